@@ -39,6 +39,8 @@
 
 #include <SparkyStudios/Audio/Amplitude/DSP/AudioConverter.h>
 #include <SparkyStudios/Audio/Amplitude/DSP/Convolver.h>
+#include <SparkyStudios/Audio/Amplitude/DSP/MultiConvolver.h>
+#include <SparkyStudios/Audio/Amplitude/DSP/TwoStageConvolver.h>
 #include <SparkyStudios/Audio/Amplitude/DSP/FFT.h>
 #include <SparkyStudios/Audio/Amplitude/DSP/Filter.h>
 #include <SparkyStudios/Audio/Amplitude/DSP/Resampler.h>
@@ -46,6 +48,7 @@
 
 #include <SparkyStudios/Audio/Amplitude/HRTF/HRIRSphere.h>
 
+#include <SparkyStudios/Audio/Amplitude/IO/CachedFileSystem.h>
 #include <SparkyStudios/Audio/Amplitude/IO/DiskFile.h>
 #include <SparkyStudios/Audio/Amplitude/IO/DiskFileSystem.h>
 #include <SparkyStudios/Audio/Amplitude/IO/File.h>
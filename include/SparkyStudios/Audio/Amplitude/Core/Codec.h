@@ -207,6 +207,42 @@ namespace SparkyStudios::Audio::Amplitude
             const Codec* m_codec;
         };
 
+        /**
+         * @brief A magic number identifying the files handled by a codec.
+         *
+         * The signature is matched against the first bytes of a file. Bytes for which the
+         * mask is `0` are ignored, which allows signatures to skip variable fields.
+         */
+        struct AM_API_PUBLIC FileSignature
+        {
+            /**
+             * @brief The expected bytes at the beginning of the file.
+             */
+            std::vector<AmUInt8> m_Bytes;
+
+            /**
+             * @brief The mask applied to the file bytes before the comparison.
+             *
+             * When empty, all the bytes of the signature are compared.
+             */
+            std::vector<AmUInt8> m_Mask;
+
+            /**
+             * @brief Checks if the given file header matches this signature.
+             *
+             * @param[in] header The first bytes of the file.
+             * @param[in] size The number of bytes in the header.
+             *
+             * @return `true` if the header matches this signature, `false` otherwise.
+             */
+            [[nodiscard]] bool Matches(AmConstUInt8Buffer header, AmSize size) const;
+        };
+
+        /**
+         * @brief The maximum size in bytes of a file signature.
+         */
+        static constexpr AmSize kMaxFileSignatureSize = 32;
+
         /**
          * @brief Create a new Codec instance.
          *
@@ -264,6 +300,20 @@ namespace SparkyStudios::Audio::Amplitude
          */
         [[nodiscard]] const AmString& GetName() const;
 
+        /**
+         * @brief Gets the file extensions handled by this codec.
+         *
+         * @return The lower-case file extensions, without the leading dot.
+         */
+        [[nodiscard]] const std::vector<AmString>& GetFileExtensions() const;
+
+        /**
+         * @brief Gets the file signatures handled by this codec.
+         *
+         * @return The file signatures handled by this codec.
+         */
+        [[nodiscard]] const std::vector<FileSignature>& GetFileSignatures() const;
+
         /**
          * @brief Registers a new audio codec.
          *
@@ -290,6 +340,10 @@ namespace SparkyStudios::Audio::Amplitude
         /**
          * @brief Finds the codec which can handle the given file.
          *
+         * The file header is read once, and matched against the signatures of the registered codecs.
+         * When several codecs match, or when no signature matches, the file extension is used to pick
+         * the codec. Codecs are probed with `CanHandleFile()` only when both lookups fail.
+         *
          * @param[in] file The file to find the codec for.
          *
          * @return The codec which can handle the given file, or `nullptr` if none.
@@ -315,10 +369,59 @@ namespace SparkyStudios::Audio::Amplitude
         static void UnlockRegistry();
 
     protected:
+        /**
+         * @brief Declares a file extension handled by this codec.
+         *
+         * This is meant to be called from the codec constructor. The extension is indexed in the
+         * codecs registry, so files with that extension are routed to this codec without probing.
+         *
+         * @param[in] extension The file extension, without the leading dot. The comparison is case-insensitive.
+         */
+        void AddFileExtension(const AmString& extension);
+
+        /**
+         * @brief Declares a file signature handled by this codec.
+         *
+         * This is meant to be called from the codec constructor. The signature is indexed in the
+         * codecs registry, so files starting with that signature are routed to this codec without probing.
+         *
+         * @param[in] bytes The expected bytes at the beginning of the file. At most `kMaxFileSignatureSize` bytes.
+         * @param[in] mask The mask applied to the file bytes before the comparison. Empty to compare all the bytes.
+         */
+        void AddFileSignature(std::vector<AmUInt8> bytes, std::vector<AmUInt8> mask = {});
+
+        /**
+         * @brief Checks if the extension of the given file is one of the extensions of this codec.
+         *
+         * @param[in] file The file to check.
+         *
+         * @return `true` if the file extension is handled by this codec, `false` otherwise.
+         */
+        [[nodiscard]] bool HasFileExtension(const std::shared_ptr<File>& file) const;
+
+        /**
+         * @brief Checks if the header of the given file matches one of the signatures of this codec.
+         *
+         * @param[in] file The file to check.
+         *
+         * @return `true` if the file header matches a signature of this codec, `false` otherwise.
+         */
+        [[nodiscard]] bool HasFileSignature(const std::shared_ptr<File>& file) const;
+
         /**
          * @brief The name of this codec.
          */
         AmString m_name;
+
+        /**
+         * @brief The lower-case file extensions handled by this codec.
+         */
+        std::vector<AmString> m_fileExtensions;
+
+        /**
+         * @brief The file signatures handled by this codec.
+         */
+        std::vector<FileSignature> m_fileSignatures;
     };
 } // namespace SparkyStudios::Audio::Amplitude
 
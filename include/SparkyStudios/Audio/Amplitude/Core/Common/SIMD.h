@@ -82,7 +82,9 @@
 #define AM_SIMD_ARCH_NEON
 #endif
 
-#if defined(AM_SIMD_ARCH_AVX2) || defined(AM_SIMD_ARCH_AVX)
+// The build system defines the alignment when the kernels are also compiled for wider instruction sets
+#if defined(AM_SIMD_ALIGNMENT)
+#elif defined(AM_SIMD_ARCH_AVX2) || defined(AM_SIMD_ARCH_AVX)
 #define AM_SIMD_ALIGNMENT 32
 #elif defined(AM_SIMD_ARCH_SSE4_1) || defined(AM_SIMD_ARCH_SSSE3) || defined(AM_SIMD_ARCH_SSE3) || defined(AM_SIMD_ARCH_SSE2) || defined(AM_SIMD_ARCH_SSE1)
 #define AM_SIMD_ALIGNMENT 16
@@ -69,6 +69,93 @@ namespace SparkyStudios::Audio::Amplitude
     typedef Rtpc* RtpcHandle;
     typedef Effect* EffectHandle;
 
+    /**
+     * @brief The state of an asynchronous sound bank request.
+     *
+     * @ingroup engine
+     */
+    enum eSoundBankRequestState : AmUInt8
+    {
+        /**
+         * @brief The request is waiting to be processed.
+         */
+        eSoundBankRequestState_Pending = 0,
+
+        /**
+         * @brief The sound bank and its asset definitions are being read on a worker thread.
+         */
+        eSoundBankRequestState_Loading = 1,
+
+        /**
+         * @brief The sound bank assets are being registered in the engine, a few of them on each frame.
+         */
+        eSoundBankRequestState_Integrating = 2,
+
+        /**
+         * @brief The sound files referenced in the sound bank are being loaded on a worker thread.
+         */
+        eSoundBankRequestState_LoadingSoundFiles = 3,
+
+        /**
+         * @brief The sound bank assets are being released from the engine, a few of them on each frame.
+         */
+        eSoundBankRequestState_Unloading = 4,
+
+        /**
+         * @brief The request has been successfully completed.
+         */
+        eSoundBankRequestState_Completed = 5,
+
+        /**
+         * @brief The request has failed.
+         */
+        eSoundBankRequestState_Failed = 6,
+    };
+
+    /**
+     * @brief Tracks the progress of an asynchronous sound bank loading or unloading.
+     *
+     * Requests are created with `#!cpp Engine::LoadSoundBankAsync()` and `#!cpp Engine::UnloadSoundBankAsync()`,
+     * and are processed by the engine in the order they have been made.
+     *
+     * @ingroup engine
+     */
+    class AM_API_PUBLIC SoundBankRequest
+    {
+    public:
+        virtual ~SoundBankRequest() = default;
+
+        /**
+         * @brief Gets the current state of the request.
+         *
+         * @return The request state.
+         */
+        [[nodiscard]] virtual eSoundBankRequestState GetState() const = 0;
+
+        /**
+         * @brief Gets the progress of the request.
+         *
+         * @return The progress of the request, between `0` and `1`.
+         */
+        [[nodiscard]] virtual AmReal32 GetProgress() const = 0;
+
+        /**
+         * @brief Checks if the request has been completed, whether it succeeded or not.
+         *
+         * @return `true` if the request is done, `false` otherwise.
+         */
+        [[nodiscard]] virtual bool IsDone() const = 0;
+
+        /**
+         * @brief Gets the ID of the sound bank targeted by this request.
+         *
+         * @return The sound bank ID, or `kAmInvalidObjectId` if it is not known yet.
+         */
+        [[nodiscard]] virtual AmBankID GetSoundBankId() const = 0;
+    };
+
+    typedef std::shared_ptr<SoundBankRequest> SoundBankRequestHandle;
+
     /**
      * @brief The Amplitude Engine.
      *
@@ -348,9 +435,53 @@ namespace SparkyStudios::Audio::Amplitude
          */
         virtual bool LoadSoundBankFromMemoryView(AmVoidPtr ptr, AmSize size, AmBankID& outID) = 0;
 
+        /**
+         * @brief Loads a sound bank from a binary asset file (`.ambank`) without blocking the calling thread.
+         *
+         * The sound bank and its asset definitions are read on a worker thread. The assets are then
+         * registered in the engine during the next frames, without spending more than the configured
+         * time budget on each frame. Finally, the sound files referenced in the sound bank are loaded
+         * on a worker thread.
+         *
+         * @param[in] filename The path to the sound bank asset file.
+         *
+         * @note Unloading the sound bank with @ref UnloadSoundBank `UnloadSoundBank()` before the request is done
+         * blocks until the request completes. Use @ref UnloadSoundBankAsync `UnloadSoundBankAsync()` instead, which
+         * waits for it without blocking.
+         *
+         * @return A handle to the request, which can be used to track its progress.
+         */
+        virtual SoundBankRequestHandle LoadSoundBankAsync(const AmOsString& filename) = 0;
+
+        /**
+         * @brief Unloads a sound bank given its filename, without blocking the calling thread.
+         *
+         * The sound bank assets are released from the engine during the next frames, without spending
+         * more than the configured time budget on each frame.
+         *
+         * @param[in] filename The file to unload.
+         *
+         * @return A handle to the request, which can be used to track its progress.
+         */
+        virtual SoundBankRequestHandle UnloadSoundBankAsync(const AmOsString& filename) = 0;
+
+        /**
+         * @brief Unloads a sound bank given its ID, without blocking the calling thread.
+         *
+         * The sound bank assets are released from the engine during the next frames, without spending
+         * more than the configured time budget on each frame.
+         *
+         * @param[in] id The sound bank id to unload.
+         *
+         * @return A handle to the request, which can be used to track its progress.
+         */
+        virtual SoundBankRequestHandle UnloadSoundBankAsync(AmBankID id) = 0;
+
         /**
          * @brief Unloads a sound bank given its filename.
          *
+         * The pending asynchronous requests targeting the sound bank are completed first.
+         *
          * @param[in] filename The file to unload.
          */
         virtual void UnloadSoundBank(const AmOsString& filename) = 0;
@@ -358,6 +489,8 @@ namespace SparkyStudios::Audio::Amplitude
         /**
          * @brief Unloads a sound bank given its ID.
          *
+         * The pending asynchronous requests targeting the sound bank are completed first.
+         *
          * @param[in] id The sound bank id to unload.
          */
         virtual void UnloadSoundBank(AmBankID id) = 0;
@@ -186,6 +186,8 @@ namespace SparkyStudios::Audio::Amplitude
 
             /**
              * @brief Makes the calling thread wait for this task to finish.
+             *
+             * Returns immediately if the task has already finished.
              */
             void Await();
 
@@ -193,12 +195,15 @@ namespace SparkyStudios::Audio::Amplitude
              * @brief Makes the calling thread wait for this task to finish.
              *
              * @param[in] duration The maximum amount of time to wait in milliseconds.
+             *
+             * @return `true` if the task has finished, `false` if the wait timed out.
              */
             bool Await(AmUInt64 duration);
 
         private:
             std::condition_variable _condition;
             std::mutex _mutex;
+            bool _done;
         };
 
         /**
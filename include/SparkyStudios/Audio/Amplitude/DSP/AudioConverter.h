@@ -58,6 +58,11 @@ namespace SparkyStudios::Audio::Amplitude
              * @brief The destination channel count.
              */
             AmUInt16 m_targetChannelCount;
+
+            /**
+             * @brief The name of the resampler to use. The default resampler is used when empty.
+             */
+            AmString m_resampler;
         };
 
         /**
@@ -73,6 +78,8 @@ namespace SparkyStudios::Audio::Amplitude
         /**
          * @brief Initializes the audio converter with the given conversion settings.
          *
+         * If the settings request a different resampler than the current one, the resampler is replaced.
+         *
          * @param[in] settings The conversion settings.
          *
          * @return `true` if the initialization was successful, `false` otherwise.
@@ -163,6 +170,7 @@ namespace SparkyStudios::Audio::Amplitude
         static void ConvertMonoFromStereo(const AudioBuffer& input, AudioBuffer& output);
 
         ResamplerInstance* _resampler;
+        AmString _resamplerName;
         ChannelConversionMode _channelConversionMode;
 
         bool _needResampling;
@@ -23,6 +23,47 @@
 
 namespace SparkyStudios::Audio::Amplitude
 {
+    /**
+     * @brief The available FFT implementations.
+     *
+     * @ingroup dsp
+     */
+    enum eFFTBackend : AmUInt8
+    {
+        /**
+         * @brief Uses the backend set with @ref FFT::SetDefaultBackend `FFT::SetDefaultBackend()`.
+         */
+        eFFTBackend_Default = 0,
+
+        /**
+         * @brief The Pretty Fast FFT library, using SIMD instructions when available.
+         *
+         * This backend only supports sizes which are multiples of 32. Smaller sizes use the
+         * Ooura backend instead.
+         */
+        eFFTBackend_PFFFT = 1,
+
+        /**
+         * @brief The portable radix-4 routines by Takuya Ooura.
+         */
+        eFFTBackend_Ooura = 2,
+
+        /**
+         * @brief The Intel Integrated Performance Primitives. Only available when built with `AM_FFT_INTEL_IPP`.
+         */
+        eFFTBackend_IntelIPP = 3,
+
+        /**
+         * @brief The Apple Accelerate framework. Only available on Apple platforms.
+         */
+        eFFTBackend_AppleAccelerate = 4,
+
+        /**
+         * @brief The FFTW3 library. Only available when built with `AM_FFT_FFTW3`.
+         */
+        eFFTBackend_FFTW3 = 5,
+    };
+
     /**
      * @brief The Fast Fourier Transform (FFT) class.
      *
@@ -48,11 +89,63 @@ namespace SparkyStudios::Audio::Amplitude
          */
         static AmUInt64 GetOutputSize(AmUInt64 inputSize);
 
+        /**
+         * @brief Checks whether the given backend is built in.
+         *
+         * @param[in] backend The backend to check.
+         *
+         * @return `true` if the backend can be used, `false` otherwise.
+         */
+        static bool IsBackendAvailable(eFFTBackend backend);
+
+        /**
+         * @brief Sets the backend used by FFT instances created with @ref eFFTBackend_Default.
+         *
+         * Instances already created keep their backend.
+         *
+         * @param[in] backend The backend to use by default. If the backend is not available,
+         * the default backend is not changed.
+         *
+         * @return `true` if the default backend has been changed, `false` otherwise.
+         */
+        static bool SetDefaultBackend(eFFTBackend backend);
+
+        /**
+         * @brief Gets the backend used by FFT instances created with @ref eFFTBackend_Default.
+         *
+         * Unless changed at runtime, this is the backend selected at build time with the
+         * `AM_FFT_BACKEND` CMake option.
+         *
+         * @return The default backend.
+         */
+        static eFFTBackend GetDefaultBackend();
+
+        /**
+         * @brief Releases the FFT plans no longer used by any instance.
+         *
+         * Twiddle factors and backend plans are computed once per size and backend, and shared by
+         * all the instances initialized with that size. They are kept in a process-wide cache, so
+         * reinitializing an FFT with a previously used size is cheap. Call this method to free the
+         * plans of sizes that are no longer needed.
+         *
+         * @return The number of released plans.
+         */
+        static AmSize ReleaseUnusedPlans();
+
         /**
          * @brief The default constructor.
+         *
+         * Creates an FFT instance using the default backend.
          */
         FFT();
 
+        /**
+         * @brief Creates an FFT instance using the given backend.
+         *
+         * @param[in] backend The backend to use. If the backend is not available, the default backend is used.
+         */
+        explicit FFT(eFFTBackend backend);
+
         FFT(const FFT&) = delete;
         FFT& operator=(const FFT&) = delete;
 
@@ -88,6 +181,16 @@ namespace SparkyStudios::Audio::Amplitude
          */
         void Backward(AmReal32* output, SplitComplex& splitComplex) const;
 
+        /**
+         * @brief Gets the backend performing the transforms.
+         *
+         * This may differ from the requested backend when it does not support the size
+         * given to @ref Initialize `Initialize()`.
+         *
+         * @return The backend performing the transforms.
+         */
+        [[nodiscard]] eFFTBackend GetBackend() const;
+
     private:
         /**
          * @brief The FFT platform-optimized implementation.
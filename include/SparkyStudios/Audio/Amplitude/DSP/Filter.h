@@ -90,11 +90,17 @@ namespace SparkyStudios::Audio::Amplitude
         /**
          * @brief Executes the filter instance on a single channel of the given buffer.
          *
+         * This is the main processing kernel of a filter, and should be implemented by filters
+         * to process the whole block at once. The default implementation calls
+         * @ref ProcessSample `ProcessSample()` for each sample, which prevents most optimizations.
+         *
          * @param[in] in The input buffer on which the filter should be applied.
          * @param[out] out The output buffer where the filtered output will be stored.
          * @param[in] channel The index of the channel to process.
          * @param[in] frames The number of frames to process.
          * @param[in] sampleRate The current sample rate of the `buffer`.
+         *
+         * @see SampleFilterInstance
          */
         virtual void ProcessChannel(const AudioBuffer& in, AudioBuffer& out, AmUInt16 channel, AmUInt64 frames, AmUInt32 sampleRate);
 
@@ -104,6 +110,9 @@ namespace SparkyStudios::Audio::Amplitude
          * @param sample The audio sample to process.
          * @param channel The index of the channel to process.
          * @param sampleRate The current sample rate of the `buffer`.
+         *
+         * @note This method is only called by the default @ref ProcessChannel `ProcessChannel()` implementation.
+         * Prefer inheriting from @ref SampleFilterInstance `SampleFilterInstance` to keep a per-sample implementation.
          */
         virtual AmAudioSample ProcessSample(AmAudioSample sample, AmUInt16 channel, AmUInt32 sampleRate);
 
@@ -128,6 +137,64 @@ namespace SparkyStudios::Audio::Amplitude
         AmReal32* m_parameters;
     };
 
+    /**
+     * @brief Helper base class for filter instances implemented one sample at a time.
+     *
+     * The derived class overrides @ref FilterInstance::ProcessSample `ProcessSample()`, and this class provides the
+     * block processing loop. The derived method is called with static binding, so the compiler can inline it in
+     * the loop instead of making a virtual call for every sample.
+     *
+     * @code
+     * class MyFilterInstance final : public SampleFilterInstance<MyFilterInstance>
+     * {
+     *     friend class SampleFilterInstance<MyFilterInstance>;
+     *
+     * public:
+     *     explicit MyFilterInstance(MyFilter* parent)
+     *         : SampleFilterInstance(parent)
+     *     {}
+     *
+     * protected:
+     *     AmAudioSample ProcessSample(AmAudioSample sample, AmUInt16 channel, AmUInt32 sampleRate) final
+     *     {
+     *         return sample * 0.5f;
+     *     }
+     * };
+     * @endcode
+     *
+     * @tparam TFilterInstance The type of the derived filter instance.
+     *
+     * @ingroup dsp
+     */
+    template<class TFilterInstance>
+    class SampleFilterInstance : public FilterInstance
+    {
+    public:
+        /**
+         * @brief Constructs a new `SampleFilterInstance` object.
+         *
+         * @param[in] parent The parent `Filter` object that created this instance.
+         */
+        explicit SampleFilterInstance(Filter* parent)
+            : FilterInstance(parent)
+        {}
+
+    protected:
+        /**
+         * @inherit
+         */
+        void ProcessChannel(const AudioBuffer& in, AudioBuffer& out, AmUInt16 channel, AmUInt64 frames, AmUInt32 sampleRate) override
+        {
+            auto* self = static_cast<TFilterInstance*>(this);
+
+            const AmAudioSample* input = in[channel].begin();
+            AmAudioSample* output = out[channel].begin();
+
+            for (AmUInt64 i = 0; i < frames; ++i)
+                output[i] = self->TFilterInstance::ProcessSample(input[i], channel, sampleRate);
+        }
+    };
+
     /**
      * @brief Base class to manage filters.
      *
@@ -0,0 +1,174 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Based on the code from https://github.com/HiFi-LoFi/FFTConvolver
+// Copyright (c) 2017 HiFi-LoFi, MIT License
+
+#pragma once
+
+#ifndef _AM_DSP_MULTI_CONVOLVER_H
+#define _AM_DSP_MULTI_CONVOLVER_H
+
+#include <SparkyStudios/Audio/Amplitude/Core/Common.h>
+
+#include <SparkyStudios/Audio/Amplitude/DSP/FFT.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    /**
+     * @brief Implementation of a partitioned FFT convolution algorithm with uniform block size,
+     * convolving a single input with several impulse responses.
+     *
+     * This produces the same outputs as one @ref Convolver `Convolver` per impulse response, but the
+     * forward FFT of the input and its spectrum history are computed once and shared by all the impulse
+     * responses. Only the complex multiplications and the backward FFTs are done per impulse response.
+     *
+     * This is useful when the same signal feeds several convolutions, like the left and right ear HRIRs
+     * of a binaural renderer, or the channels of a multichannel convolution reverb.
+     *
+     * @see Convolver
+     *
+     * @ingroup dsp
+     */
+    class MultiConvolver
+    {
+    public:
+        /**
+         * @brief Default constructor.
+         *
+         * Creates an uninitialized convolver.
+         */
+        MultiConvolver();
+
+        /**
+         * @brief Destructor.
+         *
+         * Destroys the convolver and frees all allocated resources.
+         */
+        virtual ~MultiConvolver();
+
+        // Prevent uncontrolled usage
+        MultiConvolver(const MultiConvolver&) = delete;
+        MultiConvolver& operator=(const MultiConvolver&) = delete;
+
+        /**
+         * @brief Initializes the convolver.
+         *
+         * @param[in] blockSize Block size internally used by the convolver (partition size)
+         * @param[in] irs The impulse responses.
+         * @param[in] irCount The number of impulse responses.
+         * @param[in] irLen Length of each impulse response.
+         *
+         * @return `true` when the convolver is successfully initialized, `false` otherwise.
+         */
+        bool Init(AmSize blockSize, const AmAudioSample* const* irs, AmSize irCount, AmSize irLen);
+
+        /**
+         * @brief Initializes the convolver from impulse responses already transformed with @ref TransformIR `TransformIR()`.
+         *
+         * This skips the forward FFTs of the impulse responses, which makes the initialization much cheaper
+         * when the same impulse responses are used by many convolvers (e.g. precomputed HRIRs).
+         *
+         * @param[in] blockSize Block size internally used by the convolver (partition size). Must be a power of two,
+         * and match the block size the impulse responses were transformed with.
+         * @param[in] spectra The transformed impulse responses.
+         * @param[in] irCount The number of impulse responses.
+         * @param[in] irLen Length of each impulse response before the transform.
+         *
+         * @return `true` when the convolver is successfully initialized, `false` otherwise.
+         */
+        bool InitFromSpectra(AmSize blockSize, const AmReal32* const* spectra, AmSize irCount, AmSize irLen);
+
+        /**
+         * @brief Convolves the the given input samples with each impulse response and immediately
+         * outputs the results.
+         *
+         * @param[in] input The input samples.
+         * @param[out] outputs The convolution results, one buffer per impulse response.
+         * @param[in] len Number of input/output samples to process.
+         */
+        void Process(const AmAudioSample* input, AmAudioSample* const* outputs, AmSize len);
+
+        /**
+         * @brief Resets the convolver state and discards the set impulse responses.
+         *
+         * The convolver will need to be @ref Init initialized again after this call.
+         */
+        void Reset();
+
+        /**
+         * @brief Gets the number of impulse responses.
+         *
+         * @return The number of impulse responses.
+         */
+        [[nodiscard]] AmSize GetIRCount() const;
+
+        /**
+         * @brief Gets the size of a single convolution segment.
+         *
+         * @return The size of a single convolution segment.
+         */
+        [[nodiscard]] AmSize GetSegmentSize() const;
+
+        /**
+         * @brief Gets the number of convolution segments.
+         *
+         * @return The number of convolution segments.
+         */
+        [[nodiscard]] AmSize GetSegmentCount() const;
+
+        /**
+         * @brief Gets the number of values in a transformed impulse response.
+         *
+         * @param[in] irLen Length of the impulse response.
+         * @param[in] blockSize The partition size. Must be a power of two.
+         *
+         * @return The number of values written by @ref TransformIR `TransformIR()`.
+         */
+        static AmSize GetSpectrumSize(AmSize irLen, AmSize blockSize);
+
+        /**
+         * @brief Transforms an impulse response into the partitions used by the convolver.
+         *
+         * Each partition holds the real parts followed by the imaginary parts of the FFT of @c blockSize
+         * samples of the impulse response, zero padded to twice the block size.
+         *
+         * @param[in] ir The impulse response.
+         * @param[in] irLen Length of the impulse response.
+         * @param[in] blockSize The partition size. Must be a power of two.
+         * @param[out] spectrum The transformed impulse response, with room for @ref GetSpectrumSize `GetSpectrumSize()` values.
+         */
+        static void TransformIR(const AmAudioSample* ir, AmSize irLen, AmSize blockSize, AmReal32* spectrum);
+
+    private:
+        AmSize _blockSize;
+        AmSize _segSize;
+        AmSize _segCount;
+        AmSize _irCount;
+        AmSize _fftComplexSize;
+        std::vector<SplitComplex*> _segments;
+        std::vector<SplitComplex*> _segmentsIR;
+        std::vector<SplitComplex*> _preMultiplied;
+        AmAlignedReal32Buffer _fftBuffer;
+        AmAlignedReal32Buffer _outputBuffer;
+        FFT _fft;
+        SplitComplex _conv;
+        AmAlignedReal32Buffer _overlap;
+        AmSize _current;
+        AmAlignedReal32Buffer _inputBuffer;
+        AmSize _inputBufferFill;
+    };
+} // namespace SparkyStudios::Audio::Amplitude
+
+#endif // _AM_DSP_MULTI_CONVOLVER_H
@@ -0,0 +1,149 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Based on the code from https://github.com/HiFi-LoFi/FFTConvolver
+// Copyright (c) 2017 HiFi-LoFi, MIT License
+
+#pragma once
+
+#ifndef _AM_DSP_TWO_STAGE_CONVOLVER_H
+#define _AM_DSP_TWO_STAGE_CONVOLVER_H
+
+#include <SparkyStudios/Audio/Amplitude/DSP/Convolver.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    /**
+     * @brief Implementation of a partitioned FFT convolution algorithm with non-uniform block sizes.
+     *
+     * The impulse response is split in three parts:
+     *
+     * - The head, convolved with small partitions of the head block size. This is the only part
+     *   contributing to the output of the current block, so the convolver stays free of latency.
+     *
+     * - The first tail block, also convolved with head-sized partitions, but whose output is only
+     *   needed when the next tail block starts. Its cost is spread across the head blocks.
+     *
+     * - The rest of the tail, convolved with large partitions of the tail block size. It is computed
+     *   once per tail block, and its result is only needed one tail block later. Its cost is spread
+     *   across the head blocks of the next tail block: the forward FFT runs in the first one, the
+     *   complex multiplications are shared between all of them, and the inverse FFT runs in the last one.
+     *
+     * This keeps the number of complex multiplications per head block low for long impulse responses,
+     * while still using small blocks for the start of the response, and without any processing peak
+     * when a tail block is complete.
+     *
+     * @ingroup dsp
+     */
+    class TwoStageConvolver
+    {
+    public:
+        /**
+         * @brief Default constructor.
+         *
+         * Creates an uninitialized convolver.
+         */
+        TwoStageConvolver();
+
+        /**
+         * @brief Destructor.
+         *
+         * Destroys the convolver and frees all allocated resources.
+         */
+        virtual ~TwoStageConvolver();
+
+        // Prevent uncontrolled usage
+        TwoStageConvolver(const TwoStageConvolver&) = delete;
+        TwoStageConvolver& operator=(const TwoStageConvolver&) = delete;
+
+        /**
+         * @brief Initializes the convolver.
+         *
+         * @param[in] headBlockSize The block size of the head partitions. This should match the
+         * size of the buffers given to @ref Process `Process()`.
+         * @param[in] tailBlockSize The block size of the tail partitions.
+         * @param[in] ir The impulse response.
+         * @param[in] irLen Length of the impulse response.
+         *
+         * @return `true` when the convolver is successfully initialized, `false` otherwise.
+         */
+        bool Init(AmSize headBlockSize, AmSize tailBlockSize, const AmAudioSample* ir, AmSize irLen);
+
+        /**
+         * @brief Convolves the the given input samples and immediately outputs the result.
+         *
+         * @param[in] input The input samples.
+         * @param[out] output The convolution result.
+         * @param[in] len Number of input/output samples to process.
+         */
+        void Process(const AmAudioSample* input, AmAudioSample* output, AmSize len);
+
+        /**
+         * @brief Resets the convolver state and discards the set impulse response.
+         *
+         * The convolver will need to be @ref Init initialized again after this call.
+         */
+        void Reset();
+
+        /**
+         * @brief Gets the block size of the head partitions.
+         *
+         * @return The block size of the head partitions.
+         */
+        [[nodiscard]] AmSize GetHeadBlockSize() const;
+
+        /**
+         * @brief Gets the block size of the tail partitions.
+         *
+         * @return The block size of the tail partitions.
+         */
+        [[nodiscard]] AmSize GetTailBlockSize() const;
+
+    private:
+        /**
+         * @brief Runs the next step of the convolution of the last complete tail block with the rest
+         * of the impulse response.
+         *
+         * This is called once per head block, and the convolution is complete after one tail block.
+         */
+        void ProcessTailStep();
+
+        AmSize _headBlockSize;
+        AmSize _tailBlockSize;
+
+        Convolver _headConvolver;
+        Convolver _tailConvolver0;
+        AmAlignedReal32Buffer _tailOutput0;
+        AmAlignedReal32Buffer _tailPrecalculated0;
+        AmAlignedReal32Buffer _tailOutput;
+        AmAlignedReal32Buffer _tailPrecalculated;
+        AmAlignedReal32Buffer _tailInput;
+        AmSize _tailInputFill;
+        AmSize _precalculatedPos;
+
+        AmSize _tailSegCount;
+        AmSize _tailStepCount;
+        AmSize _tailStep;
+        AmSize _tailCurrent;
+        std::vector<SplitComplex*> _tailSegments;
+        std::vector<SplitComplex*> _tailSegmentsIR;
+        AmAlignedReal32Buffer _tailFFTBuffer;
+        FFT _tailFFT;
+        SplitComplex _tailConv;
+        AmAlignedReal32Buffer _tailOverlap;
+        AmAlignedReal32Buffer _tailProcessingInput;
+    };
+} // namespace SparkyStudios::Audio::Amplitude
+
+#endif // _AM_DSP_TWO_STAGE_CONVOLVER_H
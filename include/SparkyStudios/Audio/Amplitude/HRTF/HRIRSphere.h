@@ -97,6 +97,20 @@ namespace SparkyStudios::Audio::Amplitude
          * @brief The number of indices in the HRIR sphere.
          */
         AmUInt32 m_IndexCount = 0;
+
+        /**
+         * @brief The block size of the HRIR spectra, or 0 if the file only stores time-domain HRIRs.
+         *
+         * Only available since version 2.
+         */
+        AmUInt32 m_BlockSize = 0;
+
+        /**
+         * @brief Whether the HRIRs are minimum-phase, with the interaural time difference stored in the vertex delays.
+         *
+         * Only available since version 3.
+         */
+        bool m_MinimumPhase = false;
     };
 
     /**
@@ -122,12 +136,26 @@ namespace SparkyStudios::Audio::Amplitude
         std::vector<AmReal32> m_RightIR;
 
         /**
-         * @brief The delay for the left ear.
+         * @brief The left HRIR partitions in the frequency domain, as computed by @c MultiConvolver::TransformIR().
+         *
+         * Empty if the HRIR sphere file doesn't store spectra.
+         */
+        std::vector<AmReal32> m_LeftSpectrum;
+
+        /**
+         * @brief The right HRIR partitions in the frequency domain, as computed by @c MultiConvolver::TransformIR().
+         *
+         * Empty if the HRIR sphere file doesn't store spectra.
+         */
+        std::vector<AmReal32> m_RightSpectrum;
+
+        /**
+         * @brief The delay for the left ear, in seconds.
          */
         AmReal32 m_LeftDelay = 0.0f;
 
         /**
-         * @brief The delay for the right ear.
+         * @brief The delay for the right ear, in seconds.
          */
         AmReal32 m_RightDelay = 0.0f;
     };
@@ -168,6 +196,28 @@ namespace SparkyStudios::Audio::Amplitude
          */
         [[nodiscard]] virtual eHRIRSphereSamplingMode GetSamplingMode() const = 0;
 
+        /**
+         * @brief Sets the resolution of the lookup grid used to sample the HRIR sphere.
+         *
+         * The lookup grid stores, for each azimuth and elevation step, the vertices and the
+         * interpolation weights of the sphere face in that direction. Sampling the sphere then
+         * becomes a table lookup followed by a blend of the HRIRs, instead of searching the face
+         * for each direction. Directions are rounded to the nearest grid step.
+         *
+         * The grid is built when the sphere is loaded, or immediately if it is already loaded.
+         *
+         * @warning This method is not thread-safe. Call it at load time, before the sphere is sampled
+         * by the binaural nodes, as rebuilding the grid replaces the one used by @ref Sample `Sample()`.
+         *
+         * @param[in] resolution The size of a grid step, in degrees. Set to 0 to disable the grid.
+         */
+        virtual void SetLookupGridResolution(AmReal32 resolution) = 0;
+
+        /**
+         * @brief Gets the resolution of the lookup grid, in degrees, or 0 if the grid is disabled.
+         */
+        [[nodiscard]] virtual AmReal32 GetLookupGridResolution() const = 0;
+
         /**
          * @brief Samples the HRIR sphere for the given direction.
          *
@@ -177,6 +227,55 @@ namespace SparkyStudios::Audio::Amplitude
          */
         virtual void Sample(const AmVec3& direction, AmReal32* leftHRIR, AmReal32* rightHRIR) const = 0;
 
+        /**
+         * @brief Gets the block size the HRIR spectra are partitioned with.
+         *
+         * @return The block size of the HRIR spectra, or 0 if the sphere doesn't store spectra.
+         */
+        [[nodiscard]] virtual AmUInt32 GetSpectrumBlockSize() const = 0;
+
+        /**
+         * @brief Gets the number of values in the HRIR spectrum of each ear.
+         *
+         * @return The size of the HRIR spectra, or 0 if the sphere doesn't store spectra.
+         */
+        [[nodiscard]] virtual AmSize GetSpectrumSize() const = 0;
+
+        /**
+         * @brief Samples the HRIR spectra for the given direction.
+         *
+         * The spectra are interpolated the same way as the HRIRs returned by @ref Sample `Sample()`. Since the
+         * FFT is linear, they can be given as is to @c MultiConvolver::InitFromSpectra() with the sphere block size.
+         *
+         * Does nothing if the sphere doesn't store spectra.
+         *
+         * @param[in] direction The sound to listener direction.
+         * @param[out] leftSpectrum The left HRIR spectrum, with room for @ref GetSpectrumSize `GetSpectrumSize()` values.
+         * @param[out] rightSpectrum The right HRIR spectrum, with room for @ref GetSpectrumSize `GetSpectrumSize()` values.
+         */
+        virtual void SampleSpectrum(const AmVec3& direction, AmReal32* leftSpectrum, AmReal32* rightSpectrum) const = 0;
+
+        /**
+         * @brief Checks whether the HRIRs are minimum-phase.
+         *
+         * Minimum-phase HRIRs don't include the interaural time difference. It must be applied
+         * separately, by delaying each ear by the value returned by @ref SampleDelay `SampleDelay()`.
+         *
+         * @return @c true if the HRIRs are minimum-phase, @c false otherwise.
+         */
+        [[nodiscard]] virtual bool IsMinimumPhase() const = 0;
+
+        /**
+         * @brief Samples the delay of each ear for the given direction.
+         *
+         * The delays are interpolated the same way as the HRIRs returned by @ref Sample `Sample()`.
+         *
+         * @param[in] direction The sound to listener direction.
+         * @param[out] leftDelay The delay of the left ear, in seconds.
+         * @param[out] rightDelay The delay of the right ear, in seconds.
+         */
+        virtual void SampleDelay(const AmVec3& direction, AmReal32& leftDelay, AmReal32& rightDelay) const = 0;
+
         virtual void Transform(const AmMat4& matrix) = 0;
 
         [[nodiscard]] virtual bool IsLoaded() const = 0;
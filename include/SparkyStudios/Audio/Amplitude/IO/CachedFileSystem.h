@@ -0,0 +1,252 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef _AM_IO_CACHED_FILESYSTEM_H
+#define _AM_IO_CACHED_FILESYSTEM_H
+
+#include <mutex>
+
+#include <SparkyStudios/Audio/Amplitude/IO/FileSystem.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    class FileBlockCache;
+    struct CachedFileCounters;
+
+    /**
+     * @brief Statistics collected by a `CachedFileSystem`.
+     *
+     * @ingroup io
+     */
+    struct AM_API_PUBLIC CachedFileSystemStatistics
+    {
+        /**
+         * @brief The number of block lookups served from the cache.
+         */
+        AmUInt64 m_Hits = 0;
+
+        /**
+         * @brief The number of block lookups that required a read from the wrapped file system.
+         */
+        AmUInt64 m_Misses = 0;
+
+        /**
+         * @brief The number of blocks loaded ahead of time, either by read-ahead or by prefetch hints.
+         */
+        AmUInt64 m_PrefetchedBlocks = 0;
+
+        /**
+         * @brief The total number of bytes read from the wrapped file system.
+         */
+        AmUInt64 m_BytesRead = 0;
+    };
+
+    /**
+     * @brief A `FileSystem` decorator that caches the content of the files opened from another `FileSystem`.
+     *
+     * Files opened for reading are split into fixed-size blocks, kept in a bounded LRU cache shared by all
+     * the files of the file system. Opening the same path again reuses the cached blocks, so assets that are
+     * read repeatedly, like short sound effects or definitions, only hit the wrapped file system once.
+     *
+     * On a cache miss, the missing block is read along with the next blocks of the file, which makes sequential
+     * reads cheap. `File::Prefetch()` can also be used to load a range of the file in the background.
+     *
+     * Files opened for writing, and memory-backed files, are returned as is.
+     *
+     * @note The `CachedFileSystem` does not own the wrapped file system, which must outlive it and the files it opens.
+     *
+     * @ingroup io
+     */
+    class AM_API_PUBLIC CachedFileSystem final : public FileSystem
+    {
+    public:
+        /**
+         * @brief Constructs a new `CachedFileSystem` instance.
+         *
+         * @param[in] fileSystem The file system to cache.
+         */
+        explicit CachedFileSystem(FileSystem* fileSystem);
+
+        /**
+         * @brief Destroys the `CachedFileSystem` instance.
+         */
+        ~CachedFileSystem() override;
+
+        /**
+         * @inherit
+         */
+        void SetBasePath(const AmOsString& basePath) override;
+
+        /**
+         * @inherit
+         */
+        [[nodiscard]] const AmOsString& GetBasePath() const override;
+
+        /**
+         * @inherit
+         */
+        [[nodiscard]] AmOsString ResolvePath(const AmOsString& path) const override;
+
+        /**
+         * @inherit
+         */
+        [[nodiscard]] bool Exists(const AmOsString& path) const override;
+
+        /**
+         * @inherit
+         */
+        [[nodiscard]] bool IsDirectory(const AmOsString& path) const override;
+
+        /**
+         * @inherit
+         */
+        [[nodiscard]] AmOsString Join(const std::vector<AmOsString>& parts) const override;
+
+        /**
+         * @inherit
+         *
+         * Files opened before the file system is opened are not cached.
+         */
+        [[nodiscard]] std::shared_ptr<File> OpenFile(const AmOsString& path, eFileOpenMode mode = eFileOpenMode_Read) const override;
+
+        /**
+         * @inherit
+         */
+        void StartOpenFileSystem() override;
+
+        /**
+         * @inherit
+         */
+        bool TryFinalizeOpenFileSystem() override;
+
+        /**
+         * @inherit
+         */
+        void StartCloseFileSystem() override;
+
+        /**
+         * @inherit
+         */
+        bool TryFinalizeCloseFileSystem() override;
+
+        /**
+         * @brief Gets the wrapped file system.
+         *
+         * @return The wrapped file system.
+         */
+        [[nodiscard]] FileSystem* GetFileSystem() const;
+
+        /**
+         * @brief Sets the size in bytes of a cached block.
+         *
+         * @param[in] blockSize The size in bytes of a cached block.
+         *
+         * @note This setting takes effect the next time the file system is opened.
+         */
+        void SetBlockSize(AmSize blockSize);
+
+        /**
+         * @brief Gets the size in bytes of a cached block.
+         *
+         * @return The size in bytes of a cached block.
+         */
+        [[nodiscard]] AmSize GetBlockSize() const;
+
+        /**
+         * @brief Sets the maximum number of blocks kept in memory.
+         *
+         * @param[in] capacity The maximum number of blocks to cache.
+         *
+         * @note This setting takes effect the next time the file system is opened.
+         */
+        void SetBlockCacheCapacity(AmSize capacity);
+
+        /**
+         * @brief Gets the maximum number of blocks kept in memory.
+         *
+         * @return The maximum number of blocks to cache.
+         */
+        [[nodiscard]] AmSize GetBlockCacheCapacity() const;
+
+        /**
+         * @brief Sets the number of blocks read after a missing block.
+         *
+         * @param[in] count The number of blocks to read ahead. Set to 0 to disable read-ahead.
+         *
+         * @note This setting takes effect the next time the file system is opened.
+         */
+        void SetReadAheadBlockCount(AmSize count);
+
+        /**
+         * @brief Gets the number of blocks read after a missing block.
+         *
+         * @return The number of blocks to read ahead.
+         */
+        [[nodiscard]] AmSize GetReadAheadBlockCount() const;
+
+        /**
+         * @brief Gets the cache statistics collected since the file system was created, or since the last reset.
+         *
+         * @return The cache statistics.
+         */
+        [[nodiscard]] CachedFileSystemStatistics GetStatistics() const;
+
+        /**
+         * @brief Resets the cache statistics.
+         */
+        void ResetStatistics();
+
+        /**
+         * @brief Removes all the blocks from the cache.
+         */
+        void ClearCache();
+
+    private:
+        /**
+         * @brief Gets the cache ID of the given file.
+         *
+         * Files with the same path and length share the same ID, and thus the same cached blocks.
+         *
+         * @internal
+         */
+        [[nodiscard]] AmUInt64 GetFileId(const std::shared_ptr<File>& file) const;
+
+        struct FileEntry
+        {
+            AmUInt64 m_Id;
+            AmSize m_Length;
+        };
+
+        FileSystem* _fileSystem;
+
+        AmSize _blockSize;
+        AmSize _blockCacheCapacity;
+        AmSize _readAheadBlockCount;
+
+        // The settings in use since the file system was opened
+        AmSize _openedBlockSize;
+        AmSize _openedReadAheadBlockCount;
+
+        std::shared_ptr<FileBlockCache> _blockCache;
+        std::shared_ptr<CachedFileCounters> _counters;
+
+        mutable std::mutex _filesMutex;
+        mutable std::unordered_map<AmOsString, FileEntry> _files;
+        mutable AmUInt64 _nextFileId;
+    };
+} // namespace SparkyStudios::Audio::Amplitude
+
+#endif // _AM_IO_CACHED_FILESYSTEM_H
@@ -17,10 +17,14 @@
 #ifndef _AM_IO_DISK_FILE_H
 #define _AM_IO_DISK_FILE_H
 
+#include <mutex>
+
 #include <SparkyStudios/Audio/Amplitude/IO/File.h>
 
 namespace SparkyStudios::Audio::Amplitude
 {
+    class FileReadScheduler;
+
     /**
      * @brief A `File` implementation that reads and writes a file on disk.
      *
@@ -71,6 +75,26 @@ namespace SparkyStudios::Audio::Amplitude
          */
         AmSize Read(AmUInt8Buffer dst, AmSize bytes) override;
 
+        /**
+         * @inherit
+         *
+         * This method uses positional reads (`pread` on POSIX, overlapped `ReadFile` on a dedicated handle on Windows), and
+         * can be called concurrently from multiple threads on the same instance.
+         */
+        AmSize ReadAt(AmSize offset, AmUInt8Buffer dst, AmSize bytes) override;
+
+        /**
+         * @inherit
+         *
+         * Requests are served by the shared I/O threads.
+         */
+        void ReadAsync(
+            AmSize offset,
+            AmSize size,
+            AmUInt8Buffer buffer,
+            FileReadCallback callback,
+            eFileReadPriority priority = eFileReadPriority_Normal) override;
+
         /**
          * @inherit
          */
@@ -115,12 +139,20 @@ namespace SparkyStudios::Audio::Amplitude
 
         /**
          * @brief Closes the file.
+         *
+         * This waits for all the pending asynchronous reads on this file to complete.
          */
         void Close();
 
     private:
         std::filesystem::path m_filePath;
         AmFileHandle m_fileHandle;
+        std::shared_ptr<FileReadScheduler> m_readScheduler;
+        std::once_flag m_readSchedulerFlag;
+
+#if defined(AM_WINDOWS_VERSION)
+        AmVoidPtr m_overlappedHandle;
+#endif
     };
 } // namespace SparkyStudios::Audio::Amplitude
 
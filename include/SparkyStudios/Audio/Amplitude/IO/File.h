@@ -18,6 +18,7 @@
 #define _AM_IO_FILE_H
 
 #include <filesystem>
+#include <functional>
 
 #include <SparkyStudios/Audio/Amplitude/Core/Common.h>
 
@@ -60,6 +61,31 @@ namespace SparkyStudios::Audio::Amplitude
         eFileSeekOrigin_End = SEEK_END,
     };
 
+    /**
+     * @brief The priority of an asynchronous read request.
+     *
+     * Pending requests with a higher priority are always served first. Streaming reads feed
+     * playing sounds, and should never wait behind bulk loads.
+     *
+     * @ingroup io
+     */
+    enum eFileReadPriority : AmUInt8
+    {
+        eFileReadPriority_Streaming = 0,
+        eFileReadPriority_Normal = 1,
+        eFileReadPriority_Bulk = 2,
+    };
+
+    /**
+     * @brief Callback invoked when an asynchronous read request completes.
+     *
+     * The callback receives the number of bytes actually read, which may be lower than the requested
+     * size when the end of the file is reached or when an error occurs.
+     *
+     * @ingroup io
+     */
+    typedef std::function<void(AmSize bytesRead)> FileReadCallback;
+
     /**
      * @brief Base class for a file in a `FileSystem`.
      *
@@ -168,6 +194,54 @@ namespace SparkyStudios::Audio::Amplitude
          */
         virtual AmSize Read(AmUInt8Buffer dst, AmSize bytes) = 0;
 
+        /**
+         * @brief Reads data from the file at the given offset, without moving the read cursor.
+         *
+         * The default implementation seeks to the given offset, reads the data, and restores the
+         * read cursor. Implementations that can do positional reads should override this method,
+         * and make it safe to call concurrently from multiple threads.
+         *
+         * @param[in] offset The offset in bytes from the beginning of the file.
+         * @param[out] dst The destination buffer of the read data.
+         * @param[in] bytes The number of bytes to read from the file.
+         *
+         * @return The number of bytes read from the file.
+         */
+        virtual AmSize ReadAt(AmSize offset, AmUInt8Buffer dst, AmSize bytes);
+
+        /**
+         * @brief Reads data from the file asynchronously, without moving the read cursor.
+         *
+         * The default implementation reads the data synchronously on the calling thread, and invokes
+         * the callback before returning. Implementations backed by an I/O scheduler return immediately,
+         * and invoke the callback from an I/O thread.
+         *
+         * The destination buffer and the file instance must stay alive until the callback is invoked.
+         *
+         * @param[in] offset The offset in bytes from the beginning of the file.
+         * @param[in] size The number of bytes to read from the file.
+         * @param[out] buffer The destination buffer of the read data.
+         * @param[in] callback The callback to invoke when the read completes.
+         * @param[in] priority The priority of the read request.
+         */
+        virtual void ReadAsync(
+            AmSize offset,
+            AmSize size,
+            AmUInt8Buffer buffer,
+            FileReadCallback callback,
+            eFileReadPriority priority = eFileReadPriority_Normal);
+
+        /**
+         * @brief Hints that the given range of the file will be read soon.
+         *
+         * Implementations may use this hint to load the data in the background, so the next reads
+         * of that range don't have to wait for it. The default implementation does nothing.
+         *
+         * @param[in] offset The offset in bytes from the beginning of the file.
+         * @param[in] size The number of bytes expected to be read.
+         */
+        virtual void Prefetch(AmSize offset, AmSize size);
+
         /**
          * @brief Writes data to the file.
          *
@@ -215,6 +289,17 @@ namespace SparkyStudios::Audio::Amplitude
          */
         virtual AmVoidPtr GetPtr();
 
+        /**
+         * @brief Checks if the file content is directly accessible in memory.
+         *
+         * When this method returns `true`, `GetPtr()` returns a pointer to the beginning of the file
+         * content, which stays valid as long as the file instance is alive. That memory must be considered
+         * read-only.
+         *
+         * @return `true` if the file content is accessible through `GetPtr()`, `false` otherwise.
+         */
+        [[nodiscard]] virtual bool IsMemoryBacked() const;
+
         /**
          * @brief Checks if the file is valid.
          *
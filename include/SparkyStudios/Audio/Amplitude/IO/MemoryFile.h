@@ -64,6 +64,11 @@ namespace SparkyStudios::Audio::Amplitude
          */
         AmSize Read(AmUInt8Buffer dst, AmSize bytes) override;
 
+        /**
+         * @inherit
+         */
+        AmSize ReadAt(AmSize offset, AmUInt8Buffer dst, AmSize bytes) override;
+
         /**
          * @inherit
          */
@@ -89,6 +94,11 @@ namespace SparkyStudios::Audio::Amplitude
          */
         AmVoidPtr GetPtr() override;
 
+        /**
+         * @inherit
+         */
+        [[nodiscard]] bool IsMemoryBacked() const override;
+
         /**
          * @inherit
          */
@@ -24,6 +24,8 @@
 
 namespace SparkyStudios::Audio::Amplitude
 {
+    class FileBlockCache;
+
     /**
      * @brief Defines the algorithms a package file can be compressed with.
      *
@@ -38,6 +40,9 @@ namespace SparkyStudios::Audio::Amplitude
 
         /**
          * @brief The package file has been compressed using ZLib.
+         *
+         * Each item is split into fixed-size blocks compressed independently, and its data starts
+         * with a table of the offsets of the compressed blocks. This allows random access into items.
          */
         ePackageFileCompressionAlgorithm_ZLib,
 
@@ -70,6 +75,8 @@ namespace SparkyStudios::Audio::Amplitude
 
         /**
          * @brief The size of the package item in bytes.
+         *
+         * @note For compressed packages, this is the size of the uncompressed item.
          */
         AmSize m_Size = 0;
     };
@@ -101,6 +108,13 @@ namespace SparkyStudios::Audio::Amplitude
          */
         ePackageFileCompressionAlgorithm m_CompressionAlgorithm = ePackageFileCompressionAlgorithm_Invalid;
 
+        /**
+         * @brief The size in bytes of the uncompressed blocks of compressed items.
+         *
+         * @note This is only used when the package file is compressed, and is available since version 2.
+         */
+        AmUInt32 m_BlockSize = 0;
+
         /**
          * @brief The description of each item in the package file.
          *
@@ -189,6 +203,54 @@ namespace SparkyStudios::Audio::Amplitude
          */
         [[nodiscard]] bool IsValid() const;
 
+        /**
+         * @brief Enables or disables memory-mapping of the package file.
+         *
+         * When enabled, the whole package file is mapped in memory when the file system is opened, and
+         * package items are read directly from the mapping. `File::GetPtr()` then returns a pointer to the
+         * item data, which allows definitions and uncompressed audio data to be used without copies.
+         *
+         * If the package file cannot be mapped, the file system falls back to positional reads.
+         *
+         * @param[in] enabled Whether to memory-map the package file.
+         *
+         * @note This setting takes effect the next time the file system is opened.
+         */
+        void SetMemoryMappingEnabled(bool enabled);
+
+        /**
+         * @brief Returns if memory-mapping of the package file is enabled.
+         *
+         * @return @c true if memory-mapping is enabled, @c false otherwise.
+         */
+        [[nodiscard]] bool IsMemoryMappingEnabled() const;
+
+        /**
+         * @brief Returns if the package file is currently memory-mapped.
+         *
+         * @return @c true if the package file is memory-mapped, @c false otherwise.
+         */
+        [[nodiscard]] bool IsMemoryMapped() const;
+
+        /**
+         * @brief Sets the maximum number of decompressed blocks kept in memory.
+         *
+         * The cache is shared by all the items of a compressed package file, and is not used
+         * when the package file is not compressed.
+         *
+         * @param[in] capacity The maximum number of decompressed blocks to cache.
+         *
+         * @note This setting takes effect the next time the file system is opened.
+         */
+        void SetBlockCacheCapacity(AmSize capacity);
+
+        /**
+         * @brief Gets the maximum number of decompressed blocks kept in memory.
+         *
+         * @return The maximum number of decompressed blocks to cache.
+         */
+        [[nodiscard]] AmSize GetBlockCacheCapacity() const;
+
     private:
         /**
          * @brief Loads the package in a background thread.
@@ -199,15 +261,33 @@ namespace SparkyStudios::Audio::Amplitude
          */
         static void LoadPackage(AmVoidPtr pParam);
 
+        /**
+         * @brief Finds the description of the package item at the given path.
+         *
+         * @param[in] path The path of the item in the package.
+         *
+         * @return The item description, or @c nullptr if no item matches the given path.
+         *
+         * @internal
+         */
+        [[nodiscard]] const PackageFileItemDescription* FindItem(const AmOsString& path) const;
+
         std::filesystem::path _packagePath;
-        AmUniquePtr<eMemoryPoolKind_IO, DiskFile> _packageFile;
+        std::shared_ptr<DiskFile> _packageFile;
+        std::shared_ptr<const AmUInt8> _packageData;
+        std::shared_ptr<FileBlockCache> _blockCache;
+        AmSize _blockCacheCapacity;
 
         AmThreadHandle _loadingThreadHandle;
         mutable bool _initialized;
         bool _valid;
+        bool _memoryMappingEnabled;
 
         PackageFileHeaderDescription _header;
         AmSize _headerSize;
+        AmSize _packageSize;
+
+        std::unordered_map<AmOsString, AmSize> _itemsIndex;
     };
 } // namespace SparkyStudios::Audio::Amplitude
 
@@ -22,22 +22,69 @@
 
 namespace SparkyStudios::Audio::Amplitude
 {
+    class FileBlockCache;
+    class FileReadScheduler;
+
     /**
      * @brief A `File` implementation that provides access to an item in an Amplitude package file.
      *
+     * Package items are lightweight views over the package file handle shared by the `PackageFileSystem`.
+     * Each item only tracks its own read cursor, and reads data using positional reads on the shared handle,
+     * so opening an item does not open the package file again.
+     *
+     * When the package file is memory-mapped, items read directly from the mapping, and `GetPtr()` returns
+     * a pointer to the item data in the mapped memory.
+     *
+     * Items of compressed packages are split into fixed-size blocks, compressed independently. Only the blocks
+     * covering the requested range are decompressed on read, and decompressed blocks are kept in a LRU cache
+     * shared by all the items of the package, so seeking stays cheap.
+     *
+     * Positional and asynchronous reads never touch the read cursor, and can be issued from multiple threads.
+     *
      * @ingroup io
      */
-    class AM_API_PUBLIC PackageItemFile : public DiskFile
+    class AM_API_PUBLIC PackageItemFile : public File
     {
     public:
         /**
          * @brief Constructs a new `PackageItemFile` instance.
          *
-         * @param[in] item The description of the package item.
-         * @param[in] packageFile The path to the package file.
+         * @param[in] item The description of the package item. It is copied, so it may be released before the item.
+         * @param[in] packageFile The shared handle to the package file.
          * @param[in] headerSize The size of the package file header.
+         * @param[in] dataSize The number of bytes stored in the package from the item offset to the end of the file.
          */
-        PackageItemFile(const PackageFileItemDescription* item, const std::filesystem::path& packageFile, AmSize headerSize);
+        PackageItemFile(
+            const PackageFileItemDescription* item, std::shared_ptr<DiskFile> packageFile, AmSize headerSize, AmSize dataSize);
+
+        /**
+         * @brief Constructs a new `PackageItemFile` instance from a memory-mapped package file.
+         *
+         * @param[in] item The description of the package item. It is copied, so it may be released before the item.
+         * @param[in] packageData The shared memory mapping of the package file.
+         * @param[in] headerSize The size of the package file header.
+         * @param[in] dataSize The number of bytes stored in the package from the item offset to the end of the file.
+         */
+        PackageItemFile(
+            const PackageFileItemDescription* item, std::shared_ptr<const AmUInt8> packageData, AmSize headerSize, AmSize dataSize);
+
+        /**
+         * @brief Destroys the `PackageItemFile` instance.
+         *
+         * This waits for all the pending asynchronous reads on this item to complete.
+         */
+        ~PackageItemFile() override;
+
+        /**
+         * @brief Enables block decompression for this item.
+         *
+         * @param[in] algorithm The compression algorithm used by the package file.
+         * @param[in] blockSize The size in bytes of an uncompressed block.
+         * @param[in] blockCache The cache of decompressed blocks shared by the package items.
+         *
+         * @internal
+         */
+        void SetCompression(ePackageFileCompressionAlgorithm algorithm, AmSize blockSize, std::shared_ptr<FileBlockCache> blockCache);
 
         /**
          * @inherit
@@ -54,6 +101,23 @@ namespace SparkyStudios::Audio::Amplitude
          */
         AmSize Read(AmUInt8Buffer dst, AmSize bytes) override;
 
+        /**
+         * @inherit
+         */
+        AmSize ReadAt(AmSize offset, AmUInt8Buffer dst, AmSize bytes) override;
+
+        /**
+         * @inherit
+         *
+         * Requests are served by the shared I/O threads.
+         */
+        void ReadAsync(
+            AmSize offset,
+            AmSize size,
+            AmUInt8Buffer buffer,
+            FileReadCallback callback,
+            eFileReadPriority priority = eFileReadPriority_Normal) override;
+
         /**
          * @inherit
          *
@@ -76,9 +140,50 @@ namespace SparkyStudios::Audio::Amplitude
          */
         AmSize Position() override;
 
+        /**
+         * @inherit
+         *
+         * @note This returns a pointer to the item data only when the package file is memory-mapped and not compressed.
+         */
+        AmVoidPtr GetPtr() override;
+
+        /**
+         * @inherit
+         */
+        [[nodiscard]] bool IsMemoryBacked() const override;
+
+        /**
+         * @inherit
+         */
+        [[nodiscard]] bool IsValid() const override;
+
     private:
-        const PackageFileItemDescription* _description;
+        /**
+         * @brief Reads raw item data, at the given offset from the beginning of the item data.
+         *
+         * Reads are clamped to the data stored in the package.
+         */
+        AmSize ReadRaw(AmSize offset, AmUInt8Buffer dst, AmSize bytes) const;
+
+        /**
+         * @brief Gets the decompressed block at the given index, from the cache or by decompressing it.
+         */
+        std::shared_ptr<const std::vector<AmUInt8>> GetBlock(AmSize index);
+
+        PackageFileItemDescription _description;
+        std::shared_ptr<DiskFile> _packageFile;
+        std::shared_ptr<const AmUInt8> _packageData;
         AmSize _headerSize;
+        AmSize _dataSize;
+        AmSize _position;
+
+        ePackageFileCompressionAlgorithm _compression;
+        AmSize _blockSize;
+        std::vector<AmUInt64> _blockOffsets;
+        std::shared_ptr<FileBlockCache> _blockCache;
+
+        std::shared_ptr<FileReadScheduler> _readScheduler;
+        std::once_flag _readSchedulerFlag;
     };
 } // namespace SparkyStudios::Audio::Amplitude
 
@@ -17,6 +17,7 @@
 #ifndef _AM_SOUND_SOUND_BANK_H
 #define _AM_SOUND_SOUND_BANK_H
 
+#include <mutex>
 #include <queue>
 
 #include <SparkyStudios/Audio/Amplitude/Core/RefCounter.h>
@@ -26,6 +27,7 @@ namespace SparkyStudios::Audio::Amplitude
     struct SoundBankDefinition;
 
     class Engine;
+    class Sound;
 
     /**
      * @brief Amplitude Sound Bank Asset.
@@ -80,6 +82,67 @@ namespace SparkyStudios::Audio::Amplitude
          */
         void Deinitialize(Engine* engine);
 
+        /**
+         * @brief Loads the sound bank data and reads the definitions of all the packed assets,
+         * without registering them in the engine.
+         *
+         * This method only accesses the engine file system, and can be called from any thread. Once it
+         * succeeds, call @ref IntegrateNextAsset `IntegrateNextAsset()` until no asset is pending to finish
+         * the initialization.
+         *
+         * @param[in] filename The path to the sound bank file.
+         * @param[in] engine The engine instance in which the sound bank will be loaded.
+         *
+         * @return `true` when the operation succeeds, `false` otherwise.
+         *
+         * @warning This method is for internal usage only.
+         */
+        bool Prepare(const AmOsString& filename, const Engine* engine);
+
+        /**
+         * @brief Registers the next pending asset of this sound bank in the engine.
+         *
+         * @param[in] engine The engine instance in which load the sound bank.
+         *
+         * @return `true` when the operation succeeds, `false` otherwise.
+         *
+         * @warning This method is for internal usage only.
+         */
+        bool IntegrateNextAsset(const Engine* engine);
+
+        /**
+         * @brief Queues all the assets of this sound bank for deinitialization.
+         *
+         * Call @ref DeinitializeNextAsset `DeinitializeNextAsset()` until no asset is pending to finish
+         * unloading the sound bank.
+         *
+         * @warning This method is for internal usage only.
+         */
+        void BeginDeinitialize();
+
+        /**
+         * @brief Releases the next pending asset of this sound bank from the engine.
+         *
+         * @param[in] engine The engine instance from which unload the sound bank.
+         *
+         * @warning This method is for internal usage only.
+         */
+        void DeinitializeNextAsset(const Engine* engine);
+
+        /**
+         * @brief Gets the number of assets waiting to be integrated in, or released from, the engine.
+         *
+         * @return The number of pending assets.
+         */
+        [[nodiscard]] AmSize GetPendingAssetCount() const;
+
+        /**
+         * @brief Gets the total number of assets packed in this sound bank.
+         *
+         * @return The number of assets in the sound bank.
+         */
+        [[nodiscard]] AmSize GetAssetCount() const;
+
         /**
          * @brief Returns the unique ID of this SoundBank.
          *
@@ -118,16 +181,53 @@ namespace SparkyStudios::Audio::Amplitude
          */
         void LoadSoundFiles(const Engine* engine);
 
+        /**
+         * @brief Loads the next sound file referenced in the sound bank.
+         *
+         * @param[in] engine The engine instance from which load the sound file.
+         *
+         * @return `true` if a sound file has been loaded, `false` if there was no pending sound file.
+         *
+         * @warning This method is for internal usage only.
+         */
+        bool LoadNextSoundFile(const Engine* engine);
+
+        /**
+         * @brief Gets the number of sound files waiting to be loaded.
+         *
+         * @return The number of pending sound files.
+         */
+        [[nodiscard]] AmSize GetPendingSoundFileCount() const;
+
     private:
+        /**
+         * @brief An asset waiting to be integrated in, or released from, the engine.
+         */
+        struct PendingAsset
+        {
+            AmUInt8 m_Kind;
+            AmOsString m_Filename;
+            const char* m_Data;
+            std::shared_ptr<const void> m_Owner;
+        };
+
+        bool LoadSource(const AmOsString& filename, const Engine* engine);
         bool InitializeInternal(Engine* engine);
+        void QueueAssets();
+        bool ReadPendingDefinitions(const Engine* engine);
 
         RefCounter _refCounter;
         AmString _soundBankDefSource;
+        std::shared_ptr<const char> _compiledSource;
 
         AmString _name;
         AmBankID _id;
 
-        std::queue<AmSoundID> _pendingSoundsToLoad;
+        std::vector<PendingAsset> _pendingAssets;
+        AmSize _nextPendingAsset;
+
+        mutable std::mutex _pendingSoundsMutex;
+        std::queue<Sound*> _pendingSoundsToLoad;
     };
 
 } // namespace SparkyStudios::Audio::Amplitude
@@ -16,6 +16,7 @@
 
 #include <Ambisonics/AmbisonicBinauralizer.h>
 #include <Ambisonics/AmbisonicSource.h>
+#include <DSP/ImpulseResponse.h>
 #include <Utils/Utils.h>
 
 namespace SparkyStudios::Audio::Amplitude
@@ -41,9 +42,43 @@ namespace SparkyStudios::Audio::Amplitude
         SetUpSpeakers();
         const AmUInt32 nSpeakers = _decoder.GetSpeakerCount();
 
+        // Minimum-phase HRIRs don't include the interaural time difference, so each speaker HRIR
+        // is delayed before being accumulated, which makes the accumulated HRIRs longer
+        const bool minimumPhase = _hrir->IsMinimumPhase();
+        std::vector<std::pair<AmReal32, AmReal32>> delays(minimumPhase ? nSpeakers : 0);
+        AmSize filterLength = hrirLength;
+
+        for (AmUInt32 i = 0; i < delays.size(); i++)
+        {
+            auto& [leftDelay, rightDelay] = delays[i];
+            _hrir->SampleDelay(_decoder.GetSpeakerPosition(i).ToCartesian(), leftDelay, rightDelay);
+
+            leftDelay *= static_cast<AmReal32>(_hrir->GetSampleRate());
+            rightDelay *= static_cast<AmReal32>(_hrir->GetSampleRate());
+
+            filterLength = AM_MAX(filterLength, ImpulseResponse::GetDelayedLength(hrirLength, AM_MAX(leftDelay, rightDelay)));
+        }
+
         // Setup left and right accumulated HRTFs
-        _accumulatedHRIR[0] = AudioBuffer(hrirLength, m_channelCount);
-        _accumulatedHRIR[1] = AudioBuffer(hrirLength, m_channelCount);
+        _accumulatedHRIR[0] = AudioBuffer(filterLength, m_channelCount);
+        _accumulatedHRIR[1] = AudioBuffer(filterLength, m_channelCount);
+
+        // When the sphere stores the HRIR spectra, accumulate them too, so the convolvers don't need to transform the HRIRs.
+        // The spectra of minimum-phase HRIRs are ignored, since they don't include the delays.
+        const AmUInt32 spectrumBlockSize = _hrir->GetSpectrumBlockSize();
+        const AmSize spectrumSize = minimumPhase ? 0 : _hrir->GetSpectrumSize();
+
+        AudioBuffer accumulatedSpectrum[2];
+        AmAlignedReal32Buffer spectrum[2];
+
+        if (spectrumSize > 0)
+        {
+            accumulatedSpectrum[0] = AudioBuffer(spectrumSize, m_channelCount);
+            accumulatedSpectrum[1] = AudioBuffer(spectrumSize, m_channelCount);
+
+            spectrum[0].Resize(spectrumSize, true);
+            spectrum[1].Resize(spectrumSize, true);
+        }
 
         // Sample HRIR values for each speaker
         {
@@ -51,6 +86,10 @@ namespace SparkyStudios::Audio::Amplitude
             hrir[0].Resize(hrirLength, true);
             hrir[1].Resize(hrirLength, true);
 
+            AmAlignedReal32Buffer delayed[2];
+            delayed[0].Resize(filterLength, true);
+            delayed[1].Resize(filterLength, true);
+
             for (AmUInt32 c = 0; c < m_channelCount; c++)
             {
                 auto& leftChannel = _accumulatedHRIR[0][c];
@@ -66,14 +105,34 @@ namespace SparkyStudios::Audio::Amplitude
 
                     _hrir->Sample(position.ToCartesian(), hrir[0].GetBuffer(), hrir[1].GetBuffer());
 
+                    const AmReal32* left = hrir[0].GetBuffer();
+                    const AmReal32* right = hrir[1].GetBuffer();
+
+                    if (minimumPhase)
+                    {
+                        ImpulseResponse::ApplyFractionalDelay(left, hrirLength, delays[i].first, delayed[0].GetBuffer(), filterLength);
+                        ImpulseResponse::ApplyFractionalDelay(right, hrirLength, delays[i].second, delayed[1].GetBuffer(), filterLength);
+
+                        left = delayed[0].GetBuffer();
+                        right = delayed[1].GetBuffer();
+                    }
+
                     // Scale the HRTFs by the coefficient of the current channel/component
                     // The spherical harmonic coefficients are multiplied by (2*order + 1) to provide the correct decoder
                     // for SN3D normalized Ambisonic inputs.
                     const AmReal32 coefficient =
                         _decoder.GetSpeakerCoefficient(i, c) * (2.f * std::floor(std::sqrt(static_cast<AmReal32>(c))) + 1.f);
 
-                    ScalarMultiplyAccumulate(hrir[0].GetBuffer(), leftChannel.begin(), coefficient, hrirLength);
-                    ScalarMultiplyAccumulate(hrir[1].GetBuffer(), rightChannel.begin(), coefficient, hrirLength);
+                    ScalarMultiplyAccumulate(left, leftChannel.begin(), coefficient, filterLength);
+                    ScalarMultiplyAccumulate(right, rightChannel.begin(), coefficient, filterLength);
+
+                    if (spectrumSize == 0)
+                        continue;
+
+                    _hrir->SampleSpectrum(position.ToCartesian(), spectrum[0].GetBuffer(), spectrum[1].GetBuffer());
+
+                    ScalarMultiplyAccumulate(spectrum[0].GetBuffer(), accumulatedSpectrum[0][c].begin(), coefficient, spectrumSize);
+                    ScalarMultiplyAccumulate(spectrum[1].GetBuffer(), accumulatedSpectrum[1][c].begin(), coefficient, spectrumSize);
                 }
             }
         }
@@ -88,15 +147,15 @@ namespace SparkyStudios::Audio::Amplitude
             source.SetPosition(position90);
 
             AmAlignedReal32Buffer rightEar90;
-            rightEar90.Resize(hrirLength, true);
+            rightEar90.Resize(filterLength, true);
 
             for (AmUInt32 c = 0; c < m_channelCount; c++)
             {
                 const auto& accumulatedHRIRChannel = _accumulatedHRIR[0][c];
-                ScalarMultiplyAccumulate(accumulatedHRIRChannel.begin(), rightEar90.GetBuffer(), source.GetCoefficient(c), hrirLength);
+                ScalarMultiplyAccumulate(accumulatedHRIRChannel.begin(), rightEar90.GetBuffer(), source.GetCoefficient(c), filterLength);
             }
 
-            for (AmUInt32 i = 0; i < hrirLength; i++)
+            for (AmUInt32 i = 0; i < filterLength; i++)
             {
                 const AmReal32 val = std::fabs(rightEar90[i]);
                 max = AM_MAX(val, max);
@@ -109,10 +168,25 @@ namespace SparkyStudios::Audio::Amplitude
         _accumulatedHRIR[0] *= scaler;
         _accumulatedHRIR[1] *= scaler;
 
+        if (spectrumSize > 0)
+        {
+            // The FFT is linear, so the accumulated spectra are the spectra of the accumulated HRIRs
+            accumulatedSpectrum[0] *= scaler;
+            accumulatedSpectrum[1] *= scaler;
+
+            for (AmUInt32 c = 0; c < m_channelCount; c++)
+            {
+                const AmReal32* spectra[2] = { accumulatedSpectrum[0][c].begin(), accumulatedSpectrum[1][c].begin() };
+                _conv[c].InitFromSpectra(spectrumBlockSize, spectra, 2, hrirLength);
+            }
+
+            return true;
+        }
+
         for (AmUInt32 c = 0; c < m_channelCount; c++)
         {
-            _convL[c].Init(_hrir->GetIRLength(), _accumulatedHRIR[0][c].begin(), _hrir->GetIRLength());
-            _convR[c].Init(_hrir->GetIRLength(), _accumulatedHRIR[1][c].begin(), _hrir->GetIRLength());
+            const AmAudioSample* irs[2] = { _accumulatedHRIR[0][c].begin(), _accumulatedHRIR[1][c].begin() };
+            _conv[c].Init(filterLength, irs, 2, filterLength);
         }
 
         return true;
@@ -126,22 +200,26 @@ namespace SparkyStudios::Audio::Amplitude
 
     void AmbisonicBinauralizer::Process(BFormat* input, AmUInt32 samples, AudioBuffer& output)
     {
-        AudioBuffer scratch(samples, 2);
-        auto& scratchL = scratch[0];
-        auto& scratchR = scratch[1];
+        if (_scratch.GetFrameCount() < samples)
+            _scratch = AudioBuffer(samples, 2);
+
+        auto& scratchL = _scratch[0];
+        auto& scratchR = _scratch[1];
 
         auto& outputL = output[0];
         auto& outputR = output[1];
 
+        // Both ears are convolved from the same input spectrum
+        AmAudioSample* outputs[2] = { scratchL.begin(), scratchR.begin() };
+
         for (AmUInt32 c = 0; c < m_channelCount; ++c)
         {
             const auto& inputChannel = input->GetBufferChannel(c);
 
-            _convL[c].Process(inputChannel.begin(), scratchL.begin(), samples);
-            _convR[c].Process(inputChannel.begin(), scratchR.begin(), samples);
+            _conv[c].Process(inputChannel.begin(), outputs, samples);
 
-            outputL += scratchL;
-            outputR += scratchR;
+            GetSimdKernels().m_Add(outputL.begin(), outputL.begin(), scratchL.begin(), samples);
+            GetSimdKernels().m_Add(outputR.begin(), outputR.begin(), scratchR.begin(), samples);
         }
     }
 
@@ -17,7 +17,7 @@
 #ifndef _AM_IMPLEMENTATION_AMBISONICS_AMBISONIC_BINAURALIZER_H
 #define _AM_IMPLEMENTATION_AMBISONICS_AMBISONIC_BINAURALIZER_H
 
-#include <SparkyStudios/Audio/Amplitude/DSP/Convolver.h>
+#include <SparkyStudios/Audio/Amplitude/DSP/MultiConvolver.h>
 
 #include <Ambisonics/AmbisonicDecoder.h>
 #include <Ambisonics/BFormat.h>
@@ -41,7 +41,7 @@ namespace SparkyStudios::Audio::Amplitude
          *
          * @param input The input audio samples in B-format.
          * @param samples The number of audio samples to process.
-         * @param output The output speaker feed as audio samples.
+         * @param output The output speaker feed as audio samples. The decoded samples are added to the existing ones.
          */
         void Process(BFormat* input, AmUInt32 samples, AudioBuffer& output);
 
@@ -53,8 +53,10 @@ namespace SparkyStudios::Audio::Amplitude
         const HRIRSphere* _hrir;
         AudioBuffer _accumulatedHRIR[2];
 
-        Convolver _convL[16];
-        Convolver _convR[16];
+        MultiConvolver _conv[16];
+
+        // Convolution output of each ear, grown to the largest processed block.
+        AudioBuffer _scratch;
     };
 } // namespace SparkyStudios::Audio::Amplitude
 
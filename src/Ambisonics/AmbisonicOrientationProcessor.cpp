@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <Ambisonics/AmbisonicOrientationProcessor.h>
+#include <Utils/SimdKernels.h>
 
 #define sqrt3 std::sqrt(3.f)
 #define sqrt3_2 std::sqrt(3.f / 2.f)
@@ -23,20 +24,15 @@ namespace SparkyStudios::Audio::Amplitude
 {
     AmbisonicOrientationProcessor::AmbisonicOrientationProcessor()
         : _orientation(0, 0, 0)
-    {}
-
-    AmbisonicOrientationProcessor::~AmbisonicOrientationProcessor()
     {
-        _tempSamples.Release();
+        Refresh();
     }
 
+    AmbisonicOrientationProcessor::~AmbisonicOrientationProcessor() = default;
+
     bool AmbisonicOrientationProcessor::Configure(AmUInt32 order, bool is3D)
     {
-        if (!AmbisonicComponent::Configure(order, is3D))
-            return false;
-
-        _tempSamples.Resize(m_channelCount);
-        return true;
+        return AmbisonicComponent::Configure(order, is3D);
     }
 
     void AmbisonicOrientationProcessor::Refresh()
@@ -61,6 +57,33 @@ namespace SparkyStudios::Audio::Amplitude
         _sin3Beta = std::sin(3.0f * _orientation.GetBeta());
         _cos3Gamma = std::cos(3.0f * _orientation.GetGamma());
         _sin3Gamma = std::sin(3.0f * _orientation.GetGamma());
+
+        // Rotate the basis vectors of each band, giving the columns of the band's rotation matrix
+        AmReal32 frame[kAmMaxSupportedChannelCount];
+
+        for (AmUInt32 order = 1; order <= kAmMaxSupportedAmbisonicOrder; ++order)
+        {
+            const AmUInt32 first = order * order;
+            const AmUInt32 count = 2 * order + 1;
+
+            AmReal32* matrix = _matrices[order - 1];
+
+            for (AmUInt32 c = 0; c < count; ++c)
+            {
+                std::fill_n(frame + first, count, 0.0f);
+                frame[first + c] = 1.0f;
+
+                if (order == 1)
+                    RotateOrder1(frame);
+                else if (order == 2)
+                    RotateOrder2(frame);
+                else
+                    RotateOrder3(frame);
+
+                for (AmUInt32 r = 0; r < count; ++r)
+                    matrix[r * count + c] = frame[first + r];
+            }
+        }
     }
 
     void AmbisonicOrientationProcessor::Reset()
@@ -73,137 +96,123 @@ namespace SparkyStudios::Audio::Amplitude
         if (!m_is3D)
             return; // 3D input expected
 
-        if (m_order >= 1)
-            ProcessOrder1(input, samples);
-        if (m_order >= 2)
-            ProcessOrder2(input, samples);
-        if (m_order >= 3)
-            ProcessOrder3(input, samples);
-    }
-
-    void AmbisonicOrientationProcessor::ProcessOrder1(BFormat* input, AmUInt32 samples)
-    {
-        auto& xChannel = input->GetBufferChannel(eBFormatChannel_X);
-        auto& yChannel = input->GetBufferChannel(eBFormatChannel_Y);
-        auto& zChannel = input->GetBufferChannel(eBFormatChannel_Z);
+        const auto& kernels = GetSimdKernels();
+        AmReal32* channels[kAmMaxSimdMatrixSize];
 
-        for (AmUInt32 i = 0; i < samples; ++i)
+        for (AmUInt32 order = 1, l = AM_MIN(m_order, kAmMaxSupportedAmbisonicOrder); order <= l; ++order)
         {
-            // clang-format off
-            // Alpha rotation
-            _tempSamples[eBFormatChannel_X] = xChannel[i] * _cosAlpha + yChannel[i] * _sinAlpha;
-            _tempSamples[eBFormatChannel_Y] = yChannel[i] * _cosAlpha - xChannel[i] * _sinAlpha;
-            _tempSamples[eBFormatChannel_Z] = zChannel[i];
-
-            // Beta rotation
-            xChannel[i] = _tempSamples[eBFormatChannel_X] * _cosBeta - _tempSamples[eBFormatChannel_Z] * _sinBeta;
-            yChannel[i] = _tempSamples[eBFormatChannel_Y];
-            zChannel[i] = _tempSamples[eBFormatChannel_Z] * _cosBeta + _tempSamples[eBFormatChannel_X] * _sinBeta;
-
-            // Gamma rotation
-            _tempSamples[eBFormatChannel_X] = xChannel[i] * _cosGamma + yChannel[i] * _sinGamma;
-            _tempSamples[eBFormatChannel_Y] = yChannel[i] * _cosGamma - xChannel[i] * _sinGamma;
-            _tempSamples[eBFormatChannel_Z] = zChannel[i];
-
-            // Save results
-            xChannel[i] = _tempSamples[eBFormatChannel_X];
-            yChannel[i] = _tempSamples[eBFormatChannel_Y];
-            zChannel[i] = _tempSamples[eBFormatChannel_Z];
-            // clang-format on
+            const AmUInt32 first = order * order;
+            const AmUInt32 count = 2 * order + 1;
+
+            for (AmUInt32 c = 0; c < count; ++c)
+                channels[c] = input->GetBufferChannel(first + c).begin();
+
+            kernels.m_MatrixMultiply(channels, _matrices[order - 1], count, samples);
         }
     }
 
-    void AmbisonicOrientationProcessor::ProcessOrder2(BFormat* input, AmUInt32 samples)
+    void AmbisonicOrientationProcessor::RotateOrder1(AmReal32* frame) const
     {
-        auto& rChannel = input->GetBufferChannel(eBFormatChannel_R);
-        auto& sChannel = input->GetBufferChannel(eBFormatChannel_S);
-        auto& tChannel = input->GetBufferChannel(eBFormatChannel_T);
-        auto& uChannel = input->GetBufferChannel(eBFormatChannel_U);
-        auto& vChannel = input->GetBufferChannel(eBFormatChannel_V);
+        AmReal32 t[kAmMaxSupportedChannelCount];
+
+        // clang-format off
+        // Alpha rotation
+        t[eBFormatChannel_X] = frame[eBFormatChannel_X] * _cosAlpha + frame[eBFormatChannel_Y] * _sinAlpha;
+        t[eBFormatChannel_Y] = frame[eBFormatChannel_Y] * _cosAlpha - frame[eBFormatChannel_X] * _sinAlpha;
+        t[eBFormatChannel_Z] = frame[eBFormatChannel_Z];
+
+        // Beta rotation
+        frame[eBFormatChannel_X] = t[eBFormatChannel_X] * _cosBeta - t[eBFormatChannel_Z] * _sinBeta;
+        frame[eBFormatChannel_Y] = t[eBFormatChannel_Y];
+        frame[eBFormatChannel_Z] = t[eBFormatChannel_Z] * _cosBeta + t[eBFormatChannel_X] * _sinBeta;
+
+        // Gamma rotation
+        t[eBFormatChannel_X] = frame[eBFormatChannel_X] * _cosGamma + frame[eBFormatChannel_Y] * _sinGamma;
+        t[eBFormatChannel_Y] = frame[eBFormatChannel_Y] * _cosGamma - frame[eBFormatChannel_X] * _sinGamma;
+        t[eBFormatChannel_Z] = frame[eBFormatChannel_Z];
+
+        // Save results
+        frame[eBFormatChannel_X] = t[eBFormatChannel_X];
+        frame[eBFormatChannel_Y] = t[eBFormatChannel_Y];
+        frame[eBFormatChannel_Z] = t[eBFormatChannel_Z];
+        // clang-format on
+    }
 
-        for (AmUInt32 i = 0; i < samples; ++i)
-        {
-            // clang-format off
-            // Alpha rotation
-            _tempSamples[eBFormatChannel_R] = rChannel[i];
-            _tempSamples[eBFormatChannel_S] = sChannel[i] * _cosAlpha + tChannel[i] * _sinAlpha;
-            _tempSamples[eBFormatChannel_T] = tChannel[i] * _cosAlpha - sChannel[i] * _sinAlpha;
-            _tempSamples[eBFormatChannel_U] = uChannel[i] * _cos2Alpha + vChannel[i] * _sin2Alpha;
-            _tempSamples[eBFormatChannel_V] = vChannel[i] * _cos2Alpha - uChannel[i] * _sin2Alpha;
-
-            // Beta rotation
-            rChannel[i] = _tempSamples[eBFormatChannel_R] * (0.75f * _cosBeta + 0.25f) + _tempSamples[eBFormatChannel_U] * (0.5f * sqrt3 * std::pow(_sinBeta, 2.0f)) + _tempSamples[eBFormatChannel_S] * (sqrt3 * _sinBeta * _cosBeta);
-            sChannel[i] = _tempSamples[eBFormatChannel_S] * _cos2Beta - _tempSamples[eBFormatChannel_R] * _cosBeta * _sinBeta * sqrt3 + _tempSamples[eBFormatChannel_U] * _cosBeta * _sinBeta;
-            tChannel[i] = _tempSamples[eBFormatChannel_V] * _sinBeta - _tempSamples[eBFormatChannel_T] * _cosBeta;
-            uChannel[i] = _tempSamples[eBFormatChannel_U] * (0.25f * _cos2Beta + 0.75f) - _tempSamples[eBFormatChannel_S] * _cosBeta * _sinBeta + _tempSamples[eBFormatChannel_R] * (0.5f * sqrt3 * std::pow(_sinBeta, 2.0f));
-            vChannel[i] = _tempSamples[eBFormatChannel_V] * _cosBeta - _tempSamples[eBFormatChannel_T] * _sinBeta;
-
-            // Gamma rotation
-            _tempSamples[eBFormatChannel_R] = rChannel[i];
-            _tempSamples[eBFormatChannel_S] = sChannel[i] * _cosGamma + tChannel[i] * _sinGamma;
-            _tempSamples[eBFormatChannel_T] = tChannel[i] * _cosGamma - sChannel[i] * _sinGamma;
-            _tempSamples[eBFormatChannel_U] = uChannel[i] * _cos2Gamma + vChannel[i] * _sin2Gamma;
-            _tempSamples[eBFormatChannel_V] = vChannel[i] * _cos2Gamma - uChannel[i] * _sin2Gamma;
-
-            // Save results
-            rChannel[i] = _tempSamples[eBFormatChannel_R];
-            sChannel[i] = _tempSamples[eBFormatChannel_S];
-            tChannel[i] = _tempSamples[eBFormatChannel_T];
-            uChannel[i] = _tempSamples[eBFormatChannel_U];
-            vChannel[i] = _tempSamples[eBFormatChannel_V];
-            // clang-format on
-        }
+    void AmbisonicOrientationProcessor::RotateOrder2(AmReal32* frame) const
+    {
+        AmReal32 t[kAmMaxSupportedChannelCount];
+
+        // clang-format off
+        // Alpha rotation
+        t[eBFormatChannel_R] = frame[eBFormatChannel_R];
+        t[eBFormatChannel_S] = frame[eBFormatChannel_S] * _cosAlpha + frame[eBFormatChannel_T] * _sinAlpha;
+        t[eBFormatChannel_T] = frame[eBFormatChannel_T] * _cosAlpha - frame[eBFormatChannel_S] * _sinAlpha;
+        t[eBFormatChannel_U] = frame[eBFormatChannel_U] * _cos2Alpha + frame[eBFormatChannel_V] * _sin2Alpha;
+        t[eBFormatChannel_V] = frame[eBFormatChannel_V] * _cos2Alpha - frame[eBFormatChannel_U] * _sin2Alpha;
+
+        // Beta rotation
+        frame[eBFormatChannel_R] = t[eBFormatChannel_R] * (0.75f * _cosBeta + 0.25f) + t[eBFormatChannel_U] * (0.5f * sqrt3 * std::pow(_sinBeta, 2.0f)) + t[eBFormatChannel_S] * (sqrt3 * _sinBeta * _cosBeta);
+        frame[eBFormatChannel_S] = t[eBFormatChannel_S] * _cos2Beta - t[eBFormatChannel_R] * _cosBeta * _sinBeta * sqrt3 + t[eBFormatChannel_U] * _cosBeta * _sinBeta;
+        frame[eBFormatChannel_T] = t[eBFormatChannel_V] * _sinBeta - t[eBFormatChannel_T] * _cosBeta;
+        frame[eBFormatChannel_U] = t[eBFormatChannel_U] * (0.25f * _cos2Beta + 0.75f) - t[eBFormatChannel_S] * _cosBeta * _sinBeta + t[eBFormatChannel_R] * (0.5f * sqrt3 * std::pow(_sinBeta, 2.0f));
+        frame[eBFormatChannel_V] = t[eBFormatChannel_V] * _cosBeta - t[eBFormatChannel_T] * _sinBeta;
+
+        // Gamma rotation
+        t[eBFormatChannel_R] = frame[eBFormatChannel_R];
+        t[eBFormatChannel_S] = frame[eBFormatChannel_S] * _cosGamma + frame[eBFormatChannel_T] * _sinGamma;
+        t[eBFormatChannel_T] = frame[eBFormatChannel_T] * _cosGamma - frame[eBFormatChannel_S] * _sinGamma;
+        t[eBFormatChannel_U] = frame[eBFormatChannel_U] * _cos2Gamma + frame[eBFormatChannel_V] * _sin2Gamma;
+        t[eBFormatChannel_V] = frame[eBFormatChannel_V] * _cos2Gamma - frame[eBFormatChannel_U] * _sin2Gamma;
+
+        // Save results
+        frame[eBFormatChannel_R] = t[eBFormatChannel_R];
+        frame[eBFormatChannel_S] = t[eBFormatChannel_S];
+        frame[eBFormatChannel_T] = t[eBFormatChannel_T];
+        frame[eBFormatChannel_U] = t[eBFormatChannel_U];
+        frame[eBFormatChannel_V] = t[eBFormatChannel_V];
+        // clang-format on
     }
 
-    void AmbisonicOrientationProcessor::ProcessOrder3(BFormat* input, AmUInt32 samples)
+    void AmbisonicOrientationProcessor::RotateOrder3(AmReal32* frame) const
     {
-        auto& kChannel = input->GetBufferChannel(eBFormatChannel_K);
-        auto& lChannel = input->GetBufferChannel(eBFormatChannel_L);
-        auto& mChannel = input->GetBufferChannel(eBFormatChannel_M);
-        auto& nChannel = input->GetBufferChannel(eBFormatChannel_N);
-        auto& oChannel = input->GetBufferChannel(eBFormatChannel_O);
-        auto& pChannel = input->GetBufferChannel(eBFormatChannel_P);
-        auto& qChannel = input->GetBufferChannel(eBFormatChannel_Q);
-
-        for (AmUInt32 i = 0; i < samples; i++)
-        {
-            // clang-format off
-            // Alpha rotation
-            _tempSamples[eBFormatChannel_K] = kChannel[i];
-            _tempSamples[eBFormatChannel_L] = lChannel[i] * _cosAlpha + mChannel[i] * _sinAlpha;
-            _tempSamples[eBFormatChannel_M] = mChannel[i] * _cosAlpha - lChannel[i] * _sinAlpha;
-            _tempSamples[eBFormatChannel_N] = nChannel[i] * _cos2Alpha + oChannel[i] * _sin2Alpha;
-            _tempSamples[eBFormatChannel_O] = oChannel[i] * _cos2Alpha - nChannel[i] * _sin2Alpha;
-            _tempSamples[eBFormatChannel_P] = pChannel[i] * _cos3Alpha + qChannel[i] * _sin3Alpha;
-            _tempSamples[eBFormatChannel_Q] = qChannel[i] * _cos3Alpha - pChannel[i] * _sin3Alpha;
-
-            // Beta rotation
-            qChannel[i] = 0.125f * _tempSamples[eBFormatChannel_Q] * (5.f + 3.f * _cos2Beta) - sqrt3_2 * _tempSamples[eBFormatChannel_O] * _cosBeta * _sinBeta + 0.25f * sqrt15 * _tempSamples[eBFormatChannel_M] * powf(_sinBeta, 2.0f);
-            oChannel[i] = _tempSamples[eBFormatChannel_O] * _cos2Beta - sqrt5_2 * _tempSamples[eBFormatChannel_M] * _cosBeta * _sinBeta + sqrt3_2 * _tempSamples[eBFormatChannel_Q] * _cosBeta * _sinBeta;
-            mChannel[i] = 0.125f * _tempSamples[eBFormatChannel_M] * (3.f + 5.f * _cos2Beta) - sqrt5_2 * _tempSamples[eBFormatChannel_O] * _cosBeta * _sinBeta + 0.25f * sqrt15 * _tempSamples[eBFormatChannel_Q] * powf(_sinBeta, 2.0f);
-            kChannel[i] = 0.25f * _tempSamples[eBFormatChannel_K] * _cosBeta * (-1.f + 15.f * _cos2Beta) + 0.5f * sqrt15 * _tempSamples[eBFormatChannel_N] * _cosBeta * powf(_sinBeta, 2.f) + 0.5f * sqrt5_2 * _tempSamples[eBFormatChannel_P] * powf(_sinBeta, 3.f) + 0.125f * sqrt3_2 * _tempSamples[eBFormatChannel_L] * (_sinBeta + 5.f * _sin3Beta);
-            lChannel[i] = 0.0625f * _tempSamples[eBFormatChannel_L] * (_cosBeta + 15.f * _cos3Beta) + 0.25f * sqrt5_2 * _tempSamples[eBFormatChannel_N] * (1.f + 3.f * _cos2Beta) * _sinBeta + 0.25f * sqrt15 * _tempSamples[eBFormatChannel_P] * _cosBeta * powf(_sinBeta, 2.f) - 0.125f * sqrt3_2 * _tempSamples[eBFormatChannel_K] * (_sinBeta + 5.f * _sin3Beta);
-            nChannel[i] = 0.125f * _tempSamples[eBFormatChannel_N] * (5.f * _cosBeta + 3.f * _cos3Beta) + 0.25f * sqrt3_2 * _tempSamples[eBFormatChannel_P] * (3.f + _cos2Beta) * _sinBeta + 0.5f * sqrt15 * _tempSamples[eBFormatChannel_K] * _cosBeta * powf(_sinBeta, 2.f) + 0.125f * sqrt5_2 * _tempSamples[eBFormatChannel_L] * (_sinBeta - 3.f * _sin3Beta);
-            pChannel[i] = 0.0625f * _tempSamples[eBFormatChannel_P] * (15.f * _cosBeta + _cos3Beta) - 0.25f * sqrt3_2 * _tempSamples[eBFormatChannel_N] * (3.f + _cos2Beta) * _sinBeta + 0.25f * sqrt15 * _tempSamples[eBFormatChannel_L] * _cosBeta * powf(_sinBeta, 2.f) - 0.5f * sqrt5_2 * _tempSamples[eBFormatChannel_K] * powf(_sinBeta, 3.f);
-
-            // Gamma rotation
-            _tempSamples[eBFormatChannel_K] = kChannel[i];
-            _tempSamples[eBFormatChannel_L] = lChannel[i] * _cosGamma + mChannel[i] * _sinGamma;
-            _tempSamples[eBFormatChannel_M] = mChannel[i] * _cosGamma - lChannel[i] * _sinGamma;
-            _tempSamples[eBFormatChannel_N] = nChannel[i] * _cos2Gamma + oChannel[i] * _sin2Gamma;
-            _tempSamples[eBFormatChannel_O] = oChannel[i] * _cos2Gamma - nChannel[i] * _sin2Gamma;
-            _tempSamples[eBFormatChannel_P] = pChannel[i] * _cos3Gamma + qChannel[i] * _sin3Gamma;
-            _tempSamples[eBFormatChannel_Q] = qChannel[i] * _cos3Gamma - pChannel[i] * _sin3Gamma;
-
-            // Save results
-            kChannel[i] = _tempSamples[eBFormatChannel_K];
-            lChannel[i] = _tempSamples[eBFormatChannel_L];
-            mChannel[i] = _tempSamples[eBFormatChannel_M];
-            nChannel[i] = _tempSamples[eBFormatChannel_N];
-            oChannel[i] = _tempSamples[eBFormatChannel_O];
-            pChannel[i] = _tempSamples[eBFormatChannel_P];
-            qChannel[i] = _tempSamples[eBFormatChannel_Q];
-            // clang-format off
-        }
+        AmReal32 t[kAmMaxSupportedChannelCount];
+
+        // clang-format off
+        // Alpha rotation
+        t[eBFormatChannel_K] = frame[eBFormatChannel_K];
+        t[eBFormatChannel_L] = frame[eBFormatChannel_L] * _cosAlpha + frame[eBFormatChannel_M] * _sinAlpha;
+        t[eBFormatChannel_M] = frame[eBFormatChannel_M] * _cosAlpha - frame[eBFormatChannel_L] * _sinAlpha;
+        t[eBFormatChannel_N] = frame[eBFormatChannel_N] * _cos2Alpha + frame[eBFormatChannel_O] * _sin2Alpha;
+        t[eBFormatChannel_O] = frame[eBFormatChannel_O] * _cos2Alpha - frame[eBFormatChannel_N] * _sin2Alpha;
+        t[eBFormatChannel_P] = frame[eBFormatChannel_P] * _cos3Alpha + frame[eBFormatChannel_Q] * _sin3Alpha;
+        t[eBFormatChannel_Q] = frame[eBFormatChannel_Q] * _cos3Alpha - frame[eBFormatChannel_P] * _sin3Alpha;
+
+        // Beta rotation
+        frame[eBFormatChannel_Q] = 0.125f * t[eBFormatChannel_Q] * (5.f + 3.f * _cos2Beta) - sqrt3_2 * t[eBFormatChannel_O] * _cosBeta * _sinBeta + 0.25f * sqrt15 * t[eBFormatChannel_M] * powf(_sinBeta, 2.0f);
+        frame[eBFormatChannel_O] = t[eBFormatChannel_O] * _cos2Beta - sqrt5_2 * t[eBFormatChannel_M] * _cosBeta * _sinBeta + sqrt3_2 * t[eBFormatChannel_Q] * _cosBeta * _sinBeta;
+        frame[eBFormatChannel_M] = 0.125f * t[eBFormatChannel_M] * (3.f + 5.f * _cos2Beta) - sqrt5_2 * t[eBFormatChannel_O] * _cosBeta * _sinBeta + 0.25f * sqrt15 * t[eBFormatChannel_Q] * powf(_sinBeta, 2.0f);
+        frame[eBFormatChannel_K] = 0.25f * t[eBFormatChannel_K] * _cosBeta * (-1.f + 15.f * _cos2Beta) + 0.5f * sqrt15 * t[eBFormatChannel_N] * _cosBeta * powf(_sinBeta, 2.f) + 0.5f * sqrt5_2 * t[eBFormatChannel_P] * powf(_sinBeta, 3.f) + 0.125f * sqrt3_2 * t[eBFormatChannel_L] * (_sinBeta + 5.f * _sin3Beta);
+        frame[eBFormatChannel_L] = 0.0625f * t[eBFormatChannel_L] * (_cosBeta + 15.f * _cos3Beta) + 0.25f * sqrt5_2 * t[eBFormatChannel_N] * (1.f + 3.f * _cos2Beta) * _sinBeta + 0.25f * sqrt15 * t[eBFormatChannel_P] * _cosBeta * powf(_sinBeta, 2.f) - 0.125f * sqrt3_2 * t[eBFormatChannel_K] * (_sinBeta + 5.f * _sin3Beta);
+        frame[eBFormatChannel_N] = 0.125f * t[eBFormatChannel_N] * (5.f * _cosBeta + 3.f * _cos3Beta) + 0.25f * sqrt3_2 * t[eBFormatChannel_P] * (3.f + _cos2Beta) * _sinBeta + 0.5f * sqrt15 * t[eBFormatChannel_K] * _cosBeta * powf(_sinBeta, 2.f) + 0.125f * sqrt5_2 * t[eBFormatChannel_L] * (_sinBeta - 3.f * _sin3Beta);
+        frame[eBFormatChannel_P] = 0.0625f * t[eBFormatChannel_P] * (15.f * _cosBeta + _cos3Beta) - 0.25f * sqrt3_2 * t[eBFormatChannel_N] * (3.f + _cos2Beta) * _sinBeta + 0.25f * sqrt15 * t[eBFormatChannel_L] * _cosBeta * powf(_sinBeta, 2.f) - 0.5f * sqrt5_2 * t[eBFormatChannel_K] * powf(_sinBeta, 3.f);
+
+        // Gamma rotation
+        t[eBFormatChannel_K] = frame[eBFormatChannel_K];
+        t[eBFormatChannel_L] = frame[eBFormatChannel_L] * _cosGamma + frame[eBFormatChannel_M] * _sinGamma;
+        t[eBFormatChannel_M] = frame[eBFormatChannel_M] * _cosGamma - frame[eBFormatChannel_L] * _sinGamma;
+        t[eBFormatChannel_N] = frame[eBFormatChannel_N] * _cos2Gamma + frame[eBFormatChannel_O] * _sin2Gamma;
+        t[eBFormatChannel_O] = frame[eBFormatChannel_O] * _cos2Gamma - frame[eBFormatChannel_N] * _sin2Gamma;
+        t[eBFormatChannel_P] = frame[eBFormatChannel_P] * _cos3Gamma + frame[eBFormatChannel_Q] * _sin3Gamma;
+        t[eBFormatChannel_Q] = frame[eBFormatChannel_Q] * _cos3Gamma - frame[eBFormatChannel_P] * _sin3Gamma;
+
+        // Save results
+        frame[eBFormatChannel_K] = t[eBFormatChannel_K];
+        frame[eBFormatChannel_L] = t[eBFormatChannel_L];
+        frame[eBFormatChannel_M] = t[eBFormatChannel_M];
+        frame[eBFormatChannel_N] = t[eBFormatChannel_N];
+        frame[eBFormatChannel_O] = t[eBFormatChannel_O];
+        frame[eBFormatChannel_P] = t[eBFormatChannel_P];
+        frame[eBFormatChannel_Q] = t[eBFormatChannel_Q];
+        // clang-format on
     }
-}
+} // namespace SparkyStudios::Audio::Amplitude
@@ -23,6 +23,8 @@ namespace SparkyStudios::Audio::Amplitude
 {
     class AmbisonicOrientationProcessor : public AmbisonicComponent
     {
+        static constexpr AmUInt32 kMaxBandSize = 2 * kAmMaxSupportedAmbisonicOrder + 1;
+
     public:
         AmbisonicOrientationProcessor();
 
@@ -57,12 +59,15 @@ namespace SparkyStudios::Audio::Amplitude
         void Process(BFormat* input, AmUInt32 samples);
 
     private:
-        void ProcessOrder1(BFormat* input, AmUInt32 samples);
-        void ProcessOrder2(BFormat* input, AmUInt32 samples);
-        void ProcessOrder3(BFormat* input, AmUInt32 samples);
+        // Rotate a single frame of B-Format channels in place, used to build the rotation matrices.
+        void RotateOrder1(AmReal32* frame) const;
+        void RotateOrder2(AmReal32* frame) const;
+        void RotateOrder3(AmReal32* frame) const;
 
         Orientation _orientation;
-        AmAlignedReal32Buffer _tempSamples;
+
+        // Row-major rotation matrix of each order's channels, applied to the whole block at once.
+        AmReal32 _matrices[kAmMaxSupportedAmbisonicOrder][kMaxBandSize * kMaxBandSize];
 
         AmReal32 _cosAlpha;
         AmReal32 _sinAlpha;
@@ -42,8 +42,8 @@ namespace SparkyStudios::Audio::Amplitude
 
     void AmbisonicSpeaker::Process(BFormat* input, AmUInt32 frameCount, AudioBufferChannel& output)
     {
-        AMPLITUDE_ASSERT(output.size() == frameCount);
-        output.clear();
+        AMPLITUDE_ASSERT(output.size() >= frameCount);
+        std::fill_n(output.begin(), frameCount, 0.0f);
 
         for (AmUInt32 c = 0; c < m_channelCount; ++c)
         {
@@ -47,6 +47,12 @@ namespace SparkyStudios::Audio::Amplitude
         if (!AmbisonicComponent::Configure(order, is3D))
             return false;
 
+        if (_buffer != nullptr && _buffer->GetFrameCount() == sampleCount && _buffer->GetChannelCount() == GetChannelCount())
+        {
+            _buffer->Clear();
+            return true;
+        }
+
         if (_buffer)
             ampooldelete(eMemoryPoolKind_SoundData, AudioBuffer, _buffer);
 
@@ -61,7 +67,9 @@ namespace SparkyStudios::Audio::Amplitude
             return;
 
         auto& channelBuffer = _buffer->GetChannel(channel);
-        channelBuffer = buffer;
+
+        AMPLITUDE_ASSERT(sampleCount <= buffer.size() && sampleCount <= channelBuffer.size());
+        std::copy_n(buffer.begin(), sampleCount, channelBuffer.begin());
     }
 
     void BFormat::AddStream(const AudioBufferChannel& buffer, AmUInt32 channel, AmUInt32 sampleCount, AmUInt32 offset) const
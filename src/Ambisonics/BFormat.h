@@ -54,7 +54,10 @@ namespace SparkyStudios::Audio::Amplitude
         }
 
         /**
-         * @brief Creates internal buffers for the given values. Existing buffers will be destroyed.
+         * @brief Creates internal buffers for the given values.
+         *
+         * Existing buffers are cleared and reused when they already have the requested size,
+         * so the sound field can be reconfigured on the audio thread without allocating.
          *
          * @param order The order of the ambisonic component.
          * @param is3D Whether the ambisonic component is 3D or not (has height).
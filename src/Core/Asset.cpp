@@ -19,6 +19,11 @@
 
 namespace SparkyStudios::Audio::Amplitude
 {
+    /**
+     * @brief The minimum alignment of memory-backed definition data to be used in place.
+     */
+    static constexpr AmSize kDefinitionDataAlignment = 8;
+
     template<typename Id, typename Definition>
     AssetImpl<Id, Definition>::~AssetImpl()
     {
@@ -26,6 +31,8 @@ namespace SparkyStudios::Audio::Amplitude
 
         m_id = kAmInvalidObjectId;
         m_source.clear();
+        m_sourceData = nullptr;
+        m_sourceOwner.reset();
     }
 
     template<typename Id, typename Definition>
@@ -34,6 +41,14 @@ namespace SparkyStudios::Audio::Amplitude
         // Ensure we do not load the asset more than once
         AMPLITUDE_ASSERT(m_id == kAmInvalidObjectId);
 
+        // Use the definition in place when the file content is already in memory. Flatbuffers
+        // require their data to be suitably aligned for the scalar values they contain.
+        if (file != nullptr && file->IsValid() && file->IsMemoryBacked() && file->Length() > 0 &&
+            reinterpret_cast<AmUIntPtr>(file->GetPtr()) % kDefinitionDataAlignment == 0)
+        {
+            return LoadDefinitionFromMemory(static_cast<const char*>(file->GetPtr()), file, state);
+        }
+
         AmString source;
         if (!LoadFile(file, &source))
             return false;
@@ -52,6 +67,21 @@ namespace SparkyStudios::Audio::Amplitude
         return LoadDefinitionFromFile(fs->OpenFile(rp), state);
     }
 
+    template<typename Id, typename Definition>
+    bool AssetImpl<Id, Definition>::LoadDefinitionFromMemory(const char* data, std::shared_ptr<const void> owner, EngineInternalState* state)
+    {
+        // Ensure we do not load the asset more than once
+        AMPLITUDE_ASSERT(m_id == kAmInvalidObjectId);
+
+        if (data == nullptr)
+            return false;
+
+        m_sourceOwner = std::move(owner);
+        m_sourceData = data;
+
+        return LoadDefinition(GetDefinition(), state);
+    }
+
     template<typename Id, typename Definition>
     void AssetImpl<Id, Definition>::AcquireReferences(EngineInternalState* state)
     {}
@@ -82,6 +82,19 @@ namespace SparkyStudios::Audio::Amplitude
          */
         virtual bool LoadDefinitionFromPath(const AmOsString& path, EngineInternalState* state);
 
+        /**
+         * @brief Load the asset from definition data already in memory.
+         *
+         * The data is used in place, and must stay valid as long as the given owner is alive.
+         *
+         * @param data The asset definition data.
+         * @param owner The object owning the definition data. The asset keeps a reference to it.
+         * @param state The engine internal state.
+         *
+         * @return @c true on success, @c false otherwise.
+         */
+        virtual bool LoadDefinitionFromMemory(const char* data, std::shared_ptr<const void> owner, EngineInternalState* state);
+
         /**
          * @brief Gets the asset definition instance.
          *
@@ -126,10 +139,25 @@ namespace SparkyStudios::Audio::Amplitude
         }
 
     protected:
+        /**
+         * @brief Gets the raw definition data of the asset.
+         *
+         * The returned data either points to the definition data in memory, when the asset has been
+         * loaded from a memory-backed file or a compiled sound bank, or to a copy of the definition file content.
+         *
+         * @return The raw definition data.
+         */
+        [[nodiscard]] AM_INLINE const char* GetSource() const
+        {
+            return m_sourceData != nullptr ? m_sourceData : m_source.c_str();
+        }
+
         AmString m_name;
         AmObjectID m_id = kAmInvalidObjectId;
 
         AmString m_source;
+        std::shared_ptr<const void> m_sourceOwner;
+        const char* m_sourceData = nullptr;
         RefCounter m_refCounter;
     };
 } // namespace SparkyStudios::Audio::Amplitude
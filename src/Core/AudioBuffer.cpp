@@ -99,25 +99,7 @@ namespace SparkyStudios::Audio::Amplitude
         AMPLITUDE_ASSERT(channel._isEnabled);
         AMPLITUDE_ASSERT(_frameCount <= channel._frameCount);
 
-        AmSize remaining = _frameCount;
-
-#if defined(AM_SIMD_INTRINSICS)
-        const AmSize end = GetNumSimdChunks(_frameCount);
-        constexpr AmSize blockSize = GetSimdBlockSize();
-        remaining = remaining - end;
-
-        for (AmSize i = 0; i < end; i += blockSize)
-        {
-            const auto ba = xsimd::load_aligned<simd_arch>(_begin + i);
-            const auto bb = xsimd::load_aligned<simd_arch>(channel._begin + i);
-
-            auto res = xsimd::add(ba, bb);
-            res.store_aligned(_begin + i);
-        }
-#endif
-
-        for (AmSize i = _frameCount - remaining; i < _frameCount; i++)
-            _begin[i] += channel._begin[i];
+        GetSimdKernels().m_Add(_begin, _begin, channel._begin, _frameCount);
 
         return *this;
     }
@@ -128,25 +110,7 @@ namespace SparkyStudios::Audio::Amplitude
         AMPLITUDE_ASSERT(channel._isEnabled);
         AMPLITUDE_ASSERT(_frameCount <= channel._frameCount);
 
-        AmSize remaining = _frameCount;
-
-#if defined(AM_SIMD_INTRINSICS)
-        const AmSize end = GetNumSimdChunks(_frameCount);
-        constexpr AmSize blockSize = GetSimdBlockSize();
-        remaining = remaining - end;
-
-        for (AmSize i = 0; i < end; i += blockSize)
-        {
-            const auto ba = xsimd::load_aligned<simd_arch>(_begin + i);
-            const auto bb = xsimd::load_aligned<simd_arch>(channel._begin + i);
-
-            auto res = xsimd::sub(ba, bb);
-            res.store_aligned(_begin + i);
-        }
-#endif
-
-        for (AmSize i = _frameCount - remaining; i < _frameCount; i++)
-            _begin[i] -= channel._begin[i];
+        GetSimdKernels().m_Subtract(_begin, _begin, channel._begin, _frameCount);
 
         return *this;
     }
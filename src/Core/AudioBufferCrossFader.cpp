@@ -19,28 +19,30 @@ namespace SparkyStudios::Audio::Amplitude
 {
     AudioBufferCrossFader::AudioBufferCrossFader(AmSize sampleCount)
         : _crossFadeBuffer(sampleCount, 2)
+        , _rampLength(0)
     {
         AMPLITUDE_ASSERT(sampleCount != 0);
+        ComputeRamps(sampleCount);
+    }
 
-        auto& fadeInChannel = _crossFadeBuffer[0];
-        auto& fadeOutChannel = _crossFadeBuffer[1];
-
-        for (AmSize i = 0; i < sampleCount; ++i)
-        {
-            const float factor = static_cast<AmReal32>(i) / static_cast<AmReal32>(sampleCount);
-            fadeInChannel[i] = factor;
-            fadeOutChannel[i] = 1.0f - factor;
-        }
+    void AudioBufferCrossFader::CrossFade(const AudioBuffer& bufferIn, const AudioBuffer& bufferOut, AudioBuffer& outputBuffer)
+    {
+        CrossFade(bufferIn, bufferOut, outputBuffer, bufferIn.GetFrameCount());
     }
 
-    void AudioBufferCrossFader::CrossFade(const AudioBuffer& bufferIn, const AudioBuffer& bufferOut, AudioBuffer& outputBuffer) const
+    void AudioBufferCrossFader::CrossFade(
+        const AudioBuffer& bufferIn, const AudioBuffer& bufferOut, AudioBuffer& outputBuffer, AmSize sampleCount)
     {
         AMPLITUDE_ASSERT(&outputBuffer != &bufferIn && &outputBuffer != &bufferOut);
         AMPLITUDE_ASSERT(bufferIn.GetChannelCount() == bufferOut.GetChannelCount());
-        AMPLITUDE_ASSERT(bufferIn.GetFrameCount() == bufferOut.GetFrameCount());
+        AMPLITUDE_ASSERT(sampleCount <= bufferIn.GetFrameCount() && sampleCount <= bufferOut.GetFrameCount());
+        AMPLITUDE_ASSERT(sampleCount <= outputBuffer.GetFrameCount());
+
+        // The ramps only change when the block size does
+        if (sampleCount != _rampLength)
+            ComputeRamps(sampleCount);
 
         const AmSize channelCount = bufferIn.GetChannelCount();
-        const AmSize frameCount = bufferIn.GetFrameCount();
 
         const auto& fadeInChannel = _crossFadeBuffer[0];
         const auto& fadeOutChannel = _crossFadeBuffer[1];
@@ -51,8 +53,25 @@ namespace SparkyStudios::Audio::Amplitude
             const auto& inputChannelOut = bufferOut[channel];
             auto& outputChannel = outputBuffer[channel];
 
-            PointWiseMultiply(fadeInChannel.begin(), inputChannelIn.begin(), outputChannel.begin(), frameCount);
-            PointWiseMultiplyAccumulate(fadeOutChannel.begin(), inputChannelOut.begin(), outputChannel.begin(), frameCount);
+            PointWiseMultiply(fadeInChannel.begin(), inputChannelIn.begin(), outputChannel.begin(), sampleCount);
+            PointWiseMultiplyAccumulate(fadeOutChannel.begin(), inputChannelOut.begin(), outputChannel.begin(), sampleCount);
+        }
+    }
+
+    void AudioBufferCrossFader::ComputeRamps(AmSize sampleCount)
+    {
+        AMPLITUDE_ASSERT(sampleCount <= _crossFadeBuffer.GetFrameCount());
+
+        auto& fadeInChannel = _crossFadeBuffer[0];
+        auto& fadeOutChannel = _crossFadeBuffer[1];
+
+        for (AmSize i = 0; i < sampleCount; ++i)
+        {
+            const float factor = static_cast<AmReal32>(i) / static_cast<AmReal32>(sampleCount);
+            fadeInChannel[i] = factor;
+            fadeOutChannel[i] = 1.0f - factor;
         }
+
+        _rampLength = sampleCount;
     }
 } // namespace SparkyStudios::Audio::Amplitude
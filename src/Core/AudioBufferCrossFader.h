@@ -24,6 +24,11 @@ namespace SparkyStudios::Audio::Amplitude
     class AudioBufferCrossFader
     {
     public:
+        /**
+         * @brief Creates a cross-fader.
+         *
+         * @param sampleCount The maximum number of samples to cross-fade.
+         */
         explicit AudioBufferCrossFader(AmSize sampleCount);
 
         /**
@@ -33,10 +38,23 @@ namespace SparkyStudios::Audio::Amplitude
          * @param bufferOut The second audio buffer to cross-fade to.
          * @param outputBuffer The resulting cross-faded audio buffer.
          */
-        void CrossFade(const AudioBuffer& bufferIn, const AudioBuffer& bufferOut, AudioBuffer& outputBuffer) const;
+        void CrossFade(const AudioBuffer& bufferIn, const AudioBuffer& bufferOut, AudioBuffer& outputBuffer);
+
+        /**
+         * @brief Performs a linear cross-fading over the first samples of two audio buffers.
+         *
+         * @param bufferIn The first audio buffer to cross-fade from.
+         * @param bufferOut The second audio buffer to cross-fade to.
+         * @param outputBuffer The resulting cross-faded audio buffer.
+         * @param sampleCount The number of samples to cross-fade. Must not exceed the maximum number of samples.
+         */
+        void CrossFade(const AudioBuffer& bufferIn, const AudioBuffer& bufferOut, AudioBuffer& outputBuffer, AmSize sampleCount);
 
     private:
+        void ComputeRamps(AmSize sampleCount);
+
         AudioBuffer _crossFadeBuffer;
+        AmSize _rampLength;
     };
 } // namespace SparkyStudios::Audio::Amplitude
 
@@ -12,7 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <cctype>
 #include <map>
+#include <unordered_map>
 
 #include <SparkyStudios/Audio/Amplitude/Core/Codec.h>
 #include <SparkyStudios/Audio/Amplitude/Core/Log.h>
@@ -28,6 +31,33 @@ namespace SparkyStudios::Audio::Amplitude
         return r;
     }
 
+    /**
+     * @brief Index of the registered codecs by file extension and signature.
+     */
+    struct CodecLookupIndex
+    {
+        /**
+         * @brief Codecs by lower-case file extension.
+         */
+        std::unordered_map<AmString, std::vector<Codec*>> m_Extensions;
+
+        /**
+         * @brief Codecs and signature indices, by the first 4 bytes of the signature.
+         */
+        std::unordered_map<AmUInt32, std::vector<std::pair<Codec*, AmSize>>> m_Signatures;
+
+        /**
+         * @brief Codecs and signature indices, for signatures which cannot be keyed by their first 4 bytes.
+         */
+        std::vector<std::pair<Codec*, AmSize>> m_UnkeyedSignatures;
+    };
+
+    static CodecLookupIndex& codecLookupIndex()
+    {
+        static CodecLookupIndex i;
+        return i;
+    }
+
     static bool& lockCodecs()
     {
         static bool b = false;
@@ -40,6 +70,105 @@ namespace SparkyStudios::Audio::Amplitude
         return c;
     }
 
+    static AmString toLower(AmString value)
+    {
+        std::ranges::transform(
+            value, value.begin(),
+            [](const char c)
+            {
+                return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+            });
+
+        return value;
+    }
+
+    static AmString getFileExtension(const std::shared_ptr<File>& file)
+    {
+        const auto& extension = std::filesystem::path(file->GetPath()).extension();
+        if (extension.empty())
+            return {};
+
+        // Skip the leading dot
+        return toLower(AmString(AM_OS_STRING_TO_STRING(extension.native())).substr(1));
+    }
+
+    /**
+     * @brief Gets the key of a signature in the lookup index.
+     *
+     * @return `false` if the signature cannot be keyed by its first 4 bytes.
+     */
+    static bool getSignatureKey(const Codec::FileSignature& signature, AmUInt32& key)
+    {
+        if (signature.m_Bytes.size() < 4)
+            return false;
+
+        for (AmSize i = 0; i < 4 && !signature.m_Mask.empty(); ++i)
+            if (signature.m_Mask[i] != 0xFF)
+                return false;
+
+        std::memcpy(&key, signature.m_Bytes.data(), 4);
+        return true;
+    }
+
+    static void indexSignature(Codec* codec, AmSize index)
+    {
+        CodecLookupIndex& lookup = codecLookupIndex();
+
+        if (AmUInt32 key = 0; getSignatureKey(codec->GetFileSignatures()[index], key))
+            lookup.m_Signatures[key].emplace_back(codec, index);
+        else
+            lookup.m_UnkeyedSignatures.emplace_back(codec, index);
+    }
+
+    static void indexCodec(Codec* codec)
+    {
+        CodecLookupIndex& lookup = codecLookupIndex();
+
+        for (const auto& extension : codec->GetFileExtensions())
+            lookup.m_Extensions[extension].push_back(codec);
+
+        for (AmSize i = 0, l = codec->GetFileSignatures().size(); i < l; ++i)
+            indexSignature(codec, i);
+    }
+
+    static void unindexCodec(const Codec* codec)
+    {
+        CodecLookupIndex& lookup = codecLookupIndex();
+
+        const auto isCodec = [codec](const auto& entry)
+        {
+            return entry.first == codec;
+        };
+
+        for (auto& [_, codecs] : lookup.m_Extensions)
+            std::erase(codecs, codec);
+
+        for (auto& [_, entries] : lookup.m_Signatures)
+            std::erase_if(entries, isCodec);
+
+        std::erase_if(lookup.m_UnkeyedSignatures, isCodec);
+    }
+
+    static bool isRegistered(const Codec* codec)
+    {
+        return Codec::Find(codec->GetName()) == codec;
+    }
+
+    bool Codec::FileSignature::Matches(AmConstUInt8Buffer header, AmSize size) const
+    {
+        if (m_Bytes.empty() || size < m_Bytes.size())
+            return false;
+
+        for (AmSize i = 0, l = m_Bytes.size(); i < l; ++i)
+        {
+            const AmUInt8 mask = m_Mask.empty() ? 0xFF : m_Mask[i];
+            if ((header[i] & mask) != (m_Bytes[i] & mask))
+                return false;
+        }
+
+        return true;
+    }
+
     Codec::Decoder::Decoder(const Codec* codec)
         : m_format()
         , m_codec(codec)
@@ -76,6 +205,63 @@ namespace SparkyStudios::Audio::Amplitude
         return m_name;
     }
 
+    const std::vector<AmString>& Codec::GetFileExtensions() const
+    {
+        return m_fileExtensions;
+    }
+
+    const std::vector<Codec::FileSignature>& Codec::GetFileSignatures() const
+    {
+        return m_fileSignatures;
+    }
+
+    void Codec::AddFileExtension(const AmString& extension)
+    {
+        AmString value = toLower(extension);
+        if (!value.empty() && value[0] == '.')
+            value.erase(0, 1);
+
+        if (value.empty() || std::ranges::find(m_fileExtensions, value) != m_fileExtensions.end())
+            return;
+
+        m_fileExtensions.push_back(value);
+
+        if (isRegistered(this))
+            codecLookupIndex().m_Extensions[value].push_back(this);
+    }
+
+    void Codec::AddFileSignature(std::vector<AmUInt8> bytes, std::vector<AmUInt8> mask)
+    {
+        if (bytes.empty() || bytes.size() > kMaxFileSignatureSize || (!mask.empty() && mask.size() != bytes.size()))
+        {
+            amLogWarning("Invalid file signature for codec '%s'.", m_name.c_str());
+            return;
+        }
+
+        m_fileSignatures.push_back({ std::move(bytes), std::move(mask) });
+
+        if (isRegistered(this))
+            indexSignature(this, m_fileSignatures.size() - 1);
+    }
+
+    bool Codec::HasFileExtension(const std::shared_ptr<File>& file) const
+    {
+        return std::ranges::find(m_fileExtensions, getFileExtension(file)) != m_fileExtensions.end();
+    }
+
+    bool Codec::HasFileSignature(const std::shared_ptr<File>& file) const
+    {
+        AmUInt8 header[kMaxFileSignatureSize];
+        const AmSize size = file->ReadAt(0, header, kMaxFileSignatureSize);
+
+        return std::ranges::any_of(
+            m_fileSignatures,
+            [&](const FileSignature& signature)
+            {
+                return signature.Matches(header, size);
+            });
+    }
+
     void Codec::Register(Codec* codec)
     {
         if (lockCodecs() || codec == nullptr)
@@ -90,6 +276,8 @@ namespace SparkyStudios::Audio::Amplitude
         CodecRegistry& codecs = codecRegistry();
         codecs.insert(CodecImpl(codec->GetName(), codec));
         codecsCount()++;
+
+        indexCodec(codec);
     }
 
     void Codec::Unregister(const Codec* codec)
@@ -98,10 +286,12 @@ namespace SparkyStudios::Audio::Amplitude
             return;
 
         CodecRegistry& codecs = codecRegistry();
-        if (const auto& it = codecs.find(codec->GetName()); it != codecs.end())
+        if (const auto& it = codecs.find(codec->GetName()); it != codecs.end() && it->second == codec)
         {
             codecs.erase(it);
             codecsCount()--;
+
+            unindexCodec(codec);
         }
     }
 
@@ -116,6 +306,59 @@ namespace SparkyStudios::Audio::Amplitude
 
     Codec* Codec::FindCodecForFile(std::shared_ptr<File> file)
     {
+        if (file == nullptr)
+            return nullptr;
+
+        const CodecLookupIndex& lookup = codecLookupIndex();
+        const AmString extension = getFileExtension(file);
+
+        const auto hasExtension = [&extension](const Codec* codec)
+        {
+            return std::ranges::find(codec->GetFileExtensions(), extension) != codec->GetFileExtensions().end();
+        };
+
+        // A single positional read is enough to route the file by its magic number
+        AmUInt8 header[kMaxFileSignatureSize];
+        const AmSize size = file->ReadAt(0, header, kMaxFileSignatureSize);
+
+        std::vector<Codec*> candidates;
+
+        const auto collect = [&](const std::vector<std::pair<Codec*, AmSize>>& entries)
+        {
+            for (const auto& [codec, index] : entries)
+                if (codec->GetFileSignatures()[index].Matches(header, size) && std::ranges::find(candidates, codec) == candidates.end())
+                    candidates.push_back(codec);
+        };
+
+        if (size >= 4)
+        {
+            AmUInt32 key = 0;
+            std::memcpy(&key, header, 4);
+
+            if (const auto it = lookup.m_Signatures.find(key); it != lookup.m_Signatures.end())
+                collect(it->second);
+        }
+
+        collect(lookup.m_UnkeyedSignatures);
+
+        if (candidates.size() == 1)
+            return candidates.front();
+
+        // Several codecs share the same signature (e.g. RIFF containers), use the extension to pick one
+        if (!candidates.empty())
+        {
+            if (const auto it = std::ranges::find_if(candidates, hasExtension); it != candidates.end())
+                return *it;
+
+            for (Codec* codec : candidates)
+                if (codec->CanHandleFile(file))
+                    return codec;
+        }
+
+        if (const auto it = lookup.m_Extensions.find(extension); it != lookup.m_Extensions.end() && !it->second.empty())
+            return it->second.front();
+
+        // Fallback to probing, for codecs which don't declare their extensions or signatures
         for (const CodecRegistry& codecs = codecRegistry(); const auto& [_, codec] : codecs)
             if (codec->CanHandleFile(file))
                 return codec;
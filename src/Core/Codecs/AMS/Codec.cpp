@@ -393,14 +393,30 @@ namespace SparkyStudios::Audio::Amplitude
             return 0;
         }
 
-        if (file->Read(adpcm_block, blockSize) != blockSize)
+        AmConstUInt8Buffer adpcm_data = adpcm_block;
+
+        if (file->IsMemoryBacked())
+        {
+            // Decode the block in place when the file content is available in memory
+            const AmSize position = file->Position();
+            if (position + blockSize > file->Length())
+            {
+                ampoolfree(eMemoryPoolKind_Codec, pcm_block);
+                ampoolfree(eMemoryPoolKind_Codec, adpcm_block);
+                return 0;
+            }
+
+            adpcm_data = static_cast<AmConstUInt8Buffer>(file->GetPtr()) + position;
+            file->Seek(blockSize, eFileSeekOrigin_Current);
+        }
+        else if (file->Read(adpcm_block, blockSize) != blockSize)
         {
             ampoolfree(eMemoryPoolKind_Codec, pcm_block);
             ampoolfree(eMemoryPoolKind_Codec, adpcm_block);
             return 0;
         }
 
-        if (Decompress(pcm_block, adpcm_block, blockSize, numChannels) != samplesPerBlock)
+        if (Decompress(pcm_block, adpcm_data, blockSize, numChannels) != samplesPerBlock)
         {
             ampoolfree(eMemoryPoolKind_Codec, pcm_block);
             ampoolfree(eMemoryPoolKind_Codec, adpcm_block);
@@ -556,7 +572,11 @@ namespace SparkyStudios::Audio::Amplitude
 
     AMSCodec::AMSCodec()
         : Codec("ams")
-    {}
+    {
+        AddFileExtension("ams");
+        // AMS files are RIFF containers like WAV files, the extension is used to tell them apart
+        AddFileSignature({ 'R', 'I', 'F', 'F', 0, 0, 0, 0, 'W', 'A', 'V', 'E' }, { 0xFF, 0xFF, 0xFF, 0xFF, 0, 0, 0, 0, 0xFF, 0xFF, 0xFF, 0xFF });
+    }
 
     bool AMSCodec::AMSDecoder::Open(std::shared_ptr<File> file)
     {
@@ -685,7 +705,6 @@ namespace SparkyStudios::Audio::Amplitude
 
     bool AMSCodec::CanHandleFile(std::shared_ptr<File> file) const
     {
-        const auto& path = file->GetPath();
-        return path.find(AM_OS_STRING(".ams")) != AmOsString::npos;
+        return HasFileExtension(file);
     }
 } // namespace SparkyStudios::Audio::Amplitude
@@ -59,6 +59,11 @@ namespace SparkyStudios::Audio::Amplitude
         m_allocationCallbacks.onFree = onFree;
         m_allocationCallbacks.onMalloc = onMalloc;
         m_allocationCallbacks.onRealloc = onRealloc;
+
+        AddFileExtension("mp3");
+        AddFileSignature({ 'I', 'D', '3' });
+        // MPEG audio frame sync, for files without ID3 tag
+        AddFileSignature({ 0xFF, 0xE0 }, { 0xFF, 0xE0 });
     }
 
     bool MP3Codec::MP3Decoder::Open(std::shared_ptr<File> file)
@@ -179,7 +184,6 @@ namespace SparkyStudios::Audio::Amplitude
 
     bool MP3Codec::CanHandleFile(std::shared_ptr<File> file) const
     {
-        const auto& path = file->GetPath();
-        return path.find(AM_OS_STRING(".mp3")) != AmOsString::npos;
+        return HasFileExtension(file) || HasFileSignature(file);
     }
 } // namespace SparkyStudios::Audio::Amplitude
@@ -65,6 +65,10 @@ namespace SparkyStudios::Audio::Amplitude
         m_allocationCallbacks.onFree = onFree;
         m_allocationCallbacks.onMalloc = onMalloc;
         m_allocationCallbacks.onRealloc = onRealloc;
+
+        AddFileExtension("wav");
+        AddFileSignature({ 'R', 'I', 'F', 'F', 0, 0, 0, 0, 'W', 'A', 'V', 'E' }, { 0xFF, 0xFF, 0xFF, 0xFF, 0, 0, 0, 0, 0xFF, 0xFF, 0xFF, 0xFF });
+        AddFileSignature({ 'R', 'F', '6', '4', 0, 0, 0, 0, 'W', 'A', 'V', 'E' }, { 0xFF, 0xFF, 0xFF, 0xFF, 0, 0, 0, 0, 0xFF, 0xFF, 0xFF, 0xFF });
     }
 
     bool WAVCodec::WAVDecoder::Open(std::shared_ptr<File> file)
@@ -78,7 +82,12 @@ namespace SparkyStudios::Audio::Amplitude
         _file = file;
         const auto* codec = static_cast<const WAVCodec*>(m_codec);
 
-        if (drwav_init(&_wav, onRead, onSeek, _file.get(), &codec->m_allocationCallbacks) == DRWAV_FALSE)
+        // Decode directly from memory when the file content is available, avoiding reads into intermediate buffers
+        const drwav_bool32 result = _file->IsMemoryBacked()
+            ? drwav_init_memory(&_wav, _file->GetPtr(), _file->Length(), &codec->m_allocationCallbacks)
+            : drwav_init(&_wav, onRead, onSeek, _file.get(), &codec->m_allocationCallbacks);
+
+        if (result == DRWAV_FALSE)
         {
             amLogError("Cannot load the WAV file: '" AM_OS_CHAR_FMT "'.", file->GetPath().c_str());
             return false;
@@ -226,7 +235,6 @@ namespace SparkyStudios::Audio::Amplitude
 
     bool WAVCodec::CanHandleFile(std::shared_ptr<File> file) const
     {
-        const auto& path = file->GetPath();
-        return path.find(AM_OS_STRING(".wav")) != AmOsString::npos;
+        return HasFileExtension(file) || HasFileSignature(file);
     }
 } // namespace SparkyStudios::Audio::Amplitude
\ No newline at end of file
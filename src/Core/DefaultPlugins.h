@@ -20,6 +20,7 @@
 #pragma region Default Resamplers
 
 #include <DSP/Resamplers/DefaultResampler.h>
+#include <DSP/Resamplers/PolyphaseResampler.h>
 
 #pragma endregion
 
@@ -31,6 +31,7 @@
 #include <Sound/Sound.h>
 #include <Sound/Switch.h>
 #include <Sound/SwitchContainer.h>
+#include <Utils/SimdKernels.h>
 
 #include "buses_definition_generated.h"
 #include "collection_definition_generated.h"
@@ -56,6 +57,10 @@ namespace SparkyStudios::Audio::Amplitude
 
     // Default Plugins instances
     static AmUniquePtr<eMemoryPoolKind_Engine, DefaultResampler> sDefaultResamplerPlugin = nullptr;
+    static AmUniquePtr<eMemoryPoolKind_Engine, PolyphaseResampler> sLinearResamplerPlugin = nullptr;
+    static AmUniquePtr<eMemoryPoolKind_Engine, PolyphaseResampler> sCubicResamplerPlugin = nullptr;
+    static AmUniquePtr<eMemoryPoolKind_Engine, PolyphaseResampler> sSinc8ResamplerPlugin = nullptr;
+    static AmUniquePtr<eMemoryPoolKind_Engine, PolyphaseResampler> sSinc32ResamplerPlugin = nullptr;
     // ---
     static AmUniquePtr<eMemoryPoolKind_Engine, ConstantFader> sConstantFaderPlugin = nullptr;
     static AmUniquePtr<eMemoryPoolKind_Engine, EaseFader> sEaseFaderPlugin = nullptr;
@@ -129,6 +134,146 @@ namespace SparkyStudios::Audio::Amplitude
         SoundBank* _soundBank = nullptr;
     };
 
+    /**
+     * @brief The number of threads used to load sound banks asynchronously.
+     */
+    static constexpr AmUInt32 kSoundBankLoaderThreadCount = 2;
+
+    /**
+     * @brief The part of the progress of an asynchronous sound bank loading covered by the integration of its assets.
+     */
+    static constexpr AmReal32 kSoundBankIntegrationProgress = 0.5f;
+
+    /**
+     * @brief The maximum time, in milliseconds, to wait for pending sound bank requests to complete.
+     */
+    static constexpr AmTime kSoundBankRequestsTimeout = 30.0 * kAmSecond;
+
+    class PrepareSoundBankTask final : public Thread::PoolTask
+    {
+    public:
+        explicit PrepareSoundBankTask(std::shared_ptr<SoundBankRequestImpl> request)
+            : PoolTask()
+            , _request(std::move(request))
+        {}
+
+        void Work() override
+        {
+            _request->SetState(eSoundBankRequestState_Loading);
+
+            if (!_request->GetSoundBank()->Prepare(_request->GetFilename(), amEngine))
+            {
+                amLogError("Cannot load Sound Bank '" AM_OS_CHAR_FMT "'.", _request->GetFilename().c_str());
+                _request->SetState(eSoundBankRequestState_Failed);
+                return;
+            }
+
+            _request->SetSoundBankId(_request->GetSoundBank()->GetId());
+            _request->SetState(eSoundBankRequestState_Integrating);
+        }
+
+    private:
+        std::shared_ptr<SoundBankRequestImpl> _request;
+    };
+
+    class LoadSoundBankFilesTask final : public Thread::PoolTask
+    {
+    public:
+        LoadSoundBankFilesTask(std::shared_ptr<SoundBankRequestImpl> request, SoundBank* soundBank)
+            : PoolTask()
+            , _request(std::move(request))
+            , _soundBank(soundBank)
+        {}
+
+        void Work() override
+        {
+            const AmSize count = _soundBank->GetPendingSoundFileCount();
+            AmSize loaded = 0;
+
+            while (_soundBank->LoadNextSoundFile(amEngine))
+            {
+                const AmReal32 progress = static_cast<AmReal32>(std::min(++loaded, count)) / static_cast<AmReal32>(count);
+                _request->SetProgress(kSoundBankIntegrationProgress + (1.0f - kSoundBankIntegrationProgress) * progress);
+            }
+
+            _request->SetProgress(1.0f);
+            _request->SetState(eSoundBankRequestState_Completed);
+        }
+
+    private:
+        std::shared_ptr<SoundBankRequestImpl> _request;
+        SoundBank* _soundBank = nullptr;
+    };
+
+    SoundBankRequestImpl::SoundBankRequestImpl(const AmOsString& filename)
+        : _filename(filename)
+        , _unload(false)
+        , _state(eSoundBankRequestState_Pending)
+        , _progress(0.0f)
+        , _id(kAmInvalidObjectId)
+        , _soundBank(nullptr)
+    {}
+
+    SoundBankRequestImpl::SoundBankRequestImpl(const AmOsString& filename, AmBankID id)
+        : _filename(filename)
+        , _unload(true)
+        , _state(eSoundBankRequestState_Pending)
+        , _progress(0.0f)
+        , _id(id)
+        , _soundBank(nullptr)
+    {}
+
+    eSoundBankRequestState SoundBankRequestImpl::GetState() const
+    {
+        return _state.load(std::memory_order_acquire);
+    }
+
+    AmReal32 SoundBankRequestImpl::GetProgress() const
+    {
+        return _progress.load(std::memory_order_relaxed);
+    }
+
+    bool SoundBankRequestImpl::IsDone() const
+    {
+        const eSoundBankRequestState state = GetState();
+        return state == eSoundBankRequestState_Completed || state == eSoundBankRequestState_Failed;
+    }
+
+    AmBankID SoundBankRequestImpl::GetSoundBankId() const
+    {
+        return _id.load(std::memory_order_relaxed);
+    }
+
+    void SoundBankRequestImpl::SetState(eSoundBankRequestState state)
+    {
+        _state.store(state, std::memory_order_release);
+    }
+
+    void SoundBankRequestImpl::SetProgress(AmReal32 progress)
+    {
+        _progress.store(progress, std::memory_order_relaxed);
+    }
+
+    void SoundBankRequestImpl::SetSoundBankId(AmBankID id)
+    {
+        _id.store(id, std::memory_order_relaxed);
+    }
+
+    const AmOsString& SoundBankRequestImpl::GetFilename() const
+    {
+        return _filename;
+    }
+
+    bool SoundBankRequestImpl::IsUnload() const
+    {
+        return _unload;
+    }
+
+    AmUniquePtr<eMemoryPoolKind_Engine, SoundBank>& SoundBankRequestImpl::GetSoundBank()
+    {
+        return _soundBank;
+    }
+
     bool LoadFile(const std::shared_ptr<File>& file, AmString* dest)
     {
         if (!file->IsValid())
@@ -347,6 +492,10 @@ namespace SparkyStudios::Audio::Amplitude
         UnregisterDefaultPlugins();
 
         sDefaultResamplerPlugin.reset(ampoolnew(eMemoryPoolKind_Engine, DefaultResampler));
+        sLinearResamplerPlugin.reset(ampoolnew(eMemoryPoolKind_Engine, PolyphaseResampler, "linear", ePolyphaseResamplerQuality_Linear));
+        sCubicResamplerPlugin.reset(ampoolnew(eMemoryPoolKind_Engine, PolyphaseResampler, "cubic", ePolyphaseResamplerQuality_Cubic));
+        sSinc8ResamplerPlugin.reset(ampoolnew(eMemoryPoolKind_Engine, PolyphaseResampler, "sinc8", ePolyphaseResamplerQuality_Sinc8));
+        sSinc32ResamplerPlugin.reset(ampoolnew(eMemoryPoolKind_Engine, PolyphaseResampler, "sinc32", ePolyphaseResamplerQuality_Sinc32));
         // ---
         sConstantFaderPlugin.reset(ampoolnew(eMemoryPoolKind_Engine, ConstantFader));
         sEaseFaderPlugin.reset(ampoolnew(eMemoryPoolKind_Engine, EaseFader));
@@ -403,6 +552,10 @@ namespace SparkyStudios::Audio::Amplitude
             return false; // Cannot unregister the default plugins when the engine is already initialized.
 
         sDefaultResamplerPlugin.reset(nullptr);
+        sLinearResamplerPlugin.reset(nullptr);
+        sCubicResamplerPlugin.reset(nullptr);
+        sSinc8ResamplerPlugin.reset(nullptr);
+        sSinc32ResamplerPlugin.reset(nullptr);
         // ---
         sConstantFaderPlugin.reset(nullptr);
         sEaseFaderPlugin.reset(nullptr);
@@ -656,6 +809,9 @@ namespace SparkyStudios::Audio::Amplitude
         Fader::LockRegistry();
         Node::LockRegistry();
 
+        // Pick the DSP kernels matching the CPU before any audio is processed
+        SelectSimdKernels();
+
         _frameThreadMutex = Thread::CreateMutex(500);
 
         // Create the internal engine state
@@ -713,6 +869,7 @@ namespace SparkyStudios::Audio::Amplitude
             _state->hrir_sphere = ampoolnew(eMemoryPoolKind_Engine, HRIRSphereImpl);
             _state->hrir_sphere->SetResource(AM_STRING_TO_OS_STRING(config->hrtf()->amir_file()->c_str()));
             _state->hrir_sphere->SetSamplingMode(_state->hrir_sampling_mode);
+            _state->hrir_sphere->SetLookupGridResolution(config->hrtf()->hrir_lookup_grid_resolution());
             _state->hrir_sphere->Load(GetFileSystem());
         }
         else if (_state->panning_mode != ePanningMode_Stereo)
@@ -813,6 +970,9 @@ namespace SparkyStudios::Audio::Amplitude
         // Environment Amounts
         _state->track_environments = config->game()->track_environments();
 
+        // Asynchronous sound bank loading
+        _state->sound_bank_integration_budget = config->sound_bank_integration_budget();
+
         // Engine state
         _state->paused = false;
         _state->mute = false;
@@ -864,6 +1024,9 @@ namespace SparkyStudios::Audio::Amplitude
         if (_state->mixer.IsInitialized())
             _state->mixer.Deinit();
 
+        // Complete pending sound bank requests
+        FlushSoundBankRequests();
+
         // Unload sound banks
         while (HasLoadedSoundBanks())
             UnloadSoundBanks();
@@ -918,6 +1081,9 @@ namespace SparkyStudios::Audio::Amplitude
         outID = kAmInvalidObjectId;
         bool success = true;
 
+        // Complete the asynchronous requests targeting this sound bank first, so they don't replace it once integrated
+        ResolveSoundBankRequests(filename);
+
         if (const auto findIt = _state->sound_bank_id_map.find(filename); findIt == _state->sound_bank_id_map.end() ||
             (findIt != _state->sound_bank_id_map.end() && !_state->sound_bank_map.contains(findIt->second)))
         {
@@ -1010,6 +1176,9 @@ namespace SparkyStudios::Audio::Amplitude
 
     void EngineImpl::UnloadSoundBank(const AmOsString& filename)
     {
+        // Complete the asynchronous requests targeting this sound bank first, so the right reference is released
+        ResolveSoundBankRequests(filename);
+
         if (const auto findIt = _state->sound_bank_id_map.find(filename); findIt == _state->sound_bank_id_map.end())
         {
             amLogWarning("Cannot unload Sound Bank '" AM_OS_CHAR_FMT "'. Sound Bank not loaded.", filename.c_str());
@@ -1023,6 +1192,19 @@ namespace SparkyStudios::Audio::Amplitude
 
     void EngineImpl::UnloadSoundBank(AmBankID id)
     {
+        // Complete the asynchronous requests targeting this sound bank first, so the right reference is released
+        AmOsString filename;
+        for (const auto& [path, bankId] : _state->sound_bank_id_map)
+        {
+            if (bankId == id)
+            {
+                filename = path;
+                break;
+            }
+        }
+
+        ResolveSoundBankRequests(filename, id);
+
         if (const auto findIt = _state->sound_bank_map.find(id); findIt == _state->sound_bank_map.end())
         {
             amLogWarning("Cannot unload Sound Bank with ID '" AM_ID_CHAR_FMT "'. Sound Bank not loaded.", id);
@@ -1061,6 +1243,63 @@ namespace SparkyStudios::Audio::Amplitude
         Thread::UnlockMutex(_frameThreadMutex);
     }
 
+    SoundBankRequestHandle EngineImpl::LoadSoundBankAsync(const AmOsString& filename)
+    {
+        auto request = std::shared_ptr<SoundBankRequestImpl>(
+            ampoolnew(eMemoryPoolKind_Engine, SoundBankRequestImpl, filename), am_delete<eMemoryPoolKind_Engine, SoundBankRequestImpl>{});
+
+        Thread::LockMutex(_frameThreadMutex);
+        {
+            // Nothing to load if the sound bank is already loaded
+            if (const auto findIt = _state->sound_bank_id_map.find(filename); findIt != _state->sound_bank_id_map.end())
+            {
+                if (const auto bankIt = _state->sound_bank_map.find(findIt->second); bankIt != _state->sound_bank_map.end())
+                {
+                    bankIt->second->GetRefCounter()->Increment();
+
+                    request->SetSoundBankId(findIt->second);
+                    request->SetProgress(1.0f);
+                    request->SetState(eSoundBankRequestState_Completed);
+                }
+            }
+        }
+        Thread::UnlockMutex(_frameThreadMutex);
+
+        if (request->IsDone())
+            return request;
+
+        request->GetSoundBank().reset(ampoolnew(eMemoryPoolKind_Engine, SoundBank));
+
+        if (_soundBankLoaderThreadPool == nullptr)
+        {
+            _soundBankLoaderThreadPool.reset(ampoolnew(eMemoryPoolKind_Engine, Thread::Pool));
+            _soundBankLoaderThreadPool->Init(kSoundBankLoaderThreadCount);
+        }
+
+        EnqueueSoundBankRequest(request);
+
+        auto task = std::shared_ptr<PrepareSoundBankTask>(
+            ampoolnew(eMemoryPoolKind_Engine, PrepareSoundBankTask, request), am_delete<eMemoryPoolKind_Engine, PrepareSoundBankTask>{});
+
+        _soundBankLoaderThreadPool->AddTask(task);
+
+        return request;
+    }
+
+    SoundBankRequestHandle EngineImpl::UnloadSoundBankAsync(const AmOsString& filename)
+    {
+        return EnqueueSoundBankRequest(std::shared_ptr<SoundBankRequestImpl>(
+            ampoolnew(eMemoryPoolKind_Engine, SoundBankRequestImpl, filename, kAmInvalidObjectId),
+            am_delete<eMemoryPoolKind_Engine, SoundBankRequestImpl>{}));
+    }
+
+    SoundBankRequestHandle EngineImpl::UnloadSoundBankAsync(AmBankID id)
+    {
+        return EnqueueSoundBankRequest(std::shared_ptr<SoundBankRequestImpl>(
+            ampoolnew(eMemoryPoolKind_Engine, SoundBankRequestImpl, AmOsString(), id),
+            am_delete<eMemoryPoolKind_Engine, SoundBankRequestImpl>{}));
+    }
+
     bool EngineImpl::HasLoadedSoundBank(const AmOsString& filename) const
     {
         if (const auto findIt = _state->sound_bank_id_map.find(filename); findIt != _state->sound_bank_id_map.end())
@@ -1127,6 +1366,297 @@ namespace SparkyStudios::Audio::Amplitude
         return true;
     }
 
+    SoundBankRequestHandle EngineImpl::EnqueueSoundBankRequest(std::shared_ptr<SoundBankRequestImpl> request)
+    {
+        Thread::LockMutex(_frameThreadMutex);
+        {
+            _soundBankRequests.push_back(request);
+        }
+        Thread::UnlockMutex(_frameThreadMutex);
+
+        return request;
+    }
+
+    void EngineImpl::ProcessSoundBankRequests(AmTime budget) const
+    {
+        const auto deadline = std::chrono::steady_clock::now() +
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<AmTime, std::milli>(budget));
+
+        Thread::LockMutex(_frameThreadMutex);
+        {
+            // Unload requests must wait for earlier requests still loading sound files, as they may target the same sound bank.
+            bool loadingSoundFiles = false;
+
+            for (auto it = _soundBankRequests.begin(); it != _soundBankRequests.end();)
+            {
+                const auto& request = *it;
+
+                if (request->IsDone())
+                {
+                    it = _soundBankRequests.erase(it);
+                    continue;
+                }
+
+                const eSoundBankRequestState state = request->GetState();
+
+                if (state == eSoundBankRequestState_LoadingSoundFiles)
+                {
+                    loadingSoundFiles = true;
+                    ++it;
+                    continue;
+                }
+
+                if (request->IsUnload())
+                {
+                    if (loadingSoundFiles)
+                        break;
+
+                    ProcessUnloadSoundBankRequest(request, deadline);
+                }
+                else
+                {
+                    // Requests are integrated in order, wait for the worker to read this one
+                    if (state == eSoundBankRequestState_Pending || state == eSoundBankRequestState_Loading)
+                        break;
+
+                    ProcessLoadSoundBankRequest(request, deadline);
+                }
+
+                // The time budget of this frame is exhausted
+                if (!request->IsDone() && request->GetState() != eSoundBankRequestState_LoadingSoundFiles)
+                    break;
+            }
+        }
+        Thread::UnlockMutex(_frameThreadMutex);
+    }
+
+    void EngineImpl::ProcessLoadSoundBankRequest(
+        const std::shared_ptr<SoundBankRequestImpl>& request, std::chrono::steady_clock::time_point deadline) const
+    {
+        auto& soundBank = request->GetSoundBank();
+        const AmOsString& filename = request->GetFilename();
+
+        // Before integrating the first asset, check if the sound bank has been loaded since the request was made
+        if (soundBank->GetPendingAssetCount() == soundBank->GetAssetCount())
+        {
+            if (const auto findIt = _state->sound_bank_id_map.find(filename); findIt != _state->sound_bank_id_map.end())
+            {
+                if (const auto bankIt = _state->sound_bank_map.find(findIt->second); bankIt != _state->sound_bank_map.end())
+                {
+                    bankIt->second->GetRefCounter()->Increment();
+                    soundBank.reset(nullptr);
+
+                    request->SetSoundBankId(findIt->second);
+                    request->SetProgress(1.0f);
+                    request->SetState(eSoundBankRequestState_Completed);
+                    return;
+                }
+            }
+        }
+
+        const auto assetCount = static_cast<AmReal32>(soundBank->GetAssetCount());
+
+        while (soundBank->GetPendingAssetCount() > 0)
+        {
+            if (!soundBank->IntegrateNextAsset(this))
+            {
+                amLogError("Cannot load Sound Bank '" AM_OS_CHAR_FMT "'. Failed to load its assets.", filename.c_str());
+                soundBank.reset(nullptr);
+
+                request->SetState(eSoundBankRequestState_Failed);
+                return;
+            }
+
+            const AmReal32 progress = 1.0f - static_cast<AmReal32>(soundBank->GetPendingAssetCount()) / assetCount;
+            request->SetProgress(kSoundBankIntegrationProgress * progress);
+
+            if (std::chrono::steady_clock::now() >= deadline)
+                break;
+        }
+
+        if (soundBank->GetPendingAssetCount() > 0)
+            return;
+
+        soundBank->GetRefCounter()->Increment();
+
+        const AmBankID id = soundBank->GetId();
+        SoundBank* loadedSoundBank = soundBank.get();
+
+        _state->sound_bank_id_map[filename] = id;
+        _state->sound_bank_map[id] = std::move(soundBank);
+
+        if (loadedSoundBank->GetPendingSoundFileCount() == 0)
+        {
+            request->SetProgress(1.0f);
+            request->SetState(eSoundBankRequestState_Completed);
+            return;
+        }
+
+        request->SetState(eSoundBankRequestState_LoadingSoundFiles);
+
+        auto task = std::shared_ptr<LoadSoundBankFilesTask>(
+            ampoolnew(eMemoryPoolKind_Engine, LoadSoundBankFilesTask, request, loadedSoundBank),
+            am_delete<eMemoryPoolKind_Engine, LoadSoundBankFilesTask>{});
+
+        _soundBankLoaderThreadPool->AddTask(task);
+    }
+
+    void EngineImpl::ProcessUnloadSoundBankRequest(
+        const std::shared_ptr<SoundBankRequestImpl>& request, std::chrono::steady_clock::time_point deadline) const
+    {
+        auto& soundBank = request->GetSoundBank();
+
+        if (request->GetState() == eSoundBankRequestState_Pending)
+        {
+            AmBankID id = request->GetSoundBankId();
+
+            if (const AmOsString& filename = request->GetFilename(); !filename.empty())
+            {
+                const auto findIt = _state->sound_bank_id_map.find(filename);
+                if (findIt == _state->sound_bank_id_map.end())
+                {
+                    amLogWarning("Cannot unload Sound Bank '" AM_OS_CHAR_FMT "'. Sound Bank not loaded.", filename.c_str());
+                    request->SetState(eSoundBankRequestState_Failed);
+                    return;
+                }
+
+                id = findIt->second;
+            }
+
+            const auto findIt = _state->sound_bank_map.find(id);
+            if (findIt == _state->sound_bank_map.end())
+            {
+                amLogWarning("Cannot unload Sound Bank with ID '" AM_ID_CHAR_FMT "'. Sound Bank not loaded.", id);
+                request->SetState(eSoundBankRequestState_Failed);
+                return;
+            }
+
+            request->SetSoundBankId(id);
+
+            if (findIt->second->GetRefCounter()->Decrement() > 0)
+            {
+                request->SetProgress(1.0f);
+                request->SetState(eSoundBankRequestState_Completed);
+                return;
+            }
+
+            // The sound bank is no longer visible to the engine while its assets are released
+            soundBank = std::move(findIt->second);
+            _state->sound_bank_map.erase(findIt);
+
+            soundBank->BeginDeinitialize();
+            request->SetState(eSoundBankRequestState_Unloading);
+        }
+
+        const auto assetCount = static_cast<AmReal32>(soundBank->GetAssetCount());
+
+        while (soundBank->GetPendingAssetCount() > 0)
+        {
+            soundBank->DeinitializeNextAsset(this);
+
+            request->SetProgress(1.0f - static_cast<AmReal32>(soundBank->GetPendingAssetCount()) / assetCount);
+
+            if (std::chrono::steady_clock::now() >= deadline)
+                break;
+        }
+
+        if (soundBank->GetPendingAssetCount() > 0)
+            return;
+
+        soundBank.reset(nullptr);
+
+        request->SetProgress(1.0f);
+        request->SetState(eSoundBankRequestState_Completed);
+    }
+
+    bool EngineImpl::HasSoundBankRequests(const AmOsString& filename, AmBankID id) const
+    {
+        bool found = false;
+
+        Thread::LockMutex(_frameThreadMutex);
+        {
+            for (const auto& request : _soundBankRequests)
+            {
+                if (request->IsDone())
+                    continue;
+
+                // Sound banks loading their sound files are already registered
+                if (request->GetState() == eSoundBankRequestState_LoadingSoundFiles)
+                    continue;
+
+                if ((!filename.empty() && request->GetFilename() == filename) ||
+                    (id != kAmInvalidObjectId && request->GetSoundBankId() == id))
+                {
+                    found = true;
+                    break;
+                }
+            }
+        }
+        Thread::UnlockMutex(_frameThreadMutex);
+
+        return found;
+    }
+
+    void EngineImpl::ResolveSoundBankRequests(const AmOsString& filename, AmBankID id) const
+    {
+        const auto deadline = std::chrono::steady_clock::now() +
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<AmTime, std::milli>(kSoundBankRequestsTimeout));
+
+        while (HasSoundBankRequests(filename, id))
+        {
+            if (std::chrono::steady_clock::now() >= deadline)
+            {
+                amLogError("Timed out while waiting for the pending requests of Sound Bank '" AM_OS_CHAR_FMT "'.", filename.c_str());
+                return;
+            }
+
+            ProcessSoundBankRequests(kAmSecond);
+            Thread::Sleep(1);
+        }
+    }
+
+    void EngineImpl::FlushSoundBankRequests()
+    {
+        const auto deadline = std::chrono::steady_clock::now() +
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<AmTime, std::milli>(kSoundBankRequestsTimeout));
+
+        while (true)
+        {
+            Thread::LockMutex(_frameThreadMutex);
+            const bool empty = _soundBankRequests.empty();
+            Thread::UnlockMutex(_frameThreadMutex);
+
+            if (empty)
+                break;
+
+            if (std::chrono::steady_clock::now() >= deadline)
+            {
+                amLogError("Timed out while waiting for the pending sound bank requests.");
+                break;
+            }
+
+            ProcessSoundBankRequests(kAmSecond);
+            Thread::Sleep(1);
+        }
+
+        // Stop the workers before failing the remaining requests, so none of them is still in use
+        _soundBankLoaderThreadPool.reset(nullptr);
+
+        Thread::LockMutex(_frameThreadMutex);
+        {
+            for (const auto& request : _soundBankRequests)
+            {
+                if (!request->IsDone())
+                    request->SetState(eSoundBankRequestState_Failed);
+            }
+
+            _soundBankRequests.clear();
+        }
+        Thread::UnlockMutex(_frameThreadMutex);
+    }
+
     ListenerInternalState* FindBestListener(ListenerList& listeners, const AmVec3& location, eListenerFetchMode fetchMode)
     {
         if (listeners.empty())
@@ -1912,6 +2442,8 @@ namespace SparkyStudios::Audio::Amplitude
         _state->listener_state_free_list.pop_back();
         _state->listener_list.push_back(*listener);
 
+        _state->mixer.CreateAmbisonicBus(id);
+
         return Listener(listener);
     }
 
@@ -1943,6 +2475,8 @@ namespace SparkyStudios::Audio::Amplitude
                 });
             findIt != _state->listener_state_memory.end())
         {
+            _state->mixer.DestroyAmbisonicBus(id);
+
             findIt->SetId(kAmInvalidObjectId);
             findIt->node.remove();
             _state->listener_state_free_list.push_back(&*findIt);
@@ -1954,6 +2488,8 @@ namespace SparkyStudios::Audio::Amplitude
         if (!listener->Valid())
             return;
 
+        _state->mixer.DestroyAmbisonicBus(listener->GetId());
+
         listener->GetState()->SetId(kAmInvalidObjectId);
         listener->GetState()->node.remove();
         _state->listener_state_free_list.push_back(listener->GetState());
@@ -2092,6 +2628,8 @@ namespace SparkyStudios::Audio::Amplitude
         _state->room_state_free_list.pop_back();
         _state->room_list.push_back(*room);
 
+        _state->mixer.CreateRoomBus(id);
+
         return Room(room);
     }
 
@@ -2115,6 +2653,8 @@ namespace SparkyStudios::Audio::Amplitude
         if (!room->Valid())
             return;
 
+        _state->mixer.DestroyRoomBus(room->GetId());
+
         room->GetState()->SetId(kAmInvalidObjectId);
         room->GetState()->node.remove();
         _state->room_state_free_list.push_back(room->GetState());
@@ -2133,6 +2673,8 @@ namespace SparkyStudios::Audio::Amplitude
                 });
             findIt != _state->room_state_memory.end())
         {
+            _state->mixer.DestroyRoomBus(id);
+
             findIt->SetId(kAmInvalidObjectId);
             findIt->node.remove();
             _state->room_state_free_list.push_back(&*findIt);
@@ -2292,6 +2834,10 @@ namespace SparkyStudios::Audio::Amplitude
         if (_state == nullptr)
             return;
 
+        // Sound banks are loaded even while the engine is paused.
+        if (!_state->stopping)
+            ProcessSoundBankRequests(_state->sound_bank_integration_budget);
+
         if (_state->paused)
             return;
 
@@ -17,6 +17,10 @@
 #ifndef _AM_IMPLEMENTATION_CORE_ENGINE_H
 #define _AM_IMPLEMENTATION_CORE_ENGINE_H
 
+#include <atomic>
+#include <chrono>
+#include <deque>
+
 #include <SparkyStudios/Audio/Amplitude/Core/Engine.h>
 
 #include <Core/EngineInternalState.h>
@@ -27,6 +31,85 @@
 
 namespace SparkyStudios::Audio::Amplitude
 {
+    /**
+     * @brief SoundBankRequest class' private implementation.
+     */
+    class SoundBankRequestImpl final : public SoundBankRequest
+    {
+    public:
+        /**
+         * @brief Creates a request to load the given sound bank file.
+         *
+         * @param filename The path to the sound bank file.
+         */
+        explicit SoundBankRequestImpl(const AmOsString& filename);
+
+        /**
+         * @brief Creates a request to unload a sound bank.
+         *
+         * @param filename The path to the sound bank file, or an empty string to find the sound bank by ID.
+         * @param id The sound bank ID, used when no filename is given.
+         */
+        SoundBankRequestImpl(const AmOsString& filename, AmBankID id);
+
+        ~SoundBankRequestImpl() override = default;
+
+        /**
+         * @copydoc SoundBankRequest::GetState
+         */
+        [[nodiscard]] eSoundBankRequestState GetState() const override;
+
+        /**
+         * @copydoc SoundBankRequest::GetProgress
+         */
+        [[nodiscard]] AmReal32 GetProgress() const override;
+
+        /**
+         * @copydoc SoundBankRequest::IsDone
+         */
+        [[nodiscard]] bool IsDone() const override;
+
+        /**
+         * @copydoc SoundBankRequest::GetSoundBankId
+         */
+        [[nodiscard]] AmBankID GetSoundBankId() const override;
+
+        void SetState(eSoundBankRequestState state);
+        void SetProgress(AmReal32 progress);
+        void SetSoundBankId(AmBankID id);
+
+        /**
+         * @brief Gets the path to the sound bank file targeted by this request.
+         *
+         * @return The sound bank file path, or an empty string when the request targets a sound bank ID.
+         */
+        [[nodiscard]] const AmOsString& GetFilename() const;
+
+        /**
+         * @brief Checks whether this request unloads a sound bank.
+         *
+         * @return `true` if this request unloads a sound bank, `false` if it loads one.
+         */
+        [[nodiscard]] bool IsUnload() const;
+
+        /**
+         * @brief Gets the sound bank loaded or unloaded by this request.
+         *
+         * @return The sound bank owned by the request.
+         */
+        AmUniquePtr<eMemoryPoolKind_Engine, SoundBank>& GetSoundBank();
+
+    private:
+        AmOsString _filename;
+        bool _unload;
+
+        std::atomic<eSoundBankRequestState> _state;
+        std::atomic<AmReal32> _progress;
+        std::atomic<AmBankID> _id;
+
+        AmUniquePtr<eMemoryPoolKind_Engine, SoundBank> _soundBank;
+    };
+
     class EngineImpl final : public Engine
     {
         friend class Engine;
@@ -81,6 +164,9 @@ namespace SparkyStudios::Audio::Amplitude
         void UnloadSoundBank(const AmOsString& filename) override;
         void UnloadSoundBank(AmBankID id) override;
         void UnloadSoundBanks() override;
+        SoundBankRequestHandle LoadSoundBankAsync(const AmOsString& filename) override;
+        SoundBankRequestHandle UnloadSoundBankAsync(const AmOsString& filename) override;
+        SoundBankRequestHandle UnloadSoundBankAsync(AmBankID id) override;
         [[nodiscard]] bool HasLoadedSoundBank(const AmOsString& filename) const override;
         [[nodiscard]] bool HasLoadedSoundBank(AmBankID id) const override;
         [[nodiscard]] bool HasLoadedSoundBanks() const override;
@@ -204,6 +290,14 @@ namespace SparkyStudios::Audio::Amplitude
         Channel PlayScopedCollection(CollectionHandle handle, const Entity& entity, const AmVec3& location, AmReal32 userGain) const;
         Channel PlayScopedSound(SoundHandle handle, const Entity& entity, const AmVec3& location, AmReal32 userGain) const;
 
+        SoundBankRequestHandle EnqueueSoundBankRequest(std::shared_ptr<SoundBankRequestImpl> request);
+        void ProcessSoundBankRequests(AmTime budget) const;
+        void ProcessLoadSoundBankRequest(const std::shared_ptr<SoundBankRequestImpl>& request, std::chrono::steady_clock::time_point deadline) const;
+        void ProcessUnloadSoundBankRequest(const std::shared_ptr<SoundBankRequestImpl>& request, std::chrono::steady_clock::time_point deadline) const;
+        [[nodiscard]] bool HasSoundBankRequests(const AmOsString& filename, AmBankID id) const;
+        void ResolveSoundBankRequests(const AmOsString& filename, AmBankID id = kAmInvalidObjectId) const;
+        void FlushSoundBankRequests();
+
         // The lis of paths in which search for plugins.
         static std::set<AmOsString> _pluginSearchPaths;
 
@@ -228,6 +322,12 @@ namespace SparkyStudios::Audio::Amplitude
 
         // The thread pool used to load audio files.
         AmUniquePtr<eMemoryPoolKind_Engine, Thread::Pool> _soundLoaderThreadPool;
+
+        // The thread pool used to load sound banks asynchronously.
+        AmUniquePtr<eMemoryPoolKind_Engine, Thread::Pool> _soundBankLoaderThreadPool;
+
+        // The pending asynchronous sound bank requests, processed in order.
+        mutable std::deque<std::shared_ptr<SoundBankRequestImpl>> _soundBankRequests;
     };
 } // namespace SparkyStudios::Audio::Amplitude
 
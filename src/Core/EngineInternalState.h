@@ -162,6 +162,7 @@ namespace SparkyStudios::Audio::Amplitude
             , pipeline()
             , pipeline_source()
             , track_environments(false)
+            , sound_bank_integration_budget(2.0)
             , samples_per_stream(512)
             , panning_mode(ePanningMode_Stereo)
             , hrir_sampling_mode(eHRIRSphereSamplingMode_NearestNeighbor)
@@ -302,6 +303,9 @@ namespace SparkyStudios::Audio::Amplitude
 
         bool track_environments;
 
+        // The maximum time in milliseconds spent on each frame to process asynchronous sound bank requests.
+        AmTime sound_bank_integration_budget;
+
         AmUInt32 samples_per_stream;
 
         ePanningMode panning_mode;
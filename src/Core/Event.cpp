@@ -358,7 +358,7 @@ namespace SparkyStudios::Audio::Amplitude
 
     const EventDefinition* EventImpl::GetDefinition() const
     {
-        return GetEventDefinition(m_source.c_str());
+        return GetEventDefinition(GetSource());
     }
 
     EventCanceler::EventCanceler()
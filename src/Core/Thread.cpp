@@ -327,24 +327,41 @@ namespace SparkyStudios::Audio::Amplitude::Thread
     AwaitablePoolTask::AwaitablePoolTask()
         : _condition()
         , _mutex()
+        , _done(false)
     {}
 
     void AwaitablePoolTask::Work()
     {
         AwaitableWork();
+
+        {
+            std::lock_guard lock(_mutex);
+            _done = true;
+        }
+
         _condition.notify_all();
     }
 
     void AwaitablePoolTask::Await()
     {
         std::unique_lock lock(_mutex);
-        _condition.wait(lock);
+        _condition.wait(
+            lock,
+            [this]
+            {
+                return _done;
+            });
     }
 
     bool AwaitablePoolTask::Await(AmUInt64 duration)
     {
         std::unique_lock lock(_mutex);
-        return _condition.wait_for(lock, std::chrono::milliseconds(duration)) == std::cv_status::no_timeout;
+        return _condition.wait_for(
+            lock, std::chrono::milliseconds(duration),
+            [this]
+            {
+                return _done;
+            });
     }
 
     Pool::Pool()
@@ -12,25 +12,30 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <SparkyStudios/Audio/Amplitude/Core/Log.h>
 #include <SparkyStudios/Audio/Amplitude/DSP/AudioConverter.h>
 
 #include <Utils/Utils.h>
 
 namespace SparkyStudios::Audio::Amplitude
 {
+    // The name of the resampler used when the settings don't specify one.
+    constexpr const char* kDefaultResamplerName = "default";
+
     AudioConverter::AudioConverter()
         : _resampler(nullptr)
+        , _resamplerName(kDefaultResamplerName)
         , _channelConversionMode(kChannelConversionModeDisabled)
         , _needResampling(false)
         , _srcInitialized(false)
     {
-        _resampler = Resampler::Construct("default");
+        _resampler = Resampler::Construct(_resamplerName);
         Reset();
     }
 
     AudioConverter::~AudioConverter()
     {
-        Resampler::Destruct("default", _resampler);
+        Resampler::Destruct(_resamplerName, _resampler);
     }
 
     bool AudioConverter::Configure(const Settings& settings)
@@ -44,6 +49,24 @@ namespace SparkyStudios::Audio::Amplitude
         else
             return false; // Unsupported channel conversion mode
 
+        if (const AmString name = settings.m_resampler.empty() ? kDefaultResamplerName : settings.m_resampler; name != _resamplerName)
+        {
+            ResamplerInstance* resampler = Resampler::Construct(name);
+
+            if (resampler == nullptr)
+            {
+                amLogWarning("Unable to find the resampler '%s'. The current resampler will be used instead.", name.c_str());
+            }
+            else
+            {
+                Resampler::Destruct(_resamplerName, _resampler);
+
+                _resampler = resampler;
+                _resamplerName = name;
+                _srcInitialized = false;
+            }
+        }
+
         _needResampling = settings.m_sourceSampleRate != settings.m_targetSampleRate;
 
         if (_needResampling)
@@ -0,0 +1,220 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <DSP/BiquadCascade.h>
+#include <Utils/Utils.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    // Number of frames interleaved at once in the lanes scratch buffer
+    constexpr AmSize kBiquadBlockFrames = 64;
+
+    BiquadCoefficients BiquadCoefficients::Identity()
+    {
+        return {};
+    }
+
+    BiquadCoefficients BiquadCoefficients::OnePoleLowPass(AmReal32 coefficient)
+    {
+        BiquadCoefficients coefficients;
+        coefficients.m_A0 = 1.0f - coefficient;
+        coefficients.m_B1 = -coefficient;
+
+        return coefficients;
+    }
+
+    bool BiquadCoefficients::operator==(const BiquadCoefficients& other) const
+    {
+        return m_A0 == other.m_A0 && m_A1 == other.m_A1 && m_A2 == other.m_A2 && m_B1 == other.m_B1 && m_B2 == other.m_B2;
+    }
+
+    bool BiquadCoefficients::operator!=(const BiquadCoefficients& other) const
+    {
+        return !(*this == other);
+    }
+
+    BiquadCascade::BiquadCascade(AmSize stageCount)
+        : _stageCount(AM_MIN(stageCount, kMaxStages))
+        , _stages{}
+    {
+        AMPLITUDE_ASSERT(stageCount > 0 && stageCount <= kMaxStages);
+
+        for (AmSize s = 0; s < _stageCount; ++s)
+            SetCoefficients(s, BiquadCoefficients::Identity(), false);
+    }
+
+    AmSize BiquadCascade::GetStageCount() const
+    {
+        return _stageCount;
+    }
+
+    void BiquadCascade::SetCoefficients(AmSize stage, const BiquadCoefficients& coefficients, bool interpolate)
+    {
+        for (AmSize lane = 0; lane < kMaxLanes; ++lane)
+            SetCoefficients(stage, lane, coefficients, interpolate);
+    }
+
+    void BiquadCascade::SetCoefficients(AmSize stage, AmSize lane, const BiquadCoefficients& coefficients, bool interpolate)
+    {
+        AMPLITUDE_ASSERT(stage < _stageCount && lane < kMaxLanes);
+
+        Stage& s = _stages[stage];
+        s.m_Target[lane] = coefficients;
+
+        if (!interpolate)
+        {
+            s.m_Coefficients[0][lane] = coefficients.m_A0;
+            s.m_Coefficients[1][lane] = coefficients.m_A1;
+            s.m_Coefficients[2][lane] = coefficients.m_A2;
+            s.m_Coefficients[3][lane] = coefficients.m_B1;
+            s.m_Coefficients[4][lane] = coefficients.m_B2;
+            return;
+        }
+
+        s.m_Interpolating = s.m_Interpolating || s.m_Coefficients[0][lane] != coefficients.m_A0 ||
+            s.m_Coefficients[1][lane] != coefficients.m_A1 || s.m_Coefficients[2][lane] != coefficients.m_A2 ||
+            s.m_Coefficients[3][lane] != coefficients.m_B1 || s.m_Coefficients[4][lane] != coefficients.m_B2;
+    }
+
+    BiquadCoefficients BiquadCascade::GetCoefficients(AmSize stage, AmSize lane) const
+    {
+        AMPLITUDE_ASSERT(stage < _stageCount && lane < kMaxLanes);
+        return _stages[stage].m_Target[lane];
+    }
+
+    bool BiquadCascade::IsInterpolating() const
+    {
+        for (AmSize s = 0; s < _stageCount; ++s)
+            if (_stages[s].m_Interpolating)
+                return true;
+
+        return false;
+    }
+
+    void BiquadCascade::Reset()
+    {
+        for (AmSize s = 0; s < _stageCount; ++s)
+            std::memset(_stages[s].m_State, 0, sizeof(_stages[s].m_State));
+    }
+
+    void BiquadCascade::Process(const AudioBuffer& in, AudioBuffer& out, AmSize frames)
+    {
+        AMPLITUDE_ASSERT(out.GetChannelCount() >= in.GetChannelCount());
+
+        const AmSize channels = in.GetChannelCount();
+
+        const AmAudioSample* inputs[kMaxLanes];
+        AmAudioSample* outputs[kMaxLanes];
+
+        for (AmSize c = 0; c < channels; ++c)
+        {
+            inputs[c] = in[c].begin();
+            outputs[c] = out[c].begin();
+        }
+
+        Process(inputs, outputs, channels, frames);
+    }
+
+    void BiquadCascade::Process(const AmAudioSample* const* inputs, AmAudioSample* const* outputs, AmSize laneCount, AmSize frames)
+    {
+        AMPLITUDE_ASSERT(laneCount <= kMaxLanes);
+
+        if (frames == 0 || laneCount == 0)
+            return;
+
+        // Pad the lanes to fill whole SIMD registers
+        const AmSize blockSize = GetSimdKernels().m_Width;
+        const AmSize lanes = AM_MIN((laneCount + blockSize - 1) / blockSize * blockSize, kMaxLanes);
+
+        // Spread the coefficients changes over the whole block
+        for (AmSize st = 0; st < _stageCount; ++st)
+        {
+            Stage& s = _stages[st];
+
+            if (!s.m_Interpolating)
+                continue;
+
+            const AmReal32 invFrames = 1.0f / static_cast<AmReal32>(frames);
+
+            for (AmSize lane = 0; lane < lanes; ++lane)
+            {
+                const BiquadCoefficients& target = s.m_Target[lane];
+                s.m_Steps[0][lane] = (target.m_A0 - s.m_Coefficients[0][lane]) * invFrames;
+                s.m_Steps[1][lane] = (target.m_A1 - s.m_Coefficients[1][lane]) * invFrames;
+                s.m_Steps[2][lane] = (target.m_A2 - s.m_Coefficients[2][lane]) * invFrames;
+                s.m_Steps[3][lane] = (target.m_B1 - s.m_Coefficients[3][lane]) * invFrames;
+                s.m_Steps[4][lane] = (target.m_B2 - s.m_Coefficients[4][lane]) * invFrames;
+            }
+        }
+
+        alignas(AM_SIMD_ALIGNMENT) AmReal32 samples[kBiquadBlockFrames * kMaxLanes] = {};
+
+        for (AmSize offset = 0; offset < frames; offset += kBiquadBlockFrames)
+        {
+            const AmSize length = AM_MIN(kBiquadBlockFrames, frames - offset);
+
+            // Interleave the lanes, so that each frame holds one sample per lane
+            for (AmSize lane = 0; lane < laneCount; ++lane)
+            {
+                const AmAudioSample* input = inputs[lane] + offset;
+                for (AmSize i = 0; i < length; ++i)
+                    samples[i * lanes + lane] = input[i];
+            }
+
+            ProcessBlock(samples, lanes, length);
+
+            for (AmSize lane = 0; lane < laneCount; ++lane)
+            {
+                AmAudioSample* output = outputs[lane] + offset;
+                for (AmSize i = 0; i < length; ++i)
+                    output[i] = samples[i * lanes + lane];
+            }
+        }
+
+        // Land exactly on the target coefficients
+        for (AmSize st = 0; st < _stageCount; ++st)
+        {
+            Stage& s = _stages[st];
+
+            if (!s.m_Interpolating)
+                continue;
+
+            for (AmSize lane = 0; lane < kMaxLanes; ++lane)
+            {
+                const BiquadCoefficients& target = s.m_Target[lane];
+                s.m_Coefficients[0][lane] = target.m_A0;
+                s.m_Coefficients[1][lane] = target.m_A1;
+                s.m_Coefficients[2][lane] = target.m_A2;
+                s.m_Coefficients[3][lane] = target.m_B1;
+                s.m_Coefficients[4][lane] = target.m_B2;
+            }
+
+            s.m_Interpolating = false;
+        }
+    }
+
+    void BiquadCascade::ProcessBlock(AmReal32* samples, AmSize lanes, AmSize frames)
+    {
+        const auto& kernels = GetSimdKernels();
+
+        for (AmSize st = 0; st < _stageCount; ++st)
+        {
+            Stage& s = _stages[st];
+
+            // The kernel keeps the coefficients and the state of each group of lanes in registers for the whole block
+            kernels.m_BiquadSection(
+                samples, lanes, frames, s.m_Coefficients[0], s.m_Interpolating ? s.m_Steps[0] : nullptr, s.m_State[0], kMaxLanes);
+        }
+    }
+} // namespace SparkyStudios::Audio::Amplitude
@@ -0,0 +1,167 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef _AM_DSP_BIQUAD_CASCADE_H
+#define _AM_DSP_BIQUAD_CASCADE_H
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    /**
+     * @brief The coefficients of a single biquad section.
+     *
+     * The section computes `y[n] = a0 * x[n] + a1 * x[n-1] + a2 * x[n-2] - b1 * y[n-1] - b2 * y[n-2]`.
+     */
+    struct BiquadCoefficients
+    {
+        AmReal32 m_A0 = 1.0f;
+        AmReal32 m_A1 = 0.0f;
+        AmReal32 m_A2 = 0.0f;
+        AmReal32 m_B1 = 0.0f;
+        AmReal32 m_B2 = 0.0f;
+
+        /**
+         * @brief Gets the coefficients of a section which outputs its input unchanged.
+         */
+        static BiquadCoefficients Identity();
+
+        /**
+         * @brief Gets the coefficients of a one-pole low pass section.
+         *
+         * This matches the response of the @c MonoPoleFilter, that is `y[n] = (1 - c) * x[n] + c * y[n-1]`.
+         *
+         * @param coefficient The smoothing coefficient, in the range [0, 1].
+         */
+        static BiquadCoefficients OnePoleLowPass(AmReal32 coefficient);
+
+        bool operator==(const BiquadCoefficients& other) const;
+        bool operator!=(const BiquadCoefficients& other) const;
+    };
+
+    /**
+     * @brief Runs a cascade of biquad sections on several independent signals at once.
+     *
+     * Each signal is a lane of the cascade. Lanes can be the channels of a buffer, the outputs
+     * of several voices, or copies of the same signal filtered by different bands. The lanes are
+     * processed side by side in SIMD registers, using the transposed direct form II of each section.
+     *
+     * Every lane of every section has its own coefficients. When coefficients change, the next
+     * processed block linearly interpolates from the old coefficients to the new ones to avoid
+     * zipper noise.
+     */
+    class BiquadCascade
+    {
+    public:
+        /**
+         * @brief The maximum number of lanes processed by a cascade.
+         */
+        static constexpr AmSize kMaxLanes = kAmMaxSupportedChannelCount;
+
+        /**
+         * @brief The maximum number of sections in a cascade.
+         */
+        static constexpr AmSize kMaxStages = 4;
+
+        /**
+         * @brief Creates a new biquad cascade.
+         *
+         * @param stageCount The number of biquad sections in the cascade. All the sections
+         * are initialized to the identity.
+         */
+        explicit BiquadCascade(AmSize stageCount = 1);
+
+        /**
+         * @brief Gets the number of biquad sections in the cascade.
+         */
+        [[nodiscard]] AmSize GetStageCount() const;
+
+        /**
+         * @brief Sets the coefficients of a section for all the lanes.
+         *
+         * @param stage The section index.
+         * @param coefficients The new coefficients.
+         * @param interpolate Whether to interpolate from the current coefficients during the next block.
+         */
+        void SetCoefficients(AmSize stage, const BiquadCoefficients& coefficients, bool interpolate = true);
+
+        /**
+         * @brief Sets the coefficients of a section for a single lane.
+         *
+         * @param stage The section index.
+         * @param lane The lane index.
+         * @param coefficients The new coefficients.
+         * @param interpolate Whether to interpolate from the current coefficients during the next block.
+         */
+        void SetCoefficients(AmSize stage, AmSize lane, const BiquadCoefficients& coefficients, bool interpolate = true);
+
+        /**
+         * @brief Gets the coefficients the given section and lane will reach at the end of the next block.
+         *
+         * @param stage The section index.
+         * @param lane The lane index.
+         */
+        [[nodiscard]] BiquadCoefficients GetCoefficients(AmSize stage, AmSize lane) const;
+
+        /**
+         * @brief Checks whether the next processed block will interpolate coefficients.
+         */
+        [[nodiscard]] bool IsInterpolating() const;
+
+        /**
+         * @brief Clears the state of every lane.
+         */
+        void Reset();
+
+        /**
+         * @brief Filters the given lanes.
+         *
+         * Inputs and outputs may point to the same buffers.
+         *
+         * @param inputs The input samples of each lane.
+         * @param outputs The output samples of each lane.
+         * @param laneCount The number of lanes to process.
+         * @param frames The number of samples in each lane.
+         */
+        void Process(const AmAudioSample* const* inputs, AmAudioSample* const* outputs, AmSize laneCount, AmSize frames);
+
+        /**
+         * @brief Filters every channel of the given buffer, one channel per lane.
+         *
+         * @param in The input buffer.
+         * @param out The output buffer. May be the same as the input buffer.
+         * @param frames The number of frames to process.
+         */
+        void Process(const AudioBuffer& in, AudioBuffer& out, AmSize frames);
+
+    private:
+        struct Stage
+        {
+            AmReal32 m_Coefficients[5][kMaxLanes];
+            AmReal32 m_Steps[5][kMaxLanes];
+            AmReal32 m_State[2][kMaxLanes];
+            BiquadCoefficients m_Target[kMaxLanes];
+            bool m_Interpolating;
+        };
+
+        void ProcessBlock(AmReal32* samples, AmSize lanes, AmSize frames);
+
+        AmSize _stageCount;
+        Stage _stages[kMaxStages];
+    };
+} // namespace SparkyStudios::Audio::Amplitude
+
+#endif // _AM_DSP_BIQUAD_CASCADE_H
@@ -104,7 +104,11 @@ namespace SparkyStudios::Audio::Amplitude
 
         // Prepare segments
         for (AmSize i = 0; i < _segCount; ++i)
-            _segments.push_back(ampoolnew(eMemoryPoolKind_Filtering, SplitComplex, _fftComplexSize));
+        {
+            auto* segment = ampoolnew(eMemoryPoolKind_Filtering, SplitComplex, _fftComplexSize);
+            segment->Clear();
+            _segments.push_back(segment);
+        }
 
         // Prepare IR
         for (AmSize i = 0; i < _segCount; ++i)
@@ -149,7 +153,7 @@ namespace SparkyStudios::Audio::Amplitude
             std::memcpy(_inputBuffer.GetBuffer() + inputBufferPos, input + processed, processing * sizeof(AmAudioSample));
 
             // Forward FFT
-            CopyAndPad(_fftBuffer, _inputBuffer.GetBuffer(), processing);
+            CopyAndPad(_fftBuffer, _inputBuffer.GetBuffer(), _blockSize);
             _fft.Forward(_fftBuffer.GetBuffer(), *_segments[_current]);
 
             // Complex multiplication
@@ -12,7 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include <ranges>
+#include <algorithm>
 
 #include <DSP/Delay.h>
 
@@ -83,8 +83,14 @@ namespace SparkyStudios::Audio::Amplitude
 
     void Delay::Insert(const AudioBufferChannel& channel)
     {
-        AMPLITUDE_ASSERT(_buffer != nullptr);
         AMPLITUDE_ASSERT(channel.size() == _framesCount);
+        Insert(channel, _framesCount);
+    }
+
+    void Delay::Insert(const AudioBufferChannel& channel, AmSize frames)
+    {
+        AMPLITUDE_ASSERT(_buffer != nullptr);
+        AMPLITUDE_ASSERT(frames <= _framesCount && frames <= channel.size());
 
         const AmSize delayBufferSize = _buffer->GetFrameCount();
 
@@ -93,52 +99,54 @@ namespace SparkyStudios::Audio::Amplitude
         AudioBufferChannel* delayChannel = &_buffer->GetChannel(0);
 
         // Copy the channel into the delay line.
-        if (remainingSizeWrite >= _framesCount)
+        if (remainingSizeWrite >= frames)
         {
-            AMPLITUDE_ASSERT(delayChannel->begin() + _writePos + _framesCount <= delayChannel->end());
-            std::ranges::copy(channel, delayChannel->begin() + _writePos);
+            AMPLITUDE_ASSERT(delayChannel->begin() + _writePos + frames <= delayChannel->end());
+            std::copy_n(channel.begin(), frames, delayChannel->begin() + _writePos);
         }
         else
         {
             AMPLITUDE_ASSERT(delayChannel->begin() + _writePos + remainingSizeWrite <= delayChannel->end());
-            AMPLITUDE_ASSERT(channel.begin() + remainingSizeWrite <= channel.end());
             std::copy_n(channel.begin(), remainingSizeWrite, delayChannel->begin() + _writePos);
-            AMPLITUDE_ASSERT(delayChannel->begin() + remainingSizeWrite <= delayChannel->end());
-            std::copy(channel.begin() + remainingSizeWrite, channel.end(), delayChannel->begin());
+            AMPLITUDE_ASSERT(delayChannel->begin() + frames - remainingSizeWrite <= delayChannel->end());
+            std::copy_n(channel.begin() + remainingSizeWrite, frames - remainingSizeWrite, delayChannel->begin());
         }
 
-        _writePos = (_writePos + _framesCount) % delayBufferSize;
+        _writePos = (_writePos + frames) % delayBufferSize;
     }
 
     void Delay::Process(AudioBufferChannel& channel, AmSize delaySamples)
+    {
+        Process(channel, delaySamples, _framesCount);
+    }
+
+    void Delay::Process(AudioBufferChannel& channel, AmSize delaySamples, AmSize frames)
     {
         AMPLITUDE_ASSERT(_buffer != nullptr);
         AMPLITUDE_ASSERT(delaySamples >= 0U);
         AMPLITUDE_ASSERT(delaySamples <= _maxDelay);
+        AMPLITUDE_ASSERT(frames <= _framesCount && frames <= channel.size());
 
         const AmSize delayBufferSize = _buffer->GetFrameCount();
         // Position in the delay line to begin reading from.
-        AMPLITUDE_ASSERT(_writePos + delayBufferSize >= delaySamples + _framesCount);
-        const AmSize readCursor = (_writePos + delayBufferSize - delaySamples - _framesCount) % delayBufferSize;
+        AMPLITUDE_ASSERT(_writePos + delayBufferSize >= delaySamples + frames);
+        const AmSize readCursor = (_writePos + delayBufferSize - delaySamples - frames) % delayBufferSize;
         // Record the remaining space in the _buffer after the read cursor.
         const AmSize remainingSizeRead = delayBufferSize - readCursor;
         AudioBufferChannel* delayChannel = &(*_buffer)[0];
 
         // Extract a portion of the delay line into the channel.
-        if (remainingSizeRead >= _framesCount)
+        if (remainingSizeRead >= frames)
         {
-            AMPLITUDE_ASSERT(channel.begin() + _framesCount <= channel.end());
-            AMPLITUDE_ASSERT(delayChannel->begin() + readCursor + _framesCount <= delayChannel->end());
-            std::copy_n(delayChannel->begin() + readCursor, _framesCount, channel.begin());
+            AMPLITUDE_ASSERT(delayChannel->begin() + readCursor + frames <= delayChannel->end());
+            std::copy_n(delayChannel->begin() + readCursor, frames, channel.begin());
         }
         else
         {
-            AMPLITUDE_ASSERT(channel.begin() + delayChannel->size() - readCursor <= channel.end());
             std::copy(delayChannel->begin() + readCursor, delayChannel->end(), channel.begin());
 
-            AMPLITUDE_ASSERT(channel.begin() + _framesCount <= channel.end());
-            AMPLITUDE_ASSERT(delayChannel->begin() + _framesCount - remainingSizeRead <= delayChannel->end());
-            std::copy_n(delayChannel->begin(), _framesCount - remainingSizeRead, channel.begin() + remainingSizeRead);
+            AMPLITUDE_ASSERT(delayChannel->begin() + frames - remainingSizeRead <= delayChannel->end());
+            std::copy_n(delayChannel->begin(), frames - remainingSizeRead, channel.begin() + remainingSizeRead);
         }
     }
 } // namespace SparkyStudios::Audio::Amplitude
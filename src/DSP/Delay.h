@@ -34,7 +34,7 @@ namespace SparkyStudios::Audio::Amplitude
          * @brief Creates a new delay line.
          *
          * @param maxDelay The maximum delay in milliseconds.
-         * @param framesCount The number of frames in each input/output buffer.
+         * @param framesCount The maximum number of frames in each input/output buffer.
          */
         explicit Delay(AmSize maxDelay, AmSize framesCount);
 
@@ -76,6 +76,14 @@ namespace SparkyStudios::Audio::Amplitude
          */
         void Insert(const AudioBufferChannel& channel);
 
+        /**
+         * @brief Copies the first frames of an audio buffer channel to the delay line buffer.
+         *
+         * @param channel The audio buffer channel to copy.
+         * @param frames The number of frames to copy. Must not exceed the frame count of the delay line.
+         */
+        void Insert(const AudioBufferChannel& channel, AmSize frames);
+
         /**
          * @brief Fills an audio buffer channel with data delayed by a given
          * amount less or equal to the delay line's maximum length.
@@ -86,6 +94,17 @@ namespace SparkyStudios::Audio::Amplitude
          */
         void Process(AudioBufferChannel& channel, AmSize delay);
 
+        /**
+         * @brief Fills the first frames of an audio buffer channel with data delayed by a given
+         * amount less or equal to the delay line's maximum length.
+         *
+         * @param channel The audio buffer channel to fill.
+         * @param delay The delay in number of samples. The delay must be less
+         * or equal to the delay line's maximum length.
+         * @param frames The number of frames to fill, as given to the last call to @ref Insert `Insert()`.
+         */
+        void Process(AudioBufferChannel& channel, AmSize delay, AmSize frames);
+
     private:
         AmSize _maxDelay;
         AmSize _framesCount;
@@ -0,0 +1,318 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Delay line tunings and parameter scales based on code written by Jezar at Dreampoint,
+// June 2000 http://www.dreampoint.co.uk, which was placed in public domain.
+
+#include <numeric>
+
+#include <DSP/FDNReverb.h>
+#include <Utils/Utils.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    // Number of frames processed at once. Must not exceed the shortest delay line.
+    constexpr AmSize kFDNBlockFrames = 64;
+
+    // Delay line lengths at 44.1kHz, the left and right comb tunings of Freeverb
+    constexpr AmSize kFDNLineTunings[FDNReverb::kLineCount] = { 1116, 1188, 1277, 1356, 1422, 1491, 1557, 1617,
+                                                                1139, 1211, 1300, 1379, 1445, 1514, 1580, 1640 };
+
+    // Parameter scales, matching the Freeverb model
+    constexpr AmReal32 kFDNInputGain = 0.015f;
+    constexpr AmReal32 kFDNScaleWet = 3.0f;
+    constexpr AmReal32 kFDNScaleDamp = 0.4f;
+    constexpr AmReal32 kFDNScaleRoom = 0.28f;
+    constexpr AmReal32 kFDNOffsetRoom = 0.7f;
+
+    // Tiny offset keeping the damping filters out of denormal numbers while the tail decays
+    constexpr AmReal32 kFDNAntiDenormal = 1e-18f;
+
+#if defined(AM_SIMD_INTRINSICS)
+    typedef simd_batch lane_batch;
+
+    AM_INLINE lane_batch LoadLines(const AmReal32* source)
+    {
+        return xsimd::load_unaligned<simd_arch>(source);
+    }
+
+    AM_INLINE void StoreLines(AmReal32* destination, const lane_batch& value)
+    {
+        value.store_unaligned(destination);
+    }
+
+    AM_INLINE AmReal32 SumLines(const lane_batch& value)
+    {
+        return xsimd::reduce_add(value);
+    }
+#else
+    typedef AmReal32 lane_batch;
+
+    AM_INLINE lane_batch LoadLines(const AmReal32* source)
+    {
+        return *source;
+    }
+
+    AM_INLINE void StoreLines(AmReal32* destination, const lane_batch& value)
+    {
+        *destination = value;
+    }
+
+    AM_INLINE AmReal32 SumLines(const lane_batch& value)
+    {
+        return value;
+    }
+#endif // AM_SIMD_INTRINSICS
+
+    FDNReverb::FDNReverb()
+        : _sampleRate(0)
+        , _roomSize(0.5f)
+        , _damp(0.5f)
+        , _width(1.0f)
+        , _wet(1.0f)
+        , _feedback(0.0f)
+        , _damp1(0.0f)
+        , _damp2(0.0f)
+        , _wet1(0.0f)
+        , _wet2(0.0f)
+        , _dirty(true)
+        , _lines()
+        , _lineOffsets{}
+        , _lineLengths{}
+        , _linePositions{}
+        , _filterStore{}
+    {}
+
+    void FDNReverb::Initialize(AmUInt32 sampleRate)
+    {
+        if (sampleRate == _sampleRate)
+            return;
+
+        _sampleRate = sampleRate;
+
+        const AmReal32 scale = static_cast<AmReal32>(sampleRate) / 44100.0f;
+
+        AmSize totalLength = 0;
+        for (AmSize i = 0; i < kLineCount; ++i)
+        {
+            _lineOffsets[i] = totalLength;
+            _lineLengths[i] = AM_MAX(static_cast<AmSize>(static_cast<AmReal32>(kFDNLineTunings[i]) * scale), kFDNBlockFrames);
+            totalLength += _lineLengths[i];
+        }
+
+        _lines.Resize(static_cast<AmUInt32>(totalLength));
+        Clear();
+    }
+
+    AmUInt32 FDNReverb::GetSampleRate() const
+    {
+        return _sampleRate;
+    }
+
+    void FDNReverb::Clear()
+    {
+        _lines.Clear();
+
+        std::fill_n(_linePositions, kLineCount, 0);
+        std::fill_n(_filterStore, kLineCount, 0.0f);
+    }
+
+    void FDNReverb::SetRoom(const RoomInternalState* room)
+    {
+        AmReal32 maxSurface = 0.0f;
+
+        for (AmUInt32 i = 0; i < kAmRoomSurfaceCount; ++i)
+            if (const AmReal32 surface = room->GetSurfaceArea(static_cast<RoomWall>(i)); surface > maxSurface)
+                maxSurface = surface;
+
+        if (maxSurface > kEpsilon)
+            SetRoomSize(room->GetVolume() / (maxSurface * AM_SqrtF(maxSurface)));
+
+        const auto* coefficients = room->GetCoefficients();
+        SetDamp(std::accumulate(coefficients, coefficients + kAmRoomSurfaceCount, 0.0f) / kAmRoomSurfaceCount);
+    }
+
+    void FDNReverb::SetRoomSize(AmReal32 value)
+    {
+        _roomSize = value;
+        _dirty = true;
+    }
+
+    AmReal32 FDNReverb::GetRoomSize() const
+    {
+        return _roomSize;
+    }
+
+    void FDNReverb::SetDamp(AmReal32 value)
+    {
+        _damp = value;
+        _dirty = true;
+    }
+
+    AmReal32 FDNReverb::GetDamp() const
+    {
+        return _damp;
+    }
+
+    void FDNReverb::SetWidth(AmReal32 value)
+    {
+        _width = value;
+        _dirty = true;
+    }
+
+    AmReal32 FDNReverb::GetWidth() const
+    {
+        return _width;
+    }
+
+    void FDNReverb::SetWet(AmReal32 value)
+    {
+        _wet = value;
+        _dirty = true;
+    }
+
+    AmReal32 FDNReverb::GetWet() const
+    {
+        return _wet;
+    }
+
+    void FDNReverb::Update()
+    {
+        // Keep the loop gain below 1, the Householder matrix doesn't change the energy
+        _feedback = AM_MIN(_roomSize * kFDNScaleRoom + kFDNOffsetRoom, 0.99f);
+
+        _damp1 = AM_CLAMP(_damp, 0.0f, 1.0f) * kFDNScaleDamp;
+        _damp2 = 1.0f - _damp1;
+
+        const AmReal32 wet = _wet * kFDNScaleWet;
+        _wet1 = wet * (_width / 2.0f + 0.5f);
+        _wet2 = wet * ((1.0f - _width) / 2.0f);
+
+        _dirty = false;
+    }
+
+    void FDNReverb::Process(const AmAudioSample* input, AmAudioSample* outputL, AmAudioSample* outputR, AmSize frames)
+    {
+        AMPLITUDE_ASSERT(_sampleRate > 0);
+
+        if (_dirty)
+            Update();
+
+        alignas(AM_SIMD_ALIGNMENT) AmReal32 taps[kFDNBlockFrames * kLineCount];
+        AmReal32 sums[2][kFDNBlockFrames];
+
+        for (AmSize offset = 0; offset < frames; offset += kFDNBlockFrames)
+        {
+            const AmSize length = AM_MIN(kFDNBlockFrames, frames - offset);
+
+            std::fill_n(sums[0], length, 0.0f);
+            std::fill_n(sums[1], length, 0.0f);
+
+            // Read the outputs of the delay lines, interleaved so that each frame holds one sample per line.
+            // The first half of the lines feeds the left side, the second half feeds the right side.
+            for (AmSize line = 0; line < kLineCount; ++line)
+            {
+                const AmReal32* buffer = _lines.GetBuffer() + _lineOffsets[line];
+                const AmSize position = _linePositions[line];
+                const AmSize head = AM_MIN(length, _lineLengths[line] - position);
+
+                AmReal32* sum = sums[line < kLineCount / 2 ? 0 : 1];
+
+                for (AmSize i = 0; i < head; ++i)
+                {
+                    taps[i * kLineCount + line] = buffer[position + i];
+                    sum[i] += buffer[position + i];
+                }
+
+                for (AmSize i = head; i < length; ++i)
+                {
+                    taps[i * kLineCount + line] = buffer[i - head];
+                    sum[i] += buffer[i - head];
+                }
+            }
+
+            ProcessBlock(taps, input + offset, length);
+
+            // Write the feedback back into the delay lines. Each line is longer than a block,
+            // so these samples are only read in a later block.
+            for (AmSize line = 0; line < kLineCount; ++line)
+            {
+                AmReal32* buffer = _lines.GetBuffer() + _lineOffsets[line];
+                const AmSize position = _linePositions[line];
+                const AmSize head = AM_MIN(length, _lineLengths[line] - position);
+
+                for (AmSize i = 0; i < head; ++i)
+                    buffer[position + i] = taps[i * kLineCount + line];
+
+                for (AmSize i = head; i < length; ++i)
+                    buffer[i - head] = taps[i * kLineCount + line];
+
+                _linePositions[line] = head < length ? length - head : position + length;
+            }
+
+            // The input has been consumed, the outputs can now overwrite it
+            AmAudioSample* left = outputL + offset;
+            AmAudioSample* right = outputR + offset;
+
+            for (AmSize i = 0; i < length; ++i)
+            {
+                left[i] = sums[0][i] * _wet1 + sums[1][i] * _wet2;
+                right[i] = sums[1][i] * _wet1 + sums[0][i] * _wet2;
+            }
+        }
+    }
+
+    void FDNReverb::ProcessBlock(AmReal32* taps, const AmAudioSample* input, AmSize frames)
+    {
+        constexpr AmSize blockSize = GetSimdBlockSize();
+        constexpr AmSize groups = kLineCount / blockSize;
+
+        static_assert(kLineCount % blockSize == 0, "The delay lines must fill whole SIMD registers");
+
+        const lane_batch feedback(_feedback);
+        const lane_batch damp1(_damp1);
+        const lane_batch damp2(_damp2);
+        const lane_batch antiDenormal(kFDNAntiDenormal);
+
+        // Keep the damping filters state in registers for the whole block
+        lane_batch store[groups];
+        for (AmSize g = 0; g < groups; ++g)
+            store[g] = LoadLines(_filterStore + g * blockSize);
+
+        for (AmSize i = 0; i < frames; ++i)
+        {
+            AmReal32* frame = taps + i * kLineCount;
+
+            lane_batch lines[groups];
+            lane_batch sum(0.0f);
+
+            for (AmSize g = 0; g < groups; ++g)
+            {
+                // Damped feedback, as in the Freeverb combs
+                store[g] = LoadLines(frame + g * blockSize) * damp2 + store[g] * damp1 + antiDenormal;
+                lines[g] = store[g] * feedback;
+                sum += lines[g];
+            }
+
+            // Householder feedback matrix, I - 2/N * ones, then inject the input in every line
+            const lane_batch reflection(SumLines(sum) * (-2.0f / static_cast<AmReal32>(kLineCount)) + input[i] * kFDNInputGain);
+
+            for (AmSize g = 0; g < groups; ++g)
+                StoreLines(frame + g * blockSize, lines[g] + reflection);
+        }
+
+        for (AmSize g = 0; g < groups; ++g)
+            StoreLines(_filterStore + g * blockSize, store[g]);
+    }
+} // namespace SparkyStudios::Audio::Amplitude
@@ -0,0 +1,160 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef _AM_DSP_FDN_REVERB_H
+#define _AM_DSP_FDN_REVERB_H
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+#include <Core/RoomInternalState.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    /**
+     * @brief A feedback delay network reverb.
+     *
+     * The reverb feeds a mono input into 16 damped delay lines, mixed together by a
+     * Householder feedback matrix. The delay lines are processed side by side in SIMD
+     * lanes, one block at a time. Half of the delay lines feed the left output and the
+     * other half feed the right output.
+     *
+     * The room size, damping and width parameters have the same ranges and meaning as in
+     * the Freeverb model. The reverb doesn't depend on a sound, so the same instance can
+     * process a single voice, or the mix of all the voices sent to a room.
+     */
+    class FDNReverb
+    {
+    public:
+        /**
+         * @brief The number of delay lines in the network.
+         */
+        static constexpr AmSize kLineCount = 16;
+
+        /**
+         * @brief Creates a new reverb.
+         *
+         * The reverb must be initialized with a sample rate before processing.
+         */
+        FDNReverb();
+
+        /**
+         * @brief Allocates the delay lines for the given sample rate.
+         *
+         * Does nothing if the reverb is already initialized with the same sample rate.
+         *
+         * @param sampleRate The sample rate of the processed signals.
+         */
+        void Initialize(AmUInt32 sampleRate);
+
+        /**
+         * @brief Gets the sample rate the reverb is initialized with.
+         */
+        [[nodiscard]] AmUInt32 GetSampleRate() const;
+
+        /**
+         * @brief Clears the delay lines, cutting the reverb tail.
+         */
+        void Clear();
+
+        /**
+         * @brief Sets the room size and damping from the state of a room.
+         *
+         * The room size grows with the room volume relative to its largest wall, and the damping
+         * is the average absorption of the room walls.
+         *
+         * @param room The room state.
+         */
+        void SetRoom(const RoomInternalState* room);
+
+        /**
+         * @brief Sets the room size, in the range [0, 1].
+         */
+        void SetRoomSize(AmReal32 value);
+
+        /**
+         * @brief Gets the room size.
+         */
+        [[nodiscard]] AmReal32 GetRoomSize() const;
+
+        /**
+         * @brief Sets the high frequency damping, in the range [0, 1].
+         */
+        void SetDamp(AmReal32 value);
+
+        /**
+         * @brief Gets the high frequency damping.
+         */
+        [[nodiscard]] AmReal32 GetDamp() const;
+
+        /**
+         * @brief Sets the stereo width, in the range [0, 1].
+         */
+        void SetWidth(AmReal32 value);
+
+        /**
+         * @brief Gets the stereo width.
+         */
+        [[nodiscard]] AmReal32 GetWidth() const;
+
+        /**
+         * @brief Sets the output level, in the range [0, 1].
+         */
+        void SetWet(AmReal32 value);
+
+        /**
+         * @brief Gets the output level.
+         */
+        [[nodiscard]] AmReal32 GetWet() const;
+
+        /**
+         * @brief Processes a mono input and replaces the stereo outputs with the reverberated signal.
+         *
+         * The input may be the same buffer as one of the outputs.
+         *
+         * @param input The input samples.
+         * @param outputL The left output samples.
+         * @param outputR The right output samples.
+         * @param frames The number of samples to process.
+         */
+        void Process(const AmAudioSample* input, AmAudioSample* outputL, AmAudioSample* outputR, AmSize frames);
+
+    private:
+        void Update();
+        void ProcessBlock(AmReal32* taps, const AmAudioSample* input, AmSize frames);
+
+        AmUInt32 _sampleRate;
+
+        AmReal32 _roomSize;
+        AmReal32 _damp;
+        AmReal32 _width;
+        AmReal32 _wet;
+
+        AmReal32 _feedback;
+        AmReal32 _damp1;
+        AmReal32 _damp2;
+        AmReal32 _wet1;
+        AmReal32 _wet2;
+        bool _dirty;
+
+        AmAlignedReal32Buffer _lines;
+        AmSize _lineOffsets[kLineCount];
+        AmSize _lineLengths[kLineCount];
+        AmSize _linePositions[kLineCount];
+        AmReal32 _filterStore[kLineCount];
+    };
+} // namespace SparkyStudios::Audio::Amplitude
+
+#endif // _AM_DSP_FDN_REVERB_H
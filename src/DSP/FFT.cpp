@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
+
 #include <SparkyStudios/Audio/Amplitude/Core/Memory.h>
 #include <SparkyStudios/Audio/Amplitude/DSP/FFT.h>
 
@@ -21,14 +23,47 @@ using namespace SparkyStudios::Audio::Amplitude;
 
 namespace SparkyStudios::Audio::Amplitude
 {
+    static std::atomic<eFFTBackend> gDefaultBackend = AudioFFT::BuildBackend();
+
     AmUInt64 FFT::GetOutputSize(const AmUInt64 inputSize)
     {
         return AudioFFT::ComplexSize(inputSize);
     }
 
+    bool FFT::IsBackendAvailable(eFFTBackend backend)
+    {
+        return AudioFFT::IsAvailable(backend);
+    }
+
+    bool FFT::SetDefaultBackend(eFFTBackend backend)
+    {
+        if (!AudioFFT::IsAvailable(backend))
+            return false;
+
+        gDefaultBackend = backend;
+        return true;
+    }
+
+    eFFTBackend FFT::GetDefaultBackend()
+    {
+        return gDefaultBackend;
+    }
+
+    AmSize FFT::ReleaseUnusedPlans()
+    {
+        return AudioFFT::ReleaseUnusedPlans();
+    }
+
     FFT::FFT()
+        : FFT(eFFTBackend_Default)
+    {}
+
+    FFT::FFT(eFFTBackend backend)
     {
-        _implementation = ampoolnew(eMemoryPoolKind_Filtering, AudioFFT);
+        if (backend == eFFTBackend_Default || !AudioFFT::IsAvailable(backend))
+            backend = GetDefaultBackend();
+
+        _implementation = ampoolnew(eMemoryPoolKind_Filtering, AudioFFT, backend);
     }
 
     FFT::~FFT()
@@ -52,4 +87,9 @@ namespace SparkyStudios::Audio::Amplitude
         splitComplex.Resize(GetOutputSize(static_cast<AudioFFT*>(_implementation)->size()));
         static_cast<AudioFFT*>(_implementation)->ifft(output, splitComplex.re(), splitComplex.im());
     }
+
+    eFFTBackend FFT::GetBackend() const
+    {
+        return static_cast<AudioFFT*>(_implementation)->backend();
+    }
 } // namespace SparkyStudios::Audio::Amplitude
@@ -201,11 +201,11 @@ namespace SparkyStudios::Audio::Amplitude
 
     void FilterInstance::ProcessChannel(const AudioBuffer& in, AudioBuffer& out, AmUInt16 channel, AmUInt64 frames, AmUInt32 sampleRate)
     {
-        const auto& inChannel = in[channel];
-        auto& outChannel = out[channel];
+        const AmAudioSample* input = in[channel].begin();
+        AmAudioSample* output = out[channel].begin();
 
-        for (AmUInt64 s = 0, l = in.GetFrameCount(); s < l; s++)
-            outChannel[s] = ProcessSample(inChannel[s], channel, sampleRate);
+        for (AmUInt64 i = 0; i < frames; ++i)
+            output[i] = ProcessSample(input[i], channel, sampleRate);
     }
 
     AmAudioSample FilterInstance::ProcessSample(AmAudioSample sample, AmUInt16 channel, AmUInt32 sampleRate)
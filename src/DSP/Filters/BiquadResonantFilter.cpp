@@ -158,184 +158,207 @@ namespace SparkyStudios::Audio::Amplitude
         ampooldelete(eMemoryPoolKind_Filtering, BiquadResonantFilterInstance, (BiquadResonantFilterInstance*)instance);
     }
 
-    BiquadResonantFilterInstance::BiquadResonantFilterInstance(BiquadResonantFilter* parent)
-        : FilterInstance(parent)
-        , _state{}
-        , _a0(0)
-        , _a1(0)
-        , _a2(0)
-        , _b1(0)
-        , _b2(0)
+    BiquadCoefficients BiquadResonantFilter::ComputeCoefficients(
+        TYPE type, AmReal32 frequency, AmReal32 qOrS, AmReal32 gain, AmUInt32 sampleRate)
     {
-        for (auto&& i : _state)
-        {
-            i.x1 = 0;
-            i.y1 = 0;
-            i.x2 = 0;
-            i.y2 = 0;
-        }
-
-        Initialize(BiquadResonantFilter::ATTRIBUTE_LAST);
-
-        m_parameters[BiquadResonantFilter::ATTRIBUTE_GAIN] = parent->_gain;
-        m_parameters[BiquadResonantFilter::ATTRIBUTE_RESONANCE] = parent->_resonance;
-        m_parameters[BiquadResonantFilter::ATTRIBUTE_FREQUENCY] = parent->_frequency;
-        m_parameters[BiquadResonantFilter::ATTRIBUTE_TYPE] = static_cast<AmReal32>(parent->_filterType);
-
-        _sampleRate = 44100;
+        BiquadCoefficients c;
 
-        ComputeBiquadResonantParams();
-    }
-
-    void BiquadResonantFilterInstance::ProcessChannel(
-        const AudioBuffer& in, AudioBuffer& out, AmUInt16 channel, AmUInt64 frames, AmUInt32 sampleRate)
-    {
-        if (m_numParamsChanged &
-                (1 << BiquadResonantFilter::ATTRIBUTE_FREQUENCY | 1 << BiquadResonantFilter::ATTRIBUTE_RESONANCE |
-                 1 << BiquadResonantFilter::ATTRIBUTE_GAIN | 1 << BiquadResonantFilter::ATTRIBUTE_TYPE) ||
-            sampleRate != _sampleRate)
+        if (type == TYPE_DUAL_BAND_HIGH_PASS || type == TYPE_DUAL_BAND_LOW_PASS)
         {
-            _sampleRate = sampleRate;
-            ComputeBiquadResonantParams();
-        }
-
-        m_numParamsChanged = 0;
-
-        FilterInstance::ProcessChannel(in, out, channel, frames, sampleRate);
-    }
-
-    AmAudioSample BiquadResonantFilterInstance::ProcessSample(AmAudioSample sample, AmUInt16 channel, AmUInt32 sampleRate)
-    {
-        BiquadResonantStateData& state = _state[channel];
-
-        const AmReal32 x = sample;
-        /* */ AmReal32 y;
-
-        const AmReal32 x1 = state.x1;
-        const AmReal32 x2 = state.x2;
-        const AmReal32 y1 = state.y1;
-        const AmReal32 y2 = state.y2;
-
-        y = _a0 * x + _a1 * x1 + _a2 * x2 - _b1 * y1 - _b2 * y2;
-
-        state.x1 = x;
-        state.x2 = x1;
-        state.y1 = y;
-        state.y2 = y1;
-
-        y = x + (y - x) * m_parameters[BiquadResonantFilter::ATTRIBUTE_WET];
-
-        return static_cast<AmAudioSample>(y);
-    }
-
-    void BiquadResonantFilterInstance::ComputeBiquadResonantParams()
-    {
-        if (const auto type = static_cast<BiquadResonantFilter::TYPE>(m_parameters[BiquadResonantFilter::ATTRIBUTE_TYPE]);
-            type == BiquadResonantFilter::TYPE_DUAL_BAND_HIGH_PASS || type == BiquadResonantFilter::TYPE_DUAL_BAND_LOW_PASS)
-        {
-            const AmReal32 k =
-                std::tan(AM_PI32 * m_parameters[BiquadResonantFilter::ATTRIBUTE_FREQUENCY] / static_cast<AmReal32>(_sampleRate));
+            const AmReal32 k = std::tan(AM_PI32 * frequency / static_cast<AmReal32>(sampleRate));
             const AmReal32 k2 = k * k;
             const AmReal32 d = k2 + 2.0f * k + 1.0f;
 
             AMPLITUDE_ASSERT(d > kEpsilon);
 
-            _b1 = 2.0f * (k2 - 1.0f) / d;
-            _b2 = (k2 - 2.0f * k + 1.0f) / d;
+            c.m_B1 = 2.0f * (k2 - 1.0f) / d;
+            c.m_B2 = (k2 - 2.0f * k + 1.0f) / d;
 
-            if (type == BiquadResonantFilter::TYPE_DUAL_BAND_HIGH_PASS)
+            if (type == TYPE_DUAL_BAND_HIGH_PASS)
             {
-                _a0 = 1.0f / d;
-                _a1 = -2.0f * _a0;
-                _a2 = _a0;
+                c.m_A0 = 1.0f / d;
+                c.m_A1 = -2.0f * c.m_A0;
+                c.m_A2 = c.m_A0;
             }
 
-            if (type == BiquadResonantFilter::TYPE_DUAL_BAND_LOW_PASS)
+            if (type == TYPE_DUAL_BAND_LOW_PASS)
             {
-                _a0 = k2 / d;
-                _a1 = 2.0f * _a0;
-                _a2 = _a0;
+                c.m_A0 = k2 / d;
+                c.m_A1 = 2.0f * c.m_A0;
+                c.m_A2 = c.m_A0;
             }
 
-            return;
+            return c;
         }
 
-        const AmReal32 q = m_parameters[BiquadResonantFilter::ATTRIBUTE_RESONANCE];
-        const AmReal32 omega = 2.0f * AM_PI32 * m_parameters[BiquadResonantFilter::ATTRIBUTE_FREQUENCY] / static_cast<AmReal32>(_sampleRate);
+        const AmReal32 q = qOrS;
+        const AmReal32 omega = 2.0f * AM_PI32 * frequency / static_cast<AmReal32>(sampleRate);
         const AmReal32 sinOmega = std::sin(omega);
         const AmReal32 cosOmega = std::cos(omega);
-        const AmReal32 A = std::pow(10.0f, (m_parameters[BiquadResonantFilter::ATTRIBUTE_GAIN] / 40.0f));
+        const AmReal32 A = std::pow(10.0f, (gain / 40.0f));
 
         AmReal32 scalar, alpha, beta;
 
-        switch (static_cast<AmUInt32>(m_parameters[BiquadResonantFilter::ATTRIBUTE_TYPE]))
+        switch (type)
         {
         default:
-        case BiquadResonantFilter::TYPE_LOW_PASS:
+        case TYPE_LOW_PASS:
             alpha = sinOmega / (2.0f * q);
             scalar = 1.0f / (1.0f + alpha);
-            _a0 = 0.5f * (1.0f - cosOmega) * scalar;
-            _a1 = (1.0f - cosOmega) * scalar;
-            _a2 = _a0;
-            _b1 = -2.0f * cosOmega * scalar;
-            _b2 = (1.0f - alpha) * scalar;
+            c.m_A0 = 0.5f * (1.0f - cosOmega) * scalar;
+            c.m_A1 = (1.0f - cosOmega) * scalar;
+            c.m_A2 = c.m_A0;
+            c.m_B1 = -2.0f * cosOmega * scalar;
+            c.m_B2 = (1.0f - alpha) * scalar;
             break;
-        case BiquadResonantFilter::TYPE_HIGH_PASS:
+        case TYPE_HIGH_PASS:
             alpha = sinOmega / (2.0f * q);
             scalar = 1.0f / (1.0f + alpha);
-            _a0 = 0.5f * (1.0f + cosOmega) * scalar;
-            _a1 = -(1.0f + cosOmega) * scalar;
-            _a2 = _a0;
-            _b1 = -2.0f * cosOmega * scalar;
-            _b2 = (1.0f - alpha) * scalar;
+            c.m_A0 = 0.5f * (1.0f + cosOmega) * scalar;
+            c.m_A1 = -(1.0f + cosOmega) * scalar;
+            c.m_A2 = c.m_A0;
+            c.m_B1 = -2.0f * cosOmega * scalar;
+            c.m_B2 = (1.0f - alpha) * scalar;
             break;
-        case BiquadResonantFilter::TYPE_BAND_PASS:
+        case TYPE_BAND_PASS:
             alpha = sinOmega / (2.0f * q);
             scalar = 1.0f / (1.0f + alpha);
-            _a0 = q * alpha * scalar;
-            _a1 = 0.0f;
-            _a2 = -_a0;
-            _b1 = -2.0f * cosOmega * scalar;
-            _b2 = (1.0f - alpha) * scalar;
+            c.m_A0 = q * alpha * scalar;
+            c.m_A1 = 0.0f;
+            c.m_A2 = -c.m_A0;
+            c.m_B1 = -2.0f * cosOmega * scalar;
+            c.m_B2 = (1.0f - alpha) * scalar;
             break;
-        case BiquadResonantFilter::TYPE_PEAK:
+        case TYPE_PEAK:
             alpha = sinOmega / (2.0f * q);
             scalar = 1.0f / (1.0f + (alpha / A));
-            _a0 = (1.0f + (alpha * A)) * scalar;
-            _a1 = -2.0f * cosOmega * scalar;
-            _a2 = (1.0f - (alpha * A)) * scalar;
-            _b1 = -2.0f * cosOmega * scalar;
-            _b2 = (1.0f - (alpha / A)) * scalar;
+            c.m_A0 = (1.0f + (alpha * A)) * scalar;
+            c.m_A1 = -2.0f * cosOmega * scalar;
+            c.m_A2 = (1.0f - (alpha * A)) * scalar;
+            c.m_B1 = -2.0f * cosOmega * scalar;
+            c.m_B2 = (1.0f - (alpha / A)) * scalar;
             break;
-        case BiquadResonantFilter::TYPE_NOTCH:
+        case TYPE_NOTCH:
             alpha = sinOmega / (2.0f * q);
             scalar = 1.0f / (1.0f + alpha);
-            _a0 = 1.0f * scalar;
-            _a1 = -2.0f * cosOmega * scalar;
-            _a2 = _a0;
-            _b1 = -2.0f * cosOmega * scalar;
-            _b2 = (1.0f - alpha) * scalar;
+            c.m_A0 = 1.0f * scalar;
+            c.m_A1 = -2.0f * cosOmega * scalar;
+            c.m_A2 = c.m_A0;
+            c.m_B1 = -2.0f * cosOmega * scalar;
+            c.m_B2 = (1.0f - alpha) * scalar;
             break;
-        case BiquadResonantFilter::TYPE_LOW_SHELF:
+        case TYPE_LOW_SHELF:
             alpha = sinOmega / (2.0f * std::sqrt((A + 1.0f / A) * (1.0f / q - 1.0f) + 2.0f));
             beta = 2.0f * std::sqrt(A) * alpha;
             scalar = 1.0f / ((A + 1.0f) + (A - 1.0f) * cosOmega + beta);
-            _a0 = (A * ((A + 1.0f) - (A - 1.0f) * cosOmega + beta)) * scalar;
-            _a1 = (2.0f * A * ((A - 1.0f) - (A + 1.0f) * cosOmega)) * scalar;
-            _a2 = (A * ((A + 1.0f) - (A - 1.0f) * cosOmega - beta)) * scalar;
-            _b1 = (-2.0f * ((A - 1.0f) + (A + 1.0f) * cosOmega)) * scalar;
-            _b2 = ((A + 1.0f) + (A - 1.0f) * cosOmega - beta) * scalar;
+            c.m_A0 = (A * ((A + 1.0f) - (A - 1.0f) * cosOmega + beta)) * scalar;
+            c.m_A1 = (2.0f * A * ((A - 1.0f) - (A + 1.0f) * cosOmega)) * scalar;
+            c.m_A2 = (A * ((A + 1.0f) - (A - 1.0f) * cosOmega - beta)) * scalar;
+            c.m_B1 = (-2.0f * ((A - 1.0f) + (A + 1.0f) * cosOmega)) * scalar;
+            c.m_B2 = ((A + 1.0f) + (A - 1.0f) * cosOmega - beta) * scalar;
             break;
-        case BiquadResonantFilter::TYPE_HIGH_SHELF:
+        case TYPE_HIGH_SHELF:
             alpha = sinOmega / (2.0f * std::sqrt((A + 1.0f / A) * (1.0f / q - 1.0f) + 2.0f));
             beta = 2.0f * std::sqrt(A) * alpha;
             scalar = 1.0f / ((A + 1.0f) - (A - 1.0f) * cosOmega + beta);
-            _a0 = (A * ((A + 1.0f) + (A - 1.0f) * cosOmega + beta)) * scalar;
-            _a1 = (-2.0f * A * ((A - 1.0f) + (A + 1.0f) * cosOmega)) * scalar;
-            _a2 = (A * ((A + 1.0f) + (A - 1.0f) * cosOmega - beta)) * scalar;
-            _b1 = (2.0f * ((A - 1.0f) - (A + 1.0f) * cosOmega)) * scalar;
-            _b2 = ((A + 1.0f) - (A - 1.0f) * cosOmega - beta) * scalar;
+            c.m_A0 = (A * ((A + 1.0f) + (A - 1.0f) * cosOmega + beta)) * scalar;
+            c.m_A1 = (-2.0f * A * ((A - 1.0f) + (A + 1.0f) * cosOmega)) * scalar;
+            c.m_A2 = (A * ((A + 1.0f) + (A - 1.0f) * cosOmega - beta)) * scalar;
+            c.m_B1 = (2.0f * ((A - 1.0f) - (A + 1.0f) * cosOmega)) * scalar;
+            c.m_B2 = ((A + 1.0f) - (A - 1.0f) * cosOmega - beta) * scalar;
             break;
         }
+
+        return c;
+    }
+
+    BiquadResonantFilterInstance::BiquadResonantFilterInstance(BiquadResonantFilter* parent)
+        : FilterInstance(parent)
+        , _cascade(1)
+        , _sampleRate(44100)
+    {
+        Initialize(BiquadResonantFilter::ATTRIBUTE_LAST);
+
+        m_parameters[BiquadResonantFilter::ATTRIBUTE_GAIN] = parent->_gain;
+        m_parameters[BiquadResonantFilter::ATTRIBUTE_RESONANCE] = parent->_resonance;
+        m_parameters[BiquadResonantFilter::ATTRIBUTE_FREQUENCY] = parent->_frequency;
+        m_parameters[BiquadResonantFilter::ATTRIBUTE_TYPE] = static_cast<AmReal32>(parent->_filterType);
+
+        ComputeBiquadResonantParams(false);
+    }
+
+    void BiquadResonantFilterInstance::Process(const AudioBuffer& in, AudioBuffer& out, AmUInt64 frames, AmUInt32 sampleRate)
+    {
+        AMPLITUDE_ASSERT(out.GetChannelCount() >= in.GetChannelCount());
+
+        if (m_numParamsChanged &
+                (1 << BiquadResonantFilter::ATTRIBUTE_FREQUENCY | 1 << BiquadResonantFilter::ATTRIBUTE_RESONANCE |
+                 1 << BiquadResonantFilter::ATTRIBUTE_GAIN | 1 << BiquadResonantFilter::ATTRIBUTE_TYPE) ||
+            sampleRate != _sampleRate)
+        {
+            // Smooth parameter changes, but jump straight to the coefficients of a new sample rate
+            const bool interpolate = sampleRate == _sampleRate;
+
+            _sampleRate = sampleRate;
+            ComputeBiquadResonantParams(interpolate);
+        }
+
+        m_numParamsChanged = 0;
+
+        const AmSize channels = in.GetChannelCount();
+        const AmReal32 wet = m_parameters[BiquadResonantFilter::ATTRIBUTE_WET];
+
+        const AmAudioSample* inputs[kAmMaxSupportedChannelCount];
+        AmAudioSample* outputs[kAmMaxSupportedChannelCount];
+
+        for (AmSize c = 0; c < channels; ++c)
+        {
+            inputs[c] = in[c].begin();
+            outputs[c] = out[c].begin();
+        }
+
+        if (wet >= 1.0f)
+        {
+            _cascade.Process(inputs, outputs, channels, frames);
+            return;
+        }
+
+        // Keep a copy of the dry signal, the output may be the input buffer
+        constexpr AmSize kBlockFrames = 64;
+        AmAudioSample dry[kAmMaxSupportedChannelCount][kBlockFrames];
+
+        for (AmSize offset = 0; offset < frames; offset += kBlockFrames)
+        {
+            const AmSize length = AM_MIN(kBlockFrames, frames - offset);
+
+            const AmAudioSample* blockInputs[kAmMaxSupportedChannelCount];
+            AmAudioSample* blockOutputs[kAmMaxSupportedChannelCount];
+
+            for (AmSize c = 0; c < channels; ++c)
+            {
+                std::memcpy(dry[c], inputs[c] + offset, length * sizeof(AmAudioSample));
+                blockInputs[c] = inputs[c] + offset;
+                blockOutputs[c] = outputs[c] + offset;
+            }
+
+            _cascade.Process(blockInputs, blockOutputs, channels, length);
+
+            for (AmSize c = 0; c < channels; ++c)
+            {
+                AmAudioSample* output = blockOutputs[c];
+                for (AmSize i = 0; i < length; ++i)
+                    output[i] = dry[c][i] + (output[i] - dry[c][i]) * wet;
+            }
+        }
+    }
+
+    void BiquadResonantFilterInstance::ComputeBiquadResonantParams(bool interpolate)
+    {
+        const BiquadCoefficients coefficients = BiquadResonantFilter::ComputeCoefficients(
+            static_cast<BiquadResonantFilter::TYPE>(m_parameters[BiquadResonantFilter::ATTRIBUTE_TYPE]),
+            m_parameters[BiquadResonantFilter::ATTRIBUTE_FREQUENCY], m_parameters[BiquadResonantFilter::ATTRIBUTE_RESONANCE],
+            m_parameters[BiquadResonantFilter::ATTRIBUTE_GAIN], _sampleRate);
+
+        _cascade.SetCoefficients(0, coefficients, interpolate);
     }
-} // namespace SparkyStudios::Audio::Amplitude
\ No newline at end of file
+} // namespace SparkyStudios::Audio::Amplitude
@@ -19,31 +19,24 @@
 
 #include <SparkyStudios/Audio/Amplitude/DSP/Filter.h>
 
+#include <DSP/BiquadCascade.h>
+
 namespace SparkyStudios::Audio::Amplitude
 {
     class BiquadResonantFilter;
 
-    struct BiquadResonantStateData
-    {
-        AmReal32 y1, y2, x1, x2;
-    };
-
     class BiquadResonantFilterInstance : public FilterInstance
     {
     public:
         explicit BiquadResonantFilterInstance(BiquadResonantFilter* parent);
         ~BiquadResonantFilterInstance() override = default;
 
-    protected:
-        void ProcessChannel(const AudioBuffer& in, AudioBuffer& out, AmUInt16 channel, AmUInt64 frames, AmUInt32 sampleRate) override;
-
-        AmAudioSample ProcessSample(AmAudioSample sample, AmUInt16 channel, AmUInt32 sampleRate) override;
+        void Process(const AudioBuffer& in, AudioBuffer& out, AmUInt64 frames, AmUInt32 sampleRate) override;
 
     private:
-        void ComputeBiquadResonantParams();
+        void ComputeBiquadResonantParams(bool interpolate);
 
-        BiquadResonantStateData _state[kAmMaxSupportedChannelCount];
-        AmReal32 _a0, _a1, _a2, _b1, _b2;
+        BiquadCascade _cascade;
         AmUInt32 _sampleRate;
     };
 
@@ -99,6 +92,19 @@ namespace SparkyStudios::Audio::Amplitude
 
         AmResult InitializeDualBandHighPass(AmReal32 frequency);
 
+        /**
+         * @brief Computes the coefficients of a biquad section of the given type.
+         *
+         * @param type The filter type.
+         * @param frequency The cutoff or center frequency, in Hz.
+         * @param qOrS The Q factor, or the shelf slope for shelf filters.
+         * @param gain The gain in dB, used by peaking and shelf filters.
+         * @param sampleRate The sample rate of the filtered signal.
+         *
+         * @return The biquad coefficients.
+         */
+        static BiquadCoefficients ComputeCoefficients(TYPE type, AmReal32 frequency, AmReal32 qOrS, AmReal32 gain, AmUInt32 sampleRate);
+
         [[nodiscard]] AmUInt32 GetParamCount() const override;
 
         [[nodiscard]] AmString GetParamName(AmUInt32 index) const override;
@@ -51,7 +51,7 @@ namespace SparkyStudios::Audio::Amplitude
         , _offset(0)
     {
         Initialize(DCRemovalFilter::ATTRIBUTE_LAST);
-        SetParameter(DCRemovalFilter::ATTRIBUTE_LAST, parent->_length);
+        SetParameter(DCRemovalFilter::ATTRIBUTE_LENGTH, parent->_length);
     }
 
     DCRemovalFilterInstance::~DCRemovalFilterInstance()
@@ -70,36 +70,43 @@ namespace SparkyStudios::Audio::Amplitude
         }
 
         for (AmUInt16 c = 0; c < channels; c++)
-        {
-            const auto& inChannel = in[c];
-            auto& outChannel = out[c];
-
-            _offset = 0;
+            ProcessChannel(in, out, c, frames, sampleRate);
 
-            for (AmInt64 i = 0; i < frames; i++)
-            {
-                outChannel[i] = ProcessSample(inChannel[i], c, sampleRate);
-                _offset = (_offset + 1) % _bufferLength;
-            }
-        }
+        // All the channels share the same position in the history
+        _offset = (_offset + frames) % _bufferLength;
     }
 
-    AmAudioSample DCRemovalFilterInstance::ProcessSample(AmAudioSample sample, AmUInt16 channel, AmUInt32 sampleRate)
+    void DCRemovalFilterInstance::ProcessChannel(
+        const AudioBuffer& in, AudioBuffer& out, AmUInt16 channel, AmUInt64 frames, AmUInt32 sampleRate)
     {
-        const AmUInt64 o = _offset + channel * _bufferLength;
+        AmReal32* history = _buffer.GetBuffer() + channel * _bufferLength;
 
-        const AmReal32 x = sample;
-        /* */ AmReal32 y;
+        const AmReal32 scale = 1.0f / static_cast<AmReal32>(_bufferLength);
+        const AmReal32 wet = m_parameters[DCRemovalFilter::ATTRIBUTE_WET];
 
-        _totals[channel] -= _buffer[o];
-        _totals[channel] += x;
+        AmReal32 total = _totals[channel];
+        AmUInt64 offset = _offset;
 
-        _buffer[o] = x;
+        const AmAudioSample* input = in[channel].begin();
+        AmAudioSample* output = out[channel].begin();
+
+        for (AmUInt64 i = 0; i < frames; ++i)
+        {
+            const AmReal32 x = input[i];
 
-        y = x - _totals[channel] / static_cast<AmReal32>(_bufferLength);
-        y = x + (y - x) * m_parameters[DCRemovalFilter::ATTRIBUTE_WET];
+            total -= history[offset];
+            total += x;
+
+            history[offset] = x;
+
+            if (++offset == _bufferLength)
+                offset = 0;
+
+            const AmReal32 y = x - total * scale;
+            output[i] = static_cast<AmAudioSample>(x + (y - x) * wet);
+        }
 
-        return static_cast<AmAudioSample>(y);
+        _totals[channel] = total;
     }
 
     void DCRemovalFilterInstance::InitializeBuffer(AmUInt16 channels, AmUInt32 sampleRate)
@@ -32,7 +32,7 @@ namespace SparkyStudios::Audio::Amplitude
         void Process(const AudioBuffer& in, AudioBuffer& out, AmUInt64 frames, AmUInt32 sampleRate) override;
 
     protected:
-        AmAudioSample ProcessSample(AmAudioSample sample, AmUInt16 channel, AmUInt32 sampleRate) override;
+        void ProcessChannel(const AudioBuffer& in, AudioBuffer& out, AmUInt16 channel, AmUInt64 frames, AmUInt32 sampleRate) override;
 
     private:
         void InitializeBuffer(AmUInt16 channels, AmUInt32 sampleRate);
@@ -85,7 +85,6 @@ namespace SparkyStudios::Audio::Amplitude
     {
         _buffer = nullptr;
         _bufferLength = 0;
-        _bufferOffset = 0;
         _bufferMaxLength = 0;
         _offset = 0;
 
@@ -111,47 +110,54 @@ namespace SparkyStudios::Audio::Amplitude
         InitializeBuffer(channels, sampleRate);
 
         for (AmUInt16 c = 0; c < channels; c++)
-        {
-            const auto& inChannel = in[c];
-            auto& outChannel = out[c];
-
-            _offset = 0;
-
-            for (AmUInt64 f = 0; f < frames; f++)
-            {
-                _bufferOffset = c * _bufferLength + _offset;
+            ProcessChannel(in, out, c, frames, sampleRate);
 
-                outChannel[f] = ProcessSample(inChannel[f], c, sampleRate);
-                _offset = (_offset + 1) % _bufferLength;
-            }
-        }
+        // All the channels share the same position in the delay line
+        _offset = (_offset + frames) % _bufferLength;
     }
 
-    AmAudioSample DelayFilterInstance::ProcessSample(AmAudioSample sample, AmUInt16 channel, AmUInt32 sampleRate)
+    void DelayFilterInstance::ProcessChannel(const AudioBuffer& in, AudioBuffer& out, AmUInt16 channel, AmUInt64 frames, AmUInt32 sampleRate)
     {
-        const AmUInt32 o = _bufferOffset;
+        AmReal32* line = _buffer + channel * _bufferLength;
+
+        const AmReal32 wet = m_parameters[DelayFilter::ATTRIBUTE_WET];
+        const AmReal32 decay = m_parameters[DelayFilter::ATTRIBUTE_DECAY];
 
-        const AmReal32 x = sample;
-        /* */ AmReal32 y;
+        AmUInt32 offset = _offset;
+
+        const AmAudioSample* input = in[channel].begin();
+        AmAudioSample* output = out[channel].begin();
 
         if (m_parameters[DelayFilter::ATTRIBUTE_DELAY_START] != 0.0f)
         {
-            // Read first
-            y = _buffer[o] * m_parameters[DelayFilter::ATTRIBUTE_WET];
+            for (AmUInt64 i = 0; i < frames; ++i)
+            {
+                // Read first
+                const AmReal32 y = line[offset] * wet;
 
-            // Produce feedback
-            _buffer[o] = _buffer[o] * m_parameters[DelayFilter::ATTRIBUTE_DECAY] + x;
+                // Produce feedback
+                line[offset] = line[offset] * decay + input[i];
+
+                output[i] = static_cast<AmAudioSample>(y);
+
+                if (++offset == _bufferLength)
+                    offset = 0;
+            }
         }
         else
         {
-            // Produce feedback first
-            _buffer[o] = _buffer[o] * m_parameters[DelayFilter::ATTRIBUTE_DECAY] + x;
+            for (AmUInt64 i = 0; i < frames; ++i)
+            {
+                // Produce feedback first
+                line[offset] = line[offset] * decay + input[i];
 
-            // Read
-            y = _buffer[o] * m_parameters[DelayFilter::ATTRIBUTE_WET];
-        }
+                // Read
+                output[i] = static_cast<AmAudioSample>(line[offset] * wet);
 
-        return static_cast<AmAudioSample>(y);
+                if (++offset == _bufferLength)
+                    offset = 0;
+            }
+        }
     }
 
     void DelayFilterInstance::InitializeBuffer(AmUInt16 channels, AmUInt32 sampleRate)
@@ -162,7 +168,6 @@ namespace SparkyStudios::Audio::Amplitude
         if (_buffer == nullptr)
         {
             _offset = 0;
-            _bufferOffset = 0;
 
             _bufferMaxLength = maxSamples;
             const AmUInt32 size = _bufferMaxLength * channels * sizeof(AmReal32);
@@ -174,6 +179,10 @@ namespace SparkyStudios::Audio::Amplitude
         _bufferLength = maxSamples;
         if (_bufferLength > _bufferMaxLength)
             _bufferLength = _bufferMaxLength;
+
+        // The delay may have been shortened since the last block
+        if (_offset >= _bufferLength)
+            _offset = 0;
     }
 
 } // namespace SparkyStudios::Audio::Amplitude
@@ -32,7 +32,7 @@ namespace SparkyStudios::Audio::Amplitude
         void Process(const AudioBuffer& in, AudioBuffer& out, AmUInt64 frames, AmUInt32 sampleRate) override;
 
     protected:
-        AmAudioSample ProcessSample(AmAudioSample sample, AmUInt16 channel, AmUInt32 sampleRate) override;
+        void ProcessChannel(const AudioBuffer& in, AudioBuffer& out, AmUInt16 channel, AmUInt64 frames, AmUInt32 sampleRate) override;
 
     private:
         void InitializeBuffer(AmUInt16 channels, AmUInt32 sampleRate);
@@ -40,7 +40,6 @@ namespace SparkyStudios::Audio::Amplitude
         AmReal32Buffer _buffer;
         AmUInt32 _bufferLength;
         AmUInt32 _bufferMaxLength;
-        AmUInt32 _bufferOffset;
         AmUInt32 _offset;
     };
 
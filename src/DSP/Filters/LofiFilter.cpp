@@ -107,21 +107,38 @@ namespace SparkyStudios::Audio::Amplitude
         }
     }
 
-    AmAudioSample LofiFilterInstance::ProcessSample(AmAudioSample sample, AmUInt16 channel, AmUInt32 sampleRate)
+    void LofiFilterInstance::ProcessChannel(const AudioBuffer& in, AudioBuffer& out, AmUInt16 channel, AmUInt64 frames, AmUInt32 sampleRate)
     {
-        if (_channelData[channel].m_samplesToSkip <= 0)
-        {
-            _channelData[channel].m_samplesToSkip += (sampleRate / m_parameters[LofiFilter::ATTRIBUTE_SAMPLERATE]) - 1;
-            const AmReal32 q = std::pow(2.0f, m_parameters[LofiFilter::ATTRIBUTE_BITDEPTH]);
-            _channelData[channel].m_sample = std::floor(q * sample) / q;
-        }
-        else
+        LofiChannelData& data = _channelData[channel];
+
+        const AmReal32 skip = (sampleRate / m_parameters[LofiFilter::ATTRIBUTE_SAMPLERATE]) - 1;
+        const AmReal32 q = std::pow(2.0f, m_parameters[LofiFilter::ATTRIBUTE_BITDEPTH]);
+        const AmReal32 wet = m_parameters[LofiFilter::ATTRIBUTE_WET];
+
+        AmReal32 sample = data.m_sample;
+        AmReal32 samplesToSkip = data.m_samplesToSkip;
+
+        const AmAudioSample* input = in[channel].begin();
+        AmAudioSample* output = out[channel].begin();
+
+        for (AmUInt64 i = 0; i < frames; ++i)
         {
-            _channelData[channel].m_samplesToSkip--;
+            const AmReal32 x = input[i];
+
+            if (samplesToSkip <= 0)
+            {
+                samplesToSkip += skip;
+                sample = std::floor(q * x) / q;
+            }
+            else
+            {
+                samplesToSkip--;
+            }
+
+            output[i] = static_cast<AmAudioSample>(x + (sample - x) * wet);
         }
 
-        const AmReal32 y = sample + (_channelData[channel].m_sample - sample) * m_parameters[LofiFilter::ATTRIBUTE_WET];
-
-        return static_cast<AmAudioSample>(y);
+        data.m_sample = sample;
+        data.m_samplesToSkip = samplesToSkip;
     }
 } // namespace SparkyStudios::Audio::Amplitude
@@ -36,7 +36,7 @@ namespace SparkyStudios::Audio::Amplitude
         ~LofiFilterInstance() override = default;
 
     protected:
-        AmAudioSample ProcessSample(AmAudioSample sample, AmUInt16 channel, AmUInt32 sampleRate) override;
+        void ProcessChannel(const AudioBuffer& in, AudioBuffer& out, AmUInt16 channel, AmUInt64 frames, AmUInt32 sampleRate) override;
 
     private:
         LofiChannelData _channelData[kAmMaxSupportedChannelCount]{};
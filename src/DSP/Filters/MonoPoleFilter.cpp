@@ -20,29 +20,42 @@ namespace SparkyStudios::Audio::Amplitude
 {
     MonoPoleFilterInstance::MonoPoleFilterInstance(MonoPoleFilter* parent)
         : FilterInstance(parent)
-        , _previousSample(0.0f)
     {
         Initialize(MonoPoleFilter::ATTRIBUTE_LAST);
         SetParameter(MonoPoleFilter::ATTRIBUTE_COEFFICIENT, parent->_coefficient);
     }
 
-    AmAudioSample MonoPoleFilterInstance::ProcessSample(AmAudioSample sample, AmUInt16 channel, AmUInt32 sampleRate)
+    void MonoPoleFilterInstance::ProcessChannel(
+        const AudioBuffer& in, AudioBuffer& out, AmUInt16 channel, AmUInt64 frames, AmUInt32 sampleRate)
     {
+        if (frames == 0)
+            return;
+
         const AmReal32 coefficient = m_parameters[MonoPoleFilter::ATTRIBUTE_COEFFICIENT];
+        const AmReal32 wet = m_parameters[MonoPoleFilter::ATTRIBUTE_WET];
+
+        const AmAudioSample* input = in[channel].begin();
+        AmAudioSample* output = out[channel].begin();
 
         if (coefficient < kEpsilon)
         {
-            _previousSample = sample;
-            return 0.0f;
+            _previousSample[channel] = input[frames - 1];
+            std::memset(output, 0, frames * sizeof(AmAudioSample));
+            return;
         }
 
-        const AmReal32 x = sample;
-        /* */ AmReal32 y = coefficient * (_previousSample - x) + x;
-        _previousSample = y;
+        AmReal32 previous = _previousSample[channel];
 
-        y = x + (y - x) * m_parameters[MonoPoleFilter::ATTRIBUTE_WET];
+        for (AmUInt64 i = 0; i < frames; ++i)
+        {
+            const AmReal32 x = input[i];
+            const AmReal32 y = coefficient * (previous - x) + x;
+            previous = y;
+
+            output[i] = static_cast<AmAudioSample>(x + (y - x) * wet);
+        }
 
-        return static_cast<AmAudioSample>(y);
+        _previousSample[channel] = previous;
     }
 
     MonoPoleFilter::MonoPoleFilter()
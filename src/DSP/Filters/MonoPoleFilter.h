@@ -30,10 +30,10 @@ namespace SparkyStudios::Audio::Amplitude
         ~MonoPoleFilterInstance() override = default;
 
     protected:
-        AmAudioSample ProcessSample(AmAudioSample sample, AmUInt16 channel, AmUInt32 sampleRate) override;
+        void ProcessChannel(const AudioBuffer& in, AudioBuffer& out, AmUInt16 channel, AmUInt64 frames, AmUInt32 sampleRate) override;
 
     private:
-        AmAudioSample _previousSample = 0.0f;
+        AmAudioSample _previousSample[kAmMaxSupportedChannelCount]{};
     };
 
     class MonoPoleFilter : public Filter
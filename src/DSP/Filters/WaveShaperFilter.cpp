@@ -82,7 +82,8 @@ namespace SparkyStudios::Audio::Amplitude
         m_parameters[WaveShaperFilter::ATTRIBUTE_AMOUNT] = parent->_amount;
     }
 
-    AmAudioSample WaveShaperFilterInstance::ProcessSample(AmAudioSample sample, AmUInt16 channel, AmUInt32 sampleRate)
+    void WaveShaperFilterInstance::ProcessChannel(
+        const AudioBuffer& in, AudioBuffer& out, AmUInt16 channel, AmUInt64 frames, AmUInt32 sampleRate)
     {
         AmReal32 k;
         if (std::abs(m_parameters[WaveShaperFilter::ATTRIBUTE_AMOUNT] - 1.0f) < kEpsilon)
@@ -90,15 +91,20 @@ namespace SparkyStudios::Audio::Amplitude
         else
             k = 2 * m_parameters[WaveShaperFilter::ATTRIBUTE_AMOUNT] / (1 - m_parameters[WaveShaperFilter::ATTRIBUTE_AMOUNT]);
 
-        const AmReal32 x = sample;
-        /* */ AmReal32 y;
+        const AmReal32 wet = m_parameters[WaveShaperFilter::ATTRIBUTE_WET];
 
-        const AmReal32 p = std::abs(x) * k + 1.0f;
-        const AmReal32 q = (1.0f + k) * x;
+        const AmAudioSample* input = in[channel].begin();
+        AmAudioSample* output = out[channel].begin();
 
-        y = x * (q / p);
-        y = x + (y - x) * m_parameters[WaveShaperFilter::ATTRIBUTE_WET];
+        for (AmUInt64 i = 0; i < frames; ++i)
+        {
+            const AmReal32 x = input[i];
 
-        return static_cast<AmAudioSample>(y);
+            const AmReal32 p = std::abs(x) * k + 1.0f;
+            const AmReal32 q = (1.0f + k) * x;
+            const AmReal32 y = x * (q / p);
+
+            output[i] = static_cast<AmAudioSample>(x + (y - x) * wet);
+        }
     }
 } // namespace SparkyStudios::Audio::Amplitude
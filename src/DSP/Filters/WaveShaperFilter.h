@@ -30,7 +30,7 @@ namespace SparkyStudios::Audio::Amplitude
         ~WaveShaperFilterInstance() override = default;
 
     protected:
-        AmAudioSample ProcessSample(AmAudioSample sample, AmUInt16 channel, AmUInt32 sampleRate) override;
+        void ProcessChannel(const AudioBuffer& in, AudioBuffer& out, AmUInt16 channel, AmUInt64 frames, AmUInt32 sampleRate) override;
     };
 
     class WaveShaperFilter final : public Filter
@@ -41,7 +41,7 @@ namespace SparkyStudios::Audio::Amplitude
         AMPLITUDE_ASSERT(out.size() >= outOffset + frames);
 
         if (IsOne(gain))
-            out += in;
+            GetSimdKernels().m_Add(out.begin() + outOffset, out.begin() + outOffset, in.begin() + inOffset, frames);
         else if (!IsZero(gain))
             ScalarMultiplyAccumulate(in.begin() + inOffset, out.begin() + outOffset, gain, frames);
     }
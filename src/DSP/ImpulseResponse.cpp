@@ -0,0 +1,146 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <DSP/ImpulseResponse.h>
+
+namespace SparkyStudios::Audio::Amplitude::ImpulseResponse
+{
+    // The cepstrum is computed on a longer FFT to reduce its time aliasing
+    constexpr AmSize kCepstrumOversampling = 8;
+
+    // Magnitudes below this fraction of the peak magnitude are clamped before taking their logarithm
+    constexpr AmReal32 kMagnitudeFloor = 1e-6f;
+
+    void MakeMinimumPhase(const AmReal32* input, AmSize inputLength, AmReal32* output, AmSize outputLength)
+    {
+        if (inputLength == 0)
+        {
+            std::memset(output, 0, outputLength * sizeof(AmReal32));
+            return;
+        }
+
+        const AmSize size = NextPowerOf2(inputLength) * kCepstrumOversampling;
+        const AmSize complexSize = FFT::GetOutputSize(size);
+
+        FFT fft;
+        fft.Initialize(size);
+
+        SplitComplex spectrum(complexSize);
+
+        AmAlignedReal32Buffer buffer;
+        buffer.Init(size, true);
+        std::memcpy(buffer.GetBuffer(), input, inputLength * sizeof(AmReal32));
+
+        // Log magnitude spectrum
+        fft.Forward(buffer.GetBuffer(), spectrum);
+
+        AmReal32* re = spectrum.re();
+        AmReal32* im = spectrum.im();
+
+        AmReal32 peak = 0.0f;
+        for (AmSize i = 0; i < complexSize; ++i)
+        {
+            re[i] = std::sqrt(re[i] * re[i] + im[i] * im[i]);
+            peak = AM_MAX(peak, re[i]);
+        }
+
+        const AmReal32 floor = AM_MAX(peak * kMagnitudeFloor, std::numeric_limits<AmReal32>::min());
+        for (AmSize i = 0; i < complexSize; ++i)
+        {
+            re[i] = std::log(AM_MAX(re[i], floor));
+            im[i] = 0.0f;
+        }
+
+        // Real cepstrum, folded to keep only its causal part
+        AmReal32* cepstrum = buffer.GetBuffer();
+        fft.Backward(cepstrum, spectrum);
+
+        for (AmSize i = 1; i < size / 2; ++i)
+            cepstrum[i] *= 2.0f;
+
+        std::memset(cepstrum + size / 2 + 1, 0, (size / 2 - 1) * sizeof(AmReal32));
+
+        // Complex exponential of the folded cepstrum spectrum
+        fft.Forward(cepstrum, spectrum);
+
+        re = spectrum.re();
+        im = spectrum.im();
+
+        for (AmSize i = 0; i < complexSize; ++i)
+        {
+            const AmReal32 magnitude = std::exp(re[i]);
+            const AmReal32 phase = im[i];
+
+            re[i] = magnitude * std::cos(phase);
+            im[i] = magnitude * std::sin(phase);
+        }
+
+        fft.Backward(buffer.GetBuffer(), spectrum);
+
+        const AmSize copied = AM_MIN(outputLength, size);
+        std::memcpy(output, buffer.GetBuffer(), copied * sizeof(AmReal32));
+        std::memset(output + copied, 0, (outputLength - copied) * sizeof(AmReal32));
+    }
+
+    void FadeOut(AmReal32* samples, AmSize length, AmSize fadeLength)
+    {
+        fadeLength = AM_MIN(fadeLength, length);
+
+        AmReal32* fade = samples + length - fadeLength;
+        for (AmSize i = 0; i < fadeLength; ++i)
+            fade[i] *= 0.5f + 0.5f * std::cos(AM_PI * static_cast<AmReal32>(i + 1) / static_cast<AmReal32>(fadeLength + 1));
+    }
+
+    AmSize GetDelayedLength(AmSize length, AmReal32 delay)
+    {
+        return length + static_cast<AmSize>(std::floor(AM_MAX(delay, 0.0f))) + 2;
+    }
+
+    void ApplyFractionalDelay(const AmReal32* input, AmSize inputLength, AmReal32 delay, AmReal32* output, AmSize outputLength)
+    {
+        delay = AM_MAX(delay, 0.0f);
+
+        // Each output sample n reads the input at n - delay, between the input samples n - offset and n - offset + 1
+        const AmReal32 integer = std::floor(delay);
+        const AmReal32 fraction = delay - integer;
+
+        const AmReal32 mu = fraction > 0.0f ? 1.0f - fraction : 0.0f;
+        const auto offset = static_cast<AmInt64>(integer) + (fraction > 0.0f ? 1 : 0);
+
+        // Third-order Lagrange coefficients for the input samples at offsets -1, 0, 1 and 2
+        const AmReal32 coefficients[4] = {
+            -mu * (mu - 1.0f) * (mu - 2.0f) / 6.0f,
+            (mu + 1.0f) * (mu - 1.0f) * (mu - 2.0f) / 2.0f,
+            -(mu + 1.0f) * mu * (mu - 2.0f) / 2.0f,
+            (mu + 1.0f) * mu * (mu - 1.0f) / 6.0f,
+        };
+
+        const auto length = static_cast<AmInt64>(inputLength);
+
+        for (AmSize n = 0; n < outputLength; ++n)
+        {
+            const AmInt64 i = static_cast<AmInt64>(n) - offset;
+
+            AmReal32 sample = 0.0f;
+            for (AmInt64 k = 0; k < 4; ++k)
+            {
+                const AmInt64 j = i + k - 1;
+                if (j >= 0 && j < length)
+                    sample += input[j] * coefficients[k];
+            }
+
+            output[n] = sample;
+        }
+    }
+} // namespace SparkyStudios::Audio::Amplitude::ImpulseResponse
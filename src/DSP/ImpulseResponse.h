@@ -0,0 +1,74 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef _AM_IMPLEMENTATION_DSP_IMPULSE_RESPONSE_H
+#define _AM_IMPLEMENTATION_DSP_IMPULSE_RESPONSE_H
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    namespace ImpulseResponse
+    {
+        /**
+         * @brief Computes the minimum-phase version of an impulse response.
+         *
+         * The minimum-phase response has the same magnitude spectrum as the input, with its energy
+         * moved to the start of the response. It is computed by folding the real cepstrum of the input.
+         *
+         * @param input The impulse response.
+         * @param inputLength The length of the impulse response.
+         * @param output The minimum-phase impulse response. May alias the input.
+         * @param outputLength The length of the minimum-phase impulse response. Shorter lengths truncate the response,
+         * longer lengths pad it with zeros.
+         */
+        void MakeMinimumPhase(const AmReal32* input, AmSize inputLength, AmReal32* output, AmSize outputLength);
+
+        /**
+         * @brief Fades out the end of an impulse response with the second half of a Hann window.
+         *
+         * @param samples The impulse response, updated in place.
+         * @param length The length of the impulse response.
+         * @param fadeLength The number of samples to fade out at the end of the impulse response.
+         */
+        void FadeOut(AmReal32* samples, AmSize length, AmSize fadeLength);
+
+        /**
+         * @brief Gets the length of an impulse response delayed by @ref ApplyFractionalDelay `ApplyFractionalDelay()`.
+         *
+         * @param length The length of the impulse response.
+         * @param delay The delay, in samples.
+         */
+        [[nodiscard]] AmSize GetDelayedLength(AmSize length, AmReal32 delay);
+
+        /**
+         * @brief Delays an impulse response by a fractional number of samples.
+         *
+         * The fractional part of the delay is interpolated with a third-order Lagrange filter,
+         * so integer delays shift the response exactly.
+         *
+         * @param input The impulse response.
+         * @param inputLength The length of the impulse response.
+         * @param delay The delay, in samples.
+         * @param output The delayed impulse response, with room for @ref GetDelayedLength `GetDelayedLength()` samples.
+         * Must not alias the input.
+         * @param outputLength The number of samples to write in the output.
+         */
+        void ApplyFractionalDelay(const AmReal32* input, AmSize inputLength, AmReal32 delay, AmReal32* output, AmSize outputLength);
+    } // namespace ImpulseResponse
+} // namespace SparkyStudios::Audio::Amplitude
+
+#endif // _AM_IMPLEMENTATION_DSP_IMPULSE_RESPONSE_H
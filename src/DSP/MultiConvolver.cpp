@@ -0,0 +1,331 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Based on the code from https://github.com/HiFi-LoFi/FFTConvolver
+// Copyright (c) 2017 HiFi-LoFi, MIT License
+
+#include <SparkyStudios/Audio/Amplitude/DSP/MultiConvolver.h>
+
+#include <SparkyStudios/Audio/Amplitude/Core/Memory.h>
+
+#include <Utils/Utils.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    MultiConvolver::MultiConvolver()
+        : _blockSize(0)
+        , _segSize(0)
+        , _segCount(0)
+        , _irCount(0)
+        , _fftComplexSize(0)
+        , _segments()
+        , _segmentsIR()
+        , _preMultiplied()
+        , _fftBuffer()
+        , _outputBuffer()
+        , _fft()
+        , _conv()
+        , _overlap()
+        , _current(0)
+        , _inputBuffer()
+        , _inputBufferFill(0)
+    {}
+
+    MultiConvolver::~MultiConvolver()
+    {
+        Reset();
+    }
+
+    void MultiConvolver::Reset()
+    {
+        for (auto* segment : _segments)
+            ampooldelete(eMemoryPoolKind_Filtering, SplitComplex, segment);
+
+        for (auto* segment : _segmentsIR)
+            ampooldelete(eMemoryPoolKind_Filtering, SplitComplex, segment);
+
+        for (auto* preMultiplied : _preMultiplied)
+            ampooldelete(eMemoryPoolKind_Filtering, SplitComplex, preMultiplied);
+
+        _blockSize = 0;
+        _segSize = 0;
+        _segCount = 0;
+        _irCount = 0;
+        _fftComplexSize = 0;
+        _segments.clear();
+        _segmentsIR.clear();
+        _preMultiplied.clear();
+        _fftBuffer.Release();
+        _outputBuffer.Release();
+        _fft.Initialize(0);
+        _conv.Release();
+        _overlap.Release();
+        _current = 0;
+        _inputBuffer.Release();
+        _inputBufferFill = 0;
+    }
+
+    AmSize MultiConvolver::GetIRCount() const
+    {
+        return _irCount;
+    }
+
+    AmSize MultiConvolver::GetSegmentSize() const
+    {
+        return _segSize;
+    }
+
+    AmSize MultiConvolver::GetSegmentCount() const
+    {
+        return _segCount;
+    }
+
+    bool MultiConvolver::Init(AmSize blockSize, const AmAudioSample* const* irs, AmSize irCount, AmSize irLen)
+    {
+        Reset();
+
+        if (blockSize == 0 || irCount == 0)
+            return false;
+
+        _irCount = irCount;
+
+        // Ignore zeros at the end of the impulse responses because they only waste computation time
+        AmSize usedIrLen = 0;
+        for (AmSize ir = 0; ir < irCount; ++ir)
+        {
+            AmSize len = irLen;
+            while (len > usedIrLen && std::fabs(irs[ir][len - 1]) < 0.000001f)
+                --len;
+
+            usedIrLen = AM_MAX(usedIrLen, len);
+        }
+
+        if (usedIrLen == 0)
+            return true;
+
+        _blockSize = NextPowerOf2(blockSize);
+        _segSize = 2 * _blockSize;
+        _segCount = static_cast<AmSize>(std::ceil(static_cast<AmReal32>(usedIrLen) / static_cast<AmReal32>(_blockSize)));
+        _fftComplexSize = FFT::GetOutputSize(_segSize);
+
+        // FFT
+        _fft.Initialize(_segSize);
+        _fftBuffer.Resize(_segSize);
+        _outputBuffer.Resize(_segSize);
+
+        // Prepare the input segments, shared by all the impulse responses
+        for (AmSize i = 0; i < _segCount; ++i)
+        {
+            auto* segment = ampoolnew(eMemoryPoolKind_Filtering, SplitComplex, _fftComplexSize);
+            segment->Clear();
+            _segments.push_back(segment);
+        }
+
+        // Prepare IRs
+        for (AmSize ir = 0; ir < irCount; ++ir)
+        {
+            for (AmSize i = 0; i < _segCount; ++i)
+            {
+                auto* segment = ampoolnew(eMemoryPoolKind_Filtering, SplitComplex, _fftComplexSize);
+                const AmSize remaining = usedIrLen - (i * _blockSize);
+                const AmSize sizeCopy = (remaining >= _blockSize) ? _blockSize : remaining;
+                CopyAndPad(_fftBuffer, &irs[ir][i * _blockSize], sizeCopy);
+                _fft.Forward(_fftBuffer.GetBuffer(), *segment);
+                _segmentsIR.push_back(segment);
+            }
+
+            auto* preMultiplied = ampoolnew(eMemoryPoolKind_Filtering, SplitComplex, _fftComplexSize);
+            preMultiplied->Clear();
+            _preMultiplied.push_back(preMultiplied);
+        }
+
+        // Prepare convolution buffers
+        _conv.Resize(_fftComplexSize, true);
+        _overlap.Resize(_blockSize * irCount);
+
+        // Prepare input buffer
+        _inputBuffer.Resize(_blockSize);
+        _inputBufferFill = 0;
+
+        // Reset current position
+        _current = 0;
+
+        return true;
+    }
+
+    bool MultiConvolver::InitFromSpectra(AmSize blockSize, const AmReal32* const* spectra, AmSize irCount, AmSize irLen)
+    {
+        Reset();
+
+        if (blockSize == 0 || irCount == 0)
+            return false;
+
+        if (NextPowerOf2(blockSize) != blockSize)
+            return false;
+
+        _irCount = irCount;
+
+        if (irLen == 0)
+            return true;
+
+        _blockSize = blockSize;
+        _segSize = 2 * _blockSize;
+        _segCount = (irLen + _blockSize - 1) / _blockSize;
+        _fftComplexSize = FFT::GetOutputSize(_segSize);
+
+        // FFT
+        _fft.Initialize(_segSize);
+        _fftBuffer.Resize(_segSize);
+        _outputBuffer.Resize(_segSize);
+
+        // Prepare the input segments, shared by all the impulse responses
+        for (AmSize i = 0; i < _segCount; ++i)
+        {
+            auto* segment = ampoolnew(eMemoryPoolKind_Filtering, SplitComplex, _fftComplexSize);
+            segment->Clear();
+            _segments.push_back(segment);
+        }
+
+        // Copy the transformed IRs
+        for (AmSize ir = 0; ir < irCount; ++ir)
+        {
+            const AmReal32* partition = spectra[ir];
+
+            for (AmSize i = 0; i < _segCount; ++i, partition += 2 * _fftComplexSize)
+            {
+                auto* segment = ampoolnew(eMemoryPoolKind_Filtering, SplitComplex, _fftComplexSize);
+                std::memcpy(segment->re(), partition, _fftComplexSize * sizeof(AmReal32));
+                std::memcpy(segment->im(), partition + _fftComplexSize, _fftComplexSize * sizeof(AmReal32));
+                _segmentsIR.push_back(segment);
+            }
+
+            auto* preMultiplied = ampoolnew(eMemoryPoolKind_Filtering, SplitComplex, _fftComplexSize);
+            preMultiplied->Clear();
+            _preMultiplied.push_back(preMultiplied);
+        }
+
+        // Prepare convolution buffers
+        _conv.Resize(_fftComplexSize, true);
+        _overlap.Resize(_blockSize * irCount);
+
+        // Prepare input buffer
+        _inputBuffer.Resize(_blockSize);
+        _inputBufferFill = 0;
+
+        // Reset current position
+        _current = 0;
+
+        return true;
+    }
+
+    AmSize MultiConvolver::GetSpectrumSize(AmSize irLen, AmSize blockSize)
+    {
+        const AmSize segCount = (irLen + blockSize - 1) / blockSize;
+        return segCount * 2 * FFT::GetOutputSize(2 * blockSize);
+    }
+
+    void MultiConvolver::TransformIR(const AmAudioSample* ir, AmSize irLen, AmSize blockSize, AmReal32* spectrum)
+    {
+        const AmSize segSize = 2 * blockSize;
+        const AmSize complexSize = FFT::GetOutputSize(segSize);
+
+        FFT fft;
+        fft.Initialize(segSize);
+
+        AmAlignedReal32Buffer buffer;
+        buffer.Resize(segSize);
+
+        SplitComplex segment(complexSize);
+
+        for (AmSize offset = 0; offset < irLen; offset += blockSize, spectrum += 2 * complexSize)
+        {
+            CopyAndPad(buffer, ir + offset, AM_MIN(blockSize, irLen - offset));
+            fft.Forward(buffer.GetBuffer(), segment);
+
+            std::memcpy(spectrum, segment.re(), complexSize * sizeof(AmReal32));
+            std::memcpy(spectrum + complexSize, segment.im(), complexSize * sizeof(AmReal32));
+        }
+    }
+
+    void MultiConvolver::Process(const AmAudioSample* input, AmAudioSample* const* outputs, AmSize len)
+    {
+        if (_segCount == 0)
+        {
+            for (AmSize ir = 0; ir < _irCount; ++ir)
+                std::memset(outputs[ir], 0, len * sizeof(AmAudioSample));
+
+            return;
+        }
+
+        AmSize processed = 0;
+        while (processed < len)
+        {
+            const bool inputBufferWasEmpty = (_inputBufferFill == 0);
+            const AmSize processing = std::min(len - processed, _blockSize - _inputBufferFill);
+            const AmSize inputBufferPos = _inputBufferFill;
+            std::memcpy(_inputBuffer.GetBuffer() + inputBufferPos, input + processed, processing * sizeof(AmAudioSample));
+
+            // Forward FFT, shared by all the impulse responses
+            CopyAndPad(_fftBuffer, _inputBuffer.GetBuffer(), _blockSize);
+            _fft.Forward(_fftBuffer.GetBuffer(), *_segments[_current]);
+
+            _inputBufferFill += processing;
+            const bool inputBufferFull = _inputBufferFill == _blockSize;
+
+            for (AmSize ir = 0; ir < _irCount; ++ir)
+            {
+                SplitComplex* const* segmentsIR = &_segmentsIR[ir * _segCount];
+                SplitComplex& preMultiplied = *_preMultiplied[ir];
+                AmAudioSample* overlap = _overlap.GetBuffer() + ir * _blockSize;
+
+                // Complex multiplication
+                if (inputBufferWasEmpty)
+                {
+                    preMultiplied.Clear();
+                    for (AmSize i = 1; i < _segCount; ++i)
+                    {
+                        const AmSize indexIr = i;
+                        const AmSize indexAudio = (_current + i) % _segCount;
+                        ComplexMultiplyAccumulate(preMultiplied, *segmentsIR[indexIr], *_segments[indexAudio]);
+                    }
+                }
+                _conv.CopyFrom(preMultiplied);
+                ComplexMultiplyAccumulate(_conv, *segmentsIR[0], *_segments[_current]);
+
+                // Backward FFT
+                _fft.Backward(_outputBuffer.GetBuffer(), _conv);
+
+                // Add overlap
+                Sum(outputs[ir] + processed, _outputBuffer.GetBuffer() + inputBufferPos, overlap + inputBufferPos, processing);
+
+                // Save the overlap
+                if (inputBufferFull)
+                    std::memcpy(overlap, _outputBuffer.GetBuffer() + _blockSize, _blockSize * sizeof(AmAudioSample));
+            }
+
+            // Input buffer full => Next block
+            if (inputBufferFull)
+            {
+                // Input buffer is empty again now
+                _inputBuffer.Clear();
+                _inputBufferFill = 0;
+
+                // Update current segments
+                _current = (_current > 0) ? (_current - 1) : (_segCount - 1);
+            }
+
+            processed += processing;
+        }
+    }
+} // namespace SparkyStudios::Audio::Amplitude
@@ -12,8 +12,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+
 #include <DSP/Delay.h>
 #include <DSP/ReflectionsProcessor.h>
+#include <Utils/SimdKernels.h>
 #include <Utils/Utils.h>
 
 namespace SparkyStudios::Audio::Amplitude
@@ -33,21 +36,33 @@ namespace SparkyStudios::Audio::Amplitude
         return maxDelayTime;
     }
 
-    ReflectionsProcessor::ReflectionsProcessor(AmUInt32 sampleRate, AmSize frameCount)
+    // Adds the first frames of a reflection to an ambisonic channel.
+    static void AccumulateReflection(AudioBufferChannel& output, const AudioBufferChannel& reflection, AmSize frames)
+    {
+        GetSimdKernels().m_Add(output.begin(), output.begin(), reflection.begin(), frames);
+    }
+
+    // Subtracts the first frames of a reflection from an ambisonic channel.
+    static void SubtractReflection(AudioBufferChannel& output, const AudioBufferChannel& reflection, AmSize frames)
+    {
+        GetSimdKernels().m_Subtract(output.begin(), output.begin(), reflection.begin(), frames);
+    }
+
+    ReflectionsProcessor::ReflectionsProcessor(AmUInt32 sampleRate, AmSize maxFrameCount)
         : _sampleRate(sampleRate)
-        , _frameCount(frameCount)
+        , _maxFrameCount(maxFrameCount)
         , _maxDelaySamples(kMaxDelayTimeSeconds * sampleRate)
         , _lowPassFilter(nullptr)
-        , _tempMonoBuffer(frameCount, kAmMonoChannelCount)
-        , _currentReflectionBuffer(frameCount, kAmFirstOrderAmbisonicChannelCount)
-        , _targetReflectionBuffer(frameCount, kAmFirstOrderAmbisonicChannelCount)
+        , _tempMonoBuffer(maxFrameCount, kAmMonoChannelCount)
+        , _currentReflectionBuffer(maxFrameCount, kAmFirstOrderAmbisonicChannelCount)
+        , _targetReflectionBuffer(maxFrameCount, kAmFirstOrderAmbisonicChannelCount)
         , _reflections(kAmRoomSurfaceCount)
         , _crossFade(false)
-        , _crossFader(frameCount)
+        , _crossFader(maxFrameCount)
         , _frameCountOnEmptyInput(0)
         , _delays(kAmRoomSurfaceCount)
-        , _delayFilter(_maxDelaySamples, frameCount)
-        , _delayBuffer(frameCount, kAmRoomSurfaceCount)
+        , _delayFilter(_maxDelaySamples, maxFrameCount)
+        , _delayBuffer(maxFrameCount, kAmRoomSurfaceCount)
         , _gains(kAmRoomSurfaceCount)
         , _gainProcessors(kAmRoomSurfaceCount)
     {
@@ -77,42 +92,42 @@ namespace SparkyStudios::Audio::Amplitude
 
         ComputeReflections(relativeListenerPosition, roomState->GetDimensions(), speedOfSound, roomState->GetCoefficients());
 
-        _frameCountOnEmptyInput = _frameCount + static_cast<AmSize>(FindMaxReflectionDelayTime(_reflections) * _sampleRate);
+        // The last input leaves the delay line once the longest reflection delay has been rendered
+        _frameCountOnEmptyInput = static_cast<AmSize>(std::ceil(FindMaxReflectionDelayTime(_reflections) * _sampleRate));
 
         // Enable cross-fading between reflections
         _crossFade = true;
     }
 
-    void ReflectionsProcessor::Process(const AudioBuffer& input, BFormat* output)
+    void ReflectionsProcessor::Process(const AudioBuffer& input, BFormat* output, AmSize frames)
     {
         AMPLITUDE_ASSERT(input.GetChannelCount() == kAmMonoChannelCount);
-        AMPLITUDE_ASSERT(input.GetFrameCount() == _frameCount);
+        AMPLITUDE_ASSERT(frames <= _maxFrameCount);
+        AMPLITUDE_ASSERT(input.GetFrameCount() >= frames);
         AMPLITUDE_ASSERT(output->GetChannelCount() >= kAmFirstOrderAmbisonicChannelCount);
-        AMPLITUDE_ASSERT(output->GetSampleCount() == _frameCount);
+        AMPLITUDE_ASSERT(output->GetSampleCount() >= frames);
 
         // Prefilter mono input
-        _tempMonoBuffer.Clear();
-
         if (_lowPassFilter->GetParameter(MonoPoleFilter::ATTRIBUTE_COEFFICIENT) < kEpsilon)
-            _tempMonoBuffer = input;
+            std::copy_n(input[0].begin(), frames, _tempMonoBuffer[0].begin());
         else
-            _lowPassFilter->Process(input, _tempMonoBuffer, _frameCount, _sampleRate);
+            _lowPassFilter->Process(input, _tempMonoBuffer, frames, _sampleRate);
 
-        _delayFilter.Insert(_tempMonoBuffer[0]);
+        _delayFilter.Insert(_tempMonoBuffer[0], frames);
 
         // Process reflections
         if (_crossFade)
         {
-            ProcessReflections(_currentReflectionBuffer);
+            ProcessReflections(_currentReflectionBuffer, frames);
             UpdateGainAndDelay();
-            ProcessReflections(_targetReflectionBuffer);
+            ProcessReflections(_targetReflectionBuffer, frames);
 
-            _crossFader.CrossFade(_targetReflectionBuffer, _currentReflectionBuffer, *output->GetBuffer());
+            _crossFader.CrossFade(_targetReflectionBuffer, _currentReflectionBuffer, *output->GetBuffer(), frames);
             _crossFade = false;
         }
         else
         {
-            ProcessReflections(*output->GetBuffer());
+            ProcessReflections(*output->GetBuffer(), frames);
         }
     }
 
@@ -160,15 +175,17 @@ namespace SparkyStudios::Audio::Amplitude
         }
     }
 
-    void ReflectionsProcessor::ProcessReflections(AudioBuffer& output)
+    void ReflectionsProcessor::ProcessReflections(AudioBuffer& output, AmSize frames)
     {
         AMPLITUDE_ASSERT(output.GetChannelCount() >= kAmFirstOrderAmbisonicChannelCount);
-        output.Clear();
+
+        for (AmSize c = 0; c < kAmFirstOrderAmbisonicChannelCount; ++c)
+            std::fill_n(output[c].begin(), frames, 0.0f);
 
         for (AmSize i = 0; i < kAmRoomSurfaceCount; ++i)
         {
             auto& delayChannel = _delayBuffer[i];
-            _delayFilter.Process(delayChannel, _delays[i]);
+            _delayFilter.Process(delayChannel, _delays[i], frames);
 
             const bool isZeroGain = Gain::IsZero(_gains[i]) && Gain::IsZero(_gainProcessors[i].GetGain());
 
@@ -179,34 +196,34 @@ namespace SparkyStudios::Audio::Amplitude
             else
             {
                 // Apply reflections gain
-                _gainProcessors[i].ApplyGain(_gains[i], delayChannel, 0, delayChannel, 0, delayChannel.size(), false);
+                _gainProcessors[i].ApplyGain(_gains[i], delayChannel, 0, delayChannel, 0, frames, false);
 
                 // Apply ambisonic reflection encoding
-                output[eBFormatChannel_W] += delayChannel;
+                AccumulateReflection(output[eBFormatChannel_W], delayChannel, frames);
                 switch (static_cast<RoomWall>(i))
                 {
                 case RoomWall::Left: // Left wall reflection
-                    output[eBFormatChannel_Y] += delayChannel;
+                    AccumulateReflection(output[eBFormatChannel_Y], delayChannel, frames);
                     break;
 
                 case RoomWall::Right: // Right wall reflection
-                    output[eBFormatChannel_Y] -= delayChannel;
+                    SubtractReflection(output[eBFormatChannel_Y], delayChannel, frames);
                     break;
 
                 case RoomWall::Bottom: // Floor reflection
-                    output[eBFormatChannel_Z] -= delayChannel;
+                    SubtractReflection(output[eBFormatChannel_Z], delayChannel, frames);
                     break;
 
                 case RoomWall::Top: // Ceiling reflection
-                    output[eBFormatChannel_Z] += delayChannel;
+                    AccumulateReflection(output[eBFormatChannel_Z], delayChannel, frames);
                     break;
 
                 case RoomWall::Front: // Front wall reflection
-                    output[eBFormatChannel_X] += delayChannel;
+                    AccumulateReflection(output[eBFormatChannel_X], delayChannel, frames);
                     break;
 
                 case RoomWall::Back: // Back wall reflection
-                    output[eBFormatChannel_X] -= delayChannel;
+                    SubtractReflection(output[eBFormatChannel_X], delayChannel, frames);
                     break;
 
                 default:
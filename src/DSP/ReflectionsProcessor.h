@@ -40,12 +40,25 @@ namespace SparkyStudios::Audio::Amplitude
     class ReflectionsProcessor
     {
     public:
-        ReflectionsProcessor(AmUInt32 sampleRate, AmSize frameCount);
+        /**
+         * @brief Creates a reflections processor.
+         *
+         * @param sampleRate The sample rate of the processed signal.
+         * @param maxFrameCount The maximum number of frames processed in a single call.
+         */
+        ReflectionsProcessor(AmUInt32 sampleRate, AmSize maxFrameCount);
         ~ReflectionsProcessor();
 
         void Update(const RoomInternalState* roomState, const AmVec3& listenerPosition, AmReal32 speedOfSound);
 
-        void Process(const AudioBuffer& input, BFormat* output);
+        /**
+         * @brief Renders the reflections of the given mono signal in a first order sound field.
+         *
+         * @param input The mono input signal.
+         * @param output The sound field receiving the reflections.
+         * @param frames The number of frames to process, up to the maximum frame count.
+         */
+        void Process(const AudioBuffer& input, BFormat* output, AmSize frames);
 
         AM_INLINE AmSize GetNumFramesToProcessOnEmptyInput() const
         {
@@ -61,11 +74,11 @@ namespace SparkyStudios::Audio::Amplitude
 
         void UpdateGainAndDelay();
 
-        void ProcessReflections(AudioBuffer& output);
+        void ProcessReflections(AudioBuffer& output, AmSize frames);
 
         const AmUInt32 _sampleRate;
 
-        const AmSize _frameCount;
+        const AmSize _maxFrameCount;
 
         const AmSize _maxDelaySamples;
 
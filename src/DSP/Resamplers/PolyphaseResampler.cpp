@@ -0,0 +1,413 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <DSP/Resamplers/PolyphaseResampler.h>
+#include <Utils/Utils.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    // Ratio between the input Nyquist frequency and the cutoff frequency of each filter bank.
+    // The resampler uses the first bank with a scale greater than or equal to the resampling step.
+    constexpr AmReal64 kPolyphaseBankScales[PolyphaseResampler::kBankCount] = { 1.0, 1.125, 1.25, 1.5, 2.0, 3.0, 4.0 };
+
+    // Number of input frames copied at once after the history.
+    constexpr AmSize kPolyphaseChunkFrames = 1024;
+
+    // Number of extra input frames kept in the history, to use input frames given ahead of time.
+    constexpr AmSize kPolyphaseSlackFrames = 64;
+
+    struct PolyphaseSincSettings
+    {
+        AmSize m_TapCount;
+        AmReal32 m_Rolloff;
+        AmReal32 m_Beta;
+    };
+
+    // Filter length, cutoff frequency relative to the Nyquist frequency, and Kaiser window shape of the sinc qualities.
+    constexpr PolyphaseSincSettings kPolyphaseSinc8 = { 8, 0.8f, 5.0f };
+    constexpr PolyphaseSincSettings kPolyphaseSinc32 = { 32, 0.9f, 8.0f };
+
+#if defined(AM_SIMD_INTRINSICS)
+    typedef simd_batch lane_batch;
+
+    AM_INLINE lane_batch LoadTaps(const AmReal32* source)
+    {
+        return xsimd::load_unaligned<simd_arch>(source);
+    }
+
+    AM_INLINE AmReal32 SumTaps(const lane_batch& value)
+    {
+        return xsimd::reduce_add(value);
+    }
+#else
+    typedef AmReal32 lane_batch;
+
+    AM_INLINE lane_batch LoadTaps(const AmReal32* source)
+    {
+        return *source;
+    }
+
+    AM_INLINE AmReal32 SumTaps(const lane_batch& value)
+    {
+        return value;
+    }
+#endif // AM_SIMD_INTRINSICS
+
+    // Zeroth order modified Bessel function of the first kind.
+    static AmReal64 BesselI0(AmReal64 x)
+    {
+        AmReal64 sum = 1.0;
+        AmReal64 term = 1.0;
+
+        for (AmUInt32 k = 1; k < 32; ++k)
+        {
+            term *= (x / (2.0 * k)) * (x / (2.0 * k));
+            sum += term;
+
+            if (term < sum * 1e-12)
+                break;
+        }
+
+        return sum;
+    }
+
+    PolyphaseResamplerInstance::PolyphaseResamplerInstance(const PolyphaseResampler* resampler)
+        : _resampler(resampler)
+        , _sampleRateIn(0)
+        , _sampleRateOut(0)
+        , _channelCount(0)
+        , _step(1.0)
+        , _bank(0)
+        , _index(0)
+        , _fraction(0.0)
+        , _window()
+    {}
+
+    void PolyphaseResamplerInstance::Initialize(AmUInt16 channelCount, AmUInt32 sampleRateIn, AmUInt32 sampleRateOut)
+    {
+        AMPLITUDE_ASSERT(channelCount > 0);
+
+        if (channelCount != _channelCount || _window.IsEmpty())
+        {
+            _channelCount = channelCount;
+            _window = AudioBuffer(_resampler->GetHistoryLength() + kPolyphaseChunkFrames, channelCount);
+        }
+
+        SetSampleRate(sampleRateIn, sampleRateOut);
+        Reset();
+    }
+
+    bool PolyphaseResamplerInstance::Process(const AudioBuffer& input, AmUInt64& inputFrames, AudioBuffer& output, AmUInt64& outputFrames)
+    {
+        AMPLITUDE_ASSERT(input.GetChannelCount() == _channelCount);
+        AMPLITUDE_ASSERT(output.GetChannelCount() == _channelCount);
+        AMPLITUDE_ASSERT(!_window.IsEmpty());
+
+        const AmSize history = _resampler->GetHistoryLength();
+
+        AmReal32* windows[kAmMaxSupportedChannelCount];
+        for (AmUInt16 c = 0; c < _channelCount; ++c)
+            windows[c] = _window[c].begin() + history;
+
+        AmUInt64 consumed = 0;
+        AmUInt64 produced = 0;
+
+        while (consumed < inputFrames)
+        {
+            const AmSize length = AM_MIN(kPolyphaseChunkFrames, inputFrames - consumed);
+
+            for (AmUInt16 c = 0; c < _channelCount; ++c)
+                std::copy_n(input[c].begin() + consumed, length, windows[c]);
+
+            // Interpolate every output frame whose newest input frame is in this chunk
+            while (produced < outputFrames && _index < static_cast<AmInt64>(length))
+            {
+                Interpolate(windows, _index, output, produced);
+                ++produced;
+
+                _fraction += _step;
+                const AmReal64 whole = std::floor(_fraction);
+                _index += static_cast<AmInt64>(whole);
+                _fraction -= whole;
+            }
+
+            // Keep the newest frames as the history of the next chunk
+            for (AmUInt16 c = 0; c < _channelCount; ++c)
+                std::copy_n(windows[c] - history + length, history, windows[c] - history);
+
+            // Skip the input frames which don't fit in the history anymore
+            _index = AM_MAX(_index - static_cast<AmInt64>(length), -static_cast<AmInt64>(kPolyphaseSlackFrames));
+            consumed += length;
+        }
+
+        for (AmUInt16 c = 0; c < _channelCount; ++c)
+            std::fill(output[c].begin() + produced, output[c].begin() + outputFrames, 0.0f);
+
+        inputFrames = consumed;
+        outputFrames = produced;
+
+        return true;
+    }
+
+    void PolyphaseResamplerInstance::SetSampleRate(AmUInt32 sampleRateIn, AmUInt32 sampleRateOut)
+    {
+        AMPLITUDE_ASSERT(sampleRateIn > 0 && sampleRateOut > 0);
+
+        _sampleRateIn = sampleRateIn;
+        _sampleRateOut = sampleRateOut;
+
+        _step = static_cast<AmReal64>(sampleRateIn) / static_cast<AmReal64>(sampleRateOut);
+        _bank = _resampler->GetBank(_step);
+    }
+
+    AmUInt64 PolyphaseResamplerInstance::GetRequiredInputFrames(AmUInt64 outputFrameCount) const
+    {
+        if (outputFrameCount == 0)
+            return 0;
+
+        // The last output frame needs every input frame up to its position
+        const AmReal64 last = static_cast<AmReal64>(_index) + _fraction + static_cast<AmReal64>(outputFrameCount - 1) * _step;
+        return static_cast<AmUInt64>(AM_MAX(std::floor(last) + 1.0, 0.0));
+    }
+
+    AmUInt64 PolyphaseResamplerInstance::GetExpectedOutputFrames(AmUInt64 inputFrameCount) const
+    {
+        const AmReal64 remaining = static_cast<AmReal64>(inputFrameCount) - static_cast<AmReal64>(_index) - _fraction;
+        return static_cast<AmUInt64>(AM_MAX(std::ceil(remaining / _step), 0.0));
+    }
+
+    AmUInt64 PolyphaseResamplerInstance::GetOutputLatency() const
+    {
+        return static_cast<AmUInt64>(std::round(static_cast<AmReal64>(_resampler->GetLatency()) / _step));
+    }
+
+    void PolyphaseResamplerInstance::Reset()
+    {
+        _index = 0;
+        _fraction = 0.0;
+        _window.Clear();
+    }
+
+    void PolyphaseResamplerInstance::Clear()
+    {
+        Reset();
+
+        _channelCount = 0;
+        _sampleRateIn = 0;
+        _sampleRateOut = 0;
+        _step = 1.0;
+        _bank = 0;
+    }
+
+    void PolyphaseResamplerInstance::Interpolate(AmReal32* const* windows, AmInt64 newest, AudioBuffer& output, AmSize frame) const
+    {
+        const auto fraction = static_cast<AmReal32>(_fraction);
+
+        switch (_resampler->GetQuality())
+        {
+        case ePolyphaseResamplerQuality_Linear:
+            for (AmUInt16 c = 0; c < _channelCount; ++c)
+            {
+                const AmReal32* x = windows[c] + newest;
+                output[c][frame] = x[-1] + fraction * (x[0] - x[-1]);
+            }
+            break;
+
+        case ePolyphaseResamplerQuality_Cubic:
+            for (AmUInt16 c = 0; c < _channelCount; ++c)
+            {
+                const AmReal32* x = windows[c] + newest;
+                const AmReal32 p0 = x[-3], p1 = x[-2], p2 = x[-1], p3 = x[0];
+
+                // Catmull-Rom spline between p1 and p2
+                output[c][frame] = p1 +
+                    0.5f * fraction *
+                        (p2 - p0 + fraction * (2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3 + fraction * (3.0f * (p1 - p2) + p3 - p0)));
+            }
+            break;
+
+        default:
+            {
+                constexpr AmSize blockSize = GetSimdBlockSize();
+
+                const AmSize taps = _resampler->GetTapCount(_bank);
+                const AmSize offset = _resampler->GetTapOffset(_bank);
+
+                // Blend the two nearest filter phases
+                const AmReal32 position = fraction * static_cast<AmReal32>(PolyphaseResampler::kPhaseCount);
+                const AmSize phase = AM_MIN(static_cast<AmSize>(position), PolyphaseResampler::kPhaseCount - 1);
+                const AmReal32 blend = position - static_cast<AmReal32>(phase);
+
+                const AmReal32* filter0 = _resampler->GetFilter(_bank, phase);
+                const AmReal32* filter1 = _resampler->GetFilter(_bank, phase + 1);
+
+                for (AmUInt16 c = 0; c < _channelCount; ++c)
+                {
+                    const AmReal32* x = windows[c] + newest - static_cast<AmInt64>(offset + taps - 1);
+
+                    lane_batch sum0(0.0f);
+                    lane_batch sum1(0.0f);
+
+                    for (AmSize k = 0; k < taps; k += blockSize)
+                    {
+                        const lane_batch samples = LoadTaps(x + k);
+                        sum0 += samples * LoadTaps(filter0 + k);
+                        sum1 += samples * LoadTaps(filter1 + k);
+                    }
+
+                    const AmReal32 y0 = SumTaps(sum0);
+                    const AmReal32 y1 = SumTaps(sum1);
+
+                    output[c][frame] = y0 + blend * (y1 - y0);
+                }
+            }
+            break;
+        }
+    }
+
+    PolyphaseResampler::PolyphaseResampler(AmString name, ePolyphaseResamplerQuality quality)
+        : Resampler(std::move(name))
+        , _quality(quality)
+        , _banks{}
+        , _latency(0)
+        , _historyLength(0)
+    {
+        if (quality == ePolyphaseResamplerQuality_Linear || quality == ePolyphaseResamplerQuality_Cubic)
+        {
+            const AmSize length = quality == ePolyphaseResamplerQuality_Linear ? 2 : 4;
+
+            _latency = length / 2;
+            _historyLength = length + kPolyphaseSlackFrames;
+            return;
+        }
+
+        const PolyphaseSincSettings& settings = quality == ePolyphaseResamplerQuality_Sinc8 ? kPolyphaseSinc8 : kPolyphaseSinc32;
+
+        // Filters are made longer as their cutoff frequency decreases, to keep the same transition band shape.
+        // Lengths are even, so that every filter is centered on the same frame.
+        const auto filterLength = [&settings](AmSize bank) -> AmSize
+        {
+            return 2 * static_cast<AmSize>(std::ceil(static_cast<AmReal64>(settings.m_TapCount) * kPolyphaseBankScales[bank] / 2.0));
+        };
+
+        _latency = filterLength(kBankCount - 1) / 2;
+
+        for (AmSize b = 0; b < kBankCount; ++b)
+        {
+            const auto cutoff = static_cast<AmReal32>(settings.m_Rolloff / kPolyphaseBankScales[b]);
+            GenerateBank(b, filterLength(b), cutoff, settings.m_Beta);
+
+            _historyLength = AM_MAX(_historyLength, _banks[b].m_TapOffset + _banks[b].m_TapCount);
+        }
+
+        _historyLength += kPolyphaseSlackFrames;
+    }
+
+    ResamplerInstance* PolyphaseResampler::CreateInstance()
+    {
+        return ampoolnew(eMemoryPoolKind_Filtering, PolyphaseResamplerInstance, this);
+    }
+
+    void PolyphaseResampler::DestroyInstance(ResamplerInstance* instance)
+    {
+        ampooldelete(eMemoryPoolKind_Filtering, PolyphaseResamplerInstance, (PolyphaseResamplerInstance*)instance);
+    }
+
+    ePolyphaseResamplerQuality PolyphaseResampler::GetQuality() const
+    {
+        return _quality;
+    }
+
+    AmSize PolyphaseResampler::GetBank(AmReal64 step) const
+    {
+        for (AmSize b = 0; b < kBankCount; ++b)
+            if (step <= kPolyphaseBankScales[b])
+                return b;
+
+        return kBankCount - 1;
+    }
+
+    AmSize PolyphaseResampler::GetTapCount(AmSize bank) const
+    {
+        return _banks[bank].m_TapCount;
+    }
+
+    AmSize PolyphaseResampler::GetTapOffset(AmSize bank) const
+    {
+        return _banks[bank].m_TapOffset;
+    }
+
+    const AmReal32* PolyphaseResampler::GetFilter(AmSize bank, AmSize phase) const
+    {
+        AMPLITUDE_ASSERT(phase <= kPhaseCount);
+        return _banks[bank].m_Coefficients.GetBuffer() + phase * _banks[bank].m_TapCount;
+    }
+
+    AmSize PolyphaseResampler::GetLatency() const
+    {
+        return _latency;
+    }
+
+    AmSize PolyphaseResampler::GetHistoryLength() const
+    {
+        return _historyLength;
+    }
+
+    void PolyphaseResampler::GenerateBank(AmSize bank, AmSize length, AmReal32 cutoff, AmReal32 beta)
+    {
+        constexpr AmSize blockSize = GetSimdBlockSize();
+
+        FilterBank& b = _banks[bank];
+        b.m_TapCount = (length + blockSize - 1) / blockSize * blockSize;
+        b.m_TapOffset = _latency - length / 2;
+        b.m_Coefficients.Resize(static_cast<AmUInt32>((kPhaseCount + 1) * b.m_TapCount));
+
+        const AmReal64 halfLength = static_cast<AmReal64>(length) / 2.0;
+        const AmReal64 normalization = 1.0 / BesselI0(beta);
+
+        // The padding taps are the oldest ones, and stay at zero
+        const AmSize padding = b.m_TapCount - length;
+
+        for (AmSize p = 0; p <= kPhaseCount; ++p)
+        {
+            AmReal32* filter = b.m_Coefficients.GetBuffer() + p * b.m_TapCount + padding;
+            const AmReal64 fraction = static_cast<AmReal64>(p) / static_cast<AmReal64>(kPhaseCount);
+
+            AmReal64 sum = 0.0;
+            for (AmSize k = 0; k < length; ++k)
+            {
+                // Distance between the interpolated position and the input frame of this tap
+                const AmReal64 t = halfLength - 1.0 - static_cast<AmReal64>(k) + fraction;
+                const AmReal64 x = t / halfLength;
+
+                if (std::abs(x) >= 1.0)
+                {
+                    filter[k] = 0.0f;
+                    continue;
+                }
+
+                const AmReal64 arg = AM_PI32 * cutoff * t;
+                const AmReal64 sinc = std::abs(arg) < 1e-9 ? 1.0 : std::sin(arg) / arg;
+                const AmReal64 value = cutoff * sinc * BesselI0(beta * std::sqrt(1.0 - x * x)) * normalization;
+
+                filter[k] = static_cast<AmReal32>(value);
+                sum += value;
+            }
+
+            // Unity gain at DC for every phase
+            for (AmSize k = 0; k < length; ++k)
+                filter[k] = static_cast<AmReal32>(filter[k] / sum);
+        }
+    }
+} // namespace SparkyStudios::Audio::Amplitude
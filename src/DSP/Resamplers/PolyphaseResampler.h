@@ -0,0 +1,260 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef _AM_IMPLEMENTATION_DSP_RESAMPLERS_POLYPHASE_RESAMPLER_H
+#define _AM_IMPLEMENTATION_DSP_RESAMPLERS_POLYPHASE_RESAMPLER_H
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    class PolyphaseResampler;
+
+    /**
+     * @brief The interpolation quality of a polyphase resampler.
+     */
+    enum ePolyphaseResamplerQuality : AmUInt8
+    {
+        /**
+         * @brief 2-point linear interpolation. No anti-aliasing.
+         */
+        ePolyphaseResamplerQuality_Linear = 0,
+
+        /**
+         * @brief 4-point Catmull-Rom interpolation. No anti-aliasing.
+         */
+        ePolyphaseResamplerQuality_Cubic,
+
+        /**
+         * @brief 8-tap Kaiser windowed sinc.
+         */
+        ePolyphaseResamplerQuality_Sinc8,
+
+        /**
+         * @brief 32-tap Kaiser windowed sinc.
+         */
+        ePolyphaseResamplerQuality_Sinc32,
+    };
+
+    class PolyphaseResamplerInstance final : public ResamplerInstance
+    {
+    public:
+        /**
+         * @brief Constructs a new @c PolyphaseResamplerInstance.
+         *
+         * @param resampler The resampler holding the filter banks.
+         */
+        explicit PolyphaseResamplerInstance(const PolyphaseResampler* resampler);
+
+        /**
+         * @copydoc ResamplerInstance::Initialize
+         */
+        void Initialize(AmUInt16 channelCount, AmUInt32 sampleRateIn, AmUInt32 sampleRateOut) override;
+
+        /**
+         * @copydoc ResamplerInstance::Process
+         */
+        bool Process(const AudioBuffer& input, AmUInt64& inputFrames, AudioBuffer& output, AmUInt64& outputFrames) override;
+
+        /**
+         * @copydoc ResamplerInstance::SetSampleRate
+         *
+         * The resampling ratio changes from the next output frame, without resetting the resampler state.
+         */
+        void SetSampleRate(AmUInt32 sampleRateIn, AmUInt32 sampleRateOut) override;
+
+        /**
+         * @copydoc ResamplerInstance::GetSampleRateIn
+         */
+        [[nodiscard]] AM_INLINE AmUInt32 GetSampleRateIn() const override
+        {
+            return _sampleRateIn;
+        }
+
+        /**
+         * @copydoc ResamplerInstance::GetSampleRateOut
+         */
+        [[nodiscard]] AM_INLINE AmUInt32 GetSampleRateOut() const override
+        {
+            return _sampleRateOut;
+        }
+
+        /**
+         * @copydoc ResamplerInstance::GetChannelCount
+         */
+        [[nodiscard]] AM_INLINE AmUInt16 GetChannelCount() const override
+        {
+            return _channelCount;
+        }
+
+        /**
+         * @copydoc ResamplerInstance::GetRequiredInputFrames
+         */
+        [[nodiscard]] AmUInt64 GetRequiredInputFrames(AmUInt64 outputFrameCount) const override;
+
+        /**
+         * @copydoc ResamplerInstance::GetExpectedOutputFrames
+         */
+        [[nodiscard]] AmUInt64 GetExpectedOutputFrames(AmUInt64 inputFrameCount) const override;
+
+        /**
+         * @copydoc ResamplerInstance::GetInputLatency
+         */
+        [[nodiscard]] AM_INLINE AmUInt64 GetInputLatency() const override
+        {
+            return 0;
+        }
+
+        /**
+         * @copydoc ResamplerInstance::GetOutputLatency
+         */
+        [[nodiscard]] AmUInt64 GetOutputLatency() const override;
+
+        /**
+         * @copydoc ResamplerInstance::Reset
+         */
+        void Reset() override;
+
+        /**
+         * @copydoc ResamplerInstance::Clear
+         */
+        void Clear() override;
+
+    private:
+        // The newest input frame may be negative, in which case it is read from the history.
+        void Interpolate(AmReal32* const* windows, AmInt64 newest, AudioBuffer& output, AmSize frame) const;
+
+        const PolyphaseResampler* _resampler;
+
+        AmUInt32 _sampleRateIn;
+        AmUInt32 _sampleRateOut;
+        AmUInt16 _channelCount;
+
+        // Number of input frames to advance for each output frame.
+        AmReal64 _step;
+
+        // Filter bank matching the current step.
+        AmSize _bank;
+
+        // Position of the next output frame, relative to the first frame of the next input.
+        AmInt64 _index;
+        AmReal64 _fraction;
+
+        // Past input frames followed by the chunk of input being processed, for each channel.
+        AudioBuffer _window;
+    };
+
+    /**
+     * @brief A resampler interpolating the input at arbitrary positions.
+     *
+     * The sinc qualities use precomputed banks of windowed sinc filters, with one filter
+     * per fractional position. Each bank has a lower cutoff frequency, to remove aliasing
+     * when the input is read faster than the output sample rate. Since the filters are
+     * computed once for all the instances, the resampling ratio can change continuously
+     * (e.g. for pitch and Doppler effects) without reinitializing the resampler.
+     *
+     * The linear and cubic qualities are cheaper and don't filter the input, so they are
+     * better suited to low priority sounds.
+     */
+    class PolyphaseResampler final : public Resampler
+    {
+    public:
+        /**
+         * @brief The number of filter phases between two input frames.
+         */
+        static constexpr AmSize kPhaseCount = 128;
+
+        /**
+         * @brief The number of filter banks, each with a different cutoff frequency.
+         */
+        static constexpr AmSize kBankCount = 7;
+
+        /**
+         * @brief Constructs and registers a new polyphase resampler.
+         *
+         * @param name The name of the resampler.
+         * @param quality The interpolation quality of the resampler.
+         */
+        PolyphaseResampler(AmString name, ePolyphaseResamplerQuality quality);
+
+        ResamplerInstance* CreateInstance() override;
+
+        void DestroyInstance(ResamplerInstance* instance) override;
+
+        /**
+         * @brief Gets the interpolation quality of this resampler.
+         */
+        [[nodiscard]] ePolyphaseResamplerQuality GetQuality() const;
+
+        /**
+         * @brief Gets the filter bank to use for the given resampling step.
+         *
+         * @param step The number of input frames read for each output frame.
+         */
+        [[nodiscard]] AmSize GetBank(AmReal64 step) const;
+
+        /**
+         * @brief Gets the number of taps of each filter in the given bank, padded to fill whole SIMD registers.
+         *
+         * @param bank The filter bank index.
+         */
+        [[nodiscard]] AmSize GetTapCount(AmSize bank) const;
+
+        /**
+         * @brief Gets the number of input frames between the newest input frame and the newest tap of the given bank.
+         *
+         * All the banks share the same latency, so this offset aligns the center of the shorter filters with the longest one.
+         *
+         * @param bank The filter bank index.
+         */
+        [[nodiscard]] AmSize GetTapOffset(AmSize bank) const;
+
+        /**
+         * @brief Gets the coefficients of a filter phase, oldest tap first.
+         *
+         * @param bank The filter bank index.
+         * @param phase The phase index, in the range [0, kPhaseCount].
+         */
+        [[nodiscard]] const AmReal32* GetFilter(AmSize bank, AmSize phase) const;
+
+        /**
+         * @brief Gets the delay, in input frames, between an input frame and its interpolated output.
+         */
+        [[nodiscard]] AmSize GetLatency() const;
+
+        /**
+         * @brief Gets the number of past input frames needed to interpolate a frame.
+         */
+        [[nodiscard]] AmSize GetHistoryLength() const;
+
+    private:
+        struct FilterBank
+        {
+            AmSize m_TapCount;
+            AmSize m_TapOffset;
+            AmAlignedReal32Buffer m_Coefficients;
+        };
+
+        void GenerateBank(AmSize bank, AmSize length, AmReal32 cutoff, AmReal32 beta);
+
+        ePolyphaseResamplerQuality _quality;
+        FilterBank _banks[kBankCount];
+        AmSize _latency;
+        AmSize _historyLength;
+    };
+} // namespace SparkyStudios::Audio::Amplitude
+
+#endif // _AM_IMPLEMENTATION_DSP_RESAMPLERS_POLYPHASE_RESAMPLER_H
@@ -0,0 +1,280 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Based on the code from https://github.com/HiFi-LoFi/FFTConvolver
+// Copyright (c) 2017 HiFi-LoFi, MIT License
+
+#include <SparkyStudios/Audio/Amplitude/DSP/TwoStageConvolver.h>
+
+#include <SparkyStudios/Audio/Amplitude/Core/Memory.h>
+
+#include <Utils/Utils.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    TwoStageConvolver::TwoStageConvolver()
+        : _headBlockSize(0)
+        , _tailBlockSize(0)
+        , _headConvolver()
+        , _tailConvolver0()
+        , _tailOutput0()
+        , _tailPrecalculated0()
+        , _tailOutput()
+        , _tailPrecalculated()
+        , _tailInput()
+        , _tailInputFill(0)
+        , _precalculatedPos(0)
+        , _tailSegCount(0)
+        , _tailStepCount(0)
+        , _tailStep(0)
+        , _tailCurrent(0)
+        , _tailSegments()
+        , _tailSegmentsIR()
+        , _tailFFTBuffer()
+        , _tailFFT()
+        , _tailConv()
+        , _tailOverlap()
+        , _tailProcessingInput()
+    {}
+
+    TwoStageConvolver::~TwoStageConvolver()
+    {
+        Reset();
+    }
+
+    void TwoStageConvolver::Reset()
+    {
+        for (AmSize i = 0; i < _tailSegCount; ++i)
+        {
+            ampooldelete(eMemoryPoolKind_Filtering, SplitComplex, _tailSegments[i]);
+            ampooldelete(eMemoryPoolKind_Filtering, SplitComplex, _tailSegmentsIR[i]);
+        }
+
+        _headBlockSize = 0;
+        _tailBlockSize = 0;
+        _headConvolver.Reset();
+        _tailConvolver0.Reset();
+        _tailOutput0.Release();
+        _tailPrecalculated0.Release();
+        _tailOutput.Release();
+        _tailPrecalculated.Release();
+        _tailInput.Release();
+        _tailInputFill = 0;
+        _precalculatedPos = 0;
+        _tailSegCount = 0;
+        _tailStepCount = 0;
+        _tailStep = 0;
+        _tailCurrent = 0;
+        _tailSegments.clear();
+        _tailSegmentsIR.clear();
+        _tailFFTBuffer.Release();
+        _tailFFT.Initialize(0);
+        _tailConv.Release();
+        _tailOverlap.Release();
+        _tailProcessingInput.Release();
+    }
+
+    AmSize TwoStageConvolver::GetHeadBlockSize() const
+    {
+        return _headBlockSize;
+    }
+
+    AmSize TwoStageConvolver::GetTailBlockSize() const
+    {
+        return _tailBlockSize;
+    }
+
+    bool TwoStageConvolver::Init(AmSize headBlockSize, AmSize tailBlockSize, const AmAudioSample* ir, AmSize irLen)
+    {
+        Reset();
+
+        if (headBlockSize == 0 || tailBlockSize == 0)
+            return false;
+
+        if (headBlockSize > tailBlockSize)
+            std::swap(headBlockSize, tailBlockSize);
+
+        // Ignore zeros at the end of the impulse response because they only waste computation time
+        while (irLen > 0 && std::fabs(ir[irLen - 1]) < 0.000001f)
+            --irLen;
+
+        if (irLen == 0)
+            return true;
+
+        _headBlockSize = NextPowerOf2(headBlockSize);
+        _tailBlockSize = NextPowerOf2(tailBlockSize);
+
+        // Head: the first tail block of the impulse response, with head-sized partitions
+        const AmSize headIrLen = std::min(irLen, _tailBlockSize);
+        _headConvolver.Init(_headBlockSize, ir, headIrLen);
+
+        // First tail block: the second tail block of the impulse response, with head-sized partitions
+        if (irLen > _tailBlockSize)
+        {
+            const AmSize conv1IrLen = std::min(irLen - _tailBlockSize, _tailBlockSize);
+            _tailConvolver0.Init(_headBlockSize, ir + _tailBlockSize, conv1IrLen);
+            _tailOutput0.Resize(_tailBlockSize);
+            _tailPrecalculated0.Resize(_tailBlockSize);
+        }
+
+        // Rest of the tail, with tail-sized partitions
+        if (irLen > 2 * _tailBlockSize)
+        {
+            const AmSize tailIrLen = irLen - (2 * _tailBlockSize);
+            const AmSize tailSegSize = 2 * _tailBlockSize;
+            const AmSize tailComplexSize = FFT::GetOutputSize(tailSegSize);
+
+            _tailSegCount = (tailIrLen + _tailBlockSize - 1) / _tailBlockSize;
+            _tailStepCount = _tailBlockSize / _headBlockSize;
+            _tailStep = 0;
+            _tailCurrent = 0;
+
+            _tailFFT.Initialize(tailSegSize);
+            _tailFFTBuffer.Resize(tailSegSize);
+
+            for (AmSize i = 0; i < _tailSegCount; ++i)
+            {
+                auto* segment = ampoolnew(eMemoryPoolKind_Filtering, SplitComplex, tailComplexSize);
+                segment->Clear();
+                _tailSegments.push_back(segment);
+            }
+
+            const AmAudioSample* tailIr = ir + (2 * _tailBlockSize);
+            for (AmSize i = 0; i < _tailSegCount; ++i)
+            {
+                auto* segment = ampoolnew(eMemoryPoolKind_Filtering, SplitComplex, tailComplexSize);
+                const AmSize remaining = tailIrLen - (i * _tailBlockSize);
+                const AmSize sizeCopy = (remaining >= _tailBlockSize) ? _tailBlockSize : remaining;
+                CopyAndPad(_tailFFTBuffer, &tailIr[i * _tailBlockSize], sizeCopy);
+                _tailFFT.Forward(_tailFFTBuffer.GetBuffer(), *segment);
+                _tailSegmentsIR.push_back(segment);
+            }
+
+            _tailConv.Resize(tailComplexSize, true);
+            _tailOverlap.Resize(_tailBlockSize);
+            _tailOutput.Resize(_tailBlockSize);
+            _tailPrecalculated.Resize(_tailBlockSize);
+            _tailProcessingInput.Resize(_tailBlockSize);
+        }
+
+        if (_tailPrecalculated0.GetSize() > 0 || _tailPrecalculated.GetSize() > 0)
+            _tailInput.Resize(_tailBlockSize);
+
+        _tailInputFill = 0;
+        _precalculatedPos = 0;
+
+        return true;
+    }
+
+    void TwoStageConvolver::Process(const AmAudioSample* input, AmAudioSample* output, AmSize len)
+    {
+        // Head
+        _headConvolver.Process(input, output, len);
+
+        // Tail
+        if (_tailInput.GetSize() == 0)
+            return;
+
+        AmSize processed = 0;
+        while (processed < len)
+        {
+            const AmSize remaining = len - processed;
+            const AmSize processing = std::min(remaining, _headBlockSize - (_tailInputFill % _headBlockSize));
+            AMPLITUDE_ASSERT(_tailInputFill + processing <= _tailBlockSize);
+
+            // Sum the head and the precalculated tail blocks. The buffers may not be aligned here.
+            if (_tailPrecalculated0.GetSize() > 0)
+            {
+                const AmReal32* precalculated = _tailPrecalculated0.GetBuffer() + _precalculatedPos;
+                for (AmSize i = 0; i < processing; ++i)
+                    output[processed + i] += precalculated[i];
+            }
+
+            if (_tailPrecalculated.GetSize() > 0)
+            {
+                const AmReal32* precalculated = _tailPrecalculated.GetBuffer() + _precalculatedPos;
+                for (AmSize i = 0; i < processing; ++i)
+                    output[processed + i] += precalculated[i];
+            }
+
+            _precalculatedPos += processing;
+
+            // Fill the input buffer for the tail convolution
+            std::memcpy(_tailInput.GetBuffer() + _tailInputFill, input + processed, processing * sizeof(AmAudioSample));
+            _tailInputFill += processing;
+
+            // Convolution of the first tail block, spread across the head blocks
+            if (_tailPrecalculated0.GetSize() > 0 && _tailInputFill % _headBlockSize == 0)
+            {
+                const AmSize blockOffset = _tailInputFill - _headBlockSize;
+                _tailConvolver0.Process(
+                    _tailInput.GetBuffer() + blockOffset, _tailOutput0.GetBuffer() + blockOffset, _headBlockSize);
+
+                if (_tailInputFill == _tailBlockSize)
+                    AmAlignedReal32Buffer::Swap(_tailPrecalculated0, _tailOutput0);
+            }
+
+            // Convolution of the rest of the tail, spread across the head blocks of the next tail block
+            if (_tailPrecalculated.GetSize() > 0 && _tailInputFill % _headBlockSize == 0)
+            {
+                ProcessTailStep();
+
+                if (_tailInputFill == _tailBlockSize)
+                {
+                    AmAlignedReal32Buffer::Swap(_tailPrecalculated, _tailOutput);
+                    _tailProcessingInput.CopyFrom(_tailInput);
+                }
+            }
+
+            if (_tailInputFill == _tailBlockSize)
+            {
+                _tailInputFill = 0;
+                _precalculatedPos = 0;
+            }
+
+            processed += processing;
+        }
+    }
+
+    void TwoStageConvolver::ProcessTailStep()
+    {
+        // Forward FFT of the last complete tail block
+        if (_tailStep == 0)
+        {
+            CopyAndPad(_tailFFTBuffer, _tailProcessingInput.GetBuffer(), _tailBlockSize);
+            _tailFFT.Forward(_tailFFTBuffer.GetBuffer(), *_tailSegments[_tailCurrent]);
+            _tailConv.Clear();
+        }
+
+        // Complex multiplication, shared between the steps
+        const AmSize first = (_tailStep * _tailSegCount) / _tailStepCount;
+        const AmSize last = ((_tailStep + 1) * _tailSegCount) / _tailStepCount;
+        for (AmSize i = first; i < last; ++i)
+        {
+            const AmSize indexAudio = (_tailCurrent + i) % _tailSegCount;
+            ComplexMultiplyAccumulate(_tailConv, *_tailSegmentsIR[i], *_tailSegments[indexAudio]);
+        }
+
+        if (++_tailStep < _tailStepCount)
+            return;
+
+        // Backward FFT and overlap
+        _tailFFT.Backward(_tailFFTBuffer.GetBuffer(), _tailConv);
+        Sum(_tailOutput.GetBuffer(), _tailFFTBuffer.GetBuffer(), _tailOverlap.GetBuffer(), _tailBlockSize);
+        std::memcpy(_tailOverlap.GetBuffer(), _tailFFTBuffer.GetBuffer() + _tailBlockSize, _tailBlockSize * sizeof(AmAudioSample));
+
+        _tailCurrent = (_tailCurrent > 0) ? (_tailCurrent - 1) : (_tailSegCount - 1);
+        _tailStep = 0;
+    }
+} // namespace SparkyStudios::Audio::Amplitude
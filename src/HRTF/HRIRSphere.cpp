@@ -15,14 +15,24 @@
 #include <SparkyStudios/Audio/Amplitude/Core/Log.h>
 #include <SparkyStudios/Audio/Amplitude/Math/BarycentricCoordinates.h>
 
+#include <SparkyStudios/Audio/Amplitude/DSP/MultiConvolver.h>
+
 #include <HRTF/HRIRSphere.h>
 #include <Math/FaceBSPTree.h>
 #include <Utils/Utils.h>
 
 namespace SparkyStudios::Audio::Amplitude
 {
+    // Index of the grid cells where the sphere has no face
+    constexpr AmUInt32 kInvalidVertex = static_cast<AmUInt32>(-1);
+
     HRIRSphereImpl::HRIRSphereImpl()
         : ResourceImpl()
+        , _samplingMode(eHRIRSphereSamplingMode_Bilinear)
+        , _lookupGridResolution(0.0f)
+        , _lookupGridAzimuthCount(0)
+        , _lookupGridElevationCount(0)
+        , _spectrumSize(0)
         , _loaded(false)
     {}
 
@@ -65,6 +75,14 @@ namespace SparkyStudios::Audio::Amplitude
         _header.m_VertexCount = file->Read32();
         _header.m_IndexCount = file->Read32();
 
+        if (_header.m_Version >= 2)
+            _header.m_BlockSize = file->Read32();
+
+        if (_header.m_Version >= 3)
+            _header.m_MinimumPhase = file->Read8() != 0;
+
+        _spectrumSize = _header.m_BlockSize > 0 ? MultiConvolver::GetSpectrumSize(_header.m_IRLength, _header.m_BlockSize) : 0;
+
         std::vector<AmUInt32> indices(_header.m_IndexCount);
         file->Read(reinterpret_cast<AmUInt8Buffer>(indices.data()), _header.m_IndexCount * sizeof(AmUInt32));
 
@@ -87,6 +105,15 @@ namespace SparkyStudios::Audio::Amplitude
 
             file->Read(reinterpret_cast<AmUInt8Buffer>(&vertex.m_RightDelay), sizeof(AmReal32));
 
+            if (_spectrumSize > 0)
+            {
+                vertex.m_LeftSpectrum.resize(_spectrumSize);
+                file->Read(reinterpret_cast<AmUInt8Buffer>(vertex.m_LeftSpectrum.data()), _spectrumSize * sizeof(AmReal32));
+
+                vertex.m_RightSpectrum.resize(_spectrumSize);
+                file->Read(reinterpret_cast<AmUInt8Buffer>(vertex.m_RightSpectrum.data()), _spectrumSize * sizeof(AmReal32));
+            }
+
             vertices[i] = vertex.m_Position;
             ++i;
         }
@@ -102,6 +129,7 @@ namespace SparkyStudios::Audio::Amplitude
         }
 
         _tree.Build(vertices, _faces);
+        BuildLookupGrid();
 
         _loaded = true;
     }
@@ -151,21 +179,109 @@ namespace SparkyStudios::Audio::Amplitude
         _samplingMode = mode;
     }
 
+    void HRIRSphereImpl::SetLookupGridResolution(AmReal32 resolution)
+    {
+        _lookupGridResolution = AM_MAX(resolution, 0.0f);
+
+        if (_loaded)
+            BuildLookupGrid();
+    }
+
+    AmReal32 HRIRSphereImpl::GetLookupGridResolution() const
+    {
+        return _lookupGridResolution;
+    }
+
     void HRIRSphereImpl::Sample(const AmVec3& direction, AmReal32* leftHRIR, AmReal32* rightHRIR) const
     {
+        Sample(direction, &HRIRSphereVertex::m_LeftIR, &HRIRSphereVertex::m_RightIR, leftHRIR, rightHRIR);
+    }
+
+    AmUInt32 HRIRSphereImpl::GetSpectrumBlockSize() const
+    {
+        return _header.m_BlockSize;
+    }
+
+    AmSize HRIRSphereImpl::GetSpectrumSize() const
+    {
+        return _spectrumSize;
+    }
+
+    void HRIRSphereImpl::SampleSpectrum(const AmVec3& direction, AmReal32* leftSpectrum, AmReal32* rightSpectrum) const
+    {
+        if (_spectrumSize == 0)
+            return;
+
+        Sample(direction, &HRIRSphereVertex::m_LeftSpectrum, &HRIRSphereVertex::m_RightSpectrum, leftSpectrum, rightSpectrum);
+    }
+
+    bool HRIRSphereImpl::IsMinimumPhase() const
+    {
+        return _header.m_MinimumPhase;
+    }
+
+    void HRIRSphereImpl::SampleDelay(const AmVec3& direction, AmReal32& leftDelay, AmReal32& rightDelay) const
+    {
+        Blend located;
+        const Blend* blend = GetBlend(direction, located);
+
+        if (blend == nullptr)
+            return;
+
+        if (_samplingMode == eHRIRSphereSamplingMode_NearestNeighbor)
+        {
+            const auto& vertex = _vertices[GetNearestVertex(*blend)];
+
+            leftDelay = vertex.m_LeftDelay;
+            rightDelay = vertex.m_RightDelay;
+            return;
+        }
+
+        leftDelay = rightDelay = 0.0f;
+
+        for (AmSize i = 0; i < 3; ++i)
+        {
+            const auto& vertex = _vertices[blend->m_Vertices[i]];
+
+            leftDelay += vertex.m_LeftDelay * blend->m_Weights[i];
+            rightDelay += vertex.m_RightDelay * blend->m_Weights[i];
+        }
+    }
+
+    void HRIRSphereImpl::Sample(const AmVec3& direction, Data left, Data right, AmReal32* leftOutput, AmReal32* rightOutput) const
+    {
+        Blend located;
+        const Blend* blend = GetBlend(direction, located);
+
+        if (blend == nullptr)
+            return;
+
         switch (_samplingMode)
         {
         case eHRIRSphereSamplingMode_Bilinear:
-            return SampleBilinear(direction, leftHRIR, rightHRIR);
+            return SampleBilinear(*blend, left, right, leftOutput, rightOutput);
         case eHRIRSphereSamplingMode_NearestNeighbor:
-            return SampleNearestNeighbor(direction, leftHRIR, rightHRIR);
+            return SampleNearestNeighbor(*blend, left, right, leftOutput, rightOutput);
         }
     }
 
     void HRIRSphereImpl::Transform(const AmMat4& matrix)
     {
-        for (auto& vertex : _vertices)
+        std::vector<AmVec3> vertices(_vertices.size());
+
+        for (AmSize i = 0, l = _vertices.size(); i < l; ++i)
+        {
+            auto& vertex = _vertices[i];
             vertex.m_Position = AM_Mul(matrix, AM_V4V(vertex.m_Position, 1.0f)).XYZ;
+            vertices[i] = vertex.m_Position;
+        }
+
+        // Keep the search tree and the lookup grid in the same space as the vertices
+        if (_loaded)
+        {
+            _tree.Build(vertices, _faces);
+            BuildLookupGrid();
+        }
     }
 
     bool HRIRSphereImpl::IsLoaded() const
@@ -173,111 +289,102 @@ namespace SparkyStudios::Audio::Amplitude
         return _loaded;
     }
 
-    void HRIRSphereImpl::SampleBilinear(const AmVec3& direction, AmReal32* leftHRIR, AmReal32* rightHRIR) const
+    bool HRIRSphereImpl::Locate(const AmVec3& direction, Blend& blend) const
     {
         const auto& dir = AM_Mul(direction, 10.0f);
         const auto* face = _tree.Query(dir);
 
         if (face == nullptr)
-            return;
+            return false;
 
-        // If we are very close to any vertex, just return the HRIR of that vertex
+        // If we are very close to any vertex, just use the HRIR of that vertex
+        if (const auto* vertex = GetClosestVertex(direction, face); vertex != nullptr)
         {
-            const auto* vertex = GetClosestVertex(direction, face);
+            const auto index = static_cast<AmUInt32>(vertex - _vertices.data());
 
-            if (vertex != nullptr)
-            {
-                const AmSize length = vertex->m_LeftIR.size();
-                std::memcpy(leftHRIR, vertex->m_LeftIR.data(), length * sizeof(AmReal32));
-                std::memcpy(rightHRIR, vertex->m_RightIR.data(), length * sizeof(AmReal32));
-                return;
-            }
+            blend.m_Vertices[0] = blend.m_Vertices[1] = blend.m_Vertices[2] = index;
+            blend.m_Weights[0] = 1.0f;
+            blend.m_Weights[1] = blend.m_Weights[2] = 0.0f;
+            return true;
         }
 
         const auto& vertexA = _vertices[face->m_A];
         const auto& vertexB = _vertices[face->m_B];
         const auto& vertexC = _vertices[face->m_C];
 
-        // Otherwise, perform bilinear interpolation
+        BarycentricCoordinates barycenter;
+        if (!BarycentricCoordinates::RayTriangleIntersection(
+                AM_V3(0.0f, 0.0f, 0.0f), dir, { vertexA.m_Position, vertexB.m_Position, vertexC.m_Position }, barycenter))
         {
-            BarycentricCoordinates barycenter;
-            if (!BarycentricCoordinates::RayTriangleIntersection(
-                    AM_V3(0.0f, 0.0f, 0.0f), dir, { vertexA.m_Position, vertexB.m_Position, vertexC.m_Position }, barycenter))
-            {
-                return;
-            }
+            return false;
+        }
 
-            const AmSize length = vertexA.m_LeftIR.size();
+        blend.m_Vertices[0] = face->m_A;
+        blend.m_Vertices[1] = face->m_B;
+        blend.m_Vertices[2] = face->m_C;
+        blend.m_Weights[0] = barycenter.m_U;
+        blend.m_Weights[1] = barycenter.m_V;
+        blend.m_Weights[2] = barycenter.m_W;
 
-            for (AmSize i = 0; i < length; ++i)
-            {
-                leftHRIR[i] =
-                    vertexA.m_LeftIR[i] * barycenter.m_U + vertexB.m_LeftIR[i] * barycenter.m_V + vertexC.m_LeftIR[i] * barycenter.m_W;
+        return true;
+    }
 
-                rightHRIR[i] =
-                    vertexA.m_RightIR[i] * barycenter.m_U + vertexB.m_RightIR[i] * barycenter.m_V + vertexC.m_RightIR[i] * barycenter.m_W;
-            }
-        }
+    const HRIRSphereImpl::Blend* HRIRSphereImpl::GetBlend(const AmVec3& direction, Blend& located) const
+    {
+        const Blend* blend = &located;
+
+        if (!_lookupGrid.empty())
+            blend = &GetLookupGridCell(direction);
+        else if (!Locate(direction, located))
+            return nullptr;
+
+        if (blend->m_Vertices[0] == kInvalidVertex)
+            return nullptr;
+
+        return blend;
     }
 
-    void HRIRSphereImpl::SampleNearestNeighbor(const AmVec3& direction, AmReal32* leftHRIR, AmReal32* rightHRIR) const
+    AmUInt32 HRIRSphereImpl::GetNearestVertex(const Blend& blend) const
     {
-        const auto& dir = AM_Mul(direction, 10.0f);
-        const auto* face = _tree.Query(dir);
+        const AmReal32 min = std::min({ blend.m_Weights[0], blend.m_Weights[1], blend.m_Weights[2] });
 
-        if (face == nullptr)
-            return;
+        if (min == blend.m_Weights[1])
+            return blend.m_Vertices[0];
 
-        // If we are very close to any vertex, just return the HRIR of that vertex
-        {
-            const auto* vertex = GetClosestVertex(direction, face);
+        if (min == blend.m_Weights[0])
+            return blend.m_Vertices[1];
 
-            if (vertex != nullptr)
-            {
-                const AmSize length = vertex->m_LeftIR.size();
-                std::memcpy(leftHRIR, vertex->m_LeftIR.data(), length * sizeof(AmReal32));
-                std::memcpy(rightHRIR, vertex->m_RightIR.data(), length * sizeof(AmReal32));
-                return;
-            }
-        }
+        return blend.m_Vertices[2];
+    }
 
-        const auto& vertexA = _vertices[face->m_A];
-        const auto& vertexB = _vertices[face->m_B];
-        const auto& vertexC = _vertices[face->m_C];
+    void HRIRSphereImpl::SampleBilinear(const Blend& blend, Data left, Data right, AmReal32* leftOutput, AmReal32* rightOutput) const
+    {
+        const auto& vertexA = _vertices[blend.m_Vertices[0]];
+        const AmSize length = (vertexA.*left).size();
 
-        // Otherwise, perform nearest neighbor interpolation
+        ScalarMultiply((vertexA.*left).data(), leftOutput, blend.m_Weights[0], length);
+        ScalarMultiply((vertexA.*right).data(), rightOutput, blend.m_Weights[0], length);
+
+        for (AmSize i = 1; i < 3; ++i)
         {
-            BarycentricCoordinates barycenter;
-            if (!BarycentricCoordinates::RayTriangleIntersection(
-                    AM_V3(0.0f, 0.0f, 0.0f), dir, { vertexA.m_Position, vertexB.m_Position, vertexC.m_Position }, barycenter))
-            {
-                return;
-            }
+            // Vertices are sampled exactly, without accumulating null contributions
+            if (blend.m_Weights[i] == 0.0f)
+                continue;
 
-            const AmSize length = vertexA.m_LeftIR.size();
-            const AmReal32 min = std::min({ barycenter.m_U, barycenter.m_V, barycenter.m_W });
+            const auto& vertex = _vertices[blend.m_Vertices[i]];
 
-            if (min == barycenter.m_V)
-            {
-                std::memcpy(leftHRIR, vertexA.m_LeftIR.data(), length * sizeof(AmReal32));
-                std::memcpy(rightHRIR, vertexA.m_RightIR.data(), length * sizeof(AmReal32));
-                return;
-            }
+            ScalarMultiplyAccumulate((vertex.*left).data(), leftOutput, blend.m_Weights[i], length);
+            ScalarMultiplyAccumulate((vertex.*right).data(), rightOutput, blend.m_Weights[i], length);
+        }
+    }
 
-            if (min == barycenter.m_U)
-            {
-                std::memcpy(leftHRIR, vertexB.m_LeftIR.data(), length * sizeof(AmReal32));
-                std::memcpy(rightHRIR, vertexB.m_RightIR.data(), length * sizeof(AmReal32));
-                return;
-            }
+    void HRIRSphereImpl::SampleNearestNeighbor(const Blend& blend, Data left, Data right, AmReal32* leftOutput, AmReal32* rightOutput) const
+    {
+        const auto& vertex = _vertices[GetNearestVertex(blend)];
+        const AmSize length = (vertex.*left).size();
 
-            if (min == barycenter.m_W)
-            {
-                std::memcpy(leftHRIR, vertexC.m_LeftIR.data(), length * sizeof(AmReal32));
-                std::memcpy(rightHRIR, vertexC.m_RightIR.data(), length * sizeof(AmReal32));
-                return;
-            }
-        }
+        std::memcpy(leftOutput, (vertex.*left).data(), length * sizeof(AmReal32));
+        std::memcpy(rightOutput, (vertex.*right).data(), length * sizeof(AmReal32));
     }
 
     const HRIRSphereVertex* HRIRSphereImpl::GetClosestVertex(const AmVec3& position, const Face* face) const
@@ -299,4 +406,64 @@ namespace SparkyStudios::Audio::Amplitude
 
         return nullptr;
     }
+
+    void HRIRSphereImpl::BuildLookupGrid()
+    {
+        // Build the grid aside, so the current one is only replaced once the new one is complete
+        std::vector<Blend> grid;
+        AmSize azimuthCount = 0;
+        AmSize elevationCount = 0;
+
+        if (_lookupGridResolution > 0.0f && !_vertices.empty())
+        {
+            azimuthCount = AM_MAX(static_cast<AmSize>(std::round(360.0f / _lookupGridResolution)), AmSize(1));
+            elevationCount = AM_MAX(static_cast<AmSize>(std::round(180.0f / _lookupGridResolution)), AmSize(1)) + 1;
+            grid.resize(azimuthCount * elevationCount);
+
+            // Locate the cells at the radius of the sphere, so they snap to the vertices they contain
+            const AmReal32 radius = AM_Len(_vertices[0].m_Position);
+
+            const AmReal32 azimuthStep = AM_PI * 2.0f / static_cast<AmReal32>(azimuthCount);
+            const AmReal32 elevationStep = AM_PI / static_cast<AmReal32>(elevationCount - 1);
+
+            for (AmSize e = 0; e < elevationCount; ++e)
+            {
+                const AmReal32 elevation = static_cast<AmReal32>(e) * elevationStep - AM_PI * 0.5f;
+
+                for (AmSize a = 0; a < azimuthCount; ++a)
+                {
+                    const AmReal32 azimuth = static_cast<AmReal32>(a) * azimuthStep;
+
+                    const AmVec3 direction = AM_V3(
+                        std::cos(elevation) * std::cos(azimuth), std::cos(elevation) * std::sin(azimuth), std::sin(elevation));
+
+                    Blend& cell = grid[e * azimuthCount + a];
+                    if (!Locate(AM_Mul(direction, radius), cell))
+                        cell.m_Vertices[0] = kInvalidVertex;
+                }
+            }
+        }
+
+        _lookupGrid.swap(grid);
+        _lookupGridAzimuthCount = azimuthCount;
+        _lookupGridElevationCount = elevationCount;
+    }
+
+    const HRIRSphereImpl::Blend& HRIRSphereImpl::GetLookupGridCell(const AmVec3& direction) const
+    {
+        const AmReal32 azimuth = std::atan2(direction.Y, direction.X);
+        const AmReal32 elevation = std::atan2(direction.Z, std::sqrt(direction.X * direction.X + direction.Y * direction.Y));
+
+        const AmReal32 azimuthCells = static_cast<AmReal32>(_lookupGridAzimuthCount) / (AM_PI * 2.0f);
+        const AmReal32 elevationCells = static_cast<AmReal32>(_lookupGridElevationCount - 1) / AM_PI;
+
+        auto a = static_cast<AmInt64>(std::round(azimuth * azimuthCells)) % static_cast<AmInt64>(_lookupGridAzimuthCount);
+        if (a < 0)
+            a += static_cast<AmInt64>(_lookupGridAzimuthCount);
+
+        const auto e = AM_CLAMP(static_cast<AmInt64>(std::round((elevation + AM_PI * 0.5f) * elevationCells)), 0,
+            static_cast<AmInt64>(_lookupGridElevationCount - 1));
+
+        return _lookupGrid[e * _lookupGridAzimuthCount + a];
+    }
 } // namespace SparkyStudios::Audio::Amplitude
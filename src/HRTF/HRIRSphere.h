@@ -54,20 +54,50 @@ namespace SparkyStudios::Audio::Amplitude
         [[nodiscard]] AmUInt32 GetIRLength() const override;
         void SetSamplingMode(eHRIRSphereSamplingMode mode) override;
         [[nodiscard]] eHRIRSphereSamplingMode GetSamplingMode() const override;
+        void SetLookupGridResolution(AmReal32 resolution) override;
+        [[nodiscard]] AmReal32 GetLookupGridResolution() const override;
         void Sample(const AmVec3& direction, AmReal32* leftHRIR, AmReal32* rightHRIR) const override;
+        [[nodiscard]] AmUInt32 GetSpectrumBlockSize() const override;
+        [[nodiscard]] AmSize GetSpectrumSize() const override;
+        void SampleSpectrum(const AmVec3& direction, AmReal32* leftSpectrum, AmReal32* rightSpectrum) const override;
+        [[nodiscard]] bool IsMinimumPhase() const override;
+        void SampleDelay(const AmVec3& direction, AmReal32& leftDelay, AmReal32& rightDelay) const override;
         void Transform(const AmMat4& matrix) override;
         [[nodiscard]] bool IsLoaded() const override;
 
     private:
-        void SampleBilinear(const AmVec3& direction, AmReal32* leftHRIR, AmReal32* rightHRIR) const;
-        void SampleNearestNeighbor(const AmVec3& direction, AmReal32* leftHRIR, AmReal32* rightHRIR) const;
+        // The vertices surrounding a direction, and their interpolation weights.
+        struct Blend
+        {
+            AmUInt32 m_Vertices[3];
+            AmReal32 m_Weights[3];
+        };
+
+        // The vertex data to sample, either the HRIRs or their spectra.
+        typedef std::vector<AmReal32> HRIRSphereVertex::* Data;
+
+        bool Locate(const AmVec3& direction, Blend& blend) const;
+        [[nodiscard]] const Blend* GetBlend(const AmVec3& direction, Blend& located) const;
+        [[nodiscard]] AmUInt32 GetNearestVertex(const Blend& blend) const;
+        void Sample(const AmVec3& direction, Data left, Data right, AmReal32* leftOutput, AmReal32* rightOutput) const;
+        void SampleBilinear(const Blend& blend, Data left, Data right, AmReal32* leftOutput, AmReal32* rightOutput) const;
+        void SampleNearestNeighbor(const Blend& blend, Data left, Data right, AmReal32* leftOutput, AmReal32* rightOutput) const;
         const HRIRSphereVertex* GetClosestVertex(const AmVec3& position, const Face* face) const;
 
+        void BuildLookupGrid();
+        [[nodiscard]] const Blend& GetLookupGridCell(const AmVec3& direction) const;
+
         eHRIRSphereSamplingMode _samplingMode;
         HRIRSphereFileHeaderDescription _header;
         std::vector<HRIRSphereVertex> _vertices;
         std::vector<Face> _faces;
         FaceBSPTree _tree;
+        AmSize _spectrumSize;
+
+        AmReal32 _lookupGridResolution;
+        AmSize _lookupGridAzimuthCount;
+        AmSize _lookupGridElevationCount;
+        std::vector<Blend> _lookupGrid;
 
         bool _loaded;
     };
@@ -0,0 +1,350 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <IO/CachedFile.h>
+#include <IO/FileReadScheduler.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    CachedFile::CachedFile(
+        std::shared_ptr<File> file,
+        AmUInt64 fileId,
+        AmSize blockSize,
+        AmSize readAheadBlockCount,
+        std::shared_ptr<FileBlockCache> blockCache,
+        std::shared_ptr<CachedFileCounters> counters)
+        : _file(std::move(file))
+        , _fileId(fileId)
+        , _blockSize(AM_MAX(blockSize, static_cast<AmSize>(1)))
+        , _readAheadBlockCount(readAheadBlockCount)
+        , _length(_file->Length())
+        , _position(0)
+        , _blockCache(std::move(blockCache))
+        , _counters(std::move(counters))
+        , _prefetchFile(this)
+    {}
+
+    CachedFile::~CachedFile()
+    {
+        if (_readScheduler != nullptr)
+        {
+            _readScheduler->Drain(this);
+
+            // Completes the pending prefetches, which store blocks through this instance
+            _readScheduler->Drain(&_prefetchFile);
+        }
+    }
+
+    AmOsString CachedFile::GetPath() const
+    {
+        return _file->GetPath();
+    }
+
+    bool CachedFile::Eof()
+    {
+        return _position >= _length;
+    }
+
+    AmSize CachedFile::Read(AmUInt8Buffer dst, AmSize bytes)
+    {
+        const AmSize read = ReadAt(_position, dst, bytes);
+        _position += read;
+
+        return read;
+    }
+
+    AmSize CachedFile::ReadAt(AmSize offset, AmUInt8Buffer dst, AmSize bytes)
+    {
+        if (offset >= _length)
+            return 0;
+
+        bytes = AM_MIN(bytes, _length - offset);
+
+        AmSize read = 0;
+
+        while (read < bytes)
+        {
+            const AmSize position = offset + read;
+            const AmSize blockIndex = position / _blockSize;
+            const AmSize blockOffset = position % _blockSize;
+
+            const auto block = GetBlock(blockIndex);
+            if (block == nullptr || blockOffset >= block->size())
+                break;
+
+            const AmSize count = AM_MIN(bytes - read, block->size() - blockOffset);
+            std::memcpy(dst + read, block->data() + blockOffset, count);
+
+            read += count;
+        }
+
+        return read;
+    }
+
+    void CachedFile::ReadAsync(AmSize offset, AmSize size, AmUInt8Buffer buffer, FileReadCallback callback, eFileReadPriority priority)
+    {
+        // Cached data is copied right away, there is nothing to wait for
+        if (offset >= _length || IsCached(offset, AM_MIN(size, _length - offset)))
+        {
+            const AmSize read = ReadAt(offset, buffer, size);
+
+            if (callback)
+                callback(read);
+
+            return;
+        }
+
+        GetReadScheduler()->Submit(this, offset, size, buffer, std::move(callback), priority);
+    }
+
+    AmSize CachedFile::Write(AmConstUInt8Buffer src, AmSize bytes)
+    {
+        // Writing is disabled for cached files
+        return 0;
+    }
+
+    AmSize CachedFile::Length()
+    {
+        return _length;
+    }
+
+    void CachedFile::Seek(AmInt64 offset, eFileSeekOrigin origin)
+    {
+        const auto fileSize = static_cast<AmInt64>(_length);
+
+        AmInt64 finalOffset = offset;
+
+        switch (origin)
+        {
+        case eFileSeekOrigin_Start:
+            break;
+        case eFileSeekOrigin_End:
+            finalOffset += fileSize;
+            break;
+        case eFileSeekOrigin_Current:
+            finalOffset += static_cast<AmInt64>(_position);
+            break;
+        }
+
+        _position = static_cast<AmSize>(AM_CLAMP(finalOffset, 0, fileSize));
+    }
+
+    AmSize CachedFile::Position()
+    {
+        return _position;
+    }
+
+    void CachedFile::Prefetch(AmSize offset, AmSize size)
+    {
+        if (offset >= _length || size == 0)
+            return;
+
+        size = AM_MIN(size, _length - offset);
+
+        // Only read the range between the first and the last missing blocks
+        AmSize first = offset / _blockSize;
+        AmSize last = (offset + size - 1) / _blockSize;
+
+        while (first <= last && _blockCache->Contains(_fileId, first))
+            ++first;
+
+        while (last > first && _blockCache->Contains(_fileId, last))
+            --last;
+
+        if (first > last)
+            return;
+
+        const AmSize readOffset = first * _blockSize;
+        const AmSize readSize = AM_MIN((last - first + 1) * _blockSize, _length - readOffset);
+
+        auto data = std::make_shared<std::vector<AmUInt8>>(readSize);
+
+        GetReadScheduler()->Submit(
+            &_prefetchFile, readOffset, readSize, data->data(),
+            [this, data, first](AmSize read)
+            {
+                _counters->m_BytesRead += read;
+
+                for (AmSize i = 0, position = 0; position < read; ++i, position += _blockSize)
+                {
+                    // Blocks loaded in the meantime by a synchronous read are already up to date
+                    if (_blockCache->Contains(_fileId, first + i))
+                        continue;
+
+                    if (StoreBlocks(first + i, data->data() + position, AM_MIN(_blockSize, read - position)) != nullptr)
+                        ++_counters->m_PrefetchedBlocks;
+                }
+            },
+            eFileReadPriority_Bulk);
+    }
+
+    bool CachedFile::IsValid() const
+    {
+        return _file != nullptr && _file->IsValid();
+    }
+
+    AmSize CachedFile::ReadFile(AmSize offset, AmUInt8Buffer dst, AmSize bytes)
+    {
+        std::lock_guard lock(_readMutex);
+        return _file->ReadAt(offset, dst, bytes);
+    }
+
+    FileBlockCache::Block CachedFile::GetBlock(AmSize index)
+    {
+        if (auto block = _blockCache->Get(_fileId, index); block != nullptr)
+        {
+            ++_counters->m_Hits;
+            return block;
+        }
+
+        // Serializes the reads on the wrapped file, which may not support concurrent positional reads
+        std::lock_guard lock(_readMutex);
+
+        // Another thread may have loaded the block while we were waiting
+        if (auto block = _blockCache->Get(_fileId, index); block != nullptr)
+        {
+            ++_counters->m_Hits;
+            return block;
+        }
+
+        ++_counters->m_Misses;
+
+        // Reads the missing block along with the next blocks not cached yet, in a single read
+        const AmSize blockCount = GetBlockCount();
+
+        AmSize count = 1;
+        while (count <= _readAheadBlockCount && index + count < blockCount && !_blockCache->Contains(_fileId, index + count))
+            ++count;
+
+        const AmSize offset = index * _blockSize;
+        const AmSize size = AM_MIN(count * _blockSize, _length - offset);
+
+        std::vector<AmUInt8> data(size);
+        const AmSize read = _file->ReadAt(offset, data.data(), size);
+
+        _counters->m_BytesRead += read;
+
+        auto block = StoreBlocks(index, data.data(), AM_MIN(read, _blockSize));
+
+        for (AmSize i = 1, position = _blockSize; position < read; ++i, position += _blockSize)
+        {
+            if (StoreBlocks(index + i, data.data() + position, AM_MIN(_blockSize, read - position)) != nullptr)
+                ++_counters->m_PrefetchedBlocks;
+        }
+
+        return block;
+    }
+
+    FileBlockCache::Block CachedFile::StoreBlocks(AmSize firstBlock, AmConstUInt8Buffer data, AmSize size)
+    {
+        FileBlockCache::Block first = nullptr;
+
+        for (AmSize i = 0, position = 0; position < size; ++i, position += _blockSize)
+        {
+            const AmSize index = firstBlock + i;
+            const AmSize length = AM_MIN(_blockSize, size - position);
+
+            // Only the last block of the file can be smaller than the block size, anything else is a short read
+            if (length < AM_MIN(_blockSize, _length - index * _blockSize))
+                break;
+
+            auto block = std::make_shared<const std::vector<AmUInt8>>(data + position, data + position + length);
+            _blockCache->Put(_fileId, index, block);
+
+            if (first == nullptr)
+                first = std::move(block);
+        }
+
+        return first;
+    }
+
+    bool CachedFile::IsCached(AmSize offset, AmSize size) const
+    {
+        if (size == 0)
+            return true;
+
+        const AmSize last = (offset + size - 1) / _blockSize;
+
+        for (AmSize index = offset / _blockSize; index <= last; ++index)
+            if (!_blockCache->Contains(_fileId, index))
+                return false;
+
+        return true;
+    }
+
+    AmSize CachedFile::GetBlockCount() const
+    {
+        return (_length + _blockSize - 1) / _blockSize;
+    }
+
+    CachedFile::PrefetchFile::PrefetchFile(CachedFile* owner)
+        : _owner(owner)
+    {}
+
+    AmOsString CachedFile::PrefetchFile::GetPath() const
+    {
+        return _owner->GetPath();
+    }
+
+    bool CachedFile::PrefetchFile::Eof()
+    {
+        return true;
+    }
+
+    AmSize CachedFile::PrefetchFile::Read(AmUInt8Buffer dst, AmSize bytes)
+    {
+        // Prefetches only use positional reads
+        return 0;
+    }
+
+    AmSize CachedFile::PrefetchFile::ReadAt(AmSize offset, AmUInt8Buffer dst, AmSize bytes)
+    {
+        return _owner->ReadFile(offset, dst, bytes);
+    }
+
+    AmSize CachedFile::PrefetchFile::Write(AmConstUInt8Buffer src, AmSize bytes)
+    {
+        return 0;
+    }
+
+    AmSize CachedFile::PrefetchFile::Length()
+    {
+        return _owner->_length;
+    }
+
+    void CachedFile::PrefetchFile::Seek(AmInt64 offset, eFileSeekOrigin origin)
+    {}
+
+    AmSize CachedFile::PrefetchFile::Position()
+    {
+        return 0;
+    }
+
+    bool CachedFile::PrefetchFile::IsValid() const
+    {
+        return _owner->IsValid();
+    }
+
+    FileReadScheduler* CachedFile::GetReadScheduler()
+    {
+        std::call_once(
+            _readSchedulerFlag,
+            [this]()
+            {
+                _readScheduler = FileReadScheduler::Acquire();
+            });
+
+        return _readScheduler.get();
+    }
+} // namespace SparkyStudios::Audio::Amplitude
@@ -0,0 +1,220 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef _AM_IMPLEMENTATION_IO_CACHED_FILE_H
+#define _AM_IMPLEMENTATION_IO_CACHED_FILE_H
+
+#include <atomic>
+#include <mutex>
+
+#include <SparkyStudios/Audio/Amplitude/IO/CachedFileSystem.h>
+
+#include <IO/FileBlockCache.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    class FileReadScheduler;
+
+    /**
+     * @brief The cache statistics shared by a `CachedFileSystem` and its files.
+     */
+    struct CachedFileCounters
+    {
+        std::atomic<AmUInt64> m_Hits = 0;
+        std::atomic<AmUInt64> m_Misses = 0;
+        std::atomic<AmUInt64> m_PrefetchedBlocks = 0;
+        std::atomic<AmUInt64> m_BytesRead = 0;
+    };
+
+    /**
+     * @brief A `File` opened from a `CachedFileSystem`.
+     *
+     * The cached file wraps the file opened by the underlying file system, and reads its content block by
+     * block through the shared block cache. It only tracks its own read cursor, so positional and asynchronous
+     * reads can be issued from multiple threads.
+     */
+    class CachedFile final : public File
+    {
+    public:
+        /**
+         * @brief Constructs a new `CachedFile` instance.
+         *
+         * @param[in] file The file opened by the wrapped file system.
+         * @param[in] fileId The ID of the file in the block cache.
+         * @param[in] blockSize The size in bytes of a cached block.
+         * @param[in] readAheadBlockCount The number of blocks to read after a missing block.
+         * @param[in] blockCache The block cache shared by the files of the file system.
+         * @param[in] counters The cache statistics shared by the files of the file system.
+         */
+        CachedFile(
+            std::shared_ptr<File> file,
+            AmUInt64 fileId,
+            AmSize blockSize,
+            AmSize readAheadBlockCount,
+            std::shared_ptr<FileBlockCache> blockCache,
+            std::shared_ptr<CachedFileCounters> counters);
+
+        /**
+         * @brief Destroys the `CachedFile` instance.
+         *
+         * This waits for all the pending asynchronous reads on this file to complete.
+         */
+        ~CachedFile() override;
+
+        /**
+         * @inherit
+         */
+        [[nodiscard]] AmOsString GetPath() const override;
+
+        /**
+         * @inherit
+         */
+        bool Eof() override;
+
+        /**
+         * @inherit
+         */
+        AmSize Read(AmUInt8Buffer dst, AmSize bytes) override;
+
+        /**
+         * @inherit
+         */
+        AmSize ReadAt(AmSize offset, AmUInt8Buffer dst, AmSize bytes) override;
+
+        /**
+         * @inherit
+         *
+         * Reads fully covered by cached blocks complete before this method returns. Other
+         * requests are served by the shared I/O threads.
+         */
+        void ReadAsync(
+            AmSize offset,
+            AmSize size,
+            AmUInt8Buffer buffer,
+            FileReadCallback callback,
+            eFileReadPriority priority = eFileReadPriority_Normal) override;
+
+        /**
+         * @inherit
+         *
+         * @note Writing is disabled for cached files.
+         */
+        AmSize Write(AmConstUInt8Buffer src, AmSize bytes) override;
+
+        /**
+         * @inherit
+         */
+        AmSize Length() override;
+
+        /**
+         * @inherit
+         */
+        void Seek(AmInt64 offset, eFileSeekOrigin origin) override;
+
+        /**
+         * @inherit
+         */
+        AmSize Position() override;
+
+        /**
+         * @inherit
+         *
+         * The missing blocks of the range are loaded in the background, with the bulk priority.
+         */
+        void Prefetch(AmSize offset, AmSize size) override;
+
+        /**
+         * @inherit
+         */
+        [[nodiscard]] bool IsValid() const override;
+
+    private:
+        /**
+         * @brief The file read by the I/O threads to prefetch blocks.
+         *
+         * Its reads go through `CachedFile::ReadFile()`, so they are serialized with the synchronous
+         * reads on the wrapped file.
+         */
+        class PrefetchFile final : public File
+        {
+        public:
+            explicit PrefetchFile(CachedFile* owner);
+
+            [[nodiscard]] AmOsString GetPath() const override;
+            bool Eof() override;
+            AmSize Read(AmUInt8Buffer dst, AmSize bytes) override;
+            AmSize ReadAt(AmSize offset, AmUInt8Buffer dst, AmSize bytes) override;
+            AmSize Write(AmConstUInt8Buffer src, AmSize bytes) override;
+            AmSize Length() override;
+            void Seek(AmInt64 offset, eFileSeekOrigin origin) override;
+            AmSize Position() override;
+            [[nodiscard]] bool IsValid() const override;
+
+        private:
+            CachedFile* _owner;
+        };
+
+        /**
+         * @brief Reads from the wrapped file, holding the read lock.
+         */
+        AmSize ReadFile(AmSize offset, AmUInt8Buffer dst, AmSize bytes);
+
+        /**
+         * @brief Gets the block at the given index, from the cache or by reading it from the wrapped file.
+         */
+        FileBlockCache::Block GetBlock(AmSize index);
+
+        /**
+         * @brief Splits the data read from the wrapped file into blocks, and adds them to the cache.
+         *
+         * @return The first stored block, or @c nullptr if no block was stored.
+         */
+        FileBlockCache::Block StoreBlocks(AmSize firstBlock, AmConstUInt8Buffer data, AmSize size);
+
+        /**
+         * @brief Checks if all the blocks covering the given range are cached.
+         */
+        [[nodiscard]] bool IsCached(AmSize offset, AmSize size) const;
+
+        /**
+         * @brief Gets the number of blocks in the file.
+         */
+        [[nodiscard]] AmSize GetBlockCount() const;
+
+        /**
+         * @brief Gets the shared I/O scheduler, acquiring it on first use.
+         */
+        FileReadScheduler* GetReadScheduler();
+
+        std::shared_ptr<File> _file;
+        AmUInt64 _fileId;
+        AmSize _blockSize;
+        AmSize _readAheadBlockCount;
+        AmSize _length;
+        AmSize _position;
+
+        std::shared_ptr<FileBlockCache> _blockCache;
+        std::shared_ptr<CachedFileCounters> _counters;
+
+        std::mutex _readMutex;
+        PrefetchFile _prefetchFile;
+
+        std::shared_ptr<FileReadScheduler> _readScheduler;
+        std::once_flag _readSchedulerFlag;
+    };
+} // namespace SparkyStudios::Audio::Amplitude
+
+#endif // _AM_IMPLEMENTATION_IO_CACHED_FILE_H
@@ -0,0 +1,211 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <SparkyStudios/Audio/Amplitude/Core/Memory.h>
+#include <SparkyStudios/Audio/Amplitude/IO/CachedFileSystem.h>
+
+#include <IO/CachedFile.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    /**
+     * @brief The default size in bytes of a cached block.
+     */
+    static constexpr AmSize kDefaultBlockSize = 64 * 1024;
+
+    /**
+     * @brief The default number of cached blocks.
+     */
+    static constexpr AmSize kDefaultBlockCacheCapacity = 256;
+
+    /**
+     * @brief The default number of blocks read after a missing block.
+     */
+    static constexpr AmSize kDefaultReadAheadBlockCount = 1;
+
+    CachedFileSystem::CachedFileSystem(FileSystem* fileSystem)
+        : _fileSystem(fileSystem)
+        , _blockSize(kDefaultBlockSize)
+        , _blockCacheCapacity(kDefaultBlockCacheCapacity)
+        , _readAheadBlockCount(kDefaultReadAheadBlockCount)
+        , _openedBlockSize(kDefaultBlockSize)
+        , _openedReadAheadBlockCount(kDefaultReadAheadBlockCount)
+        , _blockCache(nullptr)
+        , _counters(std::make_shared<CachedFileCounters>())
+        , _files()
+        , _nextFileId(0)
+    {
+        AMPLITUDE_ASSERT(_fileSystem != nullptr);
+    }
+
+    CachedFileSystem::~CachedFileSystem() = default;
+
+    void CachedFileSystem::SetBasePath(const AmOsString& basePath)
+    {
+        _fileSystem->SetBasePath(basePath);
+    }
+
+    const AmOsString& CachedFileSystem::GetBasePath() const
+    {
+        return _fileSystem->GetBasePath();
+    }
+
+    AmOsString CachedFileSystem::ResolvePath(const AmOsString& path) const
+    {
+        return _fileSystem->ResolvePath(path);
+    }
+
+    bool CachedFileSystem::Exists(const AmOsString& path) const
+    {
+        return _fileSystem->Exists(path);
+    }
+
+    bool CachedFileSystem::IsDirectory(const AmOsString& path) const
+    {
+        return _fileSystem->IsDirectory(path);
+    }
+
+    AmOsString CachedFileSystem::Join(const std::vector<AmOsString>& parts) const
+    {
+        return _fileSystem->Join(parts);
+    }
+
+    std::shared_ptr<File> CachedFileSystem::OpenFile(const AmOsString& path, eFileOpenMode mode) const
+    {
+        auto file = _fileSystem->OpenFile(path, mode);
+
+        // Files already in memory gain nothing from the cache, and written files must not be cached
+        if (_blockCache == nullptr || mode != eFileOpenMode_Read || file == nullptr || !file->IsValid() || file->IsMemoryBacked())
+            return file;
+
+        const AmUInt64 fileId = GetFileId(file);
+
+        return std::shared_ptr<CachedFile>(
+            ampoolnew(
+                eMemoryPoolKind_IO, CachedFile, std::move(file), fileId, _openedBlockSize, _openedReadAheadBlockCount, _blockCache,
+                _counters),
+            am_delete<eMemoryPoolKind_IO, CachedFile>{});
+    }
+
+    void CachedFileSystem::StartOpenFileSystem()
+    {
+        // Blocks are keyed by file and index only, so their size must not change while the cache is in use
+        _openedBlockSize = _blockSize;
+        _openedReadAheadBlockCount = _readAheadBlockCount;
+
+        _blockCache = std::make_shared<FileBlockCache>(_blockCacheCapacity);
+        _fileSystem->StartOpenFileSystem();
+    }
+
+    bool CachedFileSystem::TryFinalizeOpenFileSystem()
+    {
+        return _fileSystem->TryFinalizeOpenFileSystem();
+    }
+
+    void CachedFileSystem::StartCloseFileSystem()
+    {
+        _fileSystem->StartCloseFileSystem();
+    }
+
+    bool CachedFileSystem::TryFinalizeCloseFileSystem()
+    {
+        if (!_fileSystem->TryFinalizeCloseFileSystem())
+            return false;
+
+        // Files still opened keep their reference to the cache
+        _blockCache.reset();
+
+        std::lock_guard lock(_filesMutex);
+        _files.clear();
+
+        return true;
+    }
+
+    FileSystem* CachedFileSystem::GetFileSystem() const
+    {
+        return _fileSystem;
+    }
+
+    void CachedFileSystem::SetBlockSize(AmSize blockSize)
+    {
+        _blockSize = AM_MAX(blockSize, static_cast<AmSize>(1));
+    }
+
+    AmSize CachedFileSystem::GetBlockSize() const
+    {
+        return _blockSize;
+    }
+
+    void CachedFileSystem::SetBlockCacheCapacity(AmSize capacity)
+    {
+        _blockCacheCapacity = capacity;
+    }
+
+    AmSize CachedFileSystem::GetBlockCacheCapacity() const
+    {
+        return _blockCacheCapacity;
+    }
+
+    void CachedFileSystem::SetReadAheadBlockCount(AmSize count)
+    {
+        _readAheadBlockCount = count;
+    }
+
+    AmSize CachedFileSystem::GetReadAheadBlockCount() const
+    {
+        return _readAheadBlockCount;
+    }
+
+    CachedFileSystemStatistics CachedFileSystem::GetStatistics() const
+    {
+        CachedFileSystemStatistics statistics;
+        statistics.m_Hits = _counters->m_Hits;
+        statistics.m_Misses = _counters->m_Misses;
+        statistics.m_PrefetchedBlocks = _counters->m_PrefetchedBlocks;
+        statistics.m_BytesRead = _counters->m_BytesRead;
+
+        return statistics;
+    }
+
+    void CachedFileSystem::ResetStatistics()
+    {
+        _counters->m_Hits = 0;
+        _counters->m_Misses = 0;
+        _counters->m_PrefetchedBlocks = 0;
+        _counters->m_BytesRead = 0;
+    }
+
+    void CachedFileSystem::ClearCache()
+    {
+        if (_blockCache != nullptr)
+            _blockCache->Clear();
+    }
+
+    AmUInt64 CachedFileSystem::GetFileId(const std::shared_ptr<File>& file) const
+    {
+        const AmOsString path = file->GetPath();
+        const AmSize length = file->Length();
+
+        std::lock_guard lock(_filesMutex);
+
+        // A file with a different length has been replaced, its previous blocks must not be reused
+        if (const auto it = _files.find(path); it != _files.end() && it->second.m_Length == length)
+            return it->second.m_Id;
+
+        const AmUInt64 id = _nextFileId++;
+        _files[path] = { id, length };
+
+        return id;
+    }
+} // namespace SparkyStudios::Audio::Amplitude
@@ -14,6 +14,18 @@
 
 #include <SparkyStudios/Audio/Amplitude/IO/DiskFile.h>
 
+#include <IO/FileReadScheduler.h>
+
+#if defined(AM_WINDOWS_VERSION)
+// clang-format off
+#include <Windows.h>
+#include <io.h>
+// clang-format on
+#else
+#include <cerrno>
+#include <unistd.h>
+#endif
+
 namespace SparkyStudios::Audio::Amplitude
 {
     DiskFile::DiskFile()
@@ -22,6 +34,10 @@ namespace SparkyStudios::Audio::Amplitude
 
     DiskFile::DiskFile(AmFileHandle fp)
         : m_fileHandle(fp)
+        , m_readScheduler(nullptr)
+#if defined(AM_WINDOWS_VERSION)
+        , m_overlappedHandle(nullptr)
+#endif
     {}
 
     DiskFile::DiskFile(const std::filesystem::path& fileName, eFileOpenMode mode, eFileOpenKind kind)
@@ -53,6 +69,91 @@ namespace SparkyStudios::Audio::Amplitude
         return fread(dst, 1, bytes, m_fileHandle);
     }
 
+    AmSize DiskFile::ReadAt(AmSize offset, AmUInt8Buffer dst, AmSize bytes)
+    {
+        if (m_fileHandle == nullptr)
+            return 0;
+
+        AmSize read = 0;
+
+#if defined(AM_WINDOWS_VERSION)
+        // Reads from the handle opened for overlapped I/O, which has no file pointer. When that handle isn't available,
+        // reads from the stream handle and restores its file pointer, so the position used by Seek() and Read() is kept.
+        const bool isOverlapped = m_overlappedHandle != nullptr;
+        const auto handle =
+            isOverlapped ? static_cast<HANDLE>(m_overlappedHandle) : reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(m_fileHandle)));
+
+        const HANDLE event = isOverlapped ? CreateEventW(nullptr, TRUE, FALSE, nullptr) : nullptr;
+        if (isOverlapped && event == nullptr)
+            return 0;
+
+        LARGE_INTEGER filePointer = {};
+        if (!isOverlapped)
+            SetFilePointerEx(handle, LARGE_INTEGER{}, &filePointer, FILE_CURRENT);
+
+        while (read < bytes)
+        {
+            const AmUInt64 position = offset + read;
+
+            OVERLAPPED overlapped = {};
+            overlapped.Offset = static_cast<DWORD>(position & 0xFFFFFFFF);
+            overlapped.OffsetHigh = static_cast<DWORD>(position >> 32);
+            overlapped.hEvent = event;
+
+            DWORD count = 0;
+            const auto toRead = static_cast<DWORD>(AM_MIN(bytes - read, static_cast<AmSize>(0xFFFFFFFF)));
+            if (!ReadFile(handle, dst + read, toRead, nullptr, &overlapped) && GetLastError() != ERROR_IO_PENDING)
+                break;
+
+            if (!GetOverlappedResult(handle, &overlapped, &count, TRUE) || count == 0)
+                break;
+
+            read += count;
+        }
+
+        if (isOverlapped)
+            CloseHandle(event);
+        else
+            SetFilePointerEx(handle, filePointer, nullptr, FILE_BEGIN);
+#else
+        const int fd = fileno(m_fileHandle);
+
+        while (read < bytes)
+        {
+            const ssize_t count = pread(fd, dst + read, bytes - read, static_cast<off_t>(offset + read));
+            if (count < 0 && errno == EINTR)
+                continue;
+
+            if (count <= 0)
+                break;
+
+            read += static_cast<AmSize>(count);
+        }
+#endif
+
+        return read;
+    }
+
+    void DiskFile::ReadAsync(AmSize offset, AmSize size, AmUInt8Buffer buffer, FileReadCallback callback, eFileReadPriority priority)
+    {
+        if (m_fileHandle == nullptr)
+        {
+            if (callback)
+                callback(0);
+
+            return;
+        }
+
+        std::call_once(
+            m_readSchedulerFlag,
+            [this]()
+            {
+                m_readScheduler = FileReadScheduler::Acquire();
+            });
+
+        m_readScheduler->Submit(this, offset, size, buffer, std::move(callback), priority);
+    }
+
     AmSize DiskFile::Write(AmConstUInt8Buffer src, AmSize bytes)
     {
         return fwrite(src, 1, bytes, m_fileHandle);
@@ -128,6 +229,16 @@ namespace SparkyStudios::Audio::Amplitude
 
         m_filePath = filePath;
 
+#if defined(AM_WINDOWS_VERSION)
+        // Positional reads go through a second handle, leaving the stream position untouched.
+        // This fails when the file is opened for writing, in which case ReadAt() falls back to the stream handle.
+        const auto handle = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(m_fileHandle)));
+        const HANDLE overlapped =
+            ReOpenFile(handle, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, FILE_FLAG_OVERLAPPED);
+
+        m_overlappedHandle = overlapped != INVALID_HANDLE_VALUE ? overlapped : nullptr;
+#endif
+
         return eErrorCode_Success;
     }
 
@@ -136,6 +247,16 @@ namespace SparkyStudios::Audio::Amplitude
         if (m_fileHandle == nullptr)
             return;
 
+        if (m_readScheduler != nullptr)
+            m_readScheduler->Drain(this);
+
+#if defined(AM_WINDOWS_VERSION)
+        if (m_overlappedHandle != nullptr)
+            CloseHandle(static_cast<HANDLE>(m_overlappedHandle));
+
+        m_overlappedHandle = nullptr;
+#endif
+
         fclose(m_fileHandle);
         m_fileHandle = nullptr;
     }
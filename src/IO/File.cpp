@@ -55,6 +55,28 @@ namespace SparkyStudios::Audio::Amplitude
         return s;
     }
 
+    AmSize File::ReadAt(AmSize offset, AmUInt8Buffer dst, AmSize bytes)
+    {
+        const AmSize position = Position();
+
+        Seek(offset);
+        const AmSize read = Read(dst, bytes);
+        Seek(position);
+
+        return read;
+    }
+
+    void File::ReadAsync(AmSize offset, AmSize size, AmUInt8Buffer buffer, FileReadCallback callback, eFileReadPriority priority)
+    {
+        const AmSize read = ReadAt(offset, buffer, size);
+
+        if (callback)
+            callback(read);
+    }
+
+    void File::Prefetch(AmSize offset, AmSize size)
+    {}
+
     AmSize File::Write8(AmUInt8 value)
     {
         return Write(&value, 1);
@@ -91,4 +113,9 @@ namespace SparkyStudios::Audio::Amplitude
     {
         return nullptr;
     }
+
+    bool File::IsMemoryBacked() const
+    {
+        return false;
+    }
 } // namespace SparkyStudios::Audio::Amplitude
@@ -0,0 +1,110 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <IO/FileBlockCache.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    FileBlockCache::FileBlockCache(AmSize capacity)
+        : _capacity(AM_MAX(capacity, static_cast<AmSize>(1)))
+        // Always take the mutex, as the cache is shared by the file system and the I/O threads
+        , _mutex(Thread::CreateMutex(0))
+        , _entries()
+        , _index()
+    {
+        _index.reserve(_capacity);
+    }
+
+    FileBlockCache::~FileBlockCache()
+    {
+        Clear();
+        Thread::DestroyMutex(_mutex);
+    }
+
+    FileBlockCache::Block FileBlockCache::Get(AmUInt64 fileId, AmUInt64 blockIndex)
+    {
+        Thread::LockMutex(_mutex);
+
+        Block block = nullptr;
+
+        if (const auto it = _index.find({ fileId, blockIndex }); it != _index.end())
+        {
+            _entries.splice(_entries.begin(), _entries, it->second);
+            block = it->second->second;
+        }
+
+        Thread::UnlockMutex(_mutex);
+
+        return block;
+    }
+
+    void FileBlockCache::Put(AmUInt64 fileId, AmUInt64 blockIndex, Block block)
+    {
+        const Key key = { fileId, blockIndex };
+
+        Thread::LockMutex(_mutex);
+
+        if (const auto it = _index.find(key); it != _index.end())
+        {
+            it->second->second = std::move(block);
+            _entries.splice(_entries.begin(), _entries, it->second);
+        }
+        else
+        {
+            while (_entries.size() >= _capacity)
+            {
+                _index.erase(_entries.back().first);
+                _entries.pop_back();
+            }
+
+            _entries.emplace_front(key, std::move(block));
+            _index.emplace(key, _entries.begin());
+        }
+
+        Thread::UnlockMutex(_mutex);
+    }
+
+    bool FileBlockCache::Contains(AmUInt64 fileId, AmUInt64 blockIndex) const
+    {
+        Thread::LockMutex(_mutex);
+        const bool found = _index.find({ fileId, blockIndex }) != _index.end();
+        Thread::UnlockMutex(_mutex);
+
+        return found;
+    }
+
+    void FileBlockCache::Clear()
+    {
+        Thread::LockMutex(_mutex);
+
+        _index.clear();
+        _entries.clear();
+
+        Thread::UnlockMutex(_mutex);
+    }
+
+    AmSize FileBlockCache::GetCapacity() const
+    {
+        return _capacity;
+    }
+
+    AmSize FileBlockCache::GetSize() const
+    {
+        Thread::LockMutex(_mutex);
+        const AmSize size = _entries.size();
+        Thread::UnlockMutex(_mutex);
+
+        return size;
+    }
+} // namespace SparkyStudios::Audio::Amplitude
@@ -0,0 +1,124 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef _AM_IMPLEMENTATION_IO_FILE_BLOCK_CACHE_H
+#define _AM_IMPLEMENTATION_IO_FILE_BLOCK_CACHE_H
+
+#include <list>
+
+#include <SparkyStudios/Audio/Amplitude/Core/Common.h>
+#include <SparkyStudios/Audio/Amplitude/Core/Thread.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    /**
+     * @brief A thread-safe, bounded LRU cache of fixed-size file blocks.
+     *
+     * Blocks are identified by the ID of the file they belong to, and by their index in that file.
+     * The file ID is defined by the owner of the cache, and only needs to be unique within it.
+     */
+    class FileBlockCache
+    {
+    public:
+        /**
+         * @brief The data of a cached block.
+         */
+        typedef std::shared_ptr<const std::vector<AmUInt8>> Block;
+
+        /**
+         * @brief Creates a new block cache.
+         *
+         * @param[in] capacity The maximum number of blocks to keep in the cache.
+         */
+        explicit FileBlockCache(AmSize capacity);
+
+        ~FileBlockCache();
+
+        /**
+         * @brief Gets a block from the cache, and marks it as the most recently used.
+         *
+         * @param[in] fileId The ID of the file the block belongs to.
+         * @param[in] blockIndex The index of the block in the file.
+         *
+         * @return The cached block, or @c nullptr if the block is not in the cache.
+         */
+        Block Get(AmUInt64 fileId, AmUInt64 blockIndex);
+
+        /**
+         * @brief Adds a block to the cache, evicting the least recently used blocks if needed.
+         *
+         * @param[in] fileId The ID of the file the block belongs to.
+         * @param[in] blockIndex The index of the block in the file.
+         * @param[in] block The block data.
+         */
+        void Put(AmUInt64 fileId, AmUInt64 blockIndex, Block block);
+
+        /**
+         * @brief Checks if a block is in the cache, without marking it as the most recently used.
+         *
+         * @param[in] fileId The ID of the file the block belongs to.
+         * @param[in] blockIndex The index of the block in the file.
+         *
+         * @return @c true if the block is in the cache, @c false otherwise.
+         */
+        [[nodiscard]] bool Contains(AmUInt64 fileId, AmUInt64 blockIndex) const;
+
+        /**
+         * @brief Removes all the blocks from the cache.
+         */
+        void Clear();
+
+        /**
+         * @brief Gets the maximum number of blocks the cache can hold.
+         */
+        [[nodiscard]] AmSize GetCapacity() const;
+
+        /**
+         * @brief Gets the number of blocks currently in the cache.
+         */
+        [[nodiscard]] AmSize GetSize() const;
+
+    private:
+        struct Key
+        {
+            AmUInt64 m_FileId;
+            AmUInt64 m_BlockIndex;
+
+            bool operator==(const Key& other) const
+            {
+                return m_FileId == other.m_FileId && m_BlockIndex == other.m_BlockIndex;
+            }
+        };
+
+        struct KeyHash
+        {
+            AmSize operator()(const Key& key) const
+            {
+                return std::hash<AmUInt64>{}(key.m_FileId) ^ (std::hash<AmUInt64>{}(key.m_BlockIndex) * 0x9E3779B97F4A7C15ull);
+            }
+        };
+
+        typedef std::list<std::pair<Key, Block>> EntryList;
+
+        AmSize _capacity;
+        AmMutexHandle _mutex;
+
+        EntryList _entries;
+        std::unordered_map<Key, EntryList::iterator, KeyHash> _index;
+    };
+} // namespace SparkyStudios::Audio::Amplitude
+
+#endif // _AM_IMPLEMENTATION_IO_FILE_BLOCK_CACHE_H
@@ -0,0 +1,323 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mutex>
+
+#include <SparkyStudios/Audio/Amplitude/Core/Log.h>
+#include <SparkyStudios/Audio/Amplitude/Core/Memory.h>
+
+#include <IO/FileReadScheduler.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    /**
+     * @brief The number of I/O threads run by the process-wide scheduler.
+     */
+    constexpr AmUInt32 kDefaultIOThreadCount = 2;
+
+    /**
+     * @brief The maximum size in bytes of a merged read.
+     */
+    constexpr AmSize kMaxCoalescedReadSize = 4 * 1024 * 1024;
+
+    /**
+     * @brief The state of the scheduler running the calling I/O thread.
+     */
+    static thread_local const void* gCurrentSchedulerState = nullptr;
+
+    /**
+     * @brief Locks a scheduler mutex for the current scope. Condition variables can wait on it.
+     */
+    struct FileReadSchedulerMutexLocker
+    {
+        explicit FileReadSchedulerMutexLocker(AmMutexHandle mutex)
+            : _mutex(mutex)
+        {
+            lock();
+        }
+
+        ~FileReadSchedulerMutexLocker()
+        {
+            unlock();
+        }
+
+        void lock()
+        {
+            Thread::LockMutex(_mutex);
+        }
+
+        void unlock()
+        {
+            Thread::UnlockMutex(_mutex);
+        }
+
+    private:
+        AmMutexHandle _mutex;
+    };
+
+    std::shared_ptr<FileReadScheduler> FileReadScheduler::Acquire()
+    {
+        // A function-local standard mutex, since the instance can be acquired and released at any time
+        static std::mutex mutex;
+        static std::weak_ptr<FileReadScheduler> instance;
+
+        std::lock_guard lock(mutex);
+
+        auto scheduler = instance.lock();
+        if (scheduler == nullptr)
+        {
+            scheduler = std::make_shared<FileReadScheduler>(kDefaultIOThreadCount);
+            instance = scheduler;
+        }
+
+        return scheduler;
+    }
+
+    FileReadScheduler::State::State()
+        // Waiters block on the mutex instead of spinning, since reads can take a while
+        : m_Mutex(Thread::CreateMutex(0))
+        , m_RequestAvailable()
+        , m_RequestCompleted()
+        , m_Queue()
+        , m_Pending()
+        , m_Sequence(0)
+        , m_Running(true)
+    {}
+
+    FileReadScheduler::State::~State()
+    {
+        Thread::DestroyMutex(m_Mutex);
+    }
+
+    FileReadScheduler::FileReadScheduler(AmUInt32 threadCount)
+        : _threads()
+        , _state(std::make_shared<State>())
+    {
+        _threads.reserve(threadCount);
+
+        for (AmUInt32 i = 0; i < threadCount; ++i)
+        {
+            // Each thread keeps its own reference to the state
+            auto* state = ampoolnew(eMemoryPoolKind_IO, StateRef, _state);
+            _threads.push_back(Thread::CreateThread(IOThread, state));
+        }
+    }
+
+    FileReadScheduler::~FileReadScheduler()
+    {
+        {
+            FileReadSchedulerMutexLocker lock(_state->m_Mutex);
+            _state->m_Running = false;
+        }
+
+        _state->m_RequestAvailable.notify_all();
+
+        // A thread can't wait for itself, so when the scheduler is released from a read callback,
+        // the threads are detached, and keep the state alive until they stop.
+        const bool detach = IsIOThread();
+
+        for (auto& thread : _threads)
+        {
+            if (!detach)
+                Thread::Wait(thread);
+
+            Thread::Release(thread);
+        }
+    }
+
+    void FileReadScheduler::Submit(
+        File* file, AmSize offset, AmSize size, AmUInt8Buffer buffer, FileReadCallback callback, eFileReadPriority priority)
+    {
+        {
+            FileReadSchedulerMutexLocker lock(_state->m_Mutex);
+
+            _state->m_Queue.push_back({ file, offset, size, buffer, std::move(callback), priority, _state->m_Sequence++ });
+            _state->m_Pending[file]++;
+        }
+
+        _state->m_RequestAvailable.notify_one();
+    }
+
+    void FileReadScheduler::Drain(const File* file)
+    {
+        // The requests of the batch running the callback only complete after it returns,
+        // so cancel the queued requests instead, as they won't be able to use the file anymore
+        if (IsIOThread())
+        {
+            std::vector<Request> cancelled;
+
+            {
+                FileReadSchedulerMutexLocker lock(_state->m_Mutex);
+
+                auto& queue = _state->m_Queue;
+                for (auto it = queue.begin(); it != queue.end();)
+                {
+                    if (it->m_File != file)
+                    {
+                        ++it;
+                        continue;
+                    }
+
+                    cancelled.push_back(std::move(*it));
+                    it = queue.erase(it);
+
+                    if (const auto pending = _state->m_Pending.find(file); --pending->second == 0)
+                        _state->m_Pending.erase(pending);
+                }
+            }
+
+            if (cancelled.empty())
+                return;
+
+            for (const auto& request : cancelled)
+            {
+                if (request.m_Callback)
+                    request.m_Callback(0);
+            }
+
+            _state->m_RequestCompleted.notify_all();
+            return;
+        }
+
+        FileReadSchedulerMutexLocker lock(_state->m_Mutex);
+        _state->m_RequestCompleted.wait(
+            lock,
+            [this, file]
+            {
+                return !_state->m_Pending.contains(file);
+            });
+    }
+
+    void FileReadScheduler::IOThread(AmVoidPtr pParam)
+    {
+        auto* stateRef = static_cast<StateRef*>(pParam);
+        const StateRef state = std::move(*stateRef);
+        ampooldelete(eMemoryPoolKind_IO, StateRef, stateRef);
+
+        gCurrentSchedulerState = state.get();
+
+        std::vector<Request> batch;
+
+        while (true)
+        {
+            {
+                FileReadSchedulerMutexLocker lock(state->m_Mutex);
+                state->m_RequestAvailable.wait(
+                    lock,
+                    [&state]
+                    {
+                        return !state->m_Queue.empty() || !state->m_Running;
+                    });
+
+                // Pending requests are always served before stopping
+                if (state->m_Queue.empty())
+                    break;
+
+                PopBatch(*state, batch);
+            }
+
+            Execute(batch);
+
+            {
+                FileReadSchedulerMutexLocker lock(state->m_Mutex);
+
+                for (const auto& request : batch)
+                {
+                    if (const auto it = state->m_Pending.find(request.m_File); --it->second == 0)
+                        state->m_Pending.erase(it);
+                }
+            }
+
+            state->m_RequestCompleted.notify_all();
+            batch.clear();
+        }
+
+        gCurrentSchedulerState = nullptr;
+    }
+
+    bool FileReadScheduler::IsIOThread() const
+    {
+        return gCurrentSchedulerState == _state.get();
+    }
+
+    void FileReadScheduler::PopBatch(State& state, std::vector<Request>& batch)
+    {
+        auto& queue = state.m_Queue;
+
+        const auto next = std::min_element(
+            queue.begin(), queue.end(),
+            [](const Request& a, const Request& b)
+            {
+                return a.m_Priority != b.m_Priority ? a.m_Priority < b.m_Priority : a.m_Sequence < b.m_Sequence;
+            });
+
+        batch.push_back(std::move(*next));
+        queue.erase(next);
+
+        const File* file = batch.front().m_File;
+        AmSize start = batch.front().m_Offset;
+        AmSize end = start + batch.front().m_Size;
+        AmUInt8Buffer buffer = batch.front().m_Buffer;
+
+        bool merged = true;
+        while (merged && end - start < kMaxCoalescedReadSize)
+        {
+            merged = false;
+
+            for (auto it = queue.begin(); it != queue.end(); ++it)
+            {
+                if (it->m_File != file)
+                    continue;
+
+                if (it->m_Offset == end && it->m_Buffer == buffer + (end - start))
+                {
+                    end += it->m_Size;
+                    batch.push_back(std::move(*it));
+                }
+                else if (it->m_Offset + it->m_Size == start && it->m_Buffer + it->m_Size == buffer)
+                {
+                    start -= it->m_Size;
+                    buffer -= it->m_Size;
+                    batch.insert(batch.begin(), std::move(*it));
+                }
+                else
+                {
+                    continue;
+                }
+
+                queue.erase(it);
+                merged = true;
+                break;
+            }
+        }
+    }
+
+    void FileReadScheduler::Execute(std::vector<Request>& batch)
+    {
+        const Request& first = batch.front();
+        const Request& last = batch.back();
+
+        const AmSize size = last.m_Offset + last.m_Size - first.m_Offset;
+        const AmSize read = first.m_File->ReadAt(first.m_Offset, first.m_Buffer, size);
+
+        for (auto& request : batch)
+        {
+            const AmSize offset = request.m_Offset - first.m_Offset;
+            const AmSize available = read > offset ? read - offset : 0;
+
+            if (request.m_Callback)
+                request.m_Callback(AM_MIN(request.m_Size, available));
+        }
+    }
+} // namespace SparkyStudios::Audio::Amplitude
@@ -0,0 +1,145 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef _AM_IMPLEMENTATION_IO_FILE_READ_SCHEDULER_H
+#define _AM_IMPLEMENTATION_IO_FILE_READ_SCHEDULER_H
+
+#include <condition_variable>
+
+#include <SparkyStudios/Audio/Amplitude/Core/Common.h>
+#include <SparkyStudios/Audio/Amplitude/Core/Thread.h>
+#include <SparkyStudios/Audio/Amplitude/IO/File.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    /**
+     * @brief Schedules asynchronous file reads on a pool of I/O threads.
+     *
+     * Pending requests are served by priority, then in submission order. When a request is picked,
+     * all the pending requests on the same file that are contiguous with it, both in the file and in
+     * memory, are merged in a single read.
+     *
+     * Files submitting requests must override `File::ReadAt()` with a thread-safe implementation.
+     */
+    class FileReadScheduler
+    {
+    public:
+        /**
+         * @brief Gets the process-wide scheduler, creating it if needed.
+         *
+         * The scheduler is destroyed when the last reference to it is released.
+         *
+         * @return The shared scheduler instance.
+         */
+        static std::shared_ptr<FileReadScheduler> Acquire();
+
+        /**
+         * @brief Creates a new scheduler.
+         *
+         * @param[in] threadCount The number of I/O threads to run.
+         */
+        explicit FileReadScheduler(AmUInt32 threadCount);
+
+        /**
+         * @brief Completes all the pending requests, and stops the I/O threads.
+         *
+         * When the last reference to the scheduler is released from a read callback, the I/O threads
+         * are detached instead of joined, and stop after serving the pending requests.
+         */
+        ~FileReadScheduler();
+
+        /**
+         * @brief Queues a read request.
+         *
+         * @param[in] file The file to read from.
+         * @param[in] offset The offset in bytes from the beginning of the file.
+         * @param[in] size The number of bytes to read.
+         * @param[out] buffer The destination buffer of the read data.
+         * @param[in] callback The callback to invoke when the read completes.
+         * @param[in] priority The priority of the request.
+         */
+        void Submit(File* file, AmSize offset, AmSize size, AmUInt8Buffer buffer, FileReadCallback callback, eFileReadPriority priority);
+
+        /**
+         * @brief Blocks until all the requests submitted for the given file have completed.
+         *
+         * @param[in] file The file to wait for.
+         *
+         * When called from a read callback, the requests of the given file which are still queued are cancelled
+         * instead, and complete with no bytes read. The requests already being read are not waited for.
+         */
+        void Drain(const File* file);
+
+    private:
+        struct Request
+        {
+            File* m_File;
+            AmSize m_Offset;
+            AmSize m_Size;
+            AmUInt8Buffer m_Buffer;
+            FileReadCallback m_Callback;
+            eFileReadPriority m_Priority;
+            AmUInt64 m_Sequence;
+        };
+
+        /**
+         * @brief The scheduler state, shared with the I/O threads so they can outlive the scheduler.
+         */
+        struct State
+        {
+            State();
+            ~State();
+
+            AmMutexHandle m_Mutex;
+            std::condition_variable_any m_RequestAvailable;
+            std::condition_variable_any m_RequestCompleted;
+
+            std::vector<Request> m_Queue;
+            std::unordered_map<const File*, AmSize> m_Pending;
+            AmUInt64 m_Sequence;
+            bool m_Running;
+        };
+
+        typedef std::shared_ptr<State> StateRef;
+
+        static void IOThread(AmVoidPtr pParam);
+
+        /**
+         * @brief Checks whether the calling thread is one of the I/O threads of this scheduler.
+         */
+        [[nodiscard]] bool IsIOThread() const;
+
+        /**
+         * @brief Removes the next request to serve from the queue, along with the requests it can be merged with.
+         *
+         * @param[in] state The scheduler state, locked by the caller.
+         * @param[out] batch The requests to serve, sorted by offset.
+         */
+        static void PopBatch(State& state, std::vector<Request>& batch);
+
+        /**
+         * @brief Reads the data of the given requests, and invokes their callbacks.
+         *
+         * @param[in] batch The requests to serve, sorted by offset.
+         */
+        static void Execute(std::vector<Request>& batch);
+
+        std::vector<AmThreadHandle> _threads;
+        StateRef _state;
+    };
+} // namespace SparkyStudios::Audio::Amplitude
+
+#endif // _AM_IMPLEMENTATION_IO_FILE_READ_SCHEDULER_H
@@ -59,6 +59,17 @@ namespace SparkyStudios::Audio::Amplitude
         return bytes;
     }
 
+    AmSize MemoryFile::ReadAt(AmSize offset, AmUInt8Buffer dst, AmSize bytes)
+    {
+        if (offset >= m_dataSize)
+            return 0;
+
+        bytes = std::min(bytes, m_dataSize - offset);
+        std::memcpy(dst, m_dataPtr + offset, bytes);
+
+        return bytes;
+    }
+
     AmSize MemoryFile::Write(AmConstUInt8Buffer src, AmSize bytes)
     {
         const auto bytesToWrite = std::min(bytes, m_dataSize - m_offset);
@@ -97,6 +108,11 @@ namespace SparkyStudios::Audio::Amplitude
         return m_dataPtr;
     }
 
+    bool MemoryFile::IsMemoryBacked() const
+    {
+        return m_dataPtr != nullptr;
+    }
+
     bool MemoryFile::IsValid() const
     {
         return m_dataPtr != nullptr;
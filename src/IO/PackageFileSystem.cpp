@@ -12,24 +12,102 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <SparkyStudios/Audio/Amplitude/Core/Log.h>
 #include <SparkyStudios/Audio/Amplitude/Core/Memory.h>
 #include <SparkyStudios/Audio/Amplitude/IO/PackageFileSystem.h>
 #include <SparkyStudios/Audio/Amplitude/IO/PackageItemFile.h>
 
+#include <IO/FileBlockCache.h>
+
+#if defined(AM_WINDOWS_VERSION)
+// clang-format off
+#include <Windows.h>
+#include <io.h>
+// clang-format on
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 namespace SparkyStudios::Audio::Amplitude
 {
     /**
      * @brief The last supported package file version.
      */
-    static constexpr AmUInt16 kLastPackageFileVersion = 1;
+    static constexpr AmUInt16 kLastPackageFileVersion = 2;
+
+    /**
+     * @brief The default number of decompressed blocks cached for compressed packages.
+     */
+    static constexpr AmSize kDefaultBlockCacheCapacity = 64;
+
+    /**
+     * @brief Maps the given package file in memory.
+     *
+     * @param[in] file The opened package file.
+     *
+     * @return The shared memory mapping, or @c nullptr if the file cannot be mapped. The mapping
+     * is released when the last reference to it is dropped.
+     */
+    static std::shared_ptr<const AmUInt8> MapPackageFile(DiskFile* file)
+    {
+        const auto fp = static_cast<AmFileHandle>(file->GetPtr());
+        if (fp == nullptr)
+            return nullptr;
+
+#if defined(AM_WINDOWS_VERSION)
+        const auto handle = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(fp)));
+
+        HANDLE mapping = CreateFileMappingW(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping == nullptr)
+            return nullptr;
+
+        const auto* data = static_cast<const AmUInt8*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+
+        // The view keeps a reference to the mapping object
+        CloseHandle(mapping);
+
+        if (data == nullptr)
+            return nullptr;
+
+        return std::shared_ptr<const AmUInt8>(
+            data,
+            [](const AmUInt8* ptr)
+            {
+                UnmapViewOfFile(ptr);
+            });
+#else
+        const int fd = fileno(fp);
+
+        struct stat st = {};
+        if (fstat(fd, &st) != 0 || st.st_size <= 0)
+            return nullptr;
+
+        const auto size = static_cast<AmSize>(st.st_size);
+
+        void* data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        if (data == MAP_FAILED)
+            return nullptr;
+
+        return std::shared_ptr<const AmUInt8>(
+            static_cast<const AmUInt8*>(data),
+            [size](const AmUInt8* ptr)
+            {
+                munmap(const_cast<AmUInt8*>(ptr), size);
+            });
+#endif
+    }
 
     PackageFileSystem::PackageFileSystem()
         : _packageFile(nullptr)
+        , _blockCacheCapacity(kDefaultBlockCacheCapacity)
         , _loadingThreadHandle(nullptr)
         , _initialized(false)
         , _valid(false)
+        , _memoryMappingEnabled(false)
         , _header()
         , _headerSize(0)
+        , _packageSize(0)
     {}
 
     PackageFileSystem::~PackageFileSystem()
@@ -37,11 +115,15 @@ namespace SparkyStudios::Audio::Amplitude
         if (_loadingThreadHandle != nullptr)
             Thread::Release(_loadingThreadHandle);
 
-        _packageFile.reset(nullptr);
+        _blockCache.reset();
+        _packageData.reset();
+        _packageFile.reset();
         _initialized = false;
         _valid = false;
         _header = {};
         _headerSize = 0;
+        _packageSize = 0;
+        _itemsIndex.clear();
     }
 
     void PackageFileSystem::SetBasePath(const AmOsString& basePath)
@@ -67,14 +149,7 @@ namespace SparkyStudios::Audio::Amplitude
         if (!IsValid())
             return false;
 
-        const auto it = std::ranges::find_if(
-            _header.m_Items,
-            [&path](const PackageFileItemDescription& item)
-            {
-                return AM_STRING_TO_OS_STRING(item.m_Name) == path;
-            });
-
-        return it != _header.m_Items.end();
+        return FindItem(path) != nullptr;
     }
 
     bool PackageFileSystem::IsDirectory(const AmOsString& path) const
@@ -100,19 +175,32 @@ namespace SparkyStudios::Audio::Amplitude
         if (!IsValid())
             return nullptr;
 
-        const auto it = std::ranges::find_if(
-            _header.m_Items,
-            [&path](const PackageFileItemDescription& item)
-            {
-                return AM_STRING_TO_OS_STRING(item.m_Name) == path;
-            });
-
-        if (it == _header.m_Items.end())
+        const PackageFileItemDescription* item = FindItem(path);
+        if (item == nullptr)
             return nullptr;
 
-        return std::shared_ptr<PackageItemFile>(
-            ampoolnew(eMemoryPoolKind_IO, PackageItemFile, &*it, _packagePath, _headerSize),
-            am_delete<eMemoryPoolKind_IO, PackageItemFile>{});
+        // Item offsets are validated when the package is loaded
+        const AmSize dataSize = _packageSize - _headerSize - item->m_Offset;
+
+        std::shared_ptr<PackageItemFile> file;
+
+        if (_packageData != nullptr)
+        {
+            file = std::shared_ptr<PackageItemFile>(
+                ampoolnew(eMemoryPoolKind_IO, PackageItemFile, item, _packageData, _headerSize, dataSize),
+                am_delete<eMemoryPoolKind_IO, PackageItemFile>{});
+        }
+        else
+        {
+            file = std::shared_ptr<PackageItemFile>(
+                ampoolnew(eMemoryPoolKind_IO, PackageItemFile, item, _packageFile, _headerSize, dataSize),
+                am_delete<eMemoryPoolKind_IO, PackageItemFile>{});
+        }
+
+        if (_header.m_CompressionAlgorithm != ePackageFileCompressionAlgorithm_None)
+            file->SetCompression(_header.m_CompressionAlgorithm, _header.m_BlockSize, _blockCache);
+
+        return file;
     }
 
     void PackageFileSystem::StartOpenFileSystem()
@@ -133,8 +221,10 @@ namespace SparkyStudios::Audio::Amplitude
 
     void PackageFileSystem::StartCloseFileSystem()
     {
-        _packageFile->Close();
-        _packageFile.reset(nullptr);
+        // Package items still opened share the file handle, it will be closed when the last of them is released.
+        _blockCache.reset();
+        _packageData.reset();
+        _packageFile.reset();
         _initialized = false;
     }
 
@@ -148,11 +238,46 @@ namespace SparkyStudios::Audio::Amplitude
         return _valid;
     }
 
+    void PackageFileSystem::SetMemoryMappingEnabled(bool enabled)
+    {
+        _memoryMappingEnabled = enabled;
+    }
+
+    bool PackageFileSystem::IsMemoryMappingEnabled() const
+    {
+        return _memoryMappingEnabled;
+    }
+
+    bool PackageFileSystem::IsMemoryMapped() const
+    {
+        return _packageData != nullptr;
+    }
+
+    void PackageFileSystem::SetBlockCacheCapacity(AmSize capacity)
+    {
+        _blockCacheCapacity = capacity;
+    }
+
+    AmSize PackageFileSystem::GetBlockCacheCapacity() const
+    {
+        return _blockCacheCapacity;
+    }
+
+    const PackageFileItemDescription* PackageFileSystem::FindItem(const AmOsString& path) const
+    {
+        const auto it = _itemsIndex.find(path);
+        if (it == _itemsIndex.end())
+            return nullptr;
+
+        return &_header.m_Items[it->second];
+    }
+
     void PackageFileSystem::LoadPackage(AmVoidPtr pParam)
     {
         auto* pFileSystem = static_cast<PackageFileSystem*>(pParam);
 
-        pFileSystem->_packageFile.reset(ampoolnew(eMemoryPoolKind_IO, DiskFile, pFileSystem->_packagePath));
+        pFileSystem->_packageFile.reset(
+            ampoolnew(eMemoryPoolKind_IO, DiskFile, pFileSystem->_packagePath), am_delete<eMemoryPoolKind_IO, DiskFile>{});
 
         if (!pFileSystem->_packageFile->IsValid())
         {
@@ -181,6 +306,19 @@ namespace SparkyStudios::Audio::Amplitude
 
             // Compression Algorithm
             pFileSystem->_header.m_CompressionAlgorithm = static_cast<ePackageFileCompressionAlgorithm>(pFileSystem->_packageFile->Read8());
+            if (pFileSystem->_header.m_CompressionAlgorithm >= ePackageFileCompressionAlgorithm_Invalid)
+            {
+                pFileSystem->_initialized = true;
+                return;
+            }
+
+            // Block Size
+            pFileSystem->_header.m_BlockSize = pFileSystem->_header.m_Version >= 2 ? pFileSystem->_packageFile->Read32() : 0;
+            if (pFileSystem->_header.m_CompressionAlgorithm != ePackageFileCompressionAlgorithm_None && pFileSystem->_header.m_BlockSize == 0)
+            {
+                pFileSystem->_initialized = true;
+                return;
+            }
 
             // Item Descriptions
             if (const AmSize itemsCount = pFileSystem->_packageFile->Read64(); itemsCount > 0)
@@ -199,12 +337,55 @@ namespace SparkyStudios::Audio::Amplitude
                     // Item Size
                     item.m_Size = pFileSystem->_packageFile->Read64();
                 }
+
+                // Build the items lookup table, converting item names only once
+                pFileSystem->_itemsIndex.clear();
+                pFileSystem->_itemsIndex.reserve(itemsCount);
+                for (AmSize i = 0; i < itemsCount; i++)
+                    pFileSystem->_itemsIndex.emplace(AM_STRING_TO_OS_STRING(pFileSystem->_header.m_Items[i].m_Name), i);
             }
         }
 
+        pFileSystem->_headerSize = pFileSystem->_packageFile->Position();
+
+        std::error_code error;
+        pFileSystem->_packageSize = static_cast<AmSize>(std::filesystem::file_size(pFileSystem->_packagePath, error));
+
+        if (error || pFileSystem->_packageSize < pFileSystem->_headerSize)
+        {
+            pFileSystem->_initialized = true;
+            return;
+        }
+
+        // Reject packages with items stored past the end of the file
+        const AmSize dataSize = pFileSystem->_packageSize - pFileSystem->_headerSize;
+        const bool isCompressed = pFileSystem->_header.m_CompressionAlgorithm != ePackageFileCompressionAlgorithm_None;
+
+        for (const auto& item : pFileSystem->_header.m_Items)
+        {
+            // Compressed items store their own size in their block offsets table, which is validated when they are opened
+            const AmSize storedSize = isCompressed ? 0 : item.m_Size;
+
+            if (item.m_Offset > dataSize || storedSize > dataSize - item.m_Offset)
+            {
+                amLogError("The package item '%s' is stored past the end of the package file.", item.m_Name.c_str());
+                pFileSystem->_initialized = true;
+                return;
+            }
+        }
+
+        if (pFileSystem->_header.m_CompressionAlgorithm != ePackageFileCompressionAlgorithm_None)
+            pFileSystem->_blockCache = std::make_shared<FileBlockCache>(pFileSystem->_blockCacheCapacity);
+
+        if (pFileSystem->_memoryMappingEnabled)
+        {
+            pFileSystem->_packageData = MapPackageFile(pFileSystem->_packageFile.get());
+
+            if (pFileSystem->_packageData == nullptr)
+                amLogWarning("Unable to memory-map the package file. Falling back to file reads.");
+        }
+
         pFileSystem->_valid = true;
         pFileSystem->_initialized = true;
-
-        pFileSystem->_headerSize = pFileSystem->_packageFile->Position();
     }
 } // namespace SparkyStudios::Audio::Amplitude
@@ -12,22 +12,105 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <SparkyStudios/Audio/Amplitude/Core/Log.h>
 #include <SparkyStudios/Audio/Amplitude/Core/Memory.h>
 #include <SparkyStudios/Audio/Amplitude/IO/PackageItemFile.h>
 
+#include <IO/FileBlockCache.h>
+#include <IO/FileReadScheduler.h>
+
+#include <zlib.h>
+
 namespace SparkyStudios::Audio::Amplitude
 {
-    PackageItemFile::PackageItemFile(const PackageFileItemDescription* item, const std::filesystem::path& packageFile, AmSize headerSize)
-        : _description(item)
+    static bool DecompressBlock(
+        ePackageFileCompressionAlgorithm algorithm, AmConstUInt8Buffer src, AmSize srcSize, AmUInt8Buffer dst, AmSize dstSize)
+    {
+        switch (algorithm)
+        {
+        case ePackageFileCompressionAlgorithm_ZLib:
+            {
+                auto destLen = static_cast<uLongf>(dstSize);
+                return uncompress(dst, &destLen, src, static_cast<uLong>(srcSize)) == Z_OK && destLen == dstSize;
+            }
+        default:
+            return false;
+        }
+    }
+
+    PackageItemFile::PackageItemFile(
+        const PackageFileItemDescription* item, std::shared_ptr<DiskFile> packageFile, AmSize headerSize, AmSize dataSize)
+        : _description(*item)
+        , _packageFile(std::move(packageFile))
+        , _packageData(nullptr)
+        , _headerSize(headerSize)
+        , _dataSize(dataSize)
+        , _position(0)
+        , _compression(ePackageFileCompressionAlgorithm_None)
+        , _blockSize(0)
+        , _blockOffsets()
+        , _blockCache(nullptr)
+        , _readScheduler(nullptr)
+    {}
+
+    PackageItemFile::PackageItemFile(
+        const PackageFileItemDescription* item, std::shared_ptr<const AmUInt8> packageData, AmSize headerSize, AmSize dataSize)
+        : _description(*item)
+        , _packageFile(nullptr)
+        , _packageData(std::move(packageData))
         , _headerSize(headerSize)
+        , _dataSize(dataSize)
+        , _position(0)
+        , _compression(ePackageFileCompressionAlgorithm_None)
+        , _blockSize(0)
+        , _blockOffsets()
+        , _blockCache(nullptr)
+        , _readScheduler(nullptr)
+    {}
+
+    PackageItemFile::~PackageItemFile()
     {
-        Open(packageFile);
-        PackageItemFile::Seek(0, eFileSeekOrigin_Start);
+        if (_readScheduler != nullptr)
+            _readScheduler->Drain(this);
+    }
+
+    void PackageItemFile::SetCompression(
+        ePackageFileCompressionAlgorithm algorithm, AmSize blockSize, std::shared_ptr<FileBlockCache> blockCache)
+    {
+        _compression = algorithm;
+        _blockSize = blockSize;
+        _blockCache = std::move(blockCache);
+        _blockOffsets.clear();
+
+        if (_compression == ePackageFileCompressionAlgorithm_None || _blockSize == 0)
+            return;
+
+        // The item data starts with the offset of each compressed block, followed by the end offset of the last block
+        const AmSize blockCount = (Length() + _blockSize - 1) / _blockSize;
+        _blockOffsets.resize(blockCount + 1);
+
+        const AmSize tableSize = _blockOffsets.size() * sizeof(AmUInt64);
+        if (ReadRaw(0, reinterpret_cast<AmUInt8Buffer>(_blockOffsets.data()), tableSize) != tableSize)
+        {
+            _blockOffsets.clear();
+            return;
+        }
+
+        // Blocks are stored one after the other right after the table, and can't be empty
+        bool valid = _blockOffsets.front() == tableSize && _blockOffsets.back() <= _dataSize;
+        for (AmSize i = 1; valid && i < _blockOffsets.size(); ++i)
+            valid = _blockOffsets[i] > _blockOffsets[i - 1];
+
+        if (!valid)
+        {
+            amLogError("The block offsets of the package item '%s' are corrupted.", _description.m_Name.c_str());
+            _blockOffsets.clear();
+        }
     }
 
     AmOsString PackageItemFile::GetPath() const
     {
-        return AM_STRING_TO_OS_STRING(_description->m_Name);
+        return AM_STRING_TO_OS_STRING(_description.m_Name);
     }
 
     bool PackageItemFile::Eof()
@@ -37,8 +120,64 @@ namespace SparkyStudios::Audio::Amplitude
 
     AmSize PackageItemFile::Read(AmUInt8Buffer dst, AmSize bytes)
     {
-        bytes = AM_MIN(bytes, Length() - Position());
-        return bytes == 0 ? 0 : DiskFile::Read(dst, bytes);
+        const AmSize read = ReadAt(_position, dst, bytes);
+        _position += read;
+
+        return read;
+    }
+
+    AmSize PackageItemFile::ReadAt(AmSize offset, AmUInt8Buffer dst, AmSize bytes)
+    {
+        if (offset >= Length())
+            return 0;
+
+        bytes = AM_MIN(bytes, Length() - offset);
+        if (bytes == 0)
+            return 0;
+
+        if (_compression == ePackageFileCompressionAlgorithm_None)
+            return ReadRaw(offset, dst, bytes);
+
+        AmSize read = 0;
+
+        while (read < bytes)
+        {
+            const AmSize position = offset + read;
+            const AmSize blockIndex = position / _blockSize;
+            const AmSize blockOffset = position % _blockSize;
+
+            const auto block = GetBlock(blockIndex);
+            if (block == nullptr || blockOffset >= block->size())
+                break;
+
+            const AmSize count = AM_MIN(bytes - read, block->size() - blockOffset);
+            std::memcpy(dst + read, block->data() + blockOffset, count);
+
+            read += count;
+        }
+
+        return read;
+    }
+
+    void PackageItemFile::ReadAsync(
+        AmSize offset, AmSize size, AmUInt8Buffer buffer, FileReadCallback callback, eFileReadPriority priority)
+    {
+        if (!IsValid())
+        {
+            if (callback)
+                callback(0);
+
+            return;
+        }
+
+        std::call_once(
+            _readSchedulerFlag,
+            [this]()
+            {
+                _readScheduler = FileReadScheduler::Acquire();
+            });
+
+        _readScheduler->Submit(this, offset, size, buffer, std::move(callback), priority);
     }
 
     AmSize PackageItemFile::Write(AmConstUInt8Buffer src, AmSize bytes)
@@ -49,48 +188,111 @@ namespace SparkyStudios::Audio::Amplitude
 
     AmSize PackageItemFile::Length()
     {
-        return _description->m_Size;
+        return _description.m_Size;
     }
 
     void PackageItemFile::Seek(AmInt64 offset, eFileSeekOrigin origin)
     {
-        const AmSize currentPosition = Position();
-        const AmSize fileSize = Length();
-
-        const AmInt64 minOffset = _headerSize + _description->m_Offset;
-        const AmInt64 maxOffset = minOffset + fileSize;
-
-        if (origin == eFileSeekOrigin_Start && currentPosition == offset)
-            return;
-
-        if (origin == eFileSeekOrigin_End && currentPosition == (fileSize + offset))
-            return;
-
-        if (origin == eFileSeekOrigin_Current && offset == 0)
-            return;
+        const auto fileSize = static_cast<AmInt64>(Length());
 
-        AmInt64 finalOffset = minOffset;
+        AmInt64 finalOffset = offset;
 
         switch (origin)
         {
         case eFileSeekOrigin_Start:
-            finalOffset += offset;
             break;
         case eFileSeekOrigin_End:
-            finalOffset += fileSize - 1 + offset;
+            finalOffset += fileSize;
             break;
         case eFileSeekOrigin_Current:
-            finalOffset += currentPosition + offset;
+            finalOffset += static_cast<AmInt64>(_position);
             break;
         }
 
-        finalOffset = AM_CLAMP(finalOffset, minOffset, maxOffset);
-
-        DiskFile::Seek(finalOffset, eFileSeekOrigin_Start);
+        _position = static_cast<AmSize>(AM_CLAMP(finalOffset, 0, fileSize));
     }
 
     AmSize PackageItemFile::Position()
     {
-        return DiskFile::Position() - (_headerSize + _description->m_Offset);
+        return _position;
+    }
+
+    AmVoidPtr PackageItemFile::GetPtr()
+    {
+        if (!IsMemoryBacked())
+            return nullptr;
+
+        return const_cast<AmUInt8*>(_packageData.get() + _headerSize + _description.m_Offset);
+    }
+
+    bool PackageItemFile::IsMemoryBacked() const
+    {
+        return _packageData != nullptr && _compression == ePackageFileCompressionAlgorithm_None;
+    }
+
+    bool PackageItemFile::IsValid() const
+    {
+        if (_compression != ePackageFileCompressionAlgorithm_None && _blockOffsets.empty())
+            return false;
+
+        return _packageData != nullptr || (_packageFile != nullptr && _packageFile->IsValid());
+    }
+
+    AmSize PackageItemFile::ReadRaw(AmSize offset, AmUInt8Buffer dst, AmSize bytes) const
+    {
+        if (offset >= _dataSize)
+            return 0;
+
+        bytes = AM_MIN(bytes, _dataSize - offset);
+
+        const AmSize position = _headerSize + _description.m_Offset + offset;
+
+        if (_packageData != nullptr)
+        {
+            std::memcpy(dst, _packageData.get() + position, bytes);
+            return bytes;
+        }
+
+        if (_packageFile == nullptr)
+            return 0;
+
+        return _packageFile->ReadAt(position, dst, bytes);
+    }
+
+    std::shared_ptr<const std::vector<AmUInt8>> PackageItemFile::GetBlock(AmSize index)
+    {
+        if (index + 1 >= _blockOffsets.size())
+            return nullptr;
+
+        // Package items are uniquely identified by their data offset in the package
+        if (auto block = _blockCache->Get(_description.m_Offset, index); block != nullptr)
+            return block;
+
+        const AmSize compressedOffset = _blockOffsets[index];
+        const AmSize compressedSize = _blockOffsets[index + 1] - compressedOffset;
+        const AmSize blockSize = AM_MIN(_blockSize, Length() - index * _blockSize);
+
+        auto block = std::make_shared<std::vector<AmUInt8>>(blockSize);
+
+        bool success;
+        if (_packageData != nullptr)
+        {
+            success = DecompressBlock(
+                _compression, _packageData.get() + _headerSize + _description.m_Offset + compressedOffset, compressedSize, block->data(),
+                blockSize);
+        }
+        else
+        {
+            std::vector<AmUInt8> compressed(compressedSize);
+            success = ReadRaw(compressedOffset, compressed.data(), compressedSize) == compressedSize &&
+                DecompressBlock(_compression, compressed.data(), compressedSize, block->data(), blockSize);
+        }
+
+        if (!success)
+            return nullptr;
+
+        _blockCache->Put(_description.m_Offset, index, block);
+
+        return block;
     }
 } // namespace SparkyStudios::Audio::Amplitude
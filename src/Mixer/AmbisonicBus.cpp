@@ -0,0 +1,132 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+
+#include <Mixer/AmbisonicBus.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    AmbisonicBus::AmbisonicBus(AmListenerID id, ePanningMode panningMode, const HRIRSphere* hrirSphere)
+        : _id(id)
+        , _order(1)
+        , _panningMode(panningMode)
+        , _output(kAmMaxSupportedFrameCount, kAmStereoChannelCount)
+        , _hasSend(false)
+        , _sendFrames(0)
+        , _tailFrames(0)
+        , _tailLength(0)
+        , _listenerRotation(AM_Q(0.0f, 0.0f, 0.0f, 1.0f))
+    {
+        // Decode the sound field the same way the ambisonic binaural decoder node does
+        if (_panningMode != ePanningMode_Stereo && hrirSphere == nullptr)
+            _panningMode = ePanningMode_Stereo;
+
+        // Keep the voices encoded at the order of their panning node, even when falling back to stereo
+        _order = AM_MAX(static_cast<AmUInt32>(panningMode), 1u);
+
+        if (_panningMode == ePanningMode_Stereo)
+        {
+            _decoder.Configure(_order, true, eSpeakersPreset_Stereo);
+        }
+        else
+        {
+            _binauralizer.Configure(_order, true, hrirSphere);
+
+            // The last voice is heard until the end of the HRIRs, delayed by the convolver latency
+            _tailLength = 2 * hrirSphere->GetIRLength();
+        }
+
+        _rotator.Configure(_order, true);
+        _soundField.Configure(_order, true, kAmMaxSupportedFrameCount);
+    }
+
+    AmListenerID AmbisonicBus::GetId() const
+    {
+        return _id;
+    }
+
+    AmUInt32 AmbisonicBus::GetOrder() const
+    {
+        return _order;
+    }
+
+    void AmbisonicBus::Send(const Listener& listener, AmbisonicSource& source, const AudioBufferChannel& input, AmReal32 gain, AmSize frames)
+    {
+        _listenerRotation = AM_InvQ(listener.GetOrientation().GetQuaternion());
+
+        frames = AM_MIN(frames, kAmMaxSupportedFrameCount);
+
+        if (!_hasSend)
+        {
+            ClearSoundField(0, frames);
+            _sendFrames = frames;
+        }
+        else if (frames > _sendFrames)
+        {
+            // Only the frames of the previous sends were cleared
+            ClearSoundField(_sendFrames, frames - _sendFrames);
+            _sendFrames = frames;
+        }
+
+        source.ProcessAccumulate(input, static_cast<AmUInt32>(frames), &_soundField, 0, gain);
+        _hasSend = true;
+    }
+
+    bool AmbisonicBus::IsActive() const
+    {
+        return _hasSend || _tailFrames > 0;
+    }
+
+    const AudioBuffer& AmbisonicBus::Process(AmSize frames)
+    {
+        AMPLITUDE_ASSERT(frames <= kAmMaxSupportedFrameCount);
+
+        if (_hasSend)
+        {
+            // Silence the frames the voices didn't fill
+            if (frames > _sendFrames)
+                ClearSoundField(_sendFrames, frames - _sendFrames);
+
+            _tailFrames = _tailLength;
+            _hasSend = false;
+        }
+        else
+        {
+            ClearSoundField(0, frames);
+            _tailFrames -= AM_MIN(_tailFrames, frames);
+        }
+
+        // Rotate the sound field to match the listener's orientation
+        _rotator.SetOrientation(Orientation(_listenerRotation));
+        _rotator.Process(&_soundField, static_cast<AmUInt32>(frames));
+
+        // The binauralizer adds to the output, so only clear the frames processed in this callback
+        std::fill_n(_output[0].begin(), frames, 0.0f);
+        std::fill_n(_output[1].begin(), frames, 0.0f);
+
+        if (_panningMode == ePanningMode_Stereo)
+            _decoder.Process(&_soundField, static_cast<AmUInt32>(frames), _output);
+        else
+            _binauralizer.Process(&_soundField, static_cast<AmUInt32>(frames), _output);
+
+        return _output;
+    }
+
+    void AmbisonicBus::ClearSoundField(AmSize offset, AmSize frames)
+    {
+        for (AmUInt32 i = 0, l = _soundField.GetChannelCount(); i < l; ++i)
+            std::fill_n(_soundField.GetBufferChannel(i).begin() + offset, frames, 0.0f);
+    }
+} // namespace SparkyStudios::Audio::Amplitude
@@ -0,0 +1,112 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef _AM_IMPLEMENTATION_MIXER_AMBISONIC_BUS_H
+#define _AM_IMPLEMENTATION_MIXER_AMBISONIC_BUS_H
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+#include <Ambisonics/AmbisonicBinauralizer.h>
+#include <Ambisonics/AmbisonicDecoder.h>
+#include <Ambisonics/AmbisonicOrientationProcessor.h>
+#include <Ambisonics/AmbisonicSource.h>
+#include <Ambisonics/BFormat.h>
+#include <HRTF/HRIRSphere.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    /**
+     * @brief The ambisonic sound field of a listener.
+     *
+     * When the mixer renders HRTF voices on ambisonic buses, every voice only encodes its signal
+     * in the sound field of its listener. Since ambisonics is linear, the mixer then rotates and
+     * binauralizes each sound field once per callback, instead of once per voice. The cost of
+     * the HRIR convolutions thus no longer depends on the number of voices.
+     */
+    class AmbisonicBus
+    {
+    public:
+        /**
+         * @brief Creates a new ambisonic bus.
+         *
+         * The bus is sized for the maximum supported frame count, so it never reallocates while mixing.
+         *
+         * @param id The ID of the listener.
+         * @param panningMode The panning mode of the engine.
+         * @param hrirSphere The HRIR sphere used for binaural rendering. Falls back to stereo when @c nullptr.
+         */
+        AmbisonicBus(AmListenerID id, ePanningMode panningMode, const HRIRSphere* hrirSphere);
+
+        /**
+         * @brief Gets the ID of the listener this bus belongs to.
+         */
+        [[nodiscard]] AmListenerID GetId() const;
+
+        /**
+         * @brief Gets the ambisonic order of the sound field.
+         */
+        [[nodiscard]] AmUInt32 GetOrder() const;
+
+        /**
+         * @brief Encodes a voice signal in the sound field.
+         *
+         * @param listener The listener rendering the voice.
+         * @param source The ambisonic source of the voice, already positioned in the listener space.
+         * @param input The mono signal of the voice.
+         * @param gain The send gain.
+         * @param frames The number of frames in the signal.
+         */
+        void Send(const Listener& listener, AmbisonicSource& source, const AudioBufferChannel& input, AmReal32 gain, AmSize frames);
+
+        /**
+         * @brief Checks whether the bus received a signal in this callback, or still has a tail to render.
+         */
+        [[nodiscard]] bool IsActive() const;
+
+        /**
+         * @brief Rotates and decodes the sound field of this callback into the stereo output of the bus.
+         *
+         * The sound field is cleared afterward.
+         *
+         * @param frames The number of frames to process.
+         *
+         * @return The stereo output of the bus. Only the first @p frames frames are valid.
+         */
+        const AudioBuffer& Process(AmSize frames);
+
+    private:
+        void ClearSoundField(AmSize offset, AmSize frames);
+
+        AmListenerID _id;
+        AmUInt32 _order;
+
+        AmbisonicOrientationProcessor _rotator;
+        AmbisonicBinauralizer _binauralizer;
+        AmbisonicDecoder _decoder;
+        ePanningMode _panningMode;
+
+        BFormat _soundField;
+        AudioBuffer _output;
+        bool _hasSend;
+        AmSize _sendFrames;
+        AmSize _tailFrames;
+        AmSize _tailLength;
+
+        AmQuat _listenerRotation;
+    };
+} // namespace SparkyStudios::Audio::Amplitude
+
+#endif // _AM_IMPLEMENTATION_MIXER_AMBISONIC_BUS_H
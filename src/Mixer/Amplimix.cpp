@@ -12,9 +12,12 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <ranges>
+
 #include <SparkyStudios/Audio/Amplitude/Amplitude.h>
 
 #include <Core/Engine.h>
+#include <DSP/Gain.h>
 #include <Mixer/Amplimix.h>
 #include <Mixer/Pipeline.h>
 
@@ -118,6 +121,11 @@ namespace SparkyStudios::Audio::Amplitude
 
     constexpr AmUInt32 kProcessedFramesCount = GetSimdBlockSize();
 
+    // Resamplers used when the engine configuration doesn't specify them
+    constexpr const char* kAmplimixDefaultHighQualityResampler = "sinc32";
+    constexpr const char* kAmplimixDefaultLowQualityResampler = "cubic";
+    constexpr AmReal32 kAmplimixDefaultHighQualityResamplerPriority = 0.5f;
+
     static void OnSoundDestroyed(AmplimixImpl* mixer, AmplimixLayerImpl* layer);
 
     static bool ShouldLoopSound(AmplimixImpl* mixer, AmplimixLayerImpl* layer)
@@ -333,6 +341,12 @@ namespace SparkyStudios::Audio::Amplitude
         , _pipeline(nullptr)
         , _device()
         , _scratchBuffer(kAmMaxSupportedFrameCount, kAmMaxSupportedChannelCount)
+        , _roomBuses()
+        , _ambisonicBusEnabled(false)
+        , _ambisonicBuses()
+        , _highQualityResampler(kAmplimixDefaultHighQualityResampler)
+        , _lowQualityResampler(kAmplimixDefaultLowQualityResampler)
+        , _highQualityResamplerPriority(kAmplimixDefaultHighQualityResamplerPriority)
     {
         AMPLIMIX_STORE(&_masterGain, masterGain);
     }
@@ -364,6 +378,19 @@ namespace SparkyStudios::Audio::Amplitude
         _device.mRequestedOutputChannels = PlaybackOutputChannels::Stereo; // For now, only support stereo output.
         _device.mRequestedOutputFormat = static_cast<PlaybackOutputFormat>(config->output()->format());
 
+        if (const auto* resamplerConfig = config->mixer()->resampler(); resamplerConfig != nullptr)
+        {
+            if (resamplerConfig->high_quality() != nullptr)
+                _highQualityResampler = resamplerConfig->high_quality()->str();
+
+            if (resamplerConfig->low_quality() != nullptr)
+                _lowQualityResampler = resamplerConfig->low_quality()->str();
+
+            _highQualityResamplerPriority = resamplerConfig->high_quality_priority();
+        }
+
+        _ambisonicBusEnabled = config->mixer()->ambisonic_bus();
+
         _audioThreadMutex = Thread::CreateMutex(500);
 
         _initialized = true;
@@ -389,6 +416,9 @@ namespace SparkyStudios::Audio::Amplitude
 
         for (auto& layer : _layers)
             layer.Reset();
+
+        DestroyRoomBuses();
+        DestroyAmbisonicBuses();
     }
 
     void AmplimixImpl::UpdateDevice(
@@ -456,6 +486,12 @@ namespace SparkyStudios::Audio::Amplitude
             layer.ResetPipeline();
         }
 
+        // Render the reverb and reflections of each room, from the signals sent by the layers
+        hasMixedAtLeastOneLayer = MixRoomBuses(&_scratchBuffer, frameCount) || hasMixedAtLeastOneLayer;
+
+        // Binauralize the sound field of each listener, from the voices encoded by the layers
+        hasMixedAtLeastOneLayer = MixAmbisonicBuses(&_scratchBuffer, frameCount) || hasMixedAtLeastOneLayer;
+
         lock.Unlock();
 
         ExecuteCommands();
@@ -566,6 +602,11 @@ namespace SparkyStudios::Audio::Amplitude
             converterSettings.m_sourceSampleRate = soundSampleRate;
             converterSettings.m_targetSampleRate = reqSampleRate;
 
+            // Background sounds use the cheaper resampler
+            converterSettings.m_resampler = sound->sound->GetSound()->GetPriority().GetValue() >= _highQualityResamplerPriority
+                ? _highQualityResampler
+                : _lowQualityResampler;
+
             if (!lay->dataConverter->Configure(converterSettings))
             {
                 amLogError("Cannot process frames. Unable to initialize the samples data converter.");
@@ -831,6 +872,90 @@ namespace SparkyStudios::Audio::Amplitude
         return _pipeline;
     }
 
+    void AmplimixImpl::CreateRoomBus(AmRoomID id)
+    {
+        if (!_initialized || _roomBuses.contains(id))
+            return;
+
+        // Allocate the bus on the calling thread, and only lock the audio thread to register it
+        auto* bus = ampoolnew(eMemoryPoolKind_Amplimix, RoomBus, id, _device.mDeviceOutputSampleRate);
+
+        AmplimixMutexLocker lock(this);
+        _roomBuses.emplace(id, bus);
+    }
+
+    void AmplimixImpl::DestroyRoomBus(AmRoomID id)
+    {
+        if (!_initialized)
+            return;
+
+        AmplimixMutexLocker lock(this);
+
+        const auto it = _roomBuses.find(id);
+        if (it == _roomBuses.end())
+            return;
+
+        RoomBus* bus = it->second;
+        _roomBuses.erase(it);
+
+        lock.Unlock();
+
+        ampooldelete(eMemoryPoolKind_Amplimix, RoomBus, bus);
+    }
+
+    RoomBus* AmplimixImpl::GetRoomBus(AmRoomID id)
+    {
+        if (const auto it = _roomBuses.find(id); it != _roomBuses.end())
+            return it->second;
+
+        return nullptr;
+    }
+
+    bool AmplimixImpl::IsAmbisonicBusEnabled() const
+    {
+        return _ambisonicBusEnabled;
+    }
+
+    void AmplimixImpl::CreateAmbisonicBus(AmListenerID id)
+    {
+        if (!_initialized || !_ambisonicBusEnabled || _ambisonicBuses.contains(id))
+            return;
+
+        // Allocate the bus on the calling thread, and only lock the audio thread to register it
+        auto* bus = ampoolnew(
+            eMemoryPoolKind_Amplimix, AmbisonicBus, id, Engine::GetInstance()->GetPanningMode(), Engine::GetInstance()->GetHRIRSphere());
+
+        AmplimixMutexLocker lock(this);
+        _ambisonicBuses.emplace(id, bus);
+    }
+
+    void AmplimixImpl::DestroyAmbisonicBus(AmListenerID id)
+    {
+        if (!_initialized)
+            return;
+
+        AmplimixMutexLocker lock(this);
+
+        const auto it = _ambisonicBuses.find(id);
+        if (it == _ambisonicBuses.end())
+            return;
+
+        AmbisonicBus* bus = it->second;
+        _ambisonicBuses.erase(it);
+
+        lock.Unlock();
+
+        ampooldelete(eMemoryPoolKind_Amplimix, AmbisonicBus, bus);
+    }
+
+    AmbisonicBus* AmplimixImpl::GetAmbisonicBus(AmListenerID id)
+    {
+        if (const auto it = _ambisonicBuses.find(id); it != _ambisonicBuses.end())
+            return it->second;
+
+        return nullptr;
+    }
+
     void AmplimixImpl::IncrementSoundLoopCount(SoundInstance* sound)
     {
         ++sound->_currentLoopCount;
@@ -1064,6 +1189,79 @@ namespace SparkyStudios::Audio::Amplitude
         }
     }
 
+    void AmplimixImpl::MixBusOutput(const AudioBuffer& output, AudioBuffer* buffer, AmReal32 gain, AmUInt64 frameCount)
+    {
+        switch (_device.mRequestedOutputChannels)
+        {
+        case PlaybackOutputChannels::Mono:
+            // Downmix the stereo output of the bus
+            Gain::ApplyAccumulateConstantGain(gain * 0.5f, output[0], 0, buffer->GetChannel(0), 0, frameCount);
+            Gain::ApplyAccumulateConstantGain(gain * 0.5f, output[1], 0, buffer->GetChannel(0), 0, frameCount);
+            break;
+
+        case PlaybackOutputChannels::Stereo:
+            Gain::ApplyAccumulateConstantGain(gain, output[0], 0, buffer->GetChannel(0), 0, frameCount);
+            Gain::ApplyAccumulateConstantGain(gain, output[1], 0, buffer->GetChannel(1), 0, frameCount);
+            break;
+
+        default:
+            amLogWarning("The mixer cannot handle the requested output channels.");
+            break;
+        }
+    }
+
+    bool AmplimixImpl::MixRoomBuses(AudioBuffer* buffer, AmUInt64 frameCount)
+    {
+        const AmReal32 gain = AMPLIMIX_LOAD(&_masterGain);
+
+        bool hasMixedAtLeastOneBus = false;
+        for (const auto& bus : _roomBuses | std::views::values)
+        {
+            // The buses of the silent rooms are kept until their room is destroyed
+            if (!bus->IsActive())
+                continue;
+
+            MixBusOutput(bus->Process(frameCount), buffer, gain, frameCount);
+            hasMixedAtLeastOneBus = true;
+        }
+
+        return hasMixedAtLeastOneBus;
+    }
+
+    void AmplimixImpl::DestroyRoomBuses()
+    {
+        for (const auto& bus : _roomBuses | std::views::values)
+            ampooldelete(eMemoryPoolKind_Amplimix, RoomBus, bus);
+
+        _roomBuses.clear();
+    }
+
+    bool AmplimixImpl::MixAmbisonicBuses(AudioBuffer* buffer, AmUInt64 frameCount)
+    {
+        const AmReal32 gain = AMPLIMIX_LOAD(&_masterGain);
+
+        bool hasMixedAtLeastOneBus = false;
+        for (const auto& bus : _ambisonicBuses | std::views::values)
+        {
+            // The buses of the silent listeners are kept until their listener is destroyed
+            if (!bus->IsActive())
+                continue;
+
+            MixBusOutput(bus->Process(frameCount), buffer, gain, frameCount);
+            hasMixedAtLeastOneBus = true;
+        }
+
+        return hasMixedAtLeastOneBus;
+    }
+
+    void AmplimixImpl::DestroyAmbisonicBuses()
+    {
+        for (const auto& bus : _ambisonicBuses | std::views::values)
+            ampooldelete(eMemoryPoolKind_Amplimix, AmbisonicBus, bus);
+
+        _ambisonicBuses.clear();
+    }
+
     AmplimixLayerImpl* AmplimixImpl::GetLayer(AmUInt32 layer)
     {
         // get layer based on the lowest bits of layer id
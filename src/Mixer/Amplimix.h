@@ -26,6 +26,8 @@
 #include <SparkyStudios/Audio/Amplitude/Mixer/Amplimix.h>
 #include <SparkyStudios/Audio/Amplitude/Mixer/Pipeline.h>
 
+#include <Mixer/AmbisonicBus.h>
+#include <Mixer/RoomBus.h>
 #include <Mixer/SoundData.h>
 
 #include <Utils/miniaudio/miniaudio_utils.h>
@@ -221,11 +223,83 @@ namespace SparkyStudios::Audio::Amplitude
             return _device;
         }
 
+        /**
+         * @brief Creates the send bus of the given room.
+         *
+         * Called by the engine when the room is created, so the bus is never allocated on the audio thread.
+         *
+         * @param id The ID of the room.
+         */
+        void CreateRoomBus(AmRoomID id);
+
+        /**
+         * @brief Destroys the send bus of the given room.
+         *
+         * Called by the engine when the room is destroyed.
+         *
+         * @param id The ID of the room.
+         */
+        void DestroyRoomBus(AmRoomID id);
+
+        /**
+         * @brief Gets the send bus of the given room.
+         *
+         * Must be called from the audio thread, while mixing.
+         *
+         * @param id The ID of the room.
+         *
+         * @return The send bus of the room, or @c nullptr if the room has no bus.
+         */
+        [[nodiscard]] RoomBus* GetRoomBus(AmRoomID id);
+
+        /**
+         * @brief Checks whether HRTF voices are rendered on a shared ambisonic bus per listener.
+         *
+         * When enabled, the ambisonic panning node encodes the voices in the bus of their listener,
+         * and the rotator and binaural decoder nodes receive no input.
+         */
+        [[nodiscard]] bool IsAmbisonicBusEnabled() const;
+
+        /**
+         * @brief Creates the ambisonic bus of the given listener.
+         *
+         * Called by the engine when the listener is created, so the bus is never allocated on the audio thread.
+         * Does nothing if the ambisonic buses are disabled.
+         *
+         * @param id The ID of the listener.
+         */
+        void CreateAmbisonicBus(AmListenerID id);
+
+        /**
+         * @brief Destroys the ambisonic bus of the given listener.
+         *
+         * Called by the engine when the listener is destroyed.
+         *
+         * @param id The ID of the listener.
+         */
+        void DestroyAmbisonicBus(AmListenerID id);
+
+        /**
+         * @brief Gets the ambisonic bus of the given listener.
+         *
+         * Must be called from the audio thread, while mixing.
+         *
+         * @param id The ID of the listener.
+         *
+         * @return The ambisonic bus of the listener, or @c nullptr if the listener has no bus.
+         */
+        [[nodiscard]] AmbisonicBus* GetAmbisonicBus(AmListenerID id);
+
         static void IncrementSoundLoopCount(SoundInstance* sound);
 
     private:
         void ExecuteCommands();
         void MixLayer(AmplimixLayerImpl* layer, AudioBuffer* buffer, AmUInt64 frameCount);
+        void MixBusOutput(const AudioBuffer& output, AudioBuffer* buffer, AmReal32 gain, AmUInt64 frameCount);
+        bool MixRoomBuses(AudioBuffer* buffer, AmUInt64 frameCount);
+        void DestroyRoomBuses();
+        bool MixAmbisonicBuses(AudioBuffer* buffer, AmUInt64 frameCount);
+        void DestroyAmbisonicBuses();
         AmplimixLayerImpl* GetLayer(AmUInt32 layer);
         bool ShouldMix(AmplimixLayerImpl* layer);
         void UpdatePitch(AmplimixLayerImpl* layer);
@@ -250,6 +324,15 @@ namespace SparkyStudios::Audio::Amplitude
 
         AudioBuffer _scratchBuffer;
 
+        std::unordered_map<AmRoomID, RoomBus*> _roomBuses;
+
+        bool _ambisonicBusEnabled;
+        std::unordered_map<AmListenerID, AmbisonicBus*> _ambisonicBuses;
+
+        AmString _highQualityResampler;
+        AmString _lowQualityResampler;
+        AmReal32 _highQualityResamplerPriority;
+
         AfterMixCallback _afterMixCallback = nullptr;
     };
 } // namespace SparkyStudios::Audio::Amplitude
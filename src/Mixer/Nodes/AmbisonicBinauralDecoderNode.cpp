@@ -15,7 +15,6 @@
 #include <Mixer/Nodes/AmbisonicBinauralDecoderNode.h>
 
 #include <Ambisonics/AmbisonicDecoder.h>
-#include <Ambisonics/BFormat.h>
 #include <Core/EngineInternalState.h>
 
 namespace SparkyStudios::Audio::Amplitude
@@ -24,14 +23,17 @@ namespace SparkyStudios::Audio::Amplitude
         : ProcessorNodeInstance(false)
     {
         _hrirSphere = Engine::GetInstance()->GetHRIRSphere();
-        ePanningMode mode = Engine::GetInstance()->GetPanningMode();
+        _panningMode = Engine::GetInstance()->GetPanningMode();
 
-        if (mode != ePanningMode_Stereo && _hrirSphere == nullptr)
-            mode = ePanningMode_Stereo;
+        // The input sound field is encoded at the order of the panning node, even when falling back to stereo
+        _order = AM_MAX(static_cast<AmUInt32>(_panningMode), 1u);
 
-        const AmUInt32 order = AM_MAX(static_cast<AmUInt32>(mode), 1u);
+        if (_panningMode != ePanningMode_Stereo && _hrirSphere == nullptr)
+            _panningMode = ePanningMode_Stereo;
 
-        if (mode == ePanningMode_Stereo)
+        const AmUInt32 order = AM_MAX(static_cast<AmUInt32>(_panningMode), 1u);
+
+        if (_panningMode == ePanningMode_Stereo)
             _decoder.Configure(order, true, eSpeakersPreset_Stereo);
         else
             _binauralizer.Configure(order, true, _hrirSphere);
@@ -42,23 +44,23 @@ namespace SparkyStudios::Audio::Amplitude
         if (input->IsEmpty())
             return nullptr;
 
-        const auto* layer = GetLayer();
-
-        const ePanningMode mode = Engine::GetInstance()->GetPanningMode();
-        const AmUInt32 order = AM_MAX(static_cast<AmUInt32>(mode), 1u);
+        const auto frameCount = static_cast<AmUInt32>(input->GetFrameCount());
 
-        BFormat soundField;
-        soundField.Configure(order, true, input->GetFrameCount());
+        // The buffers are only reallocated when the frame count changes
+        _soundField.Configure(_order, true, frameCount);
 
         for (AmUInt32 i = 0, l = input->GetChannelCount(); i < l; ++i)
-            soundField.CopyStream(input->GetChannel(i), i, input->GetFrameCount());
+            _soundField.CopyStream(input->GetChannel(i), i, frameCount);
 
-        _output = AudioBuffer(input->GetFrameCount(), 2);
+        if (_output.GetFrameCount() != frameCount)
+            _output = AudioBuffer(frameCount, 2);
+        else
+            _output.Clear();
 
-        if (mode == ePanningMode_Stereo)
-            _decoder.Process(&soundField, input->GetFrameCount(), _output);
+        if (_panningMode == ePanningMode_Stereo)
+            _decoder.Process(&_soundField, frameCount, _output);
         else
-            _binauralizer.Process(&soundField, input->GetFrameCount(), _output);
+            _binauralizer.Process(&_soundField, frameCount, _output);
 
         return &_output;
     }
@@ -21,6 +21,7 @@
 #include <SparkyStudios/Audio/Amplitude/Mixer/Node.h>
 
 #include <Ambisonics/AmbisonicBinauralizer.h>
+#include <Ambisonics/BFormat.h>
 #include <HRTF/HRIRSphere.h>
 #include <Mixer/Pipeline.h>
 
@@ -35,9 +36,12 @@ namespace SparkyStudios::Audio::Amplitude
 
     private:
         const HRIRSphere* _hrirSphere;
+        ePanningMode _panningMode;
+        AmUInt32 _order;
         AmbisonicBinauralizer _binauralizer;
         AmbisonicDecoder _decoder;
 
+        BFormat _soundField;
         AudioBuffer _output;
     };
 
@@ -15,6 +15,7 @@
 #include <SparkyStudios/Audio/Amplitude/Mixer/Amplimix.h>
 
 #include <Core/EngineInternalState.h>
+#include <Mixer/Amplimix.h>
 #include <Mixer/Nodes/AmbisonicPanningNode.h>
 
 namespace SparkyStudios::Audio::Amplitude
@@ -40,12 +41,23 @@ namespace SparkyStudios::Audio::Amplitude
 
         const auto& listenerSpaceSourcePosition = listener.GetInverseMatrix() * AM_V4V(layer->GetLocation(), 1.0f);
 
+        _source.SetPosition(SphericalPosition::ForHRTF(listenerSpaceSourcePosition.XYZ), 0.25f);
+
+        if (auto* mixer = static_cast<AmplimixImpl*>(amEngine->GetMixer()); mixer->IsAmbisonicBusEnabled())
+        {
+            // The layer gain is applied by the mixer to the layer output, so apply it to the send as well
+            if (AmbisonicBus* bus = mixer->GetAmbisonicBus(listener.GetId()); bus != nullptr)
+                bus->Send(listener, _source, input->GetChannel(0), layer->GetGain(), input->GetFrameCount());
+
+            return nullptr;
+        }
+
         const ePanningMode mode = Engine::GetInstance()->GetPanningMode();
         const AmUInt32 order = AM_MAX(static_cast<AmUInt32>(mode), 1u);
 
+        // Reuses the sound field storage while the frame count doesn't change
         _soundField.Configure(order, true, input->GetFrameCount());
 
-        _source.SetPosition(SphericalPosition::ForHRTF(listenerSpaceSourcePosition.XYZ), 0.25f);
         _source.Process(input->GetChannel(0), input->GetFrameCount(), &_soundField);
 
         return _soundField.GetBuffer();
@@ -45,6 +45,7 @@ namespace SparkyStudios::Audio::Amplitude
         const ePanningMode mode = Engine::GetInstance()->GetPanningMode();
         const AmUInt32 order = AM_MAX(static_cast<AmUInt32>(mode), 1u);
 
+        // Reuses the sound field storage while the frame count doesn't change
         _soundField.Configure(order, true, input->GetFrameCount());
 
         for (AmUInt32 i = 0, l = input->GetChannelCount(); i < l; ++i)
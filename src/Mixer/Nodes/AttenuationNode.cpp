@@ -15,6 +15,7 @@
 #include <SparkyStudios/Audio/Amplitude/Mixer/Amplimix.h>
 
 #include <Core/EngineInternalState.h>
+#include <DSP/Filters/BiquadResonantFilter.h>
 #include <DSP/Gain.h>
 #include <Mixer/Nodes/AttenuationNode.h>
 
@@ -47,152 +48,72 @@ namespace SparkyStudios::Audio::Amplitude
     }
 
     AirAbsorptionEQFilter::AirAbsorptionEQFilter()
-        : _eqFilterFactory()
-        , _lowShelfFilter{ nullptr, nullptr }
-        , _peakingFilter{ nullptr, nullptr }
-        , _highShelfFilter{ nullptr, nullptr }
-        , _currentSet(0)
+        : _cascade(kAmAirAbsorptionBandCount)
+        , _gains{ 1.0f, 1.0f, 1.0f }
+        , _sampleRate(0)
         , _needUpdateGains(false)
-    {
-        EnsureFilters();
-    }
-
-    AirAbsorptionEQFilter::~AirAbsorptionEQFilter()
-    {
-        for (AmUInt32 i = 0; i < 2; ++i)
-        {
-            if (_lowShelfFilter[i] != nullptr)
-            {
-                _eqFilterFactory.DestroyInstance(_lowShelfFilter[i]);
-                _lowShelfFilter[i] = nullptr;
-            }
-
-            if (_peakingFilter[i] != nullptr)
-            {
-                _eqFilterFactory.DestroyInstance(_peakingFilter[i]);
-                _peakingFilter[i] = nullptr;
-            }
-
-            if (_highShelfFilter[i] != nullptr)
-            {
-                _eqFilterFactory.DestroyInstance(_highShelfFilter[i]);
-                _highShelfFilter[i] = nullptr;
-            }
-        }
-    }
+    {}
 
     void AirAbsorptionEQFilter::SetGains(AmReal32 gainLow, AmReal32 gainMid, AmReal32 gainHigh)
     {
-        const AmReal32 oldGainLow = _lowShelfFilter[_currentSet]->GetParameter(BiquadResonantFilter::ATTRIBUTE_GAIN);
-        const AmReal32 oldGainMid = _peakingFilter[_currentSet]->GetParameter(BiquadResonantFilter::ATTRIBUTE_GAIN);
-        const AmReal32 oldGainHigh = _highShelfFilter[_currentSet]->GetParameter(BiquadResonantFilter::ATTRIBUTE_GAIN);
+        const AmReal32 gains[kAmAirAbsorptionBandCount] = { gainLow, gainMid, gainHigh };
 
-        if (std::abs(gainLow - oldGainLow) > kEpsilon)
+        for (AmUInt32 i = 0; i < kAmAirAbsorptionBandCount; ++i)
         {
-            _lowShelfFilter[_currentSet]->SetParameter(BiquadResonantFilter::ATTRIBUTE_GAIN, gainLow);
-            _needUpdateGains = true;
-        }
-
-        if (std::abs(gainMid - oldGainMid) > kEpsilon)
-        {
-            _peakingFilter[_currentSet]->SetParameter(BiquadResonantFilter::ATTRIBUTE_GAIN, gainMid);
-            _needUpdateGains = true;
-        }
-
-        if (std::abs(gainHigh - oldGainHigh) > kEpsilon)
-        {
-            _highShelfFilter[_currentSet]->SetParameter(BiquadResonantFilter::ATTRIBUTE_GAIN, gainHigh);
-            _needUpdateGains = true;
+            if (std::abs(gains[i] - _gains[i]) > kEpsilon)
+            {
+                _gains[i] = gains[i];
+                _needUpdateGains = true;
+            }
         }
     }
 
     void AirAbsorptionEQFilter::Process(const AudioBuffer& input, AudioBuffer& output, AmReal32 sampleRate)
     {
-        if (_needUpdateGains)
+        if (const auto rate = static_cast<AmUInt32>(sampleRate); rate != _sampleRate)
         {
-            const AmUInt32 previousSet = _currentSet;
-            _currentSet = 1 - _currentSet;
-
-            _lowShelfFilter[_currentSet]->SetParameter(
-                BiquadResonantFilter::ATTRIBUTE_FREQUENCY,
-                _lowShelfFilter[previousSet]->GetParameter(BiquadResonantFilter::ATTRIBUTE_FREQUENCY));
-            _lowShelfFilter[_currentSet]->SetParameter(
-                BiquadResonantFilter::ATTRIBUTE_RESONANCE,
-                _lowShelfFilter[previousSet]->GetParameter(BiquadResonantFilter::ATTRIBUTE_RESONANCE));
-            _lowShelfFilter[_currentSet]->SetParameter(
-                BiquadResonantFilter::ATTRIBUTE_GAIN, _lowShelfFilter[previousSet]->GetParameter(BiquadResonantFilter::ATTRIBUTE_GAIN));
-
-            _peakingFilter[_currentSet]->SetParameter(
-                BiquadResonantFilter::ATTRIBUTE_FREQUENCY,
-                _peakingFilter[previousSet]->GetParameter(BiquadResonantFilter::ATTRIBUTE_FREQUENCY));
-            _peakingFilter[_currentSet]->SetParameter(
-                BiquadResonantFilter::ATTRIBUTE_RESONANCE,
-                _peakingFilter[previousSet]->GetParameter(BiquadResonantFilter::ATTRIBUTE_RESONANCE));
-            _peakingFilter[_currentSet]->SetParameter(
-                BiquadResonantFilter::ATTRIBUTE_GAIN, _peakingFilter[previousSet]->GetParameter(BiquadResonantFilter::ATTRIBUTE_GAIN));
-
-            _highShelfFilter[_currentSet]->SetParameter(
-                BiquadResonantFilter::ATTRIBUTE_FREQUENCY,
-                _highShelfFilter[previousSet]->GetParameter(BiquadResonantFilter::ATTRIBUTE_FREQUENCY));
-            _highShelfFilter[_currentSet]->SetParameter(
-                BiquadResonantFilter::ATTRIBUTE_RESONANCE,
-                _highShelfFilter[previousSet]->GetParameter(BiquadResonantFilter::ATTRIBUTE_RESONANCE));
-            _highShelfFilter[_currentSet]->SetParameter(
-                BiquadResonantFilter::ATTRIBUTE_GAIN, _highShelfFilter[previousSet]->GetParameter(BiquadResonantFilter::ATTRIBUTE_GAIN));
-
-            AudioBuffer temp(input.GetFrameCount(), input.GetChannelCount());
-
-            ApplyFilters(previousSet, input, temp, sampleRate);
-            ApplyFilters(_currentSet, input, output, sampleRate);
-
-            auto& o = output[0];
-            auto& t = temp[0];
-
-            for (AmUInt32 i = 0, l = input.GetFrameCount(); i < l; ++i)
-            {
-                AmReal32 weight = static_cast<AmReal32>(i) / static_cast<AmReal32>(l);
-                o[i] = weight * o[i] + (1.0f - weight) * t[i];
-            }
-
-            _needUpdateGains = false;
+            _sampleRate = rate;
+            UpdateCoefficients(false);
         }
-        else
+        else if (_needUpdateGains)
         {
-            ApplyFilters(_currentSet, input, output, sampleRate);
+            // The cascade crossfades from the previous coefficients during this block
+            UpdateCoefficients(true);
         }
-    }
-
-    void AirAbsorptionEQFilter::EnsureFilters()
-    {
-        for (AmUInt32 i = 0; i < 2; ++i)
-        {
-            if (_lowShelfFilter[i] == nullptr)
-            {
-                _eqFilterFactory.InitializeLowShelf(kHighCutoffFrequencies[0], kQ, 0.0f);
-                _lowShelfFilter[i] = _eqFilterFactory.CreateInstance();
-            }
 
-            if (_peakingFilter[i] == nullptr)
-            {
-                const AmReal32 cutoffFrequency = AM_SqrtF(kLowCutoffFrequencies[1] * kHighCutoffFrequencies[1]);
-                _eqFilterFactory.InitializePeaking(
-                    cutoffFrequency, cutoffFrequency / (kHighCutoffFrequencies[1] - kLowCutoffFrequencies[1]), 0.0f);
-                _peakingFilter[i] = _eqFilterFactory.CreateInstance();
-            }
+        _needUpdateGains = false;
 
-            if (_highShelfFilter[i] == nullptr)
-            {
-                _eqFilterFactory.InitializeHighShelf(kLowCutoffFrequencies[2], kQ, 0.0f);
-                _highShelfFilter[i] = _eqFilterFactory.CreateInstance();
-            }
-        }
+        _cascade.Process(input, output, input.GetFrameCount());
     }
 
-    void AirAbsorptionEQFilter::ApplyFilters(AmUInt32 set, const AudioBuffer& input, AudioBuffer& output, AmReal32 sampleRate)
+    void AirAbsorptionEQFilter::UpdateCoefficients(bool interpolate)
     {
-        _lowShelfFilter[set]->Process(input, output, input.GetFrameCount(), sampleRate);
-        _peakingFilter[set]->Process(output, output, input.GetFrameCount(), sampleRate);
-        _highShelfFilter[set]->Process(output, output, input.GetFrameCount(), sampleRate);
+        // The band gains are linear, the filter design expects decibels. Silent bands are floored at -100 dB.
+        const auto toDecibels = [](AmReal32 gain)
+        {
+            return 20.0f * std::log10(AM_MAX(gain, 1e-5f));
+        };
+
+        const AmReal32 peakingFrequency = AM_SqrtF(kLowCutoffFrequencies[1] * kHighCutoffFrequencies[1]);
+        const AmReal32 peakingQ = peakingFrequency / (kHighCutoffFrequencies[1] - kLowCutoffFrequencies[1]);
+
+        _cascade.SetCoefficients(
+            0,
+            BiquadResonantFilter::ComputeCoefficients(
+                BiquadResonantFilter::TYPE_LOW_SHELF, kHighCutoffFrequencies[0], kQ, toDecibels(_gains[0]), _sampleRate),
+            interpolate);
+
+        _cascade.SetCoefficients(
+            1,
+            BiquadResonantFilter::ComputeCoefficients(
+                BiquadResonantFilter::TYPE_PEAK, peakingFrequency, peakingQ, toDecibels(_gains[1]), _sampleRate),
+            interpolate);
+
+        _cascade.SetCoefficients(
+            2,
+            BiquadResonantFilter::ComputeCoefficients(
+                BiquadResonantFilter::TYPE_HIGH_SHELF, kLowCutoffFrequencies[2], kQ, toDecibels(_gains[2]), _sampleRate),
+            interpolate);
     }
 
     AttenuationNodeInstance::AttenuationNodeInstance()
@@ -20,7 +20,7 @@
 #include <SparkyStudios/Audio/Amplitude/Core/Memory.h>
 #include <SparkyStudios/Audio/Amplitude/Mixer/Node.h>
 
-#include <DSP/Filters/BiquadResonantFilter.h>
+#include <DSP/BiquadCascade.h>
 
 namespace SparkyStudios::Audio::Amplitude
 {
@@ -32,23 +32,19 @@ namespace SparkyStudios::Audio::Amplitude
         static void Normalize(std::array<AmReal32, kAmAirAbsorptionBandCount>& gains, AmReal32& overallGain);
 
         AirAbsorptionEQFilter();
-        ~AirAbsorptionEQFilter();
 
         void SetGains(AmReal32 gainLow, AmReal32 gainMid, AmReal32 gainHigh);
 
         void Process(const AudioBuffer& input, AudioBuffer& output, AmReal32 sampleRate);
 
     private:
-        void EnsureFilters();
-        void ApplyFilters(AmUInt32 set, const AudioBuffer& input, AudioBuffer& output, AmReal32 sampleRate);
+        void UpdateCoefficients(bool interpolate);
 
-        BiquadResonantFilter _eqFilterFactory;
+        // Low shelf, peaking and high shelf sections, run on all the channels at once
+        BiquadCascade _cascade;
 
-        FilterInstance* _lowShelfFilter[2];
-        FilterInstance* _peakingFilter[2];
-        FilterInstance* _highShelfFilter[2];
-
-        AmUInt32 _currentSet;
+        std::array<AmReal32, kAmAirAbsorptionBandCount> _gains;
+        AmUInt32 _sampleRate;
         bool _needUpdateGains;
     };
 
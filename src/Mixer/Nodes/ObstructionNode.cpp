@@ -13,7 +13,7 @@
 // limitations under the License.
 
 #include <Core/EngineInternalState.h>
-#include <DSP/Filters/MonoPoleFilter.h>
+#include <DSP/BiquadCascade.h>
 #include <DSP/Gain.h>
 #include <Mixer/Nodes/ObstructionNode.h>
 
@@ -25,18 +25,9 @@ namespace SparkyStudios::Audio::Amplitude
     constexpr AmReal32 kObstructionSmoothingCoefficient = 0.75f;
 
     ObstructionNodeInstance::ObstructionNodeInstance()
-        : _filter()
-        , _currentObstruction(0)
-        , _obstructionFilter(nullptr)
-    {
-        _obstructionFilter = _filter.CreateInstance();
-    }
-
-    ObstructionNodeInstance::~ObstructionNodeInstance()
-    {
-        _filter.DestroyInstance(_obstructionFilter);
-        _obstructionFilter = nullptr;
-    }
+        : _currentObstruction(0)
+        , _lowPassFilter(1)
+    {}
 
     const AudioBuffer* ObstructionNodeInstance::Process(const AudioBuffer* input)
     {
@@ -46,7 +37,6 @@ namespace SparkyStudios::Audio::Amplitude
 
         const auto frames = input->GetFrameCount();
         const auto channels = input->GetChannelCount();
-        const auto sampleRate = layer->GetSoundFormat().GetSampleRate();
 
         const Listener listener = layer->GetListener();
         const Entity entity = layer->GetEntity();
@@ -58,13 +48,16 @@ namespace SparkyStudios::Audio::Amplitude
 
         _output = AudioBuffer(frames, channels);
 
-        if (const AmReal32 lpf = lpfCurve.Get(_currentObstruction); lpf > kEpsilon)
-        {
-            // Update the filter coefficients
-            _obstructionFilter->SetParameter(MonoPoleFilter::ATTRIBUTE_COEFFICIENT, AM_CLAMP(lpf, 0.0f, 1.0f));
+        const AmReal32 lpf = lpfCurve.Get(_currentObstruction);
 
+        // Update the filter coefficients, the change is smoothed over the next block
+        _lowPassFilter.SetCoefficients(
+            0, lpf > kEpsilon ? BiquadCoefficients::OnePoleLowPass(AM_CLAMP(lpf, 0.0f, 1.0f)) : BiquadCoefficients::Identity());
+
+        if (lpf > kEpsilon || _lowPassFilter.IsInterpolating())
+        {
             // Apply Low Pass Filter
-            _obstructionFilter->Process(*input, _output, frames, sampleRate);
+            _lowPassFilter.Process(*input, _output, frames);
         }
         else
         {
@@ -20,7 +20,7 @@
 #include <SparkyStudios/Audio/Amplitude/Core/Memory.h>
 #include <SparkyStudios/Audio/Amplitude/Mixer/Node.h>
 
-#include <DSP/Filters/MonoPoleFilter.h>
+#include <DSP/BiquadCascade.h>
 
 namespace SparkyStudios::Audio::Amplitude
 {
@@ -29,15 +29,11 @@ namespace SparkyStudios::Audio::Amplitude
     public:
         ObstructionNodeInstance();
 
-        ~ObstructionNodeInstance() override;
-
         const AudioBuffer* Process(const AudioBuffer* input) override;
 
     private:
-        MonoPoleFilter _filter;
-
         AmReal32 _currentObstruction;
-        FilterInstance* _obstructionFilter;
+        BiquadCascade _lowPassFilter;
 
         AudioBuffer _output;
     };
@@ -13,7 +13,7 @@
 // limitations under the License.
 
 #include <Core/EngineInternalState.h>
-#include <DSP/Filters/MonoPoleFilter.h>
+#include <DSP/BiquadCascade.h>
 #include <DSP/Gain.h>
 #include <Mixer/Nodes/OcclusionNode.h>
 
@@ -45,18 +45,9 @@ namespace SparkyStudios::Audio::Amplitude
     }
 
     OcclusionNodeInstance::OcclusionNodeInstance()
-        : _filter()
-        , _currentOcclusion(0)
-        , _occlusionFilter(nullptr)
-    {
-        _occlusionFilter = _filter.CreateInstance();
-    }
-
-    OcclusionNodeInstance::~OcclusionNodeInstance()
-    {
-        _filter.DestroyInstance(_occlusionFilter);
-        _occlusionFilter = nullptr;
-    }
+        : _currentOcclusion(0)
+        , _lowPassFilter(1)
+    {}
 
     const AudioBuffer* OcclusionNodeInstance::Process(const AudioBuffer* input)
     {
@@ -66,7 +57,6 @@ namespace SparkyStudios::Audio::Amplitude
 
         const auto frames = input->GetFrameCount();
         const auto channels = input->GetChannelCount();
-        const auto sampleRate = layer->GetSoundFormat().GetSampleRate();
 
         const Listener listener = layer->GetListener();
         const Entity entity = layer->GetEntity();
@@ -98,13 +88,16 @@ namespace SparkyStudios::Audio::Amplitude
 
         _output = AudioBuffer(frames, channels);
 
-        if (coefficient > kEpsilon)
-        {
-            // Update the filter coefficients
-            _occlusionFilter->SetParameter(MonoPoleFilter::ATTRIBUTE_COEFFICIENT, AM_CLAMP(coefficient, 0.0f, 1.0f));
+        // Update the filter coefficients, the change is smoothed over the next block
+        _lowPassFilter.SetCoefficients(
+            0,
+            coefficient > kEpsilon ? BiquadCoefficients::OnePoleLowPass(AM_CLAMP(coefficient, 0.0f, 1.0f))
+                                   : BiquadCoefficients::Identity());
 
+        if (coefficient > kEpsilon || _lowPassFilter.IsInterpolating())
+        {
             // Apply Low Pass Filter
-            _occlusionFilter->Process(*input, _output, frames, sampleRate);
+            _lowPassFilter.Process(*input, _output, frames);
         }
         else
         {
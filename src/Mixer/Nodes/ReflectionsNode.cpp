@@ -13,58 +13,25 @@
 // limitations under the License.
 
 #include <Core/Engine.h>
+#include <Mixer/Amplimix.h>
 #include <Mixer/Nodes/ReflectionsNode.h>
 
 namespace SparkyStudios::Audio::Amplitude
 {
     ReflectionsNodeInstance::ReflectionsNodeInstance()
-        : ProcessorNodeInstance(true)
-        , _reflectionsProcessor(nullptr)
-        , _numFramesProcessedOnEmptyInput(0)
+        : ProcessorNodeInstance(false)
     {}
 
-    ReflectionsNodeInstance::~ReflectionsNodeInstance()
-    {
-        ampooldelete(eMemoryPoolKind_Amplimix, ReflectionsProcessor, _reflectionsProcessor);
-        _reflectionsProcessor = nullptr;
-    }
-
-    void ReflectionsNodeInstance::Initialize(AmObjectID id, const AmplimixLayer* layer, const PipelineInstance* node)
-    {
-        ProcessorNodeInstance::Initialize(id, layer, node);
-
-        const auto& deviceConfig = amEngine->GetMixer()->GetDeviceDescription();
-
-        _orientationProcessor.Configure(1, true);
-        _reflectionsProcessor = ampoolnew(
-            eMemoryPoolKind_Amplimix, ReflectionsProcessor, deviceConfig.mDeviceOutputSampleRate, amEngine->GetSamplesPerStream());
-
-        _output.Configure(1, true, amEngine->GetSamplesPerStream());
-        _silenceBuffer = AudioBuffer(amEngine->GetSamplesPerStream(), kAmMonoChannelCount);
-
-        Reset();
-    }
-
     const AudioBuffer* ReflectionsNodeInstance::Process(const AudioBuffer* input)
     {
-        if (input == nullptr)
-        {
-            if (_numFramesProcessedOnEmptyInput < _reflectionsProcessor->GetNumFramesToProcessOnEmptyInput())
-            {
-                _numFramesProcessedOnEmptyInput += _silenceBuffer.GetFrameCount();
-                input = &_silenceBuffer;
-            }
-            else
-                return nullptr;
-        }
-        else
-        {
-            _numFramesProcessedOnEmptyInput = 0;
-            AMPLITUDE_ASSERT(input->GetChannelCount() == kAmMonoChannelCount);
-        }
+        AMPLITUDE_ASSERT(input->GetChannelCount() == kAmMonoChannelCount);
 
         const auto* layer = GetLayer();
-        const auto& room = layer->GetRoom();
+
+        const Room& room = layer->GetRoom();
+        if (!room.Valid())
+            return nullptr;
+
         const AmReal32 roomGain = layer->GetChannel().GetState()->GetRoomGain(room.GetId());
 
         if (roomGain < kEpsilon)
@@ -74,38 +41,12 @@ namespace SparkyStudios::Audio::Amplitude
         if (!listener.Valid())
             return nullptr;
 
-        _output.Reset();
-
-        {
-            // Apply reflections gain
-            AudioBuffer temp(input->GetFrameCount(), kAmMonoChannelCount);
-            Gain::ApplyReplaceConstantGain(roomGain, input->GetChannel(0), 0, temp[0], 0, _output.GetSampleCount());
-
-            // Process reflections
-            _reflectionsProcessor->Process(temp, &_output);
-        }
-
-        // Rotate the reflections to match the listener's orientation
-        _orientationProcessor.SetOrientation(Orientation(AM_InvQ(listener.GetOrientation().GetQuaternion())));
-        _orientationProcessor.Process(&_output, _output.GetSampleCount());
-
-        return _output.GetBuffer();
-    }
-
-    void ReflectionsNodeInstance::Reset()
-    {
-        ProcessorNodeInstance::Reset();
-
-        const auto* layer = GetLayer();
-        if (layer == nullptr)
-            return;
-
-        const auto& listener = layer->GetListener();
-        if (!listener.Valid())
-            return;
+        // The layer gain is applied by the mixer to the layer output, so apply it to the send as well
+        auto* mixer = static_cast<AmplimixImpl*>(amEngine->GetMixer());
+        if (RoomBus* bus = mixer->GetRoomBus(room.GetId()); bus != nullptr)
+            bus->SendToReflections(room, listener, input->GetChannel(0), roomGain * layer->GetGain(), input->GetFrameCount());
 
-        const auto& room = layer->GetRoom();
-        _reflectionsProcessor->Update(room.GetState(), listener.GetLocation(), amEngine->GetSoundSpeed());
+        return nullptr;
     }
 
     ReflectionsNode::ReflectionsNode()
@@ -20,32 +20,19 @@
 #include <SparkyStudios/Audio/Amplitude/Core/Memory.h>
 #include <SparkyStudios/Audio/Amplitude/Mixer/Node.h>
 
-#include <Ambisonics/AmbisonicOrientationProcessor.h>
-#include <Ambisonics/BFormat.h>
-#include <DSP/ReflectionsProcessor.h>
-
 namespace SparkyStudios::Audio::Amplitude
 {
+    /**
+     * @brief Sends the input signal to the early reflections of the room the sound is playing in.
+     *
+     * The reflections themselves are rendered once per room by the mixer, so this node has no output.
+     */
     class ReflectionsNodeInstance final : public ProcessorNodeInstance
     {
     public:
         ReflectionsNodeInstance();
-        ~ReflectionsNodeInstance() override;
-
-        void Initialize(AmObjectID id, const AmplimixLayer* layer, const PipelineInstance* node) override;
 
         const AudioBuffer* Process(const AudioBuffer* input) override;
-
-        void Reset() override;
-
-    private:
-        AmbisonicOrientationProcessor _orientationProcessor;
-        ReflectionsProcessor* _reflectionsProcessor;
-
-        BFormat _output;
-        AudioBuffer _silenceBuffer;
-
-        AmSize _numFramesProcessedOnEmptyInput;
     };
 
     class ReflectionsNode final : public Node
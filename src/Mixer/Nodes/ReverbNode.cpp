@@ -13,7 +13,7 @@
 // limitations under the License.
 
 #include <Core/Engine.h>
-#include <DSP/Gain.h>
+#include <Mixer/Amplimix.h>
 #include <Mixer/Nodes/ReverbNode.h>
 
 namespace SparkyStudios::Audio::Amplitude
@@ -22,48 +22,6 @@ namespace SparkyStudios::Audio::Amplitude
         : ProcessorNodeInstance(false)
     {}
 
-    void ReverbNodeInstance::Initialize(AmObjectID id, const AmplimixLayer* layer, const PipelineInstance* node)
-    {
-        ProcessorNodeInstance::Initialize(id, layer, node);
-        Reset();
-
-        _model.SetWidth(1);
-        _model.SetWet(1);
-        _model.SetDry(0);
-        _model.SetMode(0);
-    }
-
-    void ReverbNodeInstance::Reset()
-    {
-        ProcessorNodeInstance::Reset();
-
-        const Room& room = GetLayer()->GetRoom();
-        if (!room.Valid() || !room.GetState()->WasUpdated())
-            return;
-
-        // Set room size
-        {
-            AmReal32 maxSurface = 0.0f;
-
-            for (AmUInt32 i = 0; i < kAmRoomSurfaceCount; ++i)
-                if (const AmReal32 surface = room.GetSurfaceArea(static_cast<RoomWall>(i)); surface > maxSurface)
-                    maxSurface = surface;
-
-            const AmReal32 roomSize = room.GetVolume() / (maxSurface * AM_SqrtF(maxSurface));
-
-            _model.SetRoomSize(roomSize);
-        }
-
-        // Set room total absorption
-        {
-            const auto* roomCoefficients = room.GetState()->GetCoefficients();
-            const AmReal32 absorption =
-                std::accumulate(roomCoefficients, roomCoefficients + kAmRoomSurfaceCount, 0.0f) / kAmRoomSurfaceCount;
-
-            _model.SetDamp(absorption);
-        }
-    }
-
     const AudioBuffer* ReverbNodeInstance::Process(const AudioBuffer* input)
     {
         const auto* layer = GetLayer();
@@ -77,18 +35,14 @@ namespace SparkyStudios::Audio::Amplitude
         if (roomGain < kEpsilon)
             return nullptr;
 
-        _output = AudioBuffer(input->GetFrameCount(), kAmStereoChannelCount);
-
-        {
-            // Apply reflections gain
-            AudioBuffer temp(input->GetFrameCount(), kAmMonoChannelCount);
-            Gain::ApplyReplaceConstantGain(roomGain, input->GetChannel(0), 0, temp[0], 0, _output.GetFrameCount());
+        AMPLITUDE_ASSERT(input->GetChannelCount() == kAmMonoChannelCount);
 
-            // Apply reverberation
-            _model.ProcessReplace(temp[0].begin(), temp[0].begin(), _output[0].begin(), _output[1].begin(), temp.GetFrameCount(), 1);
-        }
+        // The layer gain is applied by the mixer to the layer output, so apply it to the send as well
+        auto* mixer = static_cast<AmplimixImpl*>(amEngine->GetMixer());
+        if (RoomBus* bus = mixer->GetRoomBus(room.GetId()); bus != nullptr)
+            bus->SendToReverb(room, input->GetChannel(0), roomGain * layer->GetGain(), input->GetFrameCount());
 
-        return &_output;
+        return nullptr;
     }
 
     ReverbNode::ReverbNode()
@@ -20,23 +20,19 @@
 #include <SparkyStudios/Audio/Amplitude/Core/Memory.h>
 #include <SparkyStudios/Audio/Amplitude/Mixer/Node.h>
 
-#include <Utils/Freeverb/ReverbModel.h>
-
 namespace SparkyStudios::Audio::Amplitude
 {
+    /**
+     * @brief Sends the input signal to the reverb of the room the sound is playing in.
+     *
+     * The reverb itself is rendered once per room by the mixer, so this node has no output.
+     */
     class ReverbNodeInstance final : public ProcessorNodeInstance
     {
     public:
         ReverbNodeInstance();
 
-        void Initialize(AmObjectID id, const AmplimixLayer* layer, const PipelineInstance* node) override;
-        void Reset() override;
-
         const AudioBuffer* Process(const AudioBuffer* input) override;
-
-    private:
-        Freeverb::ReverbModel _model;
-        AudioBuffer _output;
     };
 
     class ReverbNode final : public Node
@@ -233,6 +233,6 @@ namespace SparkyStudios::Audio::Amplitude
 
     const PipelineDefinition* PipelineImpl::GetDefinition() const
     {
-        return GetPipelineDefinition(m_source.c_str());
+        return GetPipelineDefinition(GetSource());
     }
 } // namespace SparkyStudios::Audio::Amplitude
@@ -0,0 +1,243 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+
+#include <Core/Engine.h>
+#include <DSP/Gain.h>
+#include <Mixer/RoomBus.h>
+#include <Utils/SimdKernels.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    // Level below which the reverb tail is considered silent, about -120dB
+    constexpr AmReal32 kRoomBusSilenceThreshold = 1e-6f;
+
+    // Adds a voice signal to a send, clearing only the frames not already written in this callback
+    static void AccumulateSend(
+        AudioBufferChannel& send, bool& hasSend, AmSize& sendFrames, const AudioBufferChannel& input, AmReal32 gain, AmSize frames)
+    {
+        frames = AM_MIN(frames, kAmMaxSupportedFrameCount);
+
+        if (!hasSend)
+        {
+            std::fill_n(send.begin(), frames, 0.0f);
+            sendFrames = frames;
+        }
+        else if (frames > sendFrames)
+        {
+            std::fill_n(send.begin() + sendFrames, frames - sendFrames, 0.0f);
+            sendFrames = frames;
+        }
+
+        Gain::ApplyAccumulateConstantGain(gain, input, 0, send, 0, frames);
+        hasSend = true;
+    }
+
+    // Silences the frames of a send the voices didn't fill in this callback
+    static void FinishSend(AudioBufferChannel& send, bool hasSend, AmSize sendFrames, AmSize frames)
+    {
+        const AmSize offset = hasSend ? AM_MIN(sendFrames, frames) : 0;
+        std::fill_n(send.begin() + offset, frames - offset, 0.0f);
+    }
+
+    RoomBus::RoomBus(AmRoomID id, AmUInt32 sampleRate)
+        : _id(id)
+        , _room(nullptr)
+        , _needUpdate(true)
+        , _output(kAmMaxSupportedFrameCount, kAmStereoChannelCount)
+        , _reverb()
+        , _reverbSend(kAmMaxSupportedFrameCount, kAmMonoChannelCount)
+        , _hasReverbSend(false)
+        , _reverbSendFrames(0)
+        , _reverbTail(false)
+        , _reflectionsProcessor(nullptr)
+        , _panningMode(Engine::GetInstance()->GetPanningMode())
+        , _reflectionsSend(kAmMaxSupportedFrameCount, kAmMonoChannelCount)
+        , _reflectionsOutput(kAmMaxSupportedFrameCount, kAmStereoChannelCount)
+        , _hasReflectionsSend(false)
+        , _reflectionsSendFrames(0)
+        , _reflectionsTailFrames(0)
+        , _listenerLocation(AM_V3(0.0f, 0.0f, 0.0f))
+        , _listenerRotation(AM_Q(0.0f, 0.0f, 0.0f, 1.0f))
+        , _needReflectionsUpdate(true)
+    {
+        _reverb.Initialize(sampleRate);
+        _reverb.SetWidth(1.0f);
+        _reverb.SetWet(1.0f);
+
+        _reflectionsProcessor = ampoolnew(eMemoryPoolKind_Amplimix, ReflectionsProcessor, sampleRate, kAmMaxSupportedFrameCount);
+        _orientationProcessor.Configure(1, true);
+        _reflections.Configure(1, true, static_cast<AmUInt32>(kAmMaxSupportedFrameCount));
+
+        // Decode the reflections the same way the ambisonic binaural decoder node does
+        const HRIRSphere* hrirSphere = Engine::GetInstance()->GetHRIRSphere();
+
+        if (_panningMode != ePanningMode_Stereo && hrirSphere == nullptr)
+            _panningMode = ePanningMode_Stereo;
+
+        const AmUInt32 order = AM_MAX(static_cast<AmUInt32>(_panningMode), 1u);
+
+        if (_panningMode == ePanningMode_Stereo)
+            _decoder.Configure(order, true, eSpeakersPreset_Stereo);
+        else
+            _binauralizer.Configure(order, true, hrirSphere);
+
+        _soundField.Configure(order, true, static_cast<AmUInt32>(kAmMaxSupportedFrameCount));
+    }
+
+    RoomBus::~RoomBus()
+    {
+        ampooldelete(eMemoryPoolKind_Amplimix, ReflectionsProcessor, _reflectionsProcessor);
+        _reflectionsProcessor = nullptr;
+    }
+
+    AmRoomID RoomBus::GetId() const
+    {
+        return _id;
+    }
+
+    void RoomBus::SendToReverb(const Room& room, const AudioBufferChannel& input, AmReal32 gain, AmSize frames)
+    {
+        UpdateRoom(room.GetState());
+        AccumulateSend(_reverbSend[0], _hasReverbSend, _reverbSendFrames, input, gain, frames);
+    }
+
+    void RoomBus::SendToReflections(const Room& room, const Listener& listener, const AudioBufferChannel& input, AmReal32 gain, AmSize frames)
+    {
+        UpdateRoom(room.GetState());
+
+        if (const AmVec3& location = listener.GetLocation(); !AM_EqV3(location, _listenerLocation))
+        {
+            _listenerLocation = location;
+            _needReflectionsUpdate = true;
+        }
+
+        _listenerRotation = AM_InvQ(listener.GetOrientation().GetQuaternion());
+
+        AccumulateSend(_reflectionsSend[0], _hasReflectionsSend, _reflectionsSendFrames, input, gain, frames);
+    }
+
+    bool RoomBus::IsActive() const
+    {
+        return _hasReverbSend || _reverbTail || _hasReflectionsSend || _reflectionsTailFrames > 0;
+    }
+
+    const AudioBuffer& RoomBus::Process(AmSize frames)
+    {
+        AMPLITUDE_ASSERT(frames <= kAmMaxSupportedFrameCount);
+
+        if (_room != nullptr)
+        {
+            if (_needUpdate)
+                _reverb.SetRoom(_room);
+
+            if (_needUpdate || _needReflectionsUpdate)
+                _reflectionsProcessor->Update(_room, _listenerLocation, amEngine->GetSoundSpeed());
+
+            _needUpdate = false;
+            _needReflectionsUpdate = false;
+        }
+
+        // The reverb writes the bus output, and the reflections are added to it
+        if (_hasReverbSend || _reverbTail)
+        {
+            ProcessReverb(frames);
+        }
+        else
+        {
+            std::fill_n(_output[0].begin(), frames, 0.0f);
+            std::fill_n(_output[1].begin(), frames, 0.0f);
+        }
+
+        if (_hasReflectionsSend || _reflectionsTailFrames > 0)
+            ProcessReflections(frames);
+
+        // The room state is only guaranteed to be alive while voices are sending to it
+        _room = nullptr;
+
+        return _output;
+    }
+
+    void RoomBus::UpdateRoom(const RoomInternalState* room)
+    {
+        // The room update flag is reset after each voice, so catch it on the first send of the callback
+        _needUpdate = _needUpdate || room->WasUpdated();
+        _room = room;
+    }
+
+    void RoomBus::ProcessReverb(AmSize frames)
+    {
+        FinishSend(_reverbSend[0], _hasReverbSend, _reverbSendFrames, frames);
+
+        _reverb.Process(_reverbSend[0].begin(), _output[0].begin(), _output[1].begin(), frames);
+
+        if (_hasReverbSend)
+        {
+            _hasReverbSend = false;
+            _reverbTail = true;
+            return;
+        }
+
+        // Keep rendering the tail until it fades out
+        AmReal32 peak = 0.0f;
+        for (AmSize i = 0; i < frames; ++i)
+            peak = AM_MAX(peak, AM_MAX(std::abs(_output[0][i]), std::abs(_output[1][i])));
+
+        if (peak < kRoomBusSilenceThreshold)
+        {
+            _reverb.Clear();
+            _reverbTail = false;
+        }
+    }
+
+    void RoomBus::ProcessReflections(AmSize frames)
+    {
+        FinishSend(_reflectionsSend[0], _hasReflectionsSend, _reflectionsSendFrames, frames);
+
+        if (_hasReflectionsSend)
+        {
+            _reflectionsTailFrames = _reflectionsProcessor->GetNumFramesToProcessOnEmptyInput();
+            _hasReflectionsSend = false;
+        }
+        else
+        {
+            _reflectionsTailFrames -= AM_MIN(_reflectionsTailFrames, frames);
+        }
+
+        // The processor overwrites the processed frames of the reflections
+        _reflectionsProcessor->Process(_reflectionsSend, &_reflections, frames);
+
+        // Rotate the reflections to match the listener's orientation
+        _orientationProcessor.SetOrientation(Orientation(_listenerRotation));
+        _orientationProcessor.Process(&_reflections, static_cast<AmUInt32>(frames));
+
+        // Only the first order channels of the sound field are filled, the higher orders stay silent
+        for (AmUInt32 i = 0, l = _reflections.GetChannelCount(); i < l; ++i)
+            _soundField.CopyStream(_reflections.GetBufferChannel(i), i, static_cast<AmUInt32>(frames));
+
+        // The decoders add to the output, so only clear the frames processed in this callback
+        std::fill_n(_reflectionsOutput[0].begin(), frames, 0.0f);
+        std::fill_n(_reflectionsOutput[1].begin(), frames, 0.0f);
+
+        if (_panningMode == ePanningMode_Stereo)
+            _decoder.Process(&_soundField, static_cast<AmUInt32>(frames), _reflectionsOutput);
+        else
+            _binauralizer.Process(&_soundField, static_cast<AmUInt32>(frames), _reflectionsOutput);
+
+        const auto& kernels = GetSimdKernels();
+        kernels.m_Add(_output[0].begin(), _output[0].begin(), _reflectionsOutput[0].begin(), frames);
+        kernels.m_Add(_output[1].begin(), _output[1].begin(), _reflectionsOutput[1].begin(), frames);
+    }
+} // namespace SparkyStudios::Audio::Amplitude
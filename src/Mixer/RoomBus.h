@@ -0,0 +1,136 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef _AM_IMPLEMENTATION_MIXER_ROOM_BUS_H
+#define _AM_IMPLEMENTATION_MIXER_ROOM_BUS_H
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+#include <Ambisonics/AmbisonicBinauralizer.h>
+#include <Ambisonics/AmbisonicDecoder.h>
+#include <Ambisonics/AmbisonicOrientationProcessor.h>
+#include <Ambisonics/BFormat.h>
+#include <DSP/FDNReverb.h>
+#include <DSP/ReflectionsProcessor.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    /**
+     * @brief The reverb and reflections send bus of a room.
+     *
+     * Every voice playing in a room sends its dry signal, scaled by its room gain, to the bus
+     * of that room instead of running its own reverb and reflections. The mixer then processes
+     * each bus once per callback, and mixes the result in the final output. The processing cost
+     * thus scales with the number of rooms, not with the number of voices.
+     *
+     * The reflections are computed for the listener of the last voice which sent to the bus.
+     */
+    class RoomBus
+    {
+    public:
+        /**
+         * @brief Creates a new room bus.
+         *
+         * The bus buffers are sized for the largest supported callback, so the bus never
+         * reallocates while mixing.
+         *
+         * @param id The ID of the room.
+         * @param sampleRate The sample rate of the mixer output.
+         */
+        RoomBus(AmRoomID id, AmUInt32 sampleRate);
+
+        ~RoomBus();
+
+        /**
+         * @brief Gets the ID of the room this bus belongs to.
+         */
+        [[nodiscard]] AmRoomID GetId() const;
+
+        /**
+         * @brief Adds a voice signal to the reverb send.
+         *
+         * @param room The room the voice is playing in.
+         * @param input The mono dry signal of the voice.
+         * @param gain The send gain.
+         * @param frames The number of frames in the signal.
+         */
+        void SendToReverb(const Room& room, const AudioBufferChannel& input, AmReal32 gain, AmSize frames);
+
+        /**
+         * @brief Adds a voice signal to the reflections send.
+         *
+         * @param room The room the voice is playing in.
+         * @param listener The listener rendering the voice.
+         * @param input The mono dry signal of the voice.
+         * @param gain The send gain.
+         * @param frames The number of frames in the signal.
+         */
+        void SendToReflections(const Room& room, const Listener& listener, const AudioBufferChannel& input, AmReal32 gain, AmSize frames);
+
+        /**
+         * @brief Checks whether the bus received a signal in this callback, or still has a tail to render.
+         */
+        [[nodiscard]] bool IsActive() const;
+
+        /**
+         * @brief Processes the sends of this callback into the stereo output of the bus.
+         *
+         * The sends are cleared afterward.
+         *
+         * @param frames The number of frames to process, up to the maximum supported frame count.
+         *
+         * @return The stereo output of the bus.
+         */
+        const AudioBuffer& Process(AmSize frames);
+
+    private:
+        void UpdateRoom(const RoomInternalState* room);
+        void ProcessReverb(AmSize frames);
+        void ProcessReflections(AmSize frames);
+
+        AmRoomID _id;
+
+        const RoomInternalState* _room;
+        bool _needUpdate;
+
+        AudioBuffer _output;
+
+        FDNReverb _reverb;
+        AudioBuffer _reverbSend;
+        bool _hasReverbSend;
+        AmSize _reverbSendFrames;
+        bool _reverbTail;
+
+        ReflectionsProcessor* _reflectionsProcessor;
+        AmbisonicOrientationProcessor _orientationProcessor;
+        AmbisonicBinauralizer _binauralizer;
+        AmbisonicDecoder _decoder;
+        ePanningMode _panningMode;
+        BFormat _reflections;
+        BFormat _soundField;
+        AudioBuffer _reflectionsSend;
+        AudioBuffer _reflectionsOutput;
+        bool _hasReflectionsSend;
+        AmSize _reflectionsSendFrames;
+        AmSize _reflectionsTailFrames;
+
+        AmVec3 _listenerLocation;
+        AmQuat _listenerRotation;
+        bool _needReflectionsUpdate;
+    };
+} // namespace SparkyStudios::Audio::Amplitude
+
+#endif // _AM_IMPLEMENTATION_MIXER_ROOM_BUS_H
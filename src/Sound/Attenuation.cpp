@@ -82,6 +82,6 @@ namespace SparkyStudios::Audio::Amplitude
 
     const AttenuationDefinition* AttenuationImpl::GetDefinition() const
     {
-        return GetAttenuationDefinition(m_source.c_str());
+        return GetAttenuationDefinition(GetSource());
     }
 } // namespace SparkyStudios::Audio::Amplitude
\ No newline at end of file
@@ -232,7 +232,7 @@ namespace SparkyStudios::Audio::Amplitude
 
     const CollectionDefinition* CollectionImpl::GetDefinition() const
     {
-        return GetCollectionDefinition(m_source.c_str());
+        return GetCollectionDefinition(GetSource());
     }
 
     void CollectionImpl::AcquireReferences(EngineInternalState* state)
@@ -87,7 +87,7 @@ namespace SparkyStudios::Audio::Amplitude
 
     const EffectDefinition* EffectImpl::GetDefinition() const
     {
-        return GetEffectDefinition(m_source.c_str());
+        return GetEffectDefinition(GetSource());
     }
 
     EffectInstanceImpl::EffectInstanceImpl(const EffectImpl* parent)
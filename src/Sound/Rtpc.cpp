@@ -114,7 +114,7 @@ namespace SparkyStudios::Audio::Amplitude
 
     const RtpcDefinition* RtpcImpl::GetDefinition() const
     {
-        return GetRtpcDefinition(m_source.c_str());
+        return GetRtpcDefinition(GetSource());
     }
 
     void RtpcValue::Init(RtpcValue& value, const RtpcCompatibleValue* definition, AmReal32 staticValue)
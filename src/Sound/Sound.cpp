@@ -316,7 +316,7 @@ namespace SparkyStudios::Audio::Amplitude
 
     const SoundDefinition* SoundImpl::GetDefinition() const
     {
-        return GetSoundDefinition(m_source.c_str());
+        return GetSoundDefinition(GetSource());
     }
 
     void SoundImpl::AcquireReferences(EngineInternalState* state)
@@ -19,6 +19,7 @@
 
 #include "attenuation_definition_generated.h"
 #include "collection_definition_generated.h"
+#include "compiled_sound_bank_definition_generated.h"
 #include "effect_definition_generated.h"
 #include "event_definition_generated.h"
 #include "rtpc_definition_generated.h"
@@ -32,8 +33,13 @@ namespace SparkyStudios::Audio::Amplitude
     SoundBank::SoundBank()
         : _refCounter()
         , _soundBankDefSource()
+        , _compiledSource(nullptr)
         , _name()
         , _id(kAmInvalidObjectId)
+        , _pendingAssets()
+        , _nextPendingAsset(0)
+        , _pendingSoundsMutex()
+        , _pendingSoundsToLoad()
     {}
 
     SoundBank::SoundBank(const std::string& source)
@@ -47,7 +53,152 @@ namespace SparkyStudios::Audio::Amplitude
         _name = definition->name()->str();
     }
 
-    static bool InitializeSwitchContainer(const AmOsString& filename, const EngineImpl* engine)
+    /**
+     * @brief The minimum alignment of memory-backed definition data to be used in place.
+     */
+    static constexpr AmSize kDefinitionDataAlignment = 8;
+
+    /**
+     * @brief The kinds of assets a sound bank can reference.
+     */
+    enum eSoundBankAssetKind : AmUInt8
+    {
+        eSoundBankAssetKind_Rtpc = 0,
+        eSoundBankAssetKind_Effect,
+        eSoundBankAssetKind_Switch,
+        eSoundBankAssetKind_Attenuation,
+        eSoundBankAssetKind_Sound,
+        eSoundBankAssetKind_Collection,
+        eSoundBankAssetKind_SwitchContainer,
+        eSoundBankAssetKind_Event,
+    };
+
+    /**
+     * @brief The definition data of an asset already in memory.
+     */
+    struct AssetDefinitionSource
+    {
+        /**
+         * @brief The asset definition data, or @c nullptr to load the asset from its definition file.
+         */
+        const char* m_Data = nullptr;
+
+        /**
+         * @brief The object owning the definition data, kept alive by the asset loaded from it.
+         */
+        std::shared_ptr<const void> m_Owner = nullptr;
+    };
+
+    static AmOsString GetAssetDirectory(AmUInt8 kind)
+    {
+        switch (kind)
+        {
+        case eSoundBankAssetKind_Rtpc:
+            return AM_OS_STRING("rtpc");
+        case eSoundBankAssetKind_Effect:
+            return AM_OS_STRING("effects");
+        case eSoundBankAssetKind_Switch:
+            return AM_OS_STRING("switches");
+        case eSoundBankAssetKind_Attenuation:
+            return AM_OS_STRING("attenuators");
+        case eSoundBankAssetKind_Sound:
+            return AM_OS_STRING("sounds");
+        case eSoundBankAssetKind_Collection:
+            return AM_OS_STRING("collections");
+        case eSoundBankAssetKind_SwitchContainer:
+            return AM_OS_STRING("switch_containers");
+        case eSoundBankAssetKind_Event:
+            return AM_OS_STRING("events");
+        default:
+            return AM_OS_STRING("");
+        }
+    }
+
+    static const char* GetAssetKindName(AmUInt8 kind)
+    {
+        switch (kind)
+        {
+        case eSoundBankAssetKind_Rtpc:
+            return "RTPC";
+        case eSoundBankAssetKind_Effect:
+            return "effect";
+        case eSoundBankAssetKind_Switch:
+            return "switch";
+        case eSoundBankAssetKind_Attenuation:
+            return "attenuation";
+        case eSoundBankAssetKind_Sound:
+            return "sound";
+        case eSoundBankAssetKind_Collection:
+            return "collection";
+        case eSoundBankAssetKind_SwitchContainer:
+            return "switch container";
+        case eSoundBankAssetKind_Event:
+            return "event";
+        default:
+            return "asset";
+        }
+    }
+
+    static bool IsCompiledSoundBank(const void* data, AmSize size)
+    {
+        return data != nullptr && size >= sizeof(flatbuffers::uoffset_t) + flatbuffers::kFileIdentifierLength &&
+            CompiledSoundBankDefinitionBufferHasIdentifier(data);
+    }
+
+    template<typename T>
+    static bool VerifyCompiledAssets(const flatbuffers::Vector<flatbuffers::Offset<CompiledAssetDefinition>>* assets)
+    {
+        if (assets == nullptr)
+            return true;
+
+        for (const CompiledAssetDefinition* asset : *assets)
+        {
+            if (asset->filename() == nullptr || asset->data() == nullptr)
+                return false;
+
+            flatbuffers::Verifier verifier(asset->data()->data(), asset->data()->size());
+            if (!verifier.VerifyBuffer<T>(nullptr))
+                return false;
+
+            // Assets are found by ID with a binary search, so each one must be reachable through its definition ID
+            if (assets->LookupByKey(flatbuffers::GetRoot<T>(asset->data()->data())->id()) != asset)
+                return false;
+        }
+
+        return true;
+    }
+
+    // Compiled sound banks are verified once when loaded, so their assets can be read in place afterward
+    static bool VerifyCompiledSoundBank(const void* data, AmSize size)
+    {
+        flatbuffers::Verifier verifier(static_cast<const AmUInt8*>(data), size);
+        if (!VerifyCompiledSoundBankDefinitionBuffer(verifier))
+            return false;
+
+        const CompiledSoundBankDefinition* compiled = GetCompiledSoundBankDefinition(data);
+
+        return compiled->bank_nested_root() != nullptr && VerifyCompiledAssets<RtpcDefinition>(compiled->rtpc()) &&
+            VerifyCompiledAssets<EffectDefinition>(compiled->effects()) && VerifyCompiledAssets<SwitchDefinition>(compiled->switches()) &&
+            VerifyCompiledAssets<AttenuationDefinition>(compiled->attenuators()) &&
+            VerifyCompiledAssets<SoundDefinition>(compiled->sounds()) && VerifyCompiledAssets<CollectionDefinition>(compiled->collections()) &&
+            VerifyCompiledAssets<SwitchContainerDefinition>(compiled->switch_containers()) &&
+            VerifyCompiledAssets<EventDefinition>(compiled->events());
+    }
+
+    template<typename T>
+    static bool LoadAssetDefinition(
+        T* asset, const AmOsString& directory, const AmOsString& filename, const AssetDefinitionSource& source, const EngineImpl* engine)
+    {
+        if (source.m_Data != nullptr)
+            return asset->LoadDefinitionFromMemory(source.m_Data, source.m_Owner, engine->GetState());
+
+        const FileSystem* fs = engine->GetFileSystem();
+        const AmOsString& filePath = fs->ResolvePath(fs->Join({ directory, filename }));
+
+        return asset->LoadDefinitionFromPath(filePath, engine->GetState());
+    }
+
+    static bool InitializeSwitchContainer(const AmOsString& filename, const EngineImpl* engine, const AssetDefinitionSource& source = {})
     {
         // Find the ID.
         if (SwitchContainerHandle handle = engine->GetSwitchContainerHandleFromFile(filename))
@@ -57,13 +208,10 @@ namespace SparkyStudios::Audio::Amplitude
         }
         else
         {
-            const FileSystem* fs = engine->GetFileSystem();
-            const AmOsString& filePath = fs->ResolvePath(fs->Join({ AM_OS_STRING("switch_containers"), filename }));
-
             // This is a new switch container, load it and update it.
             AmUniquePtr<eMemoryPoolKind_Engine, SwitchContainerImpl> switch_container(
                 ampoolnew(eMemoryPoolKind_Engine, SwitchContainerImpl));
-            if (!switch_container->LoadDefinitionFromPath(filePath, engine->GetState()))
+            if (!LoadAssetDefinition(switch_container.get(), AM_OS_STRING("switch_containers"), filename, source, engine))
                 return false;
 
             const SwitchContainerDefinition* definition = switch_container->GetDefinition();
@@ -84,7 +232,7 @@ namespace SparkyStudios::Audio::Amplitude
         return true;
     }
 
-    static bool InitializeCollection(const AmOsString& filename, const EngineImpl* engine)
+    static bool InitializeCollection(const AmOsString& filename, const EngineImpl* engine, const AssetDefinitionSource& source = {})
     {
         // Find the ID.
         if (CollectionHandle handle = engine->GetCollectionHandleFromFile(filename))
@@ -94,12 +242,9 @@ namespace SparkyStudios::Audio::Amplitude
         }
         else
         {
-            const FileSystem* fs = engine->GetFileSystem();
-            const AmOsString& filePath = fs->ResolvePath(fs->Join({ AM_OS_STRING("collections"), filename }));
-
             // This is a new collection, load it and update it.
             AmUniquePtr<eMemoryPoolKind_Engine, CollectionImpl> collection(ampoolnew(eMemoryPoolKind_Engine, CollectionImpl));
-            if (!collection->LoadDefinitionFromPath(filePath, engine->GetState()))
+            if (!LoadAssetDefinition(collection.get(), AM_OS_STRING("collections"), filename, source, engine))
                 return false;
 
             const CollectionDefinition* definition = collection->GetDefinition();
@@ -120,7 +265,8 @@ namespace SparkyStudios::Audio::Amplitude
         return true;
     }
 
-    static bool InitializeSound(const AmOsString& filename, const EngineImpl* engine, AmSoundID& outId)
+    static bool InitializeSound(
+        const AmOsString& filename, const EngineImpl* engine, AmSoundID& outId, const AssetDefinitionSource& source = {})
     {
         // Find the ID
         if (SoundHandle handle = engine->GetSoundHandleFromFile(filename))
@@ -130,12 +276,9 @@ namespace SparkyStudios::Audio::Amplitude
         }
         else
         {
-            const FileSystem* fs = engine->GetFileSystem();
-            const AmOsString& filePath = fs->ResolvePath(fs->Join({ AM_OS_STRING("sounds"), filename }));
-
             // This is a new sound, load it and update it.
             AmUniquePtr<eMemoryPoolKind_Engine, SoundImpl> sound(ampoolnew(eMemoryPoolKind_Engine, SoundImpl));
-            if (!sound->LoadDefinitionFromPath(filePath, engine->GetState()))
+            if (!LoadAssetDefinition(sound.get(), AM_OS_STRING("sounds"), filename, source, engine))
                 return false;
 
             const SoundDefinition* definition = sound->GetDefinition();
@@ -158,7 +301,7 @@ namespace SparkyStudios::Audio::Amplitude
         return true;
     }
 
-    static bool InitializeEvent(const AmOsString& filename, const EngineImpl* engine)
+    static bool InitializeEvent(const AmOsString& filename, const EngineImpl* engine, const AssetDefinitionSource& source = {})
     {
         // Find the ID.
         if (EventHandle handle = engine->GetEventHandleFromFile(filename))
@@ -168,12 +311,9 @@ namespace SparkyStudios::Audio::Amplitude
         }
         else
         {
-            const FileSystem* fs = engine->GetFileSystem();
-            const AmOsString& filePath = fs->ResolvePath(fs->Join({ AM_OS_STRING("events"), filename }));
-
             // This is a new event, load it and update it.
             AmUniquePtr<eMemoryPoolKind_Engine, EventImpl> event(ampoolnew(eMemoryPoolKind_Engine, EventImpl));
-            if (!event->LoadDefinitionFromPath(filePath, engine->GetState()))
+            if (!LoadAssetDefinition(event.get(), AM_OS_STRING("events"), filename, source, engine))
                 return false;
 
             const EventDefinition* definition = event->GetDefinition();
@@ -194,7 +334,7 @@ namespace SparkyStudios::Audio::Amplitude
         return true;
     }
 
-    static bool InitializeAttenuation(const AmOsString& filename, const EngineImpl* engine)
+    static bool InitializeAttenuation(const AmOsString& filename, const EngineImpl* engine, const AssetDefinitionSource& source = {})
     {
         // Find the ID.
         if (AttenuationHandle handle = engine->GetAttenuationHandleFromFile(filename))
@@ -204,12 +344,9 @@ namespace SparkyStudios::Audio::Amplitude
         }
         else
         {
-            const FileSystem* fs = engine->GetFileSystem();
-            const AmOsString& filePath = fs->ResolvePath(fs->Join({ AM_OS_STRING("attenuators"), filename }));
-
             // This is a new event, load it and update it.
             AmUniquePtr<eMemoryPoolKind_Engine, AttenuationImpl> attenuation(ampoolnew(eMemoryPoolKind_Engine, AttenuationImpl));
-            if (!attenuation->LoadDefinitionFromPath(filePath, engine->GetState()))
+            if (!LoadAssetDefinition(attenuation.get(), AM_OS_STRING("attenuators"), filename, source, engine))
                 return false;
 
             const AttenuationDefinition* definition = attenuation->GetDefinition();
@@ -230,7 +367,7 @@ namespace SparkyStudios::Audio::Amplitude
         return true;
     }
 
-    static bool InitializeSwitch(const AmOsString& filename, const EngineImpl* engine)
+    static bool InitializeSwitch(const AmOsString& filename, const EngineImpl* engine, const AssetDefinitionSource& source = {})
     {
         // Find the ID.
         if (SwitchHandle handle = engine->GetSwitchHandleFromFile(filename))
@@ -240,12 +377,9 @@ namespace SparkyStudios::Audio::Amplitude
         }
         else
         {
-            const FileSystem* fs = engine->GetFileSystem();
-            const AmOsString& filePath = fs->ResolvePath(fs->Join({ AM_OS_STRING("switches"), filename }));
-
             // This is a new event, load it and update it.
             AmUniquePtr<eMemoryPoolKind_Engine, SwitchImpl> _switch(ampoolnew(eMemoryPoolKind_Engine, SwitchImpl));
-            if (!_switch->LoadDefinitionFromPath(filePath, engine->GetState()))
+            if (!LoadAssetDefinition(_switch.get(), AM_OS_STRING("switches"), filename, source, engine))
             {
                 return false;
             }
@@ -268,7 +402,7 @@ namespace SparkyStudios::Audio::Amplitude
         return true;
     }
 
-    static bool InitializeRtpc(const AmOsString& filename, const EngineImpl* engine)
+    static bool InitializeRtpc(const AmOsString& filename, const EngineImpl* engine, const AssetDefinitionSource& source = {})
     {
         // Find the ID.
         if (RtpcHandle handle = engine->GetRtpcHandleFromFile(filename))
@@ -278,12 +412,9 @@ namespace SparkyStudios::Audio::Amplitude
         }
         else
         {
-            const FileSystem* fs = engine->GetFileSystem();
-            const AmOsString& filePath = fs->ResolvePath(fs->Join({ AM_OS_STRING("rtpc"), filename }));
-
             // This is a new rtpc, load it and update it.
             AmUniquePtr<eMemoryPoolKind_Engine, RtpcImpl> rtpc(ampoolnew(eMemoryPoolKind_Engine, RtpcImpl));
-            if (!rtpc->LoadDefinitionFromPath(filePath, engine->GetState()))
+            if (!LoadAssetDefinition(rtpc.get(), AM_OS_STRING("rtpc"), filename, source, engine))
             {
                 return false;
             }
@@ -306,7 +437,7 @@ namespace SparkyStudios::Audio::Amplitude
         return true;
     }
 
-    static bool InitializeEffect(const AmOsString& filename, const EngineImpl* engine)
+    static bool InitializeEffect(const AmOsString& filename, const EngineImpl* engine, const AssetDefinitionSource& source = {})
     {
         // Find the ID.
         if (EffectHandle handle = engine->GetEffectHandleFromFile(filename))
@@ -316,12 +447,9 @@ namespace SparkyStudios::Audio::Amplitude
         }
         else
         {
-            const FileSystem* fs = engine->GetFileSystem();
-            const AmOsString& filePath = fs->ResolvePath(fs->Join({ AM_OS_STRING("effects"), filename }));
-
             // This is a new effect, load it and update it.
             AmUniquePtr<eMemoryPoolKind_Engine, EffectImpl> effect(ampoolnew(eMemoryPoolKind_Engine, EffectImpl));
-            if (!effect->LoadDefinitionFromPath(filePath, engine->GetState()))
+            if (!LoadAssetDefinition(effect.get(), AM_OS_STRING("effects"), filename, source, engine))
             {
                 return false;
             }
@@ -346,10 +474,7 @@ namespace SparkyStudios::Audio::Amplitude
 
     bool SoundBank::Initialize(const AmOsString& filename, Engine* engine)
     {
-        const FileSystem* fs = engine->GetFileSystem();
-        const AmOsString& filePath = fs->ResolvePath(fs->Join({ AM_OS_STRING("soundbanks"), filename }));
-
-        if (!LoadFile(fs->OpenFile(filePath), &_soundBankDefSource))
+        if (!LoadSource(filename, engine))
             return false;
 
         return InitializeInternal(engine);
@@ -365,6 +490,20 @@ namespace SparkyStudios::Audio::Amplitude
         return InitializeInternal(engine);
     }
 
+    bool SoundBank::Prepare(const AmOsString& filename, const Engine* engine)
+    {
+        if (!LoadSource(filename, engine))
+            return false;
+
+        QueueAssets();
+
+        // Compiled sound banks already hold the definition data of their assets
+        if (_compiledSource != nullptr)
+            return true;
+
+        return ReadPendingDefinitions(engine);
+    }
+
     static bool DeinitializeSwitchContainer(const AmOsString& filename, EngineInternalState* state)
     {
         const auto id_iter = state->switch_container_id_map.find(filename);
@@ -533,90 +672,101 @@ namespace SparkyStudios::Audio::Amplitude
         return true;
     }
 
+    static bool DeinitializeAsset(AmUInt8 kind, const AmOsString& filename, EngineInternalState* state)
+    {
+        switch (kind)
+        {
+        case eSoundBankAssetKind_Rtpc:
+            return DeinitializeRtpc(filename, state);
+        case eSoundBankAssetKind_Effect:
+            return DeinitializeEffect(filename, state);
+        case eSoundBankAssetKind_Switch:
+            return DeinitializeSwitch(filename, state);
+        case eSoundBankAssetKind_Attenuation:
+            return DeinitializeAttenuation(filename, state);
+        case eSoundBankAssetKind_Sound:
+            return DeinitializeSound(filename, state);
+        case eSoundBankAssetKind_Collection:
+            return DeinitializeCollection(filename, state);
+        case eSoundBankAssetKind_SwitchContainer:
+            return DeinitializeSwitchContainer(filename, state);
+        case eSoundBankAssetKind_Event:
+            return DeinitializeEvent(filename, state);
+        default:
+            return false;
+        }
+    }
+
     void SoundBank::Deinitialize(Engine* engine)
     {
-        auto* engineImpl = static_cast<EngineImpl*>(engine);
+        BeginDeinitialize();
+
+        while (GetPendingAssetCount() > 0)
+            DeinitializeNextAsset(engine);
+    }
+
+    void SoundBank::BeginDeinitialize()
+    {
         const SoundBankDefinition* definition = GetSoundBankDefinition();
 
-        for (flatbuffers::uoffset_t i = 0; i < definition->events()->size(); ++i)
-        {
-            AmString filename = definition->events()->Get(i)->str();
-            if (!DeinitializeEvent(AM_STRING_TO_OS_STRING(filename), engineImpl->GetState()))
-            {
-                amLogError("Error while deinitializing event %s in sound bank.", filename.c_str());
-                AMPLITUDE_ASSERT(false);
-            }
-        }
+        _pendingAssets.clear();
+        _nextPendingAsset = 0;
 
-        for (flatbuffers::uoffset_t i = 0; i < definition->switch_containers()->size(); ++i)
+        // Release assets in the reverse order of their initialization, so that assets are released before the ones they reference.
+        const auto queue = [this](AmUInt8 kind, const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>* filenames)
         {
-            AmString filename = definition->switch_containers()->Get(i)->str();
-            if (!DeinitializeSwitchContainer(AM_STRING_TO_OS_STRING(filename), engineImpl->GetState()))
-            {
-                amLogError("Error while deinitializing switch container %s in sound bank.", filename.c_str());
-                AMPLITUDE_ASSERT(false);
-            }
-        }
+            for (flatbuffers::uoffset_t i = 0; i < filenames->size(); ++i)
+                _pendingAssets.push_back({ kind, AM_STRING_TO_OS_STRING(filenames->Get(i)->str()), nullptr, nullptr });
+        };
+
+        queue(eSoundBankAssetKind_Event, definition->events());
+        queue(eSoundBankAssetKind_SwitchContainer, definition->switch_containers());
+        queue(eSoundBankAssetKind_Collection, definition->collections());
+        queue(eSoundBankAssetKind_Sound, definition->sounds());
+        queue(eSoundBankAssetKind_Attenuation, definition->attenuators());
+        queue(eSoundBankAssetKind_Switch, definition->switches());
+        queue(eSoundBankAssetKind_Effect, definition->effects());
+        queue(eSoundBankAssetKind_Rtpc, definition->rtpc());
+
+        // Sounds not loaded yet are about to be released
+        std::lock_guard lock(_pendingSoundsMutex);
+        std::queue<Sound*>().swap(_pendingSoundsToLoad);
+    }
 
-        for (flatbuffers::uoffset_t i = 0; i < definition->collections()->size(); ++i)
-        {
-            AmString filename = definition->collections()->Get(i)->str();
-            if (!DeinitializeCollection(AM_STRING_TO_OS_STRING(filename), engineImpl->GetState()))
-            {
-                amLogError("Error while deinitializing collection %s in sound bank.", filename.c_str());
-                AMPLITUDE_ASSERT(false);
-            }
-        }
+    void SoundBank::DeinitializeNextAsset(const Engine* engine)
+    {
+        AMPLITUDE_ASSERT(_nextPendingAsset < _pendingAssets.size());
 
-        for (flatbuffers::uoffset_t i = 0; i < definition->sounds()->size(); ++i)
-        {
-            AmString filename = definition->sounds()->Get(i)->str();
-            if (!DeinitializeSound(AM_STRING_TO_OS_STRING(filename), engineImpl->GetState()))
-            {
-                amLogError("Error while deinitializing sound %s in sound bank.", filename.c_str());
-                AMPLITUDE_ASSERT(false);
-            }
-        }
+        const auto* engineImpl = static_cast<const EngineImpl*>(engine);
+        const PendingAsset& asset = _pendingAssets[_nextPendingAsset++];
 
-        for (flatbuffers::uoffset_t i = 0; i < definition->attenuators()->size(); ++i)
+        if (!DeinitializeAsset(asset.m_Kind, asset.m_Filename, engineImpl->GetState()))
         {
-            AmString filename = definition->attenuators()->Get(i)->str();
-            if (!DeinitializeAttenuation(AM_STRING_TO_OS_STRING(filename), engineImpl->GetState()))
-            {
-                amLogError("Error while deinitializing attenuation %s in sound bank.", filename.c_str());
-                AMPLITUDE_ASSERT(false);
-            }
+            amLogError(
+                "Error while deinitializing %s " AM_OS_CHAR_FMT " in sound bank.", GetAssetKindName(asset.m_Kind),
+                asset.m_Filename.c_str());
+            AMPLITUDE_ASSERT(false);
         }
 
-        for (flatbuffers::uoffset_t i = 0; i < definition->switches()->size(); ++i)
+        if (_nextPendingAsset == _pendingAssets.size())
         {
-            AmString filename = definition->switches()->Get(i)->str();
-            if (!DeinitializeSwitch(AM_STRING_TO_OS_STRING(filename), engineImpl->GetState()))
-            {
-                amLogError("Error while deinitializing switch %s in sound bank.", filename.c_str());
-                AMPLITUDE_ASSERT(false);
-            }
+            _pendingAssets.clear();
+            _nextPendingAsset = 0;
         }
+    }
 
-        for (flatbuffers::uoffset_t i = 0; i < definition->effects()->size(); ++i)
-        {
-            AmString filename = definition->effects()->Get(i)->str();
-            if (!DeinitializeEffect(AM_STRING_TO_OS_STRING(filename), engineImpl->GetState()))
-            {
-                amLogError("Error while deinitializing effect %s in sound bank.", filename.c_str());
-                AMPLITUDE_ASSERT(false);
-            }
-        }
+    AmSize SoundBank::GetPendingAssetCount() const
+    {
+        return _pendingAssets.size() - _nextPendingAsset;
+    }
 
-        for (flatbuffers::uoffset_t i = 0; i < definition->rtpc()->size(); ++i)
-        {
-            AmString filename = definition->rtpc()->Get(i)->str();
-            if (!DeinitializeRtpc(AM_STRING_TO_OS_STRING(filename), engineImpl->GetState()))
-            {
-                amLogError("Error while deinitializing RTPC %s in sound bank.", filename.c_str());
-                AMPLITUDE_ASSERT(false);
-            }
-        }
+    AmSize SoundBank::GetAssetCount() const
+    {
+        const SoundBankDefinition* definition = GetSoundBankDefinition();
+
+        return definition->rtpc()->size() + definition->effects()->size() + definition->switches()->size() +
+            definition->attenuators()->size() + definition->sounds()->size() + definition->collections()->size() +
+            definition->switch_containers()->size() + definition->events()->size();
     }
 
     AmBankID SoundBank::GetId() const
@@ -631,6 +781,9 @@ namespace SparkyStudios::Audio::Amplitude
 
     const SoundBankDefinition* SoundBank::GetSoundBankDefinition() const
     {
+        if (_compiledSource != nullptr)
+            return GetCompiledSoundBankDefinition(_compiledSource.get())->bank_nested_root();
+
         return Amplitude::GetSoundBankDefinition(_soundBankDefSource.c_str());
     }
 
@@ -641,86 +794,236 @@ namespace SparkyStudios::Audio::Amplitude
 
     void SoundBank::LoadSoundFiles(const Engine* engine)
     {
-        const auto* engineImpl = static_cast<const EngineImpl*>(engine);
+        while (LoadNextSoundFile(engine))
+        {}
+    }
+
+    bool SoundBank::LoadNextSoundFile(const Engine* engine)
+    {
+        Sound* sound = nullptr;
 
-        while (!_pendingSoundsToLoad.empty())
         {
-            const auto id = _pendingSoundsToLoad.front();
+            std::lock_guard lock(_pendingSoundsMutex);
+
+            if (_pendingSoundsToLoad.empty())
+                return false;
+
+            sound = _pendingSoundsToLoad.front();
             _pendingSoundsToLoad.pop();
+        }
 
-            if (!engineImpl->GetState()->sound_map.contains(id))
-                continue;
+        static_cast<SoundImpl*>(sound)->Load(engine->GetFileSystem());
+        return true;
+    }
+
+    AmSize SoundBank::GetPendingSoundFileCount() const
+    {
+        std::lock_guard lock(_pendingSoundsMutex);
+        return _pendingSoundsToLoad.size();
+    }
+
+    bool SoundBank::LoadSource(const AmOsString& filename, const Engine* engine)
+    {
+        const FileSystem* fs = engine->GetFileSystem();
+        const AmOsString& filePath = fs->ResolvePath(fs->Join({ AM_OS_STRING("soundbanks"), filename }));
+
+        const auto file = fs->OpenFile(filePath);
+        if (file == nullptr)
+            return false;
 
-            engineImpl->GetState()->sound_map[id]->Load(engineImpl->GetFileSystem());
+        // Use compiled sound banks in place when the file content is already in memory
+        if (file->IsValid() && file->IsMemoryBacked() && IsCompiledSoundBank(file->GetPtr(), file->Length()) &&
+            reinterpret_cast<AmUIntPtr>(file->GetPtr()) % kDefinitionDataAlignment == 0)
+        {
+            if (!VerifyCompiledSoundBank(file->GetPtr(), file->Length()))
+            {
+                amLogError("The compiled sound bank " AM_OS_CHAR_FMT " is corrupted.", filePath.c_str());
+                return false;
+            }
+
+            _compiledSource = std::shared_ptr<const char>(file, static_cast<const char*>(file->GetPtr()));
+            return true;
         }
+
+        if (!LoadFile(file, &_soundBankDefSource))
+            return false;
+
+        if (IsCompiledSoundBank(_soundBankDefSource.data(), _soundBankDefSource.size()))
+        {
+            if (!VerifyCompiledSoundBank(_soundBankDefSource.data(), _soundBankDefSource.size()))
+            {
+                amLogError("The compiled sound bank " AM_OS_CHAR_FMT " is corrupted.", filePath.c_str());
+                _soundBankDefSource.clear();
+                return false;
+            }
+
+            const auto source = std::make_shared<AmString>(std::move(_soundBankDefSource));
+            _soundBankDefSource.clear();
+
+            _compiledSource = std::shared_ptr<const char>(source, source->data());
+        }
+
+        return true;
     }
 
     bool SoundBank::InitializeInternal(Engine* engine)
     {
         bool success = true;
+
+        QueueAssets();
+
+        while (success && GetPendingAssetCount() > 0)
+            success &= IntegrateNextAsset(engine);
+
+        return success;
+    }
+
+    void SoundBank::QueueAssets()
+    {
         const SoundBankDefinition* definition = GetSoundBankDefinition();
 
         _id = definition->id();
         _name = definition->name()->str();
 
-        auto* engineImpl = static_cast<EngineImpl*>(engine);
+        _pendingAssets.clear();
+        _nextPendingAsset = 0;
 
-        // Load each Rtpc named in the sound bank.
-        for (flatbuffers::uoffset_t i = 0; success && i < definition->rtpc()->size(); ++i)
+        // Assets are initialized after the ones they may reference.
+        if (_compiledSource != nullptr)
         {
-            AmString filename = definition->rtpc()->Get(i)->str();
-            success &= InitializeRtpc(AM_STRING_TO_OS_STRING(filename), engineImpl);
+            const auto queue = [this](AmUInt8 kind, const flatbuffers::Vector<flatbuffers::Offset<CompiledAssetDefinition>>* assets)
+            {
+                if (assets == nullptr)
+                    return;
+
+                for (flatbuffers::uoffset_t i = 0; i < assets->size(); ++i)
+                {
+                    const CompiledAssetDefinition* asset = assets->Get(i);
+                    _pendingAssets.push_back({ kind, AM_STRING_TO_OS_STRING(asset->filename()->str()),
+                                               reinterpret_cast<const char*>(asset->data()->data()), _compiledSource });
+                }
+            };
+
+            const CompiledSoundBankDefinition* compiled = GetCompiledSoundBankDefinition(_compiledSource.get());
+
+            queue(eSoundBankAssetKind_Rtpc, compiled->rtpc());
+            queue(eSoundBankAssetKind_Effect, compiled->effects());
+            queue(eSoundBankAssetKind_Switch, compiled->switches());
+            queue(eSoundBankAssetKind_Attenuation, compiled->attenuators());
+            queue(eSoundBankAssetKind_Sound, compiled->sounds());
+            queue(eSoundBankAssetKind_Collection, compiled->collections());
+            queue(eSoundBankAssetKind_SwitchContainer, compiled->switch_containers());
+            queue(eSoundBankAssetKind_Event, compiled->events());
         }
-
-        // Load each effect named in the sound bank.
-        for (flatbuffers::uoffset_t i = 0; success && i < definition->effects()->size(); ++i)
+        else
         {
-            AmString filename = definition->effects()->Get(i)->str();
-            success &= InitializeEffect(AM_STRING_TO_OS_STRING(filename), engineImpl);
+            const auto queue = [this](AmUInt8 kind, const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>* filenames)
+            {
+                for (flatbuffers::uoffset_t i = 0; i < filenames->size(); ++i)
+                    _pendingAssets.push_back({ kind, AM_STRING_TO_OS_STRING(filenames->Get(i)->str()), nullptr, nullptr });
+            };
+
+            queue(eSoundBankAssetKind_Rtpc, definition->rtpc());
+            queue(eSoundBankAssetKind_Effect, definition->effects());
+            queue(eSoundBankAssetKind_Switch, definition->switches());
+            queue(eSoundBankAssetKind_Attenuation, definition->attenuators());
+            queue(eSoundBankAssetKind_Sound, definition->sounds());
+            queue(eSoundBankAssetKind_Collection, definition->collections());
+            queue(eSoundBankAssetKind_SwitchContainer, definition->switch_containers());
+            queue(eSoundBankAssetKind_Event, definition->events());
         }
+    }
 
-        // Load each Switch named in the sound bank.
-        for (flatbuffers::uoffset_t i = 0; success && i < definition->switches()->size(); ++i)
-        {
-            AmString switch_filename = definition->switches()->Get(i)->str();
-            success &= InitializeSwitch(AM_STRING_TO_OS_STRING(switch_filename), engineImpl);
-        }
+    bool SoundBank::ReadPendingDefinitions(const Engine* engine)
+    {
+        const FileSystem* fs = engine->GetFileSystem();
 
-        // Load each Attenuation named in the sound bank.
-        for (flatbuffers::uoffset_t i = 0; success && i < definition->attenuators()->size(); ++i)
+        for (auto& asset : _pendingAssets)
         {
-            AmString attenuation_filename = definition->attenuators()->Get(i)->str();
-            success &= InitializeAttenuation(AM_STRING_TO_OS_STRING(attenuation_filename), engineImpl);
-        }
+            const AmOsString& filePath = fs->ResolvePath(fs->Join({ GetAssetDirectory(asset.m_Kind), asset.m_Filename }));
 
-        // Load each Sound named in the sound bank.
-        for (flatbuffers::uoffset_t i = 0; success && i < definition->sounds()->size(); ++i)
-        {
-            AmSoundID id = kAmInvalidObjectId;
-            AmString filename = definition->sounds()->Get(i)->str();
-            success &= InitializeSound(AM_STRING_TO_OS_STRING(filename), engineImpl, id);
-            _pendingSoundsToLoad.push(id);
-        }
+            const auto file = fs->OpenFile(filePath);
+            if (file == nullptr || !file->IsValid())
+            {
+                amLogError("Cannot open the %s definition file '" AM_OS_CHAR_FMT "'.", GetAssetKindName(asset.m_Kind), filePath.c_str());
+                return false;
+            }
 
-        // Load each Collection named in the sound bank.
-        for (flatbuffers::uoffset_t i = 0; success && i < definition->collections()->size(); ++i)
-        {
-            AmString sound_filename = definition->collections()->Get(i)->str();
-            success &= InitializeCollection(AM_STRING_TO_OS_STRING(sound_filename), engineImpl);
+            // Use the definition in place when the file content is already in memory
+            if (file->IsMemoryBacked() && file->Length() > 0 &&
+                reinterpret_cast<AmUIntPtr>(file->GetPtr()) % kDefinitionDataAlignment == 0)
+            {
+                asset.m_Data = static_cast<const char*>(file->GetPtr());
+                asset.m_Owner = file;
+                continue;
+            }
+
+            const auto source = std::make_shared<AmString>();
+            if (!LoadFile(file, source.get()))
+                return false;
+
+            asset.m_Data = source->c_str();
+            asset.m_Owner = source;
         }
 
-        // Load each SwitchContainer named in the sound bank.
-        for (flatbuffers::uoffset_t i = 0; success && i < definition->switch_containers()->size(); ++i)
+        return true;
+    }
+
+    bool SoundBank::IntegrateNextAsset(const Engine* engine)
+    {
+        AMPLITUDE_ASSERT(_nextPendingAsset < _pendingAssets.size());
+
+        const auto* engineImpl = static_cast<const EngineImpl*>(engine);
+        const PendingAsset& asset = _pendingAssets[_nextPendingAsset++];
+        const AssetDefinitionSource source{ asset.m_Data, asset.m_Owner };
+
+        bool success = false;
+
+        switch (asset.m_Kind)
         {
-            AmString filename = definition->switch_containers()->Get(i)->str();
-            success &= InitializeSwitchContainer(AM_STRING_TO_OS_STRING(filename), engineImpl);
+        case eSoundBankAssetKind_Rtpc:
+            success = InitializeRtpc(asset.m_Filename, engineImpl, source);
+            break;
+        case eSoundBankAssetKind_Effect:
+            success = InitializeEffect(asset.m_Filename, engineImpl, source);
+            break;
+        case eSoundBankAssetKind_Switch:
+            success = InitializeSwitch(asset.m_Filename, engineImpl, source);
+            break;
+        case eSoundBankAssetKind_Attenuation:
+            success = InitializeAttenuation(asset.m_Filename, engineImpl, source);
+            break;
+        case eSoundBankAssetKind_Sound:
+            {
+                AmSoundID id = kAmInvalidObjectId;
+                success = InitializeSound(asset.m_Filename, engineImpl, id, source);
+
+                // Only newly loaded sounds need their file to be loaded
+                if (success && id != kAmInvalidObjectId)
+                {
+                    std::lock_guard lock(_pendingSoundsMutex);
+                    _pendingSoundsToLoad.push(engineImpl->GetSoundHandle(id));
+                }
+            }
+            break;
+        case eSoundBankAssetKind_Collection:
+            success = InitializeCollection(asset.m_Filename, engineImpl, source);
+            break;
+        case eSoundBankAssetKind_SwitchContainer:
+            success = InitializeSwitchContainer(asset.m_Filename, engineImpl, source);
+            break;
+        case eSoundBankAssetKind_Event:
+            success = InitializeEvent(asset.m_Filename, engineImpl, source);
+            break;
+        default:
+            break;
         }
 
-        // Load each Event named in the sound bank.
-        for (flatbuffers::uoffset_t i = 0; success && i < definition->events()->size(); ++i)
+        // Release the definition data not retained by the loaded assets
+        if (_nextPendingAsset == _pendingAssets.size())
         {
-            AmString event_filename = definition->events()->Get(i)->str();
-            success &= InitializeEvent(AM_STRING_TO_OS_STRING(event_filename), engineImpl);
+            _pendingAssets.clear();
+            _nextPendingAsset = 0;
         }
 
         return success;
@@ -121,6 +121,6 @@ namespace SparkyStudios::Audio::Amplitude
 
     const SwitchDefinition* SwitchImpl::GetDefinition() const
     {
-        return GetSwitchDefinition(m_source.c_str());
+        return GetSwitchDefinition(GetSource());
     }
 } // namespace SparkyStudios::Audio::Amplitude
@@ -217,7 +217,7 @@ namespace SparkyStudios::Audio::Amplitude
 
     const SwitchContainerDefinition* SwitchContainerImpl::GetDefinition() const
     {
-        return GetSwitchContainerDefinition(m_source.c_str());
+        return GetSwitchContainerDefinition(GetSource());
     }
 
     void SwitchContainerImpl::AcquireReferences(EngineInternalState* state)
@@ -24,30 +24,48 @@
 #include <cassert>
 #include <cmath>
 #include <cstring>
+#include <map>
+#include <mutex>
 
+// Platform backends, only built in when enabled
 #if defined(AM_FFT_INTEL_IPP)
 #define AM_FFT_INTEL_IPP_USED
 #include <ipp.h>
-#elif defined(AM_FFT_APPLE_ACCELERATE)
+#endif
+
+#if defined(AM_FFT_APPLE_ACCELERATE)
 #define AM_FFT_APPLE_ACCELERATE_USED
 #include <Accelerate/Accelerate.h>
-#include <vector>
-#elif defined(AM_FFT_FFTW3)
+#endif
+
+#if defined(AM_FFT_FFTW3)
 #define AM_FFT_FFTW3_USED
 #include <fftw3.h>
-#elif defined(AM_FFT_OOURA)
-#define AM_FFT_OOURA_USED
-#include <vector>
-#else
-#if !defined(AM_FFT_PFFFT)
-#define AM_FFT_PFFFT
 #endif
+
+// Portable backends, always built in
+#define AM_FFT_OOURA_USED
 #define AM_FFT_PFFFT_USED
 #if defined(AM_SIMD_ARCH_NEON)
 #define PFFFT_ENABLE_NEON
 #endif
 #include <Utils/pffft/pffft.h>
+
 #include <vector>
+
+// Backend used when none is requested
+#if defined(AM_FFT_PFFFT)
+#define AM_FFT_BUILD_BACKEND eFFTBackend_PFFFT
+#elif defined(AM_FFT_OOURA)
+#define AM_FFT_BUILD_BACKEND eFFTBackend_Ooura
+#elif defined(AM_FFT_INTEL_IPP_USED)
+#define AM_FFT_BUILD_BACKEND eFFTBackend_IntelIPP
+#elif defined(AM_FFT_APPLE_ACCELERATE_USED)
+#define AM_FFT_BUILD_BACKEND eFFTBackend_AppleAccelerate
+#elif defined(AM_FFT_FFTW3_USED)
+#define AM_FFT_BUILD_BACKEND eFFTBackend_FFTW3
+#else
+#define AM_FFT_BUILD_BACKEND eFFTBackend_PFFFT
 #endif
 
 namespace SparkyStudios::Audio::Amplitude
@@ -91,6 +109,50 @@ namespace SparkyStudios::Audio::Amplitude
             }
         }
 
+        /**
+         * @brief The part of an FFT implementation which only depends on the backend and the size
+         * (setup, twiddle factors, etc.).
+         *
+         * Plans are never modified once created, so they are shared by every instance transforming
+         * the same size with the same backend, each instance only owning its work buffers.
+         */
+        class AudioFFTPlan
+        {
+        public:
+            AudioFFTPlan() = default;
+            AudioFFTPlan(const AudioFFTPlan&) = delete;
+            AudioFFTPlan& operator=(const AudioFFTPlan&) = delete;
+            virtual ~AudioFFTPlan() = default;
+        };
+
+        struct AudioFFTPlanCache
+        {
+            std::mutex m_Mutex;
+            std::map<std::pair<eFFTBackend, size_t>, std::shared_ptr<const AudioFFTPlan>> m_Plans;
+        };
+
+        static AudioFFTPlanCache& GetPlanCache()
+        {
+            static AudioFFTPlanCache cache;
+            return cache;
+        }
+
+        /**
+         * @brief Gets the plan of the given backend and size, creating it with the given factory on first use.
+         */
+        template<typename Plan, typename Factory>
+        std::shared_ptr<const Plan> AcquirePlan(eFFTBackend backend, size_t size, Factory&& factory)
+        {
+            AudioFFTPlanCache& cache = GetPlanCache();
+            std::lock_guard lock(cache.m_Mutex);
+
+            auto& plan = cache.m_Plans[{ backend, size }];
+            if (plan == nullptr)
+                plan = factory();
+
+            return std::static_pointer_cast<const Plan>(plan);
+        }
+
     } // End of namespace detail
 
     // ================================================================
@@ -104,6 +166,20 @@ namespace SparkyStudios::Audio::Amplitude
      */
     class PFFFT : public detail::AudioFFTImpl
     {
+        struct Plan final : detail::AudioFFTPlan
+        {
+            explicit Plan(size_t size)
+                : m_Setup(pffft_new_setup(static_cast<int>(size), PFFFT_REAL))
+            {}
+
+            ~Plan() override
+            {
+                pffft_destroy_setup(m_Setup);
+            }
+
+            PFFFT_Setup* m_Setup;
+        };
+
     public:
         PFFFT()
             : detail::AudioFFTImpl()
@@ -112,6 +188,12 @@ namespace SparkyStudios::Audio::Amplitude
         PFFFT(const PFFFT&) = delete;
         PFFFT& operator=(const PFFFT&) = delete;
 
+        static bool supports(size_t size)
+        {
+            // The SIMD code paths need at least 32 values, use the same limit everywhere for consistency
+            return size >= 32 && pffft_is_valid_size(static_cast<int>(size), PFFFT_REAL);
+        }
+
         ~PFFFT() override
         {
             init(0);
@@ -119,11 +201,7 @@ namespace SparkyStudios::Audio::Amplitude
 
         void init(size_t size) override
         {
-            if (_pffft_setup != nullptr)
-            {
-                pffft_destroy_setup(_pffft_setup);
-                _pffft_setup = nullptr;
-            }
+            _plan.reset();
 
             if (_buffer != nullptr)
             {
@@ -142,7 +220,13 @@ namespace SparkyStudios::Audio::Amplitude
             if (_size == 0)
                 return;
 
-            _pffft_setup = pffft_new_setup(_size, PFFFT_REAL);
+            _plan = detail::AcquirePlan<Plan>(
+                eFFTBackend_PFFFT, _size,
+                [size]()
+                {
+                    return std::make_shared<Plan>(size);
+                });
+
             _buffer = static_cast<float*>(pffft_aligned_malloc(_size * sizeof(float)));
             _scratch = static_cast<float*>(pffft_aligned_malloc(_size * sizeof(float)));
         }
@@ -151,19 +235,23 @@ namespace SparkyStudios::Audio::Amplitude
         {
             detail::ConvertBuffer(_buffer, data, _size);
 
-            pffft_transform_ordered(_pffft_setup, _buffer, _buffer, _scratch, PFFFT_FORWARD);
+            pffft_transform_ordered(_plan->m_Setup, _buffer, _buffer, _scratch, PFFFT_FORWARD);
 
-            // Convert back to split-complex
+            // Convert back to split-complex. PFFFT packs the real DC and Nyquist values in the first pair.
             {
-                float* b = _buffer;
-                float* bEnd = b + _size;
-                float* r = re;
-                float* i = im;
-                while (b != bEnd)
+                const size_t half = _size / 2;
+
+                re[0] = _buffer[0];
+                im[0] = 0.0f;
+
+                for (size_t k = 1; k < half; ++k)
                 {
-                    *r++ = *b++;
-                    *i++ = *b++;
+                    re[k] = _buffer[2 * k];
+                    im[k] = _buffer[2 * k + 1];
                 }
+
+                re[half] = _buffer[1];
+                im[half] = 0.0f;
             }
         }
 
@@ -171,37 +259,32 @@ namespace SparkyStudios::Audio::Amplitude
         {
             // Convert into the format as required by the PFFFT
             {
-                float* b = _buffer;
-                float* bEnd = b + _size;
-                const float* r = re;
-                const float* i = im;
-                while (b != bEnd)
+                const size_t half = _size / 2;
+
+                _buffer[0] = re[0];
+                _buffer[1] = re[half];
+
+                for (size_t k = 1; k < half; ++k)
                 {
-                    *b++ = *r++;
-                    *b++ = *i++;
+                    _buffer[2 * k] = re[k];
+                    _buffer[2 * k + 1] = im[k];
                 }
             }
 
-            pffft_transform_ordered(_pffft_setup, _buffer, _buffer, _scratch, PFFFT_BACKWARD);
+            pffft_transform_ordered(_plan->m_Setup, _buffer, _buffer, _scratch, PFFFT_BACKWARD);
 
-            // Convert back to split-complex
-            detail::ScaleBuffer(data, _buffer, 2.0f / static_cast<float>(_size), _size);
+            // PFFFT transforms are not scaled
+            detail::ScaleBuffer(data, _buffer, 1.0f / static_cast<float>(_size), _size);
         }
 
     private:
         size_t _size = 0;
-        PFFFT_Setup* _pffft_setup = nullptr;
+        std::shared_ptr<const Plan> _plan;
 
         float* _buffer = nullptr;
         float* _scratch = nullptr;
     };
 
-    /**
-     * @internal
-     * @brief Concrete FFT implementation.
-     */
-    typedef PFFFT AudioFFTImplementation;
-
 #endif // AM_FFT_PFFFT_USED
 
     // ================================================================
@@ -215,12 +298,18 @@ namespace SparkyStudios::Audio::Amplitude
      */
     class OouraFFT : public detail::AudioFFTImpl
     {
+        struct Plan final : detail::AudioFFTPlan
+        {
+            std::vector<int> m_Ip;
+            std::vector<double> m_W;
+        };
+
     public:
         OouraFFT()
             : detail::AudioFFTImpl()
             , _size(0)
+            , _plan()
             , _ip()
-            , _w()
             , _buffer()
         {}
 
@@ -229,16 +318,34 @@ namespace SparkyStudios::Audio::Amplitude
 
         virtual void init(size_t size) override
         {
-            if (_size != size)
+            if (_size != size && size == 0)
+            {
+                _plan.reset();
+                _ip.clear();
+                _buffer.clear();
+                _size = 0;
+            }
+            else if (_size != size)
             {
-                _ip.resize(2 + static_cast<int>(std::sqrt(static_cast<double>(size))));
-                _w.resize(size / 2);
+                _plan = detail::AcquirePlan<Plan>(
+                    eFFTBackend_Ooura, size,
+                    [size]()
+                    {
+                        auto plan = std::make_shared<Plan>();
+                        plan->m_Ip.resize(2 + static_cast<int>(std::sqrt(static_cast<double>(size))));
+                        plan->m_W.resize(size / 2);
+
+                        const int size4 = static_cast<int>(size) / 4;
+                        makewt(size4, plan->m_Ip.data(), plan->m_W.data());
+                        makect(size4, plan->m_Ip.data(), plan->m_W.data() + size4);
+
+                        return plan;
+                    });
+
+                // The bit reversal uses the end of ip as a work area, so each instance needs its own copy
+                _ip = _plan->m_Ip;
                 _buffer.resize(size);
                 _size = size;
-
-                const int size4 = static_cast<int>(_size) / 4;
-                makewt(size4, _ip.data(), _w.data());
-                makect(size4, _ip.data(), _w.data() + size4);
             }
         }
 
@@ -247,7 +354,7 @@ namespace SparkyStudios::Audio::Amplitude
             // Convert into the format as required by the Ooura FFT
             detail::ConvertBuffer(_buffer.data(), data, _size);
 
-            rdft(static_cast<int>(_size), +1, _buffer.data(), _ip.data(), _w.data());
+            rdft(static_cast<int>(_size), +1, _buffer.data(), _ip.data(), _plan->m_W.data());
 
             // Convert back to split-complex
             {
@@ -283,7 +390,7 @@ namespace SparkyStudios::Audio::Amplitude
                 _buffer[1] = re[_size / 2];
             }
 
-            rdft(static_cast<int>(_size), -1, _buffer.data(), _ip.data(), _w.data());
+            rdft(static_cast<int>(_size), -1, _buffer.data(), _ip.data(), _plan->m_W.data());
 
             // Convert back to split-complex
             detail::ScaleBuffer(data, _buffer.data(), 2.0 / static_cast<double>(_size), _size);
@@ -291,11 +398,11 @@ namespace SparkyStudios::Audio::Amplitude
 
     private:
         size_t _size;
+        std::shared_ptr<const Plan> _plan;
         std::vector<int> _ip;
-        std::vector<double> _w;
         std::vector<double> _buffer;
 
-        void rdft(int n, int isgn, double* a, int* ip, double* w)
+        void rdft(int n, int isgn, double* a, int* ip, const double* w)
         {
             int nw = ip[0];
             int nc = ip[1];
@@ -335,7 +442,7 @@ namespace SparkyStudios::Audio::Amplitude
 
         /* -------- initializing routines -------- */
 
-        void makewt(int nw, int* ip, double* w)
+        static void makewt(int nw, int* ip, double* w)
         {
             int j, nwh;
             double delta, x, y;
@@ -366,7 +473,7 @@ namespace SparkyStudios::Audio::Amplitude
             }
         }
 
-        void makect(int nc, int* ip, double* c)
+        static void makect(int nc, int* ip, double* c)
         {
             int j, nch;
             double delta;
@@ -388,7 +495,7 @@ namespace SparkyStudios::Audio::Amplitude
 
         /* -------- child routines -------- */
 
-        void bitrv2(int n, int* ip, double* a)
+        static void bitrv2(int n, int* ip, double* a)
         {
             int j, j1, k, k1, l, m, m2;
             double xr, xi, yr, yi;
@@ -496,7 +603,7 @@ namespace SparkyStudios::Audio::Amplitude
             }
         }
 
-        void cftfsub(int n, double* a, double* w)
+        void cftfsub(int n, double* a, const double* w)
         {
             int j, j1, j2, j3, l;
             double x0r, x0i, x1r, x1i, x2r, x2i, x3r, x3i;
@@ -552,7 +659,7 @@ namespace SparkyStudios::Audio::Amplitude
             }
         }
 
-        void cftbsub(int n, double* a, double* w)
+        void cftbsub(int n, double* a, const double* w)
         {
             int j, j1, j2, j3, l;
             double x0r, x0i, x1r, x1i, x2r, x2i, x3r, x3i;
@@ -608,7 +715,7 @@ namespace SparkyStudios::Audio::Amplitude
             }
         }
 
-        void cft1st(int n, double* a, double* w)
+        void cft1st(int n, double* a, const double* w)
         {
             int j, k1, k2;
             double wk1r, wk1i, wk2r, wk2i, wk3r, wk3i;
@@ -713,7 +820,7 @@ namespace SparkyStudios::Audio::Amplitude
             }
         }
 
-        void cftmdl(int n, int l, double* a, double* w)
+        void cftmdl(int n, int l, double* a, const double* w)
         {
             int j, j1, j2, j3, k, k1, k2, m, m2;
             double wk1r, wk1i, wk2r, wk2i, wk3r, wk3i;
@@ -844,7 +951,7 @@ namespace SparkyStudios::Audio::Amplitude
             }
         }
 
-        void rftfsub(int n, double* a, int nc, double* c)
+        void rftfsub(int n, double* a, int nc, const double* c)
         {
             int j, k, kk, ks, m;
             double wkr, wki, xr, xi, yr, yi;
@@ -869,7 +976,7 @@ namespace SparkyStudios::Audio::Amplitude
             }
         }
 
-        void rftbsub(int n, double* a, int nc, double* c)
+        void rftbsub(int n, double* a, int nc, const double* c)
         {
             int j, k, kk, ks, m;
             double wkr, wki, xr, xi, yr, yi;
@@ -897,12 +1004,6 @@ namespace SparkyStudios::Audio::Amplitude
         }
     };
 
-    /**
-     * @internal
-     * @brief Concrete FFT implementation
-     */
-    typedef OouraFFT AudioFFTImplementation;
-
 #endif // AM_FFT_OOURA_USED
 
     // ================================================================
@@ -916,14 +1017,48 @@ namespace SparkyStudios::Audio::Amplitude
      */
     class IntelIppFFT : public detail::AudioFFTImpl
     {
+        struct Plan final : detail::AudioFFTPlan
+        {
+            explicit Plan(size_t size)
+                : m_Spec(nullptr)
+                , m_SpecBuffer(nullptr)
+                , m_WorkBufferSize(0)
+            {
+                const int powerOf2 = (int)(log((double)size) / log(2.0));
+
+                // Query to get buffer sizes
+                int sizeFFTSpec, sizeFFTInitBuf, sizeFFTWorkBuf;
+                ippsFFTGetSize_R_32f(powerOf2, IPP_FFT_NODIV_BY_ANY, ippAlgHintAccurate, &sizeFFTSpec, &sizeFFTInitBuf, &sizeFFTWorkBuf);
+
+                // init buffers
+                m_SpecBuffer = ippsMalloc_8u(sizeFFTSpec);
+                Ipp8u* fftInitBuf = ippsMalloc_8u(sizeFFTInitBuf);
+
+                // Initialize FFT
+                ippsFFTInit_R_32f(&m_Spec, powerOf2, IPP_FFT_NODIV_BY_ANY, ippAlgHintAccurate, m_SpecBuffer, fftInitBuf);
+                if (fftInitBuf)
+                    ippFree(fftInitBuf);
+
+                m_WorkBufferSize = sizeFFTWorkBuf;
+            }
+
+            ~Plan() override
+            {
+                if (m_SpecBuffer)
+                    ippFree(m_SpecBuffer);
+            }
+
+            IppsFFTSpec_R_32f* m_Spec;
+            Ipp8u* m_SpecBuffer;
+            int m_WorkBufferSize;
+        };
+
     public:
         IntelIppFFT()
             : detail::AudioFFTImpl()
             , _size(0)
             , _operationalBufferSize(0)
-            , _powerOf2(0)
-            , _fftSpec(nullptr)
-            , _fftSpecBuf(0)
+            , _plan()
             , _fftWorkBuf(0)
             , _operationalBuffer(nullptr)
         {
@@ -940,41 +1075,33 @@ namespace SparkyStudios::Audio::Amplitude
 
         virtual void init(size_t size) override
         {
-            if (_fftSpec)
+            if (_plan)
             {
                 if (_fftWorkBuf)
                     ippFree(_fftWorkBuf);
-                if (_fftSpecBuf)
-                    ippFree(_fftSpecBuf);
                 ippFree(_operationalBuffer);
 
                 _size = 0;
                 _operationalBufferSize = 0;
-                _powerOf2 = 0;
-                _fftSpec = 0;
+                _plan.reset();
+                _fftWorkBuf = 0;
+                _operationalBuffer = nullptr;
             }
 
             if (size > 0)
             {
                 _size = size;
                 _operationalBufferSize = _size + 2;
-                _powerOf2 = (int)(log((double)_size) / log(2.0));
-
-                // Query to get buffer sizes
-                int sizeFFTSpec, sizeFFTInitBuf, sizeFFTWorkBuf;
-                ippsFFTGetSize_R_32f(_powerOf2, IPP_FFT_NODIV_BY_ANY, ippAlgHintAccurate, &sizeFFTSpec, &sizeFFTInitBuf, &sizeFFTWorkBuf);
-
-                Ipp8u* fftInitBuf;
 
-                // init buffers
-                _fftSpecBuf = ippsMalloc_8u(sizeFFTSpec);
-                _fftWorkBuf = ippsMalloc_8u(sizeFFTWorkBuf);
-                fftInitBuf = ippsMalloc_8u(sizeFFTInitBuf);
+                // The spec is shared, but each instance needs its own work buffer
+                _plan = detail::AcquirePlan<Plan>(
+                    eFFTBackend_IntelIPP, size,
+                    [size]()
+                    {
+                        return std::make_shared<Plan>(size);
+                    });
 
-                // Initialize FFT
-                ippsFFTInit_R_32f(&_fftSpec, _powerOf2, IPP_FFT_NODIV_BY_ANY, ippAlgHintAccurate, _fftSpecBuf, fftInitBuf);
-                if (fftInitBuf)
-                    ippFree(fftInitBuf);
+                _fftWorkBuf = ippsMalloc_8u(_plan->m_WorkBufferSize);
 
                 // init operational buffer
                 _operationalBuffer = ippsMalloc_32f(_operationalBufferSize);
@@ -984,7 +1111,7 @@ namespace SparkyStudios::Audio::Amplitude
         virtual void fft(const float* data, float* re, float* im) override
         {
             size_t complexNumbersCount = _operationalBufferSize / 2;
-            ippsFFTFwd_RToCCS_32f(data, _operationalBuffer, _fftSpec, _fftWorkBuf);
+            ippsFFTFwd_RToCCS_32f(data, _operationalBuffer, _plan->m_Spec, _fftWorkBuf);
 
             // no need to scale
 
@@ -1007,7 +1134,7 @@ namespace SparkyStudios::Audio::Amplitude
                 _operationalBuffer[complexCounter++] = im[i];
             }
 
-            ippsFFTInv_CCSToR_32f(_operationalBuffer, data, _fftSpec, _fftWorkBuf);
+            ippsFFTInv_CCSToR_32f(_operationalBuffer, data, _plan->m_Spec, _fftWorkBuf);
 
             // scaling
             const float factor = 1.0f / static_cast<float>(_size);
@@ -1017,19 +1144,11 @@ namespace SparkyStudios::Audio::Amplitude
     private:
         size_t _size;
         size_t _operationalBufferSize;
-        size_t _powerOf2;
-        IppsFFTSpec_R_32f* _fftSpec;
-        Ipp8u* _fftSpecBuf;
+        std::shared_ptr<const Plan> _plan;
         Ipp8u* _fftWorkBuf;
         Ipp32f* _operationalBuffer;
     };
 
-    /**
-     * @internal
-     * @brief Concrete FFT implementation
-     */
-    typedef IntelIppFFT AudioFFTImplementation;
-
 #endif // AM_FFT_INTEL_IPP_USED
 
     // ================================================================
@@ -1043,12 +1162,26 @@ namespace SparkyStudios::Audio::Amplitude
      */
     class AppleAccelerateFFT : public detail::AudioFFTImpl
     {
+        struct Plan final : detail::AudioFFTPlan
+        {
+            explicit Plan(size_t powerOf2)
+                : m_Setup(vDSP_create_fftsetup(powerOf2, FFT_RADIX2))
+            {}
+
+            ~Plan() override
+            {
+                vDSP_destroy_fftsetup(m_Setup);
+            }
+
+            FFTSetup m_Setup;
+        };
+
     public:
         AppleAccelerateFFT()
             : detail::AudioFFTImpl()
             , _size(0)
             , _powerOf2(0)
-            , _fftSetup(0)
+            , _plan()
             , _re()
             , _im()
         {}
@@ -1063,12 +1196,11 @@ namespace SparkyStudios::Audio::Amplitude
 
         virtual void init(size_t size) override
         {
-            if (_fftSetup)
+            if (_plan)
             {
-                vDSP_destroy_fftsetup(_fftSetup);
                 _size = 0;
                 _powerOf2 = 0;
-                _fftSetup = 0;
+                _plan.reset();
                 _re.clear();
                 _im.clear();
             }
@@ -1081,7 +1213,15 @@ namespace SparkyStudios::Audio::Amplitude
                 {
                     ++_powerOf2;
                 }
-                _fftSetup = vDSP_create_fftsetup(_powerOf2, FFT_RADIX2);
+
+                const size_t powerOf2 = _powerOf2;
+                _plan = detail::AcquirePlan<Plan>(
+                    eFFTBackend_AppleAccelerate, size,
+                    [powerOf2]()
+                    {
+                        return std::make_shared<Plan>(powerOf2);
+                    });
+
                 _re.resize(_size / 2);
                 _im.resize(_size / 2);
             }
@@ -1094,7 +1234,7 @@ namespace SparkyStudios::Audio::Amplitude
             splitComplex.realp = re;
             splitComplex.imagp = im;
             vDSP_ctoz(reinterpret_cast<const COMPLEX*>(data), 2, &splitComplex, 1, size2);
-            vDSP_fft_zrip(_fftSetup, &splitComplex, 1, _powerOf2, FFT_FORWARD);
+            vDSP_fft_zrip(_plan->m_Setup, &splitComplex, 1, _powerOf2, FFT_FORWARD);
             const float factor = 0.5f;
             vDSP_vsmul(re, 1, &factor, re, 1, size2);
             vDSP_vsmul(im, 1, &factor, im, 1, size2);
@@ -1112,7 +1252,7 @@ namespace SparkyStudios::Audio::Amplitude
             DSPSplitComplex splitComplex;
             splitComplex.realp = _re.data();
             splitComplex.imagp = _im.data();
-            vDSP_fft_zrip(_fftSetup, &splitComplex, 1, _powerOf2, FFT_INVERSE);
+            vDSP_fft_zrip(_plan->m_Setup, &splitComplex, 1, _powerOf2, FFT_INVERSE);
             vDSP_ztoc(&splitComplex, 1, reinterpret_cast<COMPLEX*>(data), 2, size2);
             const float factor = 1.0f / static_cast<float>(_size);
             vDSP_vsmul(data, 1, &factor, data, 1, _size);
@@ -1121,17 +1261,11 @@ namespace SparkyStudios::Audio::Amplitude
     private:
         size_t _size;
         size_t _powerOf2;
-        FFTSetup _fftSetup;
+        std::shared_ptr<const Plan> _plan;
         std::vector<float> _re;
         std::vector<float> _im;
     };
 
-    /**
-     * @internal
-     * @brief Concrete FFT implementation
-     */
-    typedef AppleAccelerateFFT AudioFFTImplementation;
-
 #endif // AM_FFT_APPLE_ACCELERATE_USED
 
     // ================================================================
@@ -1145,13 +1279,45 @@ namespace SparkyStudios::Audio::Amplitude
      */
     class FFTW3FFT : public detail::AudioFFTImpl
     {
+        struct Plan final : detail::AudioFFTPlan
+        {
+            explicit Plan(size_t size)
+            {
+                // Plan on temporary buffers, the instances execute the plans on their own buffers. They are allocated
+                // with fftwf_malloc, so they have the alignment the plans expect.
+                const size_t complexSize = AudioFFT::ComplexSize(size);
+                float* data = reinterpret_cast<float*>(fftwf_malloc(size * sizeof(float)));
+                float* re = reinterpret_cast<float*>(fftwf_malloc(complexSize * sizeof(float)));
+                float* im = reinterpret_cast<float*>(fftwf_malloc(complexSize * sizeof(float)));
+
+                fftw_iodim dim;
+                dim.n = static_cast<int>(size);
+                dim.is = 1;
+                dim.os = 1;
+                m_PlanForward = fftwf_plan_guru_split_dft_r2c(1, &dim, 0, 0, data, re, im, FFTW_MEASURE);
+                m_PlanBackward = fftwf_plan_guru_split_dft_c2r(1, &dim, 0, 0, re, im, data, FFTW_MEASURE);
+
+                fftwf_free(data);
+                fftwf_free(re);
+                fftwf_free(im);
+            }
+
+            ~Plan() override
+            {
+                fftwf_destroy_plan(m_PlanForward);
+                fftwf_destroy_plan(m_PlanBackward);
+            }
+
+            fftwf_plan m_PlanForward;
+            fftwf_plan m_PlanBackward;
+        };
+
     public:
         FFTW3FFT()
             : detail::AudioFFTImpl()
             , _size(0)
             , _complexSize(0)
-            , _planForward(0)
-            , _planBackward(0)
+            , _plan()
             , _data(0)
             , _re(0)
             , _im(0)
@@ -1171,10 +1337,7 @@ namespace SparkyStudios::Audio::Amplitude
             {
                 if (_size > 0)
                 {
-                    fftwf_destroy_plan(_planForward);
-                    fftwf_destroy_plan(_planBackward);
-                    _planForward = 0;
-                    _planBackward = 0;
+                    _plan.reset();
                     _size = 0;
                     _complexSize = 0;
 
@@ -1201,17 +1364,17 @@ namespace SparkyStudios::Audio::Amplitude
                 {
                     _size = size;
                     _complexSize = AudioFFT::ComplexSize(_size);
-                    const size_t complexSize = AudioFFT::ComplexSize(_size);
                     _data = reinterpret_cast<float*>(fftwf_malloc(_size * sizeof(float)));
-                    _re = reinterpret_cast<float*>(fftwf_malloc(complexSize * sizeof(float)));
-                    _im = reinterpret_cast<float*>(fftwf_malloc(complexSize * sizeof(float)));
-
-                    fftw_iodim dim;
-                    dim.n = static_cast<int>(size);
-                    dim.is = 1;
-                    dim.os = 1;
-                    _planForward = fftwf_plan_guru_split_dft_r2c(1, &dim, 0, 0, _data, _re, _im, FFTW_MEASURE);
-                    _planBackward = fftwf_plan_guru_split_dft_c2r(1, &dim, 0, 0, _re, _im, _data, FFTW_MEASURE);
+                    _re = reinterpret_cast<float*>(fftwf_malloc(_complexSize * sizeof(float)));
+                    _im = reinterpret_cast<float*>(fftwf_malloc(_complexSize * sizeof(float)));
+
+                    // FFTW planners are not thread safe, the cache serializes the plans creation
+                    _plan = detail::AcquirePlan<Plan>(
+                        eFFTBackend_FFTW3, size,
+                        [size]()
+                        {
+                            return std::make_shared<Plan>(size);
+                        });
                 }
             }
         }
@@ -1219,7 +1382,7 @@ namespace SparkyStudios::Audio::Amplitude
         virtual void fft(const float* data, float* re, float* im) override
         {
             ::memcpy(_data, data, _size * sizeof(float));
-            fftwf_execute_split_dft_r2c(_planForward, _data, _re, _im);
+            fftwf_execute_split_dft_r2c(_plan->m_PlanForward, _data, _re, _im);
             ::memcpy(re, _re, _complexSize * sizeof(float));
             ::memcpy(im, _im, _complexSize * sizeof(float));
         }
@@ -1228,40 +1391,82 @@ namespace SparkyStudios::Audio::Amplitude
         {
             ::memcpy(_re, re, _complexSize * sizeof(float));
             ::memcpy(_im, im, _complexSize * sizeof(float));
-            fftwf_execute_split_dft_c2r(_planBackward, _re, _im, _data);
+            fftwf_execute_split_dft_c2r(_plan->m_PlanBackward, _re, _im, _data);
             detail::ScaleBuffer(data, _data, 1.0f / static_cast<float>(_size), _size);
         }
 
     private:
         size_t _size;
         size_t _complexSize;
-        fftwf_plan _planForward;
-        fftwf_plan _planBackward;
+        std::shared_ptr<const Plan> _plan;
         float* _data;
         float* _re;
         float* _im;
     };
 
-    /**
-     * @internal
-     * @brief Concrete FFT implementation
-     */
-    typedef FFTW3FFT AudioFFTImplementation;
-
 #endif // AM_FFT_FFTW3_USED
 
     // =============================================================
 
+    static std::unique_ptr<detail::AudioFFTImpl> CreateImplementation(eFFTBackend backend)
+    {
+        switch (backend)
+        {
+        case eFFTBackend_Ooura:
+            return std::make_unique<OouraFFT>();
+#ifdef AM_FFT_INTEL_IPP_USED
+        case eFFTBackend_IntelIPP:
+            return std::make_unique<IntelIppFFT>();
+#endif
+#ifdef AM_FFT_APPLE_ACCELERATE_USED
+        case eFFTBackend_AppleAccelerate:
+            return std::make_unique<AppleAccelerateFFT>();
+#endif
+#ifdef AM_FFT_FFTW3_USED
+        case eFFTBackend_FFTW3:
+            return std::make_unique<FFTW3FFT>();
+#endif
+        default:
+            return std::make_unique<PFFFT>();
+        }
+    }
+
+    static bool SupportsSize(eFFTBackend backend, size_t size)
+    {
+        if (backend == eFFTBackend_PFFFT)
+            return PFFFT::supports(size);
+
+        return true;
+    }
+
     AudioFFT::AudioFFT()
-        : _impl(new AudioFFTImplementation())
+        : AudioFFT(AM_FFT_BUILD_BACKEND)
     {}
 
+    AudioFFT::AudioFFT(eFFTBackend backend)
+        : _impl(nullptr)
+        , _requestedBackend(IsAvailable(backend) && backend != eFFTBackend_Default ? backend : AM_FFT_BUILD_BACKEND)
+        , _backend(_requestedBackend)
+        , _size(0)
+    {
+        _impl = CreateImplementation(_backend);
+    }
+
     AudioFFT::~AudioFFT()
     {}
 
     void AudioFFT::init(size_t size)
     {
         assert(detail::IsPowerOf2(size));
+
+        const eFFTBackend backend = SupportsSize(_requestedBackend, size) ? _requestedBackend : eFFTBackend_Ooura;
+
+        if (backend != _backend)
+        {
+            _impl = CreateImplementation(backend);
+            _backend = backend;
+        }
+
         _impl->init(size);
         _size = size;
     }
@@ -1281,9 +1486,67 @@ namespace SparkyStudios::Audio::Amplitude
         return _size;
     }
 
+    eFFTBackend AudioFFT::backend() const
+    {
+        return _backend;
+    }
+
     size_t AudioFFT::ComplexSize(size_t size)
     {
         return (size / 2) + 1;
     }
 
+    bool AudioFFT::IsAvailable(eFFTBackend backend)
+    {
+        switch (backend)
+        {
+        case eFFTBackend_PFFFT:
+        case eFFTBackend_Ooura:
+            return true;
+#ifdef AM_FFT_INTEL_IPP_USED
+        case eFFTBackend_IntelIPP:
+            return true;
+#endif
+#ifdef AM_FFT_APPLE_ACCELERATE_USED
+        case eFFTBackend_AppleAccelerate:
+            return true;
+#endif
+#ifdef AM_FFT_FFTW3_USED
+        case eFFTBackend_FFTW3:
+            return true;
+#endif
+        default:
+            return false;
+        }
+    }
+
+    eFFTBackend AudioFFT::BuildBackend()
+    {
+        return AM_FFT_BUILD_BACKEND;
+    }
+
+    size_t AudioFFT::ReleaseUnusedPlans()
+    {
+        detail::AudioFFTPlanCache& cache = detail::GetPlanCache();
+        std::lock_guard lock(cache.m_Mutex);
+
+        size_t released = 0;
+
+        // New references to a plan are only taken under the lock, so a plan only referenced by the cache stays unused
+        for (auto it = cache.m_Plans.begin(); it != cache.m_Plans.end();)
+        {
+            if (it->second.use_count() == 1)
+            {
+                it = cache.m_Plans.erase(it);
+                ++released;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        return released;
+    }
+
 } // namespace SparkyStudios::Audio::Amplitude
@@ -29,7 +29,8 @@
  *
  * - Real-complex FFT and complex-real inverse FFT for power-of-2-sized real data.
  *
- * - Uniform interface to different FFT implementations (currently Ooura, FFTW3 and Apple Accelerate).
+ * - Uniform interface to different FFT implementations (currently PFFFT, Ooura, Intel IPP, FFTW3 and Apple Accelerate).
+ *   PFFFT and Ooura are always built in, the other implementations are only available when enabled at build time.
  *
  * - Complex data is handled in "split-complex" format, i.e. there are separate
  *   arrays for the real and imaginary parts which can be useful for SIMD optimizations
@@ -45,6 +46,8 @@
 #include <cstddef>
 #include <memory>
 
+#include <SparkyStudios/Audio/Amplitude/DSP/FFT.h>
+
 namespace SparkyStudios::Audio::Amplitude
 {
     namespace detail
@@ -63,9 +66,17 @@ namespace SparkyStudios::Audio::Amplitude
     public:
         /**
          * @brief Constructor
+         *
+         * Uses the backend selected at build time.
          */
         AudioFFT();
 
+        /**
+         * @brief Constructor
+         * @param backend The backend to use. Falls back to the build time backend if not available.
+         */
+        explicit AudioFFT(eFFTBackend backend);
+
         AudioFFT(const AudioFFT&) = delete;
         AudioFFT& operator=(const AudioFFT&) = delete;
 
@@ -76,6 +87,9 @@ namespace SparkyStudios::Audio::Amplitude
 
         /**
          * @brief Initializes the FFT object
+         *
+         * Switches to the Ooura backend if the requested backend doesn't support the given size.
+         *
          * @param size Size of the real input (must be power 2)
          */
         void init(size_t size);
@@ -102,6 +116,12 @@ namespace SparkyStudios::Audio::Amplitude
          */
         [[nodiscard]] size_t size() const;
 
+        /**
+         * @brief Gets the backend performing the transforms.
+         * @return The backend performing the transforms.
+         */
+        [[nodiscard]] eFFTBackend backend() const;
+
         /**
          * @brief Calculates the necessary size of the real/imaginary complex arrays
          * @param size The size of the real data
@@ -109,8 +129,29 @@ namespace SparkyStudios::Audio::Amplitude
          */
         static size_t ComplexSize(size_t size);
 
+        /**
+         * @brief Checks whether the given backend is built in
+         * @param backend The backend to check
+         * @return Whether the backend is available
+         */
+        static bool IsAvailable(eFFTBackend backend);
+
+        /**
+         * @brief Gets the backend selected at build time
+         * @return The backend selected at build time
+         */
+        static eFFTBackend BuildBackend();
+
+        /**
+         * @brief Releases the cached plans no longer used by any instance
+         * @return The number of released plans
+         */
+        static size_t ReleaseUnusedPlans();
+
     private:
         std::unique_ptr<detail::AudioFFTImpl> _impl;
+        eFFTBackend _requestedBackend;
+        eFFTBackend _backend;
         size_t _size;
     };
 } // namespace SparkyStudios::Audio::Amplitude
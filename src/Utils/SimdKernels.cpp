@@ -0,0 +1,76 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <SparkyStudios/Audio/Amplitude/Core/Log.h>
+
+#include <Utils/SimdKernelsImpl.h>
+#include <Utils/Utils.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    // Defined in the translation units compiled for wider instruction sets, returning nullptr when they are not built.
+    const SimdKernels* GetSimdKernelsAVX();
+    const SimdKernels* GetSimdKernelsAVX2();
+    const SimdKernels* GetSimdKernelsAVX512();
+
+#if defined(AM_SIMD_INTRINSICS)
+    static constexpr SimdKernels kBaselineSimdKernels = SimdKernelsImpl::MakeSimdKernels<simd_arch>(simd_arch::name());
+#else
+    static constexpr SimdKernels kBaselineSimdKernels = SimdKernelsImpl::MakeSimdKernels<SimdKernelsImpl::ScalarArch>("scalar");
+#endif // AM_SIMD_INTRINSICS
+
+    static const SimdKernels* gSimdKernels = &kBaselineSimdKernels;
+
+    const SimdKernels& GetSimdKernels()
+    {
+        return *gSimdKernels;
+    }
+
+    const SimdKernels& SelectSimdKernels()
+    {
+        const auto& kernels = GetAvailableSimdKernels();
+        gSimdKernels = kernels.back();
+
+        amLogInfo("Using %s DSP kernels.", gSimdKernels->m_Name);
+
+        return *gSimdKernels;
+    }
+
+    std::vector<const SimdKernels*> GetAvailableSimdKernels()
+    {
+        std::vector<const SimdKernels*> kernels = { &kBaselineSimdKernels };
+
+#if defined(AM_SIMD_RUNTIME_DISPATCH) && defined(AM_SIMD_INTRINSICS)
+        const auto supported = xsimd::available_architectures();
+
+        const auto add = [&kernels](const SimdKernels* candidate)
+        {
+            // Skip the tables narrower than the baseline, the CPU already runs the baseline
+            if (candidate != nullptr && candidate->m_Width >= kBaselineSimdKernels.m_Width)
+                kernels.push_back(candidate);
+        };
+
+        if (supported.avx)
+            add(GetSimdKernelsAVX());
+
+        if (supported.fma3_avx2)
+            add(GetSimdKernelsAVX2());
+
+        if (supported.avx512f)
+            add(GetSimdKernelsAVX512());
+#endif // AM_SIMD_RUNTIME_DISPATCH && AM_SIMD_INTRINSICS
+
+        return kernels;
+    }
+} // namespace SparkyStudios::Audio::Amplitude
@@ -0,0 +1,141 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef _AM_IMPLEMENTATION_UTILS_SIMD_KERNELS_H
+#define _AM_IMPLEMENTATION_UTILS_SIMD_KERNELS_H
+
+#include <vector>
+
+#include <SparkyStudios/Audio/Amplitude/Core/Common.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    /**
+     * @brief The maximum number of channels transformed by the matrix kernel.
+     */
+    constexpr AmSize kAmMaxSimdMatrixSize = 8;
+
+    /**
+     * @brief A table of the hot DSP kernels, compiled for a single instruction set.
+     *
+     * The library is compiled for a baseline instruction set. When the build enables the
+     * `AM_SIMD_RUNTIME_DISPATCH` option, the kernels are also compiled for wider instruction
+     * sets, and the best table the CPU supports is selected when the engine initializes.
+     *
+     * Kernels never require aligned buffers, and process any length.
+     */
+    struct SimdKernels
+    {
+        /**
+         * @brief The name of the instruction set the kernels are compiled for.
+         */
+        const char* m_Name;
+
+        /**
+         * @brief The number of floats processed at once by the kernels.
+         */
+        AmSize m_Width;
+
+        /**
+         * @brief Computes `result[i] = a[i] + b[i]`. The result may alias the inputs.
+         */
+        void (*m_Add)(AmReal32* result, const AmReal32* a, const AmReal32* b, AmSize length);
+
+        /**
+         * @brief Computes `result[i] = a[i] - b[i]`. The result may alias the inputs.
+         */
+        void (*m_Subtract)(AmReal32* result, const AmReal32* a, const AmReal32* b, AmSize length);
+
+        /**
+         * @brief Computes `result[i] = a[i] * b[i]`. The result may alias the inputs.
+         */
+        void (*m_Multiply)(AmReal32* result, const AmReal32* a, const AmReal32* b, AmSize length);
+
+        /**
+         * @brief Computes `output[i] = input[i] * scalar`. The output may alias the input.
+         */
+        void (*m_ScalarMultiply)(const AmReal32* input, AmReal32* output, AmReal32 scalar, AmSize length);
+
+        /**
+         * @brief Computes `output[i] += input[i] * scalar`.
+         */
+        void (*m_ScalarMultiplyAccumulate)(const AmReal32* input, AmReal32* output, AmReal32 scalar, AmSize length);
+
+        /**
+         * @brief Computes `(re[i], im[i]) += (reA[i], imA[i]) * (reB[i], imB[i])`.
+         */
+        void (*m_ComplexMultiplyAccumulate)(
+            AmReal32* re, AmReal32* im, const AmReal32* reA, const AmReal32* imA, const AmReal32* reB, const AmReal32* imB, AmSize length);
+
+        /**
+         * @brief Interleaves two channels in a stereo buffer.
+         */
+        void (*m_InterleaveStereo)(const AmReal32* left, const AmReal32* right, AmReal32* output, AmSize length);
+
+        /**
+         * @brief Runs a biquad section in transposed direct form II on interleaved lanes.
+         *
+         * @param samples The samples, one frame after the other, each frame holding one sample per lane.
+         * @param lanes The number of lanes. Must be a multiple of the kernels width.
+         * @param frames The number of frames.
+         * @param coefficients The a0, a1, a2, b1 and b2 coefficients of each lane, one row of @c stride values per coefficient.
+         * Updated in place when interpolating.
+         * @param steps The per-frame coefficients increments, with the same layout, or @c nullptr when not interpolating.
+         * @param state The two state values of each lane, one row of @c stride values per state.
+         * @param stride The distance between two rows of coefficients or states.
+         */
+        void (*m_BiquadSection)(
+            AmReal32* samples,
+            AmSize lanes,
+            AmSize frames,
+            AmReal32* coefficients,
+            const AmReal32* steps,
+            AmReal32* state,
+            AmSize stride);
+
+        /**
+         * @brief Transforms a group of channels in place by a square matrix.
+         *
+         * @param channels The channels to transform.
+         * @param matrix The row-major matrix, with @c count rows and columns.
+         * @param count The number of channels, up to @c kAmMaxSimdMatrixSize.
+         * @param frames The number of frames in each channel.
+         */
+        void (*m_MatrixMultiply)(AmReal32* const* channels, const AmReal32* matrix, AmSize count, AmSize frames);
+    };
+
+    /**
+     * @brief Gets the kernels selected for the current CPU.
+     *
+     * Before @c SelectSimdKernels is called, the kernels of the baseline instruction set are returned.
+     */
+    const SimdKernels& GetSimdKernels();
+
+    /**
+     * @brief Selects the widest kernels supported by the current CPU.
+     *
+     * @return The selected kernels.
+     */
+    const SimdKernels& SelectSimdKernels();
+
+    /**
+     * @brief Gets every kernels table compiled in the library and supported by the current CPU,
+     * from the narrowest to the widest.
+     */
+    std::vector<const SimdKernels*> GetAvailableSimdKernels();
+} // namespace SparkyStudios::Audio::Amplitude
+
+#endif // _AM_IMPLEMENTATION_UTILS_SIMD_KERNELS_H
@@ -0,0 +1,37 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// This file is compiled for the AVX2 and FMA3 instruction sets when AM_SIMD_RUNTIME_DISPATCH is enabled.
+// Only the kernels templates can be used here, see SimdKernelsImpl.h.
+
+#include <Utils/SimdKernelsImpl.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+#if defined(AM_SIMD_RUNTIME_DISPATCH) && defined(AM_SIMD_INTRINSICS) && XSIMD_WITH_FMA3_AVX2
+    typedef xsimd::fma3<xsimd::avx2> dispatch_arch;
+
+    static constexpr SimdKernels kSimdKernelsAVX2 = SimdKernelsImpl::MakeSimdKernels<dispatch_arch>(dispatch_arch::name());
+
+    const SimdKernels* GetSimdKernelsAVX2()
+    {
+        return &kSimdKernelsAVX2;
+    }
+#else
+    const SimdKernels* GetSimdKernelsAVX2()
+    {
+        return nullptr;
+    }
+#endif // AM_SIMD_RUNTIME_DISPATCH && AM_SIMD_INTRINSICS && XSIMD_WITH_FMA3_AVX2
+} // namespace SparkyStudios::Audio::Amplitude
@@ -0,0 +1,343 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef _AM_IMPLEMENTATION_UTILS_SIMD_KERNELS_IMPL_H
+#define _AM_IMPLEMENTATION_UTILS_SIMD_KERNELS_IMPL_H
+
+#include <Utils/SimdKernels.h>
+
+#if defined(AM_SIMD_INTRINSICS)
+#include <xsimd/xsimd.hpp>
+#endif // AM_SIMD_INTRINSICS
+
+// This header is compiled once per instruction set. Every function it defines is a template of the
+// target architecture, so the linker can never merge the code generated for a wide instruction set
+// into the baseline one. Don't call non-template inline helpers (std::min, AM_MIN on functions, etc.) here.
+namespace SparkyStudios::Audio::Amplitude::SimdKernelsImpl
+{
+    /**
+     * @brief Tag used to build the kernels without SIMD intrinsics.
+     */
+    struct ScalarArch
+    {};
+
+    template<typename Arch>
+    struct Lanes
+    {
+#if defined(AM_SIMD_INTRINSICS)
+        typedef xsimd::batch<AmReal32, Arch> batch;
+
+        static constexpr AmSize kSize = batch::size;
+
+        static AM_INLINE batch Load(const AmReal32* source)
+        {
+            return xsimd::load_unaligned<Arch>(source);
+        }
+
+        static AM_INLINE void Store(AmReal32* destination, const batch& value)
+        {
+            value.store_unaligned(destination);
+        }
+
+        static AM_INLINE batch Fma(const batch& a, const batch& b, const batch& c)
+        {
+            return xsimd::fma(a, b, c);
+        }
+#endif // AM_SIMD_INTRINSICS
+    };
+
+    template<>
+    struct Lanes<ScalarArch>
+    {
+        typedef AmReal32 batch;
+
+        static constexpr AmSize kSize = 1;
+
+        static AM_INLINE batch Load(const AmReal32* source)
+        {
+            return *source;
+        }
+
+        static AM_INLINE void Store(AmReal32* destination, const batch& value)
+        {
+            *destination = value;
+        }
+
+        static AM_INLINE batch Fma(const batch& a, const batch& b, const batch& c)
+        {
+            return a * b + c;
+        }
+    };
+
+    template<typename Arch>
+    void Add(AmReal32* result, const AmReal32* a, const AmReal32* b, AmSize length)
+    {
+        typedef Lanes<Arch> L;
+        const AmSize end = length - length % L::kSize;
+
+        for (AmSize i = 0; i < end; i += L::kSize)
+            L::Store(result + i, L::Load(a + i) + L::Load(b + i));
+
+        for (AmSize i = end; i < length; ++i)
+            result[i] = a[i] + b[i];
+    }
+
+    template<typename Arch>
+    void Subtract(AmReal32* result, const AmReal32* a, const AmReal32* b, AmSize length)
+    {
+        typedef Lanes<Arch> L;
+        const AmSize end = length - length % L::kSize;
+
+        for (AmSize i = 0; i < end; i += L::kSize)
+            L::Store(result + i, L::Load(a + i) - L::Load(b + i));
+
+        for (AmSize i = end; i < length; ++i)
+            result[i] = a[i] - b[i];
+    }
+
+    template<typename Arch>
+    void Multiply(AmReal32* result, const AmReal32* a, const AmReal32* b, AmSize length)
+    {
+        typedef Lanes<Arch> L;
+        const AmSize end = length - length % L::kSize;
+
+        for (AmSize i = 0; i < end; i += L::kSize)
+            L::Store(result + i, L::Load(a + i) * L::Load(b + i));
+
+        for (AmSize i = end; i < length; ++i)
+            result[i] = a[i] * b[i];
+    }
+
+    template<typename Arch>
+    void ScalarMultiply(const AmReal32* input, AmReal32* output, AmReal32 scalar, AmSize length)
+    {
+        typedef Lanes<Arch> L;
+        const AmSize end = length - length % L::kSize;
+        const typename L::batch s(scalar);
+
+        for (AmSize i = 0; i < end; i += L::kSize)
+            L::Store(output + i, L::Load(input + i) * s);
+
+        for (AmSize i = end; i < length; ++i)
+            output[i] = input[i] * scalar;
+    }
+
+    template<typename Arch>
+    void ScalarMultiplyAccumulate(const AmReal32* input, AmReal32* output, AmReal32 scalar, AmSize length)
+    {
+        typedef Lanes<Arch> L;
+        const AmSize end = length - length % L::kSize;
+        const typename L::batch s(scalar);
+
+        for (AmSize i = 0; i < end; i += L::kSize)
+            L::Store(output + i, L::Fma(L::Load(input + i), s, L::Load(output + i)));
+
+        for (AmSize i = end; i < length; ++i)
+            output[i] += input[i] * scalar;
+    }
+
+    template<typename Arch>
+    void ComplexMultiplyAccumulate(
+        AmReal32* re, AmReal32* im, const AmReal32* reA, const AmReal32* imA, const AmReal32* reB, const AmReal32* imB, AmSize length)
+    {
+        typedef Lanes<Arch> L;
+        const AmSize end = length - length % L::kSize;
+
+        for (AmSize i = 0; i < end; i += L::kSize)
+        {
+            const auto ra = L::Load(reA + i);
+            const auto rb = L::Load(reB + i);
+            const auto ia = L::Load(imA + i);
+            const auto ib = L::Load(imB + i);
+
+            L::Store(re + i, L::Fma(ra, rb, L::Load(re + i)) - ia * ib);
+            L::Store(im + i, L::Fma(ia, rb, L::Fma(ra, ib, L::Load(im + i))));
+        }
+
+        for (AmSize i = end; i < length; ++i)
+        {
+            re[i] += reA[i] * reB[i] - imA[i] * imB[i];
+            im[i] += reA[i] * imB[i] + imA[i] * reB[i];
+        }
+    }
+
+    template<typename Arch>
+    void InterleaveStereo(const AmReal32* left, const AmReal32* right, AmReal32* output, AmSize length)
+    {
+        typedef Lanes<Arch> L;
+        AmSize end = 0;
+
+#if defined(AM_SIMD_INTRINSICS)
+        if constexpr (L::kSize > 1)
+        {
+            end = length - length % L::kSize;
+
+            for (AmSize i = 0; i < end; i += L::kSize)
+            {
+                const auto l = L::Load(left + i);
+                const auto r = L::Load(right + i);
+
+                L::Store(output + 2 * i, xsimd::zip_lo(l, r));
+                L::Store(output + 2 * i + L::kSize, xsimd::zip_hi(l, r));
+            }
+        }
+#endif // AM_SIMD_INTRINSICS
+
+        for (AmSize i = end; i < length; ++i)
+        {
+            output[2 * i] = left[i];
+            output[2 * i + 1] = right[i];
+        }
+    }
+
+    template<typename Arch>
+    void BiquadSection(
+        AmReal32* samples, AmSize lanes, AmSize frames, AmReal32* coefficients, const AmReal32* steps, AmReal32* state, AmSize stride)
+    {
+        typedef Lanes<Arch> L;
+
+        for (AmSize lane = 0; lane < lanes; lane += L::kSize)
+        {
+            auto a0 = L::Load(coefficients + lane);
+            auto a1 = L::Load(coefficients + stride + lane);
+            auto a2 = L::Load(coefficients + 2 * stride + lane);
+            auto b1 = L::Load(coefficients + 3 * stride + lane);
+            auto b2 = L::Load(coefficients + 4 * stride + lane);
+
+            auto s1 = L::Load(state + lane);
+            auto s2 = L::Load(state + stride + lane);
+
+            AmReal32* frame = samples + lane;
+
+            if (steps != nullptr)
+            {
+                const auto da0 = L::Load(steps + lane);
+                const auto da1 = L::Load(steps + stride + lane);
+                const auto da2 = L::Load(steps + 2 * stride + lane);
+                const auto db1 = L::Load(steps + 3 * stride + lane);
+                const auto db2 = L::Load(steps + 4 * stride + lane);
+
+                for (AmSize i = 0; i < frames; ++i, frame += lanes)
+                {
+                    const auto x = L::Load(frame);
+                    const auto y = L::Fma(a0, x, s1);
+
+                    s1 = L::Fma(a1, x, s2) - b1 * y;
+                    s2 = a2 * x - b2 * y;
+
+                    L::Store(frame, y);
+
+                    a0 = a0 + da0;
+                    a1 = a1 + da1;
+                    a2 = a2 + da2;
+                    b1 = b1 + db1;
+                    b2 = b2 + db2;
+                }
+
+                L::Store(coefficients + lane, a0);
+                L::Store(coefficients + stride + lane, a1);
+                L::Store(coefficients + 2 * stride + lane, a2);
+                L::Store(coefficients + 3 * stride + lane, b1);
+                L::Store(coefficients + 4 * stride + lane, b2);
+            }
+            else
+            {
+                for (AmSize i = 0; i < frames; ++i, frame += lanes)
+                {
+                    const auto x = L::Load(frame);
+                    const auto y = L::Fma(a0, x, s1);
+
+                    s1 = L::Fma(a1, x, s2) - b1 * y;
+                    s2 = a2 * x - b2 * y;
+
+                    L::Store(frame, y);
+                }
+            }
+
+            L::Store(state + lane, s1);
+            L::Store(state + stride + lane, s2);
+        }
+    }
+
+    template<typename Arch>
+    void MatrixMultiply(AmReal32* const* channels, const AmReal32* matrix, AmSize count, AmSize frames)
+    {
+        typedef Lanes<Arch> L;
+        const AmSize end = frames - frames % L::kSize;
+
+        typename L::batch m[kAmMaxSimdMatrixSize * kAmMaxSimdMatrixSize];
+        typename L::batch x[kAmMaxSimdMatrixSize];
+
+        for (AmSize i = 0; i < count * count; ++i)
+            m[i] = typename L::batch(matrix[i]);
+
+        for (AmSize i = 0; i < end; i += L::kSize)
+        {
+            for (AmSize c = 0; c < count; ++c)
+                x[c] = L::Load(channels[c] + i);
+
+            for (AmSize r = 0; r < count; ++r)
+            {
+                const typename L::batch* row = m + r * count;
+
+                auto y = x[0] * row[0];
+                for (AmSize c = 1; c < count; ++c)
+                    y = L::Fma(x[c], row[c], y);
+
+                L::Store(channels[r] + i, y);
+            }
+        }
+
+        AmReal32 v[kAmMaxSimdMatrixSize];
+
+        for (AmSize i = end; i < frames; ++i)
+        {
+            for (AmSize c = 0; c < count; ++c)
+                v[c] = channels[c][i];
+
+            for (AmSize r = 0; r < count; ++r)
+            {
+                const AmReal32* row = matrix + r * count;
+
+                AmReal32 y = 0.0f;
+                for (AmSize c = 0; c < count; ++c)
+                    y += v[c] * row[c];
+
+                channels[r][i] = y;
+            }
+        }
+    }
+
+    template<typename Arch>
+    constexpr SimdKernels MakeSimdKernels(const char* name)
+    {
+        return SimdKernels{
+            name,
+            Lanes<Arch>::kSize,
+            &Add<Arch>,
+            &Subtract<Arch>,
+            &Multiply<Arch>,
+            &ScalarMultiply<Arch>,
+            &ScalarMultiplyAccumulate<Arch>,
+            &ComplexMultiplyAccumulate<Arch>,
+            &InterleaveStereo<Arch>,
+            &BiquadSection<Arch>,
+            &MatrixMultiply<Arch>,
+        };
+    }
+} // namespace SparkyStudios::Audio::Amplitude::SimdKernelsImpl
+
+#endif // _AM_IMPLEMENTATION_UTILS_SIMD_KERNELS_IMPL_H
@@ -21,6 +21,8 @@
 #include <SparkyStudios/Audio/Amplitude/DSP/SplitComplex.h>
 #include <SparkyStudios/Audio/Amplitude/Math/Utils.h>
 
+#include <Utils/SimdKernels.h>
+
 #if defined(AM_SIMD_INTRINSICS)
 #include <xsimd/xsimd.hpp>
 #endif // defined(AM_SIMD_INTRINSICS)
@@ -176,74 +178,17 @@ namespace SparkyStudios::Audio::Amplitude
 
     AM_INLINE void ScalarMultiply(const AmReal32* input, AmReal32* output, AmReal32 scalar, AmSize length)
     {
-        AmSize remaining = length;
-
-#if defined(AM_SIMD_INTRINSICS)
-        const AmSize end = GetNumSimdChunks(length);
-        constexpr AmSize blockSize = GetSimdBlockSize();
-        remaining = remaining - end;
-
-        const auto& bb = simd_batch(scalar);
-
-        for (AmSize i = 0; i < end; i += blockSize)
-        {
-            const auto& ba = xsimd::load_aligned<simd_arch>(input + i);
-
-            simd_batch res = xsimd::mul(ba, bb);
-            res.store_aligned(output + i);
-        }
-#endif
-
-        for (AmSize i = length - remaining; i < length; i++)
-            output[i] = input[i] * scalar;
+        GetSimdKernels().m_ScalarMultiply(input, output, scalar, length);
     }
 
     AM_INLINE void ScalarMultiplyAccumulate(const AmReal32* input, AmReal32* output, AmReal32 scalar, AmSize length)
     {
-        AmSize remaining = length;
-
-#if defined(AM_SIMD_INTRINSICS)
-        const AmSize end = GetNumSimdChunks(length);
-        constexpr AmSize blockSize = GetSimdBlockSize();
-        remaining = remaining - end;
-
-        const auto& bb = simd_batch(scalar);
-
-        for (AmSize i = 0; i < end; i += blockSize)
-        {
-            const auto& ba = xsimd::load_aligned<simd_arch>(input + i);
-            const auto& bc = xsimd::load_aligned<simd_arch>(output + i);
-
-            auto res = xsimd::fma(ba, bb, bc);
-            res.store_aligned(output + i);
-        }
-#endif
-
-        for (AmSize i = length - remaining; i < length; i++)
-            output[i] += input[i] * scalar;
+        GetSimdKernels().m_ScalarMultiplyAccumulate(input, output, scalar, length);
     }
 
     AM_INLINE void PointWiseMultiply(const AmReal32* inputA, const AmReal32* inputB, AmReal32* output, AmSize length)
     {
-        AmSize remaining = length;
-
-#if defined(AM_SIMD_INTRINSICS)
-        const AmSize end = GetNumSimdChunks(length);
-        constexpr AmSize blockSize = GetSimdBlockSize();
-        remaining = remaining - end;
-
-        for (AmSize i = 0; i < end; i += blockSize)
-        {
-            const auto& ba = xsimd::load_aligned<simd_arch>(inputA + i);
-            const auto& bb = xsimd::load_aligned<simd_arch>(inputB + i);
-
-            auto res = xsimd::mul(ba, bb);
-            res.store_aligned(output + i);
-        }
-#endif
-
-        for (AmSize i = length - remaining; i < length; i++)
-            output[i] = inputA[i] * inputB[i];
+        GetSimdKernels().m_Multiply(output, inputA, inputB, length);
     }
 
     AM_INLINE void PointWiseMultiplyAccumulate(const AmReal32* inputA, const AmReal32* inputB, AmReal32* output, AmSize length)
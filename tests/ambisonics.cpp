@@ -0,0 +1,232 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+#include <Ambisonics/AmbisonicBinauralizer.h>
+#include <Ambisonics/AmbisonicDecoder.h>
+#include <Ambisonics/AmbisonicOrientationProcessor.h>
+#include <Ambisonics/AmbisonicSource.h>
+#include <Ambisonics/BFormat.h>
+#include <Core/ListenerInternalState.h>
+#include <HRTF/HRIRSphere.h>
+#include <Mixer/AmbisonicBus.h>
+
+using namespace SparkyStudios::Audio::Amplitude;
+
+constexpr AmUInt32 kOrder = 1;
+constexpr AmUInt32 kBlockSize = 512;
+
+// The ambisonic components processed by the binaural decoder nodes, for a single voice
+struct AmbisonicChain
+{
+    AmbisonicSource m_Source;
+    AmbisonicOrientationProcessor m_Rotator;
+    AmbisonicBinauralizer m_Binauralizer;
+    AmbisonicDecoder m_Decoder;
+
+    BFormat m_SoundField;
+    AudioBuffer m_Input;
+    AudioBuffer m_Output;
+
+    explicit AmbisonicChain(const HRIRSphere* sphere)
+        : m_Input(kBlockSize, 1)
+        , m_Output(kBlockSize, 2)
+    {
+        m_Source.Configure(kOrder, true);
+        m_Source.SetPosition(SphericalPosition(AM_DegToRad * 30.0f, 0.0f, 1.0f));
+
+        m_Rotator.Configure(kOrder, true);
+        m_Rotator.SetOrientation(Orientation(AM_DegToRad * 45.0f, 0.0f, 0.0f));
+
+        m_Binauralizer.Configure(kOrder, true, sphere);
+        m_Decoder.Configure(kOrder, true, eSpeakersPreset_Stereo);
+
+        for (AmSize i = 0; i < kBlockSize; ++i)
+            m_Input[0][i] = static_cast<AmAudioSample>(i % 37) / 37.0f - 0.5f;
+    }
+
+    // Processes a block the same way the panning, rotator and binaural decoder nodes do
+    void Process(bool binaural)
+    {
+        m_SoundField.Configure(kOrder, true, kBlockSize);
+        m_Source.Process(m_Input[0], kBlockSize, &m_SoundField);
+        m_Rotator.Process(&m_SoundField, kBlockSize);
+
+        m_Output.Clear();
+
+        if (binaural)
+            m_Binauralizer.Process(&m_SoundField, kBlockSize, m_Output);
+        else
+            m_Decoder.Process(&m_SoundField, kBlockSize, m_Output);
+    }
+};
+
+#if !defined(AM_NO_MEMORY_STATS)
+static AmUInt64 GetAllocationCount()
+{
+    AmUInt64 count = 0;
+
+    for (AmUInt32 pool = 0; pool < eMemoryPoolKind_COUNT; ++pool)
+        count += amMemory->GetStats(static_cast<eMemoryPoolKind>(pool)).allocCount.load();
+
+    return count;
+}
+#endif // AM_NO_MEMORY_STATS
+
+TEST_CASE("Ambisonic Components Tests", "[ambisonics][amplitude]")
+{
+    DiskFileSystem fs;
+    fs.SetBasePath(AM_OS_STRING("./samples/assets"));
+
+    HRIRSphereImpl sphere;
+    sphere.SetResource(AM_OS_STRING("./data/sadie_h12.amir"));
+    sphere.Load(&fs);
+
+    REQUIRE(sphere.IsLoaded());
+
+    SECTION("reconfiguring a sound field with the same frame count reuses its buffer")
+    {
+        BFormat soundField;
+        REQUIRE(soundField.Configure(kOrder, true, kBlockSize));
+
+        AudioBuffer* buffer = soundField.GetBuffer();
+        (*buffer)[0][0] = 1.0f;
+
+        REQUIRE(soundField.Configure(kOrder, true, kBlockSize));
+        REQUIRE(soundField.GetBuffer() == buffer);
+        REQUIRE((*buffer)[0][0] == 0.0f);
+
+        REQUIRE(soundField.Configure(kOrder, true, kBlockSize * 2));
+        REQUIRE(soundField.GetSampleCount() == kBlockSize * 2);
+    }
+
+    SECTION("the binauralizer adds its output to the existing samples")
+    {
+        AmbisonicChain expected(&sphere);
+        expected.Process(true);
+
+        AmbisonicChain chain(&sphere);
+        chain.m_SoundField.Configure(kOrder, true, kBlockSize);
+        chain.m_Source.Process(chain.m_Input[0], kBlockSize, &chain.m_SoundField);
+        chain.m_Rotator.Process(&chain.m_SoundField, kBlockSize);
+
+        chain.m_Output.Clear();
+        chain.m_Output[0][0] = 1.0f;
+        chain.m_Binauralizer.Process(&chain.m_SoundField, kBlockSize, chain.m_Output);
+
+        REQUIRE(std::abs(chain.m_Output[0][0] - expected.m_Output[0][0] - 1.0f) < 1e-6f);
+
+        for (AmSize i = 1; i < kBlockSize; ++i)
+            REQUIRE(chain.m_Output[0][i] == expected.m_Output[0][i]);
+
+        for (AmSize i = 0; i < kBlockSize; ++i)
+            REQUIRE(chain.m_Output[1][i] == expected.m_Output[1][i]);
+    }
+
+    SECTION("a voice rendered through the ambisonic bus matches the per-voice chain")
+    {
+        // The bus rotates the sound field by the inverse of the listener orientation
+        ListenerInternalState state;
+        state.SetId(1);
+        state.SetOrientation(Orientation(AM_InvQ(Orientation(AM_DegToRad * 45.0f, 0.0f, 0.0f).GetQuaternion())));
+
+        fplutil::intrusive_list listener_list(&ListenerInternalState::node);
+        listener_list.push_back(state);
+
+        const Listener listener(&state);
+
+        AmbisonicBus bus(state.GetId(), ePanningMode_BinauralLowQuality, &sphere);
+        REQUIRE(bus.GetOrder() == kOrder);
+
+        AmbisonicSource source;
+        source.Configure(kOrder, true);
+        source.SetPosition(SphericalPosition(AM_DegToRad * 30.0f, 0.0f, 1.0f));
+
+        AmbisonicChain chain(&sphere);
+
+        // Process a few blocks, so the convolution history is compared as well
+        for (AmUInt32 block = 0; block < 4; ++block)
+        {
+            chain.Process(true);
+
+            bus.Send(listener, source, chain.m_Input[0], 1.0f, kBlockSize);
+            const AudioBuffer& output = bus.Process(kBlockSize);
+
+            AmReal32 error = 0.0f;
+            for (AmSize c = 0; c < kAmStereoChannelCount; ++c)
+                for (AmSize i = 0; i < kBlockSize; ++i)
+                    error = AM_MAX(error, std::abs(output[c][i] - chain.m_Output[c][i]));
+
+            REQUIRE(error < 1e-4f);
+        }
+
+        REQUIRE(bus.IsActive());
+    }
+
+#if !defined(AM_NO_MEMORY_STATS)
+    SECTION("processing blocks doesn't allocate once the components are warmed up")
+    {
+        for (const bool binaural : { true, false })
+        {
+            AmbisonicChain chain(&sphere);
+            chain.Process(binaural);
+
+            const AmUInt64 allocations = GetAllocationCount();
+
+            for (AmUInt32 i = 0; i < 16; ++i)
+                chain.Process(binaural);
+
+            REQUIRE(GetAllocationCount() == allocations);
+        }
+    }
+#endif // AM_NO_MEMORY_STATS
+}
+
+TEST_CASE("Ambisonic Benchmarks", "[.][benchmark][ambisonics][amplitude]")
+{
+    DiskFileSystem fs;
+    fs.SetBasePath(AM_OS_STRING("./samples/assets"));
+
+    HRIRSphereImpl sphere;
+    sphere.SetResource(AM_OS_STRING("./data/sadie_h12.amir"));
+    sphere.Load(&fs);
+
+    AmbisonicChain chain(&sphere);
+    chain.Process(true);
+
+#if !defined(AM_NO_MEMORY_STATS)
+    const AmUInt64 allocations = GetAllocationCount();
+#endif // AM_NO_MEMORY_STATS
+
+    BENCHMARK("encode, rotate and binauralize 512 frames")
+    {
+        chain.Process(true);
+        return chain.m_Output[0][0];
+    };
+
+    BENCHMARK("encode, rotate and decode to stereo 512 frames")
+    {
+        chain.Process(false);
+        return chain.m_Output[0][0];
+    };
+
+#if !defined(AM_NO_MEMORY_STATS)
+    // Catch2 allocates its samples with the standard allocator, so every allocation here comes from the components
+    REQUIRE(GetAllocationCount() == allocations);
+#endif // AM_NO_MEMORY_STATS
+}
@@ -136,4 +136,13 @@ TEST_CASE("AudioBufferCrossFader Tests", "[audio_buffer_cross_fader][core][ampli
 
     for (size_t i = 0; i < 10; ++i)
         REQUIRE(std::abs(1.0f - fade[0][i]) < kEpsilon);
+
+    // Shorter blocks fade over their own length
+    for (size_t i = 0; i < 10; ++i)
+        out[0][i] = 0.0f;
+
+    crossfader.CrossFade(in, out, fade, 4);
+
+    for (size_t i = 0; i < 4; ++i)
+        REQUIRE(std::abs(static_cast<AmReal32>(i) / 4.0f - fade[0][i]) < kEpsilon);
 }
\ No newline at end of file
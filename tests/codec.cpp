@@ -0,0 +1,165 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+using namespace SparkyStudios::Audio::Amplitude;
+
+class SignatureTestCodec final : public Codec
+{
+public:
+    SignatureTestCodec(AmString name, const AmString& extension, std::vector<AmUInt8> bytes, std::vector<AmUInt8> mask = {})
+        : Codec(std::move(name))
+    {
+        AddFileExtension(extension);
+        AddFileSignature(std::move(bytes), std::move(mask));
+    }
+
+    [[nodiscard]] Decoder* CreateDecoder() override
+    {
+        return nullptr;
+    }
+
+    void DestroyDecoder(Decoder* decoder) override
+    {}
+
+    [[nodiscard]] Encoder* CreateEncoder() override
+    {
+        return nullptr;
+    }
+
+    void DestroyEncoder(Encoder* encoder) override
+    {}
+
+    [[nodiscard]] bool CanHandleFile(std::shared_ptr<File> file) const override
+    {
+        // Only signatures and extensions are used to route files to this codec
+        return false;
+    }
+};
+
+// A memory file with a path, so codecs can be looked up by extension
+class NamedMemoryFile final : public MemoryFile
+{
+public:
+    NamedMemoryFile(AmOsString path, const std::string& content)
+        : MemoryFile(reinterpret_cast<AmUInt8Buffer>(const_cast<char*>(content.data())), content.size(), true)
+        , _path(std::move(path))
+    {}
+
+    [[nodiscard]] AmOsString GetPath() const override
+    {
+        return _path;
+    }
+
+private:
+    AmOsString _path;
+};
+
+static std::shared_ptr<File> MakeFile(const AmOsString& path, const std::string& content)
+{
+    return std::make_shared<NamedMemoryFile>(path, content);
+}
+
+TEST_CASE("Codec File Signature Tests", "[codec][amplitude]")
+{
+    const AmUInt8 header[] = { 'R', 'I', 'F', 'F', 0x24, 0x08, 0x00, 0x00, 'W', 'A', 'V', 'E' };
+
+    SECTION("matches the header starting with its bytes")
+    {
+        const Codec::FileSignature signature{ { 'R', 'I', 'F', 'F' } };
+
+        REQUIRE(signature.Matches(header, sizeof(header)));
+        REQUIRE_FALSE(signature.Matches(header + 1, sizeof(header) - 1));
+    }
+
+    SECTION("ignores the masked bytes")
+    {
+        const Codec::FileSignature signature{ { 'R', 'I', 'F', 'F', 0, 0, 0, 0, 'W', 'A', 'V', 'E' },
+                                              { 0xFF, 0xFF, 0xFF, 0xFF, 0, 0, 0, 0, 0xFF, 0xFF, 0xFF, 0xFF } };
+
+        REQUIRE(signature.Matches(header, sizeof(header)));
+
+        const AmUInt8 other[] = { 'R', 'I', 'F', 'F', 0x24, 0x08, 0x00, 0x00, 'A', 'V', 'I', ' ' };
+        REQUIRE_FALSE(signature.Matches(other, sizeof(other)));
+    }
+
+    SECTION("does not match headers shorter than the signature")
+    {
+        const Codec::FileSignature signature{ { 'R', 'I', 'F', 'F' } };
+
+        REQUIRE_FALSE(signature.Matches(header, 3));
+        REQUIRE_FALSE(signature.Matches(header, 0));
+    }
+
+    SECTION("empty signatures never match")
+    {
+        const Codec::FileSignature signature{};
+        REQUIRE_FALSE(signature.Matches(header, sizeof(header)));
+    }
+}
+
+TEST_CASE("Codec Routing Tests", "[codec][amplitude]")
+{
+    // The engine locks the registry while it is initialized
+    const bool locked = amEngine->IsInitialized();
+    Codec::UnlockRegistry();
+
+    {
+        // Keyed by its first 4 bytes
+        SignatureTestCodec first("SIGNATURE_TEST_A", "sta", { 'S', 'T', 'A', '1' });
+
+        // Masked, and so looked up without the signature key
+        SignatureTestCodec second("SIGNATURE_TEST_B", "stb", { 'S', 'T', 'B', 0 }, { 0xFF, 0xFF, 0xFF, 0 });
+
+        SECTION("routes files by their signature")
+        {
+            REQUIRE(Codec::FindCodecForFile(MakeFile(AM_OS_STRING("sound.sta"), "STA1 content")) == &first);
+            REQUIRE(Codec::FindCodecForFile(MakeFile(AM_OS_STRING("sound.stb"), "STB2 content")) == &second);
+        }
+
+        SECTION("prefers the signature over a wrong extension")
+        {
+            REQUIRE(Codec::FindCodecForFile(MakeFile(AM_OS_STRING("sound.stb"), "STA1 content")) == &first);
+            REQUIRE(Codec::FindCodecForFile(MakeFile(AM_OS_STRING("sound.sta"), "STB9 content")) == &second);
+            REQUIRE(Codec::FindCodecForFile(MakeFile(AM_OS_STRING("sound"), "STA1 content")) == &first);
+        }
+
+        SECTION("uses the extension for files shorter than the signatures")
+        {
+            REQUIRE(Codec::FindCodecForFile(MakeFile(AM_OS_STRING("sound.stb"), "ST")) == &second);
+            REQUIRE(Codec::FindCodecForFile(MakeFile(AM_OS_STRING("sound.STA"), "")) == &first);
+        }
+
+        SECTION("uses the extension for unknown signatures")
+        {
+            REQUIRE(Codec::FindCodecForFile(MakeFile(AM_OS_STRING("sound.sta"), "UNKNOWN SIGNATURE")) == &first);
+            REQUIRE(Codec::FindCodecForFile(MakeFile(AM_OS_STRING("sound.stb"), "UNKNOWN SIGNATURE")) == &second);
+        }
+
+        SECTION("does not route unknown files to the test codecs")
+        {
+            const Codec* codec = Codec::FindCodecForFile(MakeFile(AM_OS_STRING("sound.unknown"), "UNKNOWN SIGNATURE"));
+            REQUIRE(codec != &first);
+            REQUIRE(codec != &second);
+
+            REQUIRE(Codec::FindCodecForFile(nullptr) == nullptr);
+        }
+    }
+
+    if (locked)
+        Codec::LockRegistry();
+}
@@ -0,0 +1,214 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <random>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+using namespace SparkyStudios::Audio::Amplitude;
+
+static std::vector<AmAudioSample> GenerateSignal(AmSize length, AmUInt32 seed)
+{
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<AmAudioSample> distribution(-1.0f, 1.0f);
+
+    std::vector<AmAudioSample> signal(length);
+    for (auto& sample : signal)
+        sample = distribution(generator);
+
+    return signal;
+}
+
+static std::vector<AmAudioSample> DirectConvolution(const std::vector<AmAudioSample>& input, const std::vector<AmAudioSample>& ir)
+{
+    std::vector<AmAudioSample> output(input.size(), 0.0f);
+
+    for (AmSize i = 0; i < input.size(); ++i)
+        for (AmSize j = 0; j < ir.size() && j <= i; ++j)
+            output[i] += input[i - j] * ir[j];
+
+    return output;
+}
+
+template<typename TProcess>
+static std::vector<AmAudioSample> ProcessInChunks(const std::vector<AmAudioSample>& input, TProcess&& process)
+{
+    // Irregular chunk sizes, to cover inputs not aligned on the convolver blocks
+    constexpr AmSize kChunkSizes[] = { 64, 17, 128, 1, 250, 64, 511 };
+
+    std::vector<AmAudioSample> output(input.size(), 0.0f);
+
+    for (AmSize offset = 0, chunk = 0; offset < input.size(); ++chunk)
+    {
+        const AmSize length = AM_MIN(kChunkSizes[chunk % std::size(kChunkSizes)], input.size() - offset);
+        process(input.data() + offset, output.data() + offset, length);
+        offset += length;
+    }
+
+    return output;
+}
+
+static AmReal32 MaxError(const std::vector<AmAudioSample>& a, const std::vector<AmAudioSample>& b)
+{
+    AmReal32 error = 0.0f;
+
+    for (AmSize i = 0; i < a.size(); ++i)
+        error = AM_MAX(error, std::abs(a[i] - b[i]));
+
+    return error;
+}
+
+TEST_CASE("Convolver Tests", "[convolver][dsp][amplitude]")
+{
+    const auto ir = GenerateSignal(5000, 1);
+    const auto input = GenerateSignal(12000, 2);
+    const auto expected = DirectConvolution(input, ir);
+
+    SECTION("uniform convolver matches the direct convolution")
+    {
+        Convolver convolver;
+        REQUIRE(convolver.Init(128, ir.data(), ir.size()));
+
+        const auto output = ProcessInChunks(
+            input,
+            [&convolver](const AmAudioSample* in, AmAudioSample* out, AmSize len)
+            {
+                convolver.Process(in, out, len);
+            });
+
+        REQUIRE(MaxError(output, expected) < 1e-3f);
+    }
+
+    SECTION("two-stage convolver matches the direct convolution")
+    {
+        TwoStageConvolver convolver;
+        REQUIRE(convolver.Init(64, 1024, ir.data(), ir.size()));
+        REQUIRE(convolver.GetHeadBlockSize() == 64);
+        REQUIRE(convolver.GetTailBlockSize() == 1024);
+
+        const auto output = ProcessInChunks(
+            input,
+            [&convolver](const AmAudioSample* in, AmAudioSample* out, AmSize len)
+            {
+                convolver.Process(in, out, len);
+            });
+
+        REQUIRE(MaxError(output, expected) < 1e-3f);
+    }
+
+    SECTION("two-stage convolver matches the direct convolution with a long tail")
+    {
+        // More tail partitions than head blocks per tail block
+        TwoStageConvolver convolver;
+        REQUIRE(convolver.Init(64, 256, ir.data(), ir.size()));
+
+        const auto output = ProcessInChunks(
+            input,
+            [&convolver](const AmAudioSample* in, AmAudioSample* out, AmSize len)
+            {
+                convolver.Process(in, out, len);
+            });
+
+        REQUIRE(MaxError(output, expected) < 1e-3f);
+    }
+
+    SECTION("multi convolver matches the direct convolution of each impulse response")
+    {
+        const auto otherIr = GenerateSignal(3000, 4);
+        const auto otherExpected = DirectConvolution(input, otherIr);
+
+        // Impulse responses shorter than the given length are padded with zeros
+        std::vector<AmAudioSample> paddedIr(ir.size(), 0.0f);
+        std::copy(otherIr.begin(), otherIr.end(), paddedIr.begin());
+
+        MultiConvolver convolver;
+        const AmAudioSample* irs[2] = { ir.data(), paddedIr.data() };
+        REQUIRE(convolver.Init(128, irs, 2, ir.size()));
+        REQUIRE(convolver.GetIRCount() == 2);
+
+        std::vector<AmAudioSample> otherOutput(input.size(), 0.0f);
+
+        const auto output = ProcessInChunks(
+            input,
+            [&](const AmAudioSample* in, AmAudioSample* out, AmSize len)
+            {
+                AmAudioSample* outputs[2] = { out, otherOutput.data() + (in - input.data()) };
+                convolver.Process(in, outputs, len);
+            });
+
+        REQUIRE(MaxError(output, expected) < 1e-3f);
+        REQUIRE(MaxError(otherOutput, otherExpected) < 1e-3f);
+    }
+
+    SECTION("multi convolver can be initialized from transformed impulse responses")
+    {
+        const auto otherIr = GenerateSignal(3000, 4);
+        const auto otherExpected = DirectConvolution(input, otherIr);
+
+        std::vector<AmReal32> spectrum(MultiConvolver::GetSpectrumSize(ir.size(), 128));
+        std::vector<AmReal32> otherSpectrum(MultiConvolver::GetSpectrumSize(ir.size(), 128), 0.0f);
+
+        MultiConvolver::TransformIR(ir.data(), ir.size(), 128, spectrum.data());
+        MultiConvolver::TransformIR(otherIr.data(), otherIr.size(), 128, otherSpectrum.data());
+
+        MultiConvolver convolver;
+        const AmReal32* spectra[2] = { spectrum.data(), otherSpectrum.data() };
+        REQUIRE_FALSE(convolver.InitFromSpectra(100, spectra, 2, ir.size()));
+        REQUIRE(convolver.InitFromSpectra(128, spectra, 2, ir.size()));
+        REQUIRE(convolver.GetSegmentCount() == 40);
+
+        std::vector<AmAudioSample> otherOutput(input.size(), 0.0f);
+
+        const auto output = ProcessInChunks(
+            input,
+            [&](const AmAudioSample* in, AmAudioSample* out, AmSize len)
+            {
+                AmAudioSample* outputs[2] = { out, otherOutput.data() + (in - input.data()) };
+                convolver.Process(in, outputs, len);
+            });
+
+        REQUIRE(MaxError(output, expected) < 1e-3f);
+        REQUIRE(MaxError(otherOutput, otherExpected) < 1e-3f);
+    }
+
+    SECTION("two-stage convolver handles short impulse responses")
+    {
+        const auto shortIr = GenerateSignal(100, 3);
+        const auto shortExpected = DirectConvolution(input, shortIr);
+
+        TwoStageConvolver convolver;
+        REQUIRE(convolver.Init(64, 1024, shortIr.data(), shortIr.size()));
+
+        const auto output = ProcessInChunks(
+            input,
+            [&convolver](const AmAudioSample* in, AmAudioSample* out, AmSize len)
+            {
+                convolver.Process(in, out, len);
+            });
+
+        REQUIRE(MaxError(output, shortExpected) < 1e-3f);
+    }
+
+    SECTION("two-stage convolver validates block sizes")
+    {
+        TwoStageConvolver convolver;
+        REQUIRE_FALSE(convolver.Init(0, 1024, ir.data(), ir.size()));
+
+        REQUIRE(convolver.Init(1000, 60, ir.data(), ir.size()));
+        REQUIRE(convolver.GetHeadBlockSize() == 64);
+        REQUIRE(convolver.GetTailBlockSize() == 1024);
+    }
+}
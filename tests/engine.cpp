@@ -43,6 +43,19 @@ public:
     }
 };
 
+static bool WaitForSoundBankRequest(const SoundBankRequestHandle& request, AmTime timeout = 10.0 * kAmSecond)
+{
+    for (AmTime elapsed = 0; !request->IsDone(); elapsed += 1.0)
+    {
+        if (elapsed >= timeout)
+            return false;
+
+        Thread::Sleep(1);
+    }
+
+    return true;
+}
+
 TEST_CASE("Engine Tests", "[engine][core][amplitude]")
 {
     DiskFileSystem fileSystem;
@@ -462,6 +475,90 @@ TEST_CASE("Engine Tests", "[engine][core][amplitude]")
                 amEngine->UnloadSoundBanks();
             }
 
+            THEN("it can load compiled sound banks")
+            {
+                REQUIRE(amEngine->LoadSoundBank(AM_OS_STRING("sample_01.amcbank")));
+                REQUIRE(amEngine->HasLoadedSoundBank(AM_OS_STRING("sample_01.amcbank")));
+
+                REQUIRE(amEngine->GetEventHandle("play_throw") != nullptr);
+                REQUIRE(amEngine->GetSwitchContainerHandle("footsteps") != nullptr);
+
+                amEngine->UnloadSoundBank(AM_OS_STRING("sample_01.amcbank"));
+
+                // Assets shared with the already loaded sound bank are kept
+                REQUIRE(amEngine->GetEventHandle("play_throw") != nullptr);
+            }
+
+            THEN("it can load and unload sound banks asynchronously")
+            {
+                const SoundBankRequestHandle load = amEngine->LoadSoundBankAsync(AM_OS_STRING("sample_02.ambank"));
+                REQUIRE(load != nullptr);
+
+                REQUIRE(WaitForSoundBankRequest(load));
+
+                REQUIRE(load->GetState() == eSoundBankRequestState_Completed);
+                REQUIRE(load->GetProgress() == 1.0f);
+                REQUIRE(amEngine->HasLoadedSoundBank(load->GetSoundBankId()));
+
+                const SoundBankRequestHandle unload = amEngine->UnloadSoundBankAsync(load->GetSoundBankId());
+                REQUIRE(unload != nullptr);
+
+                REQUIRE(WaitForSoundBankRequest(unload));
+
+                REQUIRE(unload->GetState() == eSoundBankRequestState_Completed);
+                REQUIRE_FALSE(amEngine->HasLoadedSoundBank(AM_OS_STRING("sample_02.ambank")));
+
+                const SoundBankRequestHandle invalid = amEngine->UnloadSoundBankAsync(AM_OS_STRING("sample_02.ambank"));
+
+                REQUIRE(WaitForSoundBankRequest(invalid));
+
+                REQUIRE(invalid->GetState() == eSoundBankRequestState_Failed);
+            }
+
+            THEN("a synchronous load completes the pending asynchronous requests of the same sound bank")
+            {
+                const SoundBankRequestHandle load = amEngine->LoadSoundBankAsync(AM_OS_STRING("sample_02.ambank"));
+                REQUIRE(load != nullptr);
+
+                REQUIRE(amEngine->LoadSoundBank(AM_OS_STRING("sample_02.ambank")));
+                REQUIRE(WaitForSoundBankRequest(load));
+
+                REQUIRE(load->GetState() == eSoundBankRequestState_Completed);
+                REQUIRE(amEngine->HasLoadedSoundBank(load->GetSoundBankId()));
+
+                // Both loads share the same sound bank
+                amEngine->UnloadSoundBank(AM_OS_STRING("sample_02.ambank"));
+                REQUIRE(amEngine->HasLoadedSoundBank(AM_OS_STRING("sample_02.ambank")));
+
+                amEngine->UnloadSoundBank(AM_OS_STRING("sample_02.ambank"));
+                REQUIRE_FALSE(amEngine->HasLoadedSoundBank(AM_OS_STRING("sample_02.ambank")));
+            }
+
+            THEN("a synchronous unload completes the pending asynchronous requests of the same sound bank")
+            {
+                const SoundBankRequestHandle load = amEngine->LoadSoundBankAsync(AM_OS_STRING("sample_02.ambank"));
+                REQUIRE(load != nullptr);
+
+                amEngine->UnloadSoundBank(AM_OS_STRING("sample_02.ambank"));
+
+                REQUIRE(load->IsDone());
+                REQUIRE(load->GetState() == eSoundBankRequestState_Completed);
+                REQUIRE_FALSE(amEngine->HasLoadedSoundBank(AM_OS_STRING("sample_02.ambank")));
+
+                AmBankID id = kAmInvalidObjectId;
+                REQUIRE(amEngine->LoadSoundBank(AM_OS_STRING("sample_02.ambank"), id));
+                REQUIRE(amEngine->LoadSoundBank(AM_OS_STRING("sample_02.ambank")));
+
+                const SoundBankRequestHandle unload = amEngine->UnloadSoundBankAsync(id);
+                REQUIRE(unload != nullptr);
+
+                amEngine->UnloadSoundBank(id);
+
+                REQUIRE(unload->IsDone());
+                REQUIRE(unload->GetState() == eSoundBankRequestState_Completed);
+                REQUIRE_FALSE(amEngine->HasLoadedSoundBank(id));
+            }
+
             THEN("engine can play a sound using its handle")
             {
                 SoundHandle test_sound_01 = amEngine->GetSoundHandle("test_sound_01");
@@ -0,0 +1,252 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+using namespace SparkyStudios::Audio::Amplitude;
+
+static const std::pair<eFFTBackend, const char*> kBackends[] = {
+    { eFFTBackend_PFFFT, "pffft" },           { eFFTBackend_Ooura, "ooura" }, { eFFTBackend_IntelIPP, "ipp" },
+    { eFFTBackend_AppleAccelerate, "accelerate" }, { eFFTBackend_FFTW3, "fftw3" },
+};
+
+static std::vector<AmReal32> GenerateSignal(AmSize length)
+{
+    std::mt19937 generator(static_cast<AmUInt32>(length));
+    std::uniform_real_distribution<AmReal32> distribution(-1.0f, 1.0f);
+
+    std::vector<AmReal32> signal(length);
+    for (auto& sample : signal)
+        sample = distribution(generator);
+
+    return signal;
+}
+
+TEST_CASE("FFT Tests", "[fft][dsp][amplitude]")
+{
+    SECTION("portable backends are always available")
+    {
+        REQUIRE(FFT::IsBackendAvailable(eFFTBackend_PFFFT));
+        REQUIRE(FFT::IsBackendAvailable(eFFTBackend_Ooura));
+        REQUIRE_FALSE(FFT::IsBackendAvailable(eFFTBackend_Default));
+    }
+
+    SECTION("can change the default backend")
+    {
+        const eFFTBackend defaultBackend = FFT::GetDefaultBackend();
+
+        REQUIRE(FFT::SetDefaultBackend(eFFTBackend_Ooura));
+        REQUIRE(FFT::GetDefaultBackend() == eFFTBackend_Ooura);
+        REQUIRE(FFT().GetBackend() == eFFTBackend_Ooura);
+
+        REQUIRE_FALSE(FFT::SetDefaultBackend(eFFTBackend_Default));
+        REQUIRE(FFT::GetDefaultBackend() == eFFTBackend_Ooura);
+
+        REQUIRE(FFT::SetDefaultBackend(defaultBackend));
+    }
+
+    SECTION("pffft falls back to ooura for unsupported sizes")
+    {
+        FFT fft(eFFTBackend_PFFFT);
+
+        fft.Initialize(16);
+        REQUIRE(fft.GetBackend() == eFFTBackend_Ooura);
+
+        fft.Initialize(64);
+        REQUIRE(fft.GetBackend() == eFFTBackend_PFFFT);
+    }
+
+    SECTION("instances of the same size share their plans")
+    {
+        constexpr AmSize kSize = 512;
+        const auto input = GenerateSignal(kSize);
+
+        FFT::ReleaseUnusedPlans();
+
+        {
+            FFT a(eFFTBackend_PFFFT), b(eFFTBackend_PFFFT), c(eFFTBackend_Ooura), d(eFFTBackend_Ooura);
+            a.Initialize(kSize);
+            b.Initialize(kSize);
+            c.Initialize(kSize);
+            d.Initialize(kSize);
+
+            SplitComplex expected(FFT::GetOutputSize(kSize));
+            a.Forward(input.data(), expected);
+
+            for (const FFT* fft : { &b, &c, &d })
+            {
+                SplitComplex spectrum(FFT::GetOutputSize(kSize));
+                fft->Forward(input.data(), spectrum);
+
+                std::vector<AmReal32> output(kSize);
+                fft->Backward(output.data(), spectrum);
+
+                for (AmSize k = 0; k < spectrum.GetSize(); ++k)
+                {
+                    REQUIRE(std::abs(spectrum.re()[k] - expected.re()[k]) < 1e-3);
+                    REQUIRE(std::abs(spectrum.im()[k] - expected.im()[k]) < 1e-3);
+                }
+
+                for (AmSize i = 0; i < kSize; ++i)
+                    REQUIRE(std::abs(output[i] - input[i]) < 1e-4f);
+            }
+
+            REQUIRE(FFT::ReleaseUnusedPlans() == 0);
+        }
+
+        REQUIRE(FFT::ReleaseUnusedPlans() == 2);
+        REQUIRE(FFT::ReleaseUnusedPlans() == 0);
+    }
+
+    SECTION("instances can be initialized from several threads")
+    {
+        constexpr AmSize kThreadCount = 8;
+
+        // The pool allocations are made up front, only the plans are created concurrently
+        std::vector<std::unique_ptr<FFT>> ffts;
+        std::vector<std::unique_ptr<SplitComplex>> spectrums;
+        std::vector<AmReal32> errors(kThreadCount, 1.0f);
+
+        for (AmSize t = 0; t < kThreadCount; ++t)
+        {
+            const AmSize size = t % 2 == 0 ? 1024 : 2048;
+
+            ffts.emplace_back(std::make_unique<FFT>(t % 4 < 2 ? eFFTBackend_PFFFT : eFFTBackend_Ooura));
+            spectrums.emplace_back(std::make_unique<SplitComplex>(FFT::GetOutputSize(size)));
+        }
+
+        std::vector<std::thread> threads;
+
+        for (AmSize t = 0; t < kThreadCount; ++t)
+        {
+            threads.emplace_back(
+                [t, &ffts, &spectrums, &errors]()
+                {
+                    const AmSize size = t % 2 == 0 ? 1024 : 2048;
+                    const auto input = GenerateSignal(size);
+                    std::vector<AmReal32> output(size);
+
+                    ffts[t]->Initialize(size);
+
+                    AmReal32 error = 0.0f;
+                    for (AmSize i = 0; i < 16; ++i)
+                    {
+                        ffts[t]->Forward(input.data(), *spectrums[t]);
+                        ffts[t]->Backward(output.data(), *spectrums[t]);
+
+                        for (AmSize j = 0; j < size; ++j)
+                            error = AM_MAX(error, std::abs(output[j] - input[j]));
+                    }
+
+                    errors[t] = error;
+                });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        for (const AmReal32 error : errors)
+            REQUIRE(error < 1e-4f);
+    }
+
+    for (const auto& [backend, name] : kBackends)
+    {
+        if (!FFT::IsBackendAvailable(backend))
+            continue;
+
+        SECTION(std::string(name) + " matches the discrete Fourier transform")
+        {
+            for (const AmSize size : { 16, 64, 256 })
+            {
+                const auto input = GenerateSignal(size);
+
+                FFT fft(backend);
+                fft.Initialize(size);
+
+                SplitComplex spectrum(FFT::GetOutputSize(size));
+                fft.Forward(input.data(), spectrum);
+
+                for (AmSize k = 0; k < spectrum.GetSize(); ++k)
+                {
+                    AmReal64 re = 0.0, im = 0.0;
+                    for (AmSize n = 0; n < size; ++n)
+                    {
+                        const AmReal64 angle = -AM_PI * 2.0 * static_cast<AmReal64>(k * n) / static_cast<AmReal64>(size);
+                        re += input[n] * std::cos(angle);
+                        im += input[n] * std::sin(angle);
+                    }
+
+                    REQUIRE(std::abs(spectrum.re()[k] - re) < 1e-3);
+                    REQUIRE(std::abs(spectrum.im()[k] - im) < 1e-3);
+                }
+            }
+        }
+
+        SECTION(std::string(name) + " round trip restores the input")
+        {
+            for (const AmSize size : { 16, 64, 1024, 8192 })
+            {
+                const auto input = GenerateSignal(size);
+
+                FFT fft(backend);
+                fft.Initialize(size);
+
+                SplitComplex spectrum(FFT::GetOutputSize(size));
+                fft.Forward(input.data(), spectrum);
+
+                std::vector<AmReal32> output(size);
+                fft.Backward(output.data(), spectrum);
+
+                for (AmSize i = 0; i < size; ++i)
+                    REQUIRE(std::abs(output[i] - input[i]) < 1e-4f);
+            }
+        }
+    }
+}
+
+TEST_CASE("FFT Benchmarks", "[.][benchmark][fft][dsp][amplitude]")
+{
+    for (AmSize size = 64; size <= 8192; size *= 2)
+    {
+        const auto input = GenerateSignal(size);
+
+        std::vector<AmReal32> output(size);
+
+        SplitComplex spectrum(FFT::GetOutputSize(size));
+
+        for (const auto& [backend, name] : kBackends)
+        {
+            if (!FFT::IsBackendAvailable(backend))
+                continue;
+
+            FFT fft(backend);
+            fft.Initialize(size);
+
+            BENCHMARK(std::string(name) + " forward+backward " + std::to_string(size))
+            {
+                fft.Forward(input.data(), spectrum);
+                fft.Backward(output.data(), spectrum);
+                return output[0];
+            };
+        }
+    }
+}
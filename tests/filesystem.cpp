@@ -12,10 +12,14 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <array>
+
 #include <catch2/catch_test_macros.hpp>
 
 #include <SparkyStudios/Audio/Amplitude/Amplitude.h>
 
+#include <IO/FileReadScheduler.h>
+
 using namespace SparkyStudios::Audio::Amplitude;
 
 TEST_CASE("DiskFileSystem Tests", "[filesystem][amplitude]")
@@ -141,6 +145,18 @@ TEST_CASE("DiskFileSystem DiskFile Tests", "[filesystem][amplitude]")
         amfree(content);
     }
 
+    SECTION("can read at a given offset without moving the cursor")
+    {
+        auto* diskFile = static_cast<DiskFile*>(file.get());
+
+        AmUInt8 value = 0;
+        REQUIRE(diskFile->ReadAt(1, &value, 1) == 1);
+        REQUIRE(value == 'K');
+        REQUIRE(diskFile->ReadAt(2, &value, 1) == 0);
+        REQUIRE(file->Position() == 0);
+        REQUIRE(file->Read8() == 'O');
+    }
+
     SECTION("can close files")
     {
         static_cast<DiskFile*>(file.get())->Close();
@@ -253,6 +269,7 @@ TEST_CASE("MemoryFile Tests", "[filesystem][amplitude]")
         REQUIRE_FALSE(file.IsValid());
         REQUIRE(file.OpenMem(reinterpret_cast<AmConstUInt8Buffer>(ok), 2, false, false) == eErrorCode_Success);
         REQUIRE(file.IsValid());
+        REQUIRE(file.IsMemoryBacked());
         REQUIRE(file.GetPtr() == ok);
 
         file.Close();
@@ -336,6 +353,44 @@ TEST_CASE("MemoryFile Tests", "[filesystem][amplitude]")
     }
 }
 
+// Writes a package holding a single item, the same way the ampk tool does
+static void WritePackage(
+    const std::filesystem::path& path,
+    ePackageFileCompressionAlgorithm compression,
+    AmUInt32 blockSize,
+    const PackageFileItemDescription& item,
+    const std::vector<AmUInt8>& data)
+{
+    DiskFile file(path, eFileOpenMode_Write);
+
+    file.Write(reinterpret_cast<AmConstUInt8Buffer>("AMPK"), 4);
+    file.Write16(2);
+    file.Write8(compression);
+    file.Write32(blockSize);
+
+    file.Write64(1);
+    file.WriteString(item.m_Name);
+    file.Write64(item.m_Offset);
+    file.Write64(item.m_Size);
+
+    file.Write(data.data(), data.size());
+    file.Close();
+}
+
+static std::shared_ptr<File> OpenPackageItem(PackageFileSystem& fileSystem, const std::filesystem::path& path)
+{
+    fileSystem.SetBasePath(path.native());
+
+    fileSystem.StartOpenFileSystem();
+    while (!fileSystem.TryFinalizeOpenFileSystem())
+        Thread::Sleep(1);
+
+    if (!fileSystem.IsValid())
+        return nullptr;
+
+    return fileSystem.OpenFile(AM_OS_STRING("item.bin"));
+}
+
 TEST_CASE("PackageFileSystem Tests", "[filesystem][amplitude]")
 {
     PackageFileSystem fileSystem;
@@ -518,4 +573,623 @@ TEST_CASE("PackageFileSystem PackageItemFile Tests", "[filesystem][amplitude]")
         REQUIRE(file->Eof());
         amfree(content);
     }
-}
\ No newline at end of file
+
+    SECTION("can read the same item from independent files")
+    {
+        const auto other = fileSystem.OpenFile(AM_OS_STRING("data/tests/file_read_test.txt"), eFileOpenMode_Read);
+        REQUIRE(other->IsValid());
+
+        file->Seek(1, eFileSeekOrigin_Start);
+        REQUIRE(other->Position() == 0);
+        REQUIRE(other->Read8() == 'O');
+        REQUIRE(file->Read8() == 'K');
+        REQUIRE(other->Read8() == 'K');
+    }
+
+    SECTION("can still read files after the filesystem is closed")
+    {
+        fileSystem.StartCloseFileSystem();
+        REQUIRE(fileSystem.TryFinalizeCloseFileSystem());
+
+        REQUIRE(file->IsValid());
+        REQUIRE(file->Read8() == 'O');
+    }
+}
+TEST_CASE("PackageFileSystem Memory-Mapped PackageItemFile Tests", "[filesystem][amplitude]")
+{
+    PackageFileSystem fileSystem;
+    fileSystem.SetBasePath(AM_OS_STRING("./samples/assets.ampk"));
+    fileSystem.SetMemoryMappingEnabled(true);
+
+    fileSystem.StartOpenFileSystem();
+    while (!fileSystem.TryFinalizeOpenFileSystem())
+        Thread::Sleep(1);
+
+    auto file = fileSystem.OpenFile(AM_OS_STRING("data/tests/file_read_test.txt"), eFileOpenMode_Read);
+
+    SECTION("can map the package file")
+    {
+        REQUIRE(fileSystem.IsMemoryMappingEnabled());
+        REQUIRE(fileSystem.IsMemoryMapped());
+    }
+
+    SECTION("can access the file content in memory")
+    {
+        REQUIRE(file->IsValid());
+        REQUIRE(file->IsMemoryBacked());
+
+        const auto* data = static_cast<AmConstUInt8Buffer>(file->GetPtr());
+        REQUIRE(data != nullptr);
+        REQUIRE(data[0] == 'O');
+        REQUIRE(data[1] == 'K');
+
+        // The test package is built with items aligned to 4 KiB
+        REQUIRE(reinterpret_cast<AmUIntPtr>(data) % 4096 == 0);
+    }
+
+    SECTION("can read the entire file")
+    {
+        file->Seek(0, eFileSeekOrigin_Start);
+        auto* content = static_cast<AmUInt8Buffer>(ammalloc(2));
+        REQUIRE(file->Read(content, 4) == 2);
+        REQUIRE(content[0] == 'O');
+        REQUIRE(content[1] == 'K');
+        REQUIRE(file->Position() == file->Length());
+        REQUIRE(file->Eof());
+        amfree(content);
+    }
+
+    SECTION("can still read files after the filesystem is closed")
+    {
+        fileSystem.StartCloseFileSystem();
+        REQUIRE(fileSystem.TryFinalizeCloseFileSystem());
+        REQUIRE_FALSE(fileSystem.IsMemoryMapped());
+
+        REQUIRE(file->IsValid());
+        REQUIRE(file->Read8() == 'O');
+    }
+}
+
+TEST_CASE("PackageFileSystem Compressed PackageItemFile Tests", "[filesystem][amplitude]")
+{
+    DiskFileSystem diskFileSystem;
+    diskFileSystem.SetBasePath(AM_OS_STRING("./samples/assets"));
+
+    PackageFileSystem fileSystem;
+    fileSystem.SetBasePath(AM_OS_STRING("./samples/assets_zlib.ampk"));
+    fileSystem.SetBlockCacheCapacity(4);
+
+    fileSystem.StartOpenFileSystem();
+    while (!fileSystem.TryFinalizeOpenFileSystem())
+        Thread::Sleep(1);
+
+    REQUIRE(fileSystem.IsValid());
+
+    const auto diskFile = diskFileSystem.OpenFile(AM_OS_STRING("data/throw_05.ogg"), eFileOpenMode_Read);
+    const auto file = fileSystem.OpenFile(AM_OS_STRING("data/throw_05.ogg"));
+
+    const AmSize length = diskFile->Length();
+
+    std::vector<AmUInt8> expected(length);
+    REQUIRE(diskFile->Read(expected.data(), length) == length);
+
+    SECTION("can open a compressed package file")
+    {
+        REQUIRE(file->IsValid());
+        REQUIRE_FALSE(file->IsMemoryBacked());
+        REQUIRE(file->Length() == length);
+    }
+
+    SECTION("can read the small compressed files")
+    {
+        const auto smallFile = fileSystem.OpenFile(AM_OS_STRING("data/tests/file_read_test.txt"));
+        REQUIRE(smallFile->Length() == 2);
+        REQUIRE(smallFile->Read8() == 'O');
+        REQUIRE(smallFile->Read8() == 'K');
+        REQUIRE(smallFile->Eof());
+    }
+
+    SECTION("can read the entire file")
+    {
+        std::vector<AmUInt8> content(length);
+        REQUIRE(file->Read(content.data(), length) == length);
+        REQUIRE(content == expected);
+        REQUIRE(file->Eof());
+    }
+
+    SECTION("can seek and read across blocks")
+    {
+        const AmSize offset = length / 2 - 3;
+        const AmSize size = AM_MIN(static_cast<AmSize>(10000), length - offset);
+
+        std::vector<AmUInt8> content(size);
+
+        file->Seek(offset, eFileSeekOrigin_Start);
+        REQUIRE(file->Read(content.data(), size) == size);
+        REQUIRE(std::equal(content.begin(), content.end(), expected.begin() + offset));
+        REQUIRE(file->Position() == offset + size);
+
+        file->Seek(-10, eFileSeekOrigin_End);
+        REQUIRE(file->Read(content.data(), size) == 10);
+        REQUIRE(std::equal(content.begin(), content.begin() + 10, expected.end() - 10));
+
+        file->Seek(1, eFileSeekOrigin_Start);
+        REQUIRE(file->Read8() == expected[1]);
+    }
+
+    SECTION("can read memory-mapped compressed files")
+    {
+        PackageFileSystem mappedFileSystem;
+        mappedFileSystem.SetBasePath(AM_OS_STRING("./samples/assets_zlib.ampk"));
+        mappedFileSystem.SetMemoryMappingEnabled(true);
+
+        mappedFileSystem.StartOpenFileSystem();
+        while (!mappedFileSystem.TryFinalizeOpenFileSystem())
+            Thread::Sleep(1);
+
+        const auto mappedFile = mappedFileSystem.OpenFile(AM_OS_STRING("data/throw_05.ogg"));
+        REQUIRE_FALSE(mappedFile->IsMemoryBacked());
+        REQUIRE(mappedFile->GetPtr() == nullptr);
+
+        std::vector<AmUInt8> content(length);
+        REQUIRE(mappedFile->Read(content.data(), length) == length);
+        REQUIRE(content == expected);
+    }
+}
+
+TEST_CASE("PackageFileSystem Corrupted Package Tests", "[filesystem][amplitude]")
+{
+    const auto path = std::filesystem::absolute("./corrupted.ampk");
+
+    PackageFileItemDescription item;
+    item.m_Name = "item.bin";
+
+    SECTION("cannot load a package with items stored past its end")
+    {
+        item.m_Offset = 0;
+        item.m_Size = 64;
+
+        WritePackage(path, ePackageFileCompressionAlgorithm_None, 0, item, std::vector<AmUInt8>(32, 1));
+
+        PackageFileSystem fileSystem;
+        REQUIRE(OpenPackageItem(fileSystem, path) == nullptr);
+        REQUIRE_FALSE(fileSystem.IsValid());
+
+        item.m_Offset = 1024;
+        item.m_Size = 0;
+
+        WritePackage(path, ePackageFileCompressionAlgorithm_None, 0, item, std::vector<AmUInt8>(32, 1));
+
+        PackageFileSystem other;
+        REQUIRE(OpenPackageItem(other, path) == nullptr);
+        REQUIRE_FALSE(other.IsValid());
+    }
+
+    SECTION("rejects corrupted block offsets")
+    {
+        constexpr AmUInt32 kBlockSize = 16;
+
+        // Two blocks, so the table holds three offsets
+        item.m_Offset = 0;
+        item.m_Size = kBlockSize * 2;
+
+        const std::vector<std::vector<AmUInt64>> tables = {
+            { 24, 12, 40 }, // Not monotonic
+            { 24, 32, 1ull << 40 }, // Past the end of the package
+            { 0, 32, 40 }, // Not starting after the table
+        };
+
+        for (const auto& table : tables)
+        {
+            std::vector<AmUInt8> data(64, 0);
+            std::memcpy(data.data(), table.data(), table.size() * sizeof(AmUInt64));
+
+            WritePackage(path, ePackageFileCompressionAlgorithm_ZLib, kBlockSize, item, data);
+
+            for (const bool mapped : { false, true })
+            {
+                PackageFileSystem fileSystem;
+                fileSystem.SetMemoryMappingEnabled(mapped);
+
+                const auto file = OpenPackageItem(fileSystem, path);
+                REQUIRE(file != nullptr);
+                REQUIRE_FALSE(file->IsValid());
+
+                AmUInt8 buffer[kBlockSize * 2];
+                REQUIRE(file->Read(buffer, sizeof(buffer)) == 0);
+            }
+        }
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Asynchronous File Reads Tests", "[filesystem][amplitude]")
+{
+    DiskFileSystem diskFileSystem;
+    diskFileSystem.SetBasePath(AM_OS_STRING("./samples/assets"));
+
+    PackageFileSystem packageFileSystem;
+    packageFileSystem.SetBasePath(AM_OS_STRING("./samples/assets.ampk"));
+
+    PackageFileSystem compressedFileSystem;
+    compressedFileSystem.SetBasePath(AM_OS_STRING("./samples/assets_zlib.ampk"));
+
+    packageFileSystem.StartOpenFileSystem();
+    compressedFileSystem.StartOpenFileSystem();
+    while (!packageFileSystem.TryFinalizeOpenFileSystem() || !compressedFileSystem.TryFinalizeOpenFileSystem())
+        Thread::Sleep(1);
+
+    const auto diskFile = diskFileSystem.OpenFile(AM_OS_STRING("data/throw_05.ogg"), eFileOpenMode_Read);
+    const AmSize length = diskFile->Length();
+
+    std::vector<AmUInt8> expected(length);
+    REQUIRE(diskFile->Read(expected.data(), length) == length);
+
+    const auto readInChunks = [&](const std::shared_ptr<File>& file)
+    {
+        constexpr AmSize kChunkSize = 1000;
+
+        std::vector<AmUInt8> content(length);
+        std::atomic<AmSize> totalRead = 0;
+        std::atomic<AmSize> completed = 0;
+        AmSize submitted = 0;
+
+        for (AmSize offset = 0; offset < length; offset += kChunkSize, ++submitted)
+        {
+            const AmSize size = AM_MIN(kChunkSize, length - offset);
+            const auto priority = static_cast<eFileReadPriority>(submitted % 3);
+
+            file->ReadAsync(
+                offset, size, content.data() + offset,
+                [&totalRead, &completed](AmSize read)
+                {
+                    totalRead += read;
+                    ++completed;
+                },
+                priority);
+        }
+
+        while (completed < submitted)
+            Thread::Sleep(1);
+
+        REQUIRE(totalRead == length);
+        REQUIRE(content == expected);
+    };
+
+    SECTION("can read disk files asynchronously")
+    {
+        readInChunks(diskFile);
+        REQUIRE(diskFile->Position() == length);
+    }
+
+    SECTION("can read package items asynchronously")
+    {
+        const auto file = packageFileSystem.OpenFile(AM_OS_STRING("data/throw_05.ogg"));
+        readInChunks(file);
+        REQUIRE(file->Position() == 0);
+    }
+
+    SECTION("can read compressed package items asynchronously")
+    {
+        readInChunks(compressedFileSystem.OpenFile(AM_OS_STRING("data/throw_05.ogg")));
+    }
+
+    SECTION("can read in memory files asynchronously")
+    {
+        MemoryFile file;
+        file.Open(length);
+        file.Write(expected.data(), length);
+        file.Seek(0, eFileSeekOrigin_Start);
+
+        AmUInt8 value = 0;
+        AmSize read = 0;
+        file.ReadAsync(
+            1, 1, &value,
+            [&read](AmSize bytes)
+            {
+                read = bytes;
+            });
+
+        REQUIRE(read == 1);
+        REQUIRE(value == expected[1]);
+        REQUIRE(file.Position() == 0);
+    }
+
+    SECTION("reports short reads at the end of the file")
+    {
+        AmUInt8 buffer[16];
+        std::atomic<AmSize> read = 0;
+        std::atomic<bool> done = false;
+
+        diskFile->ReadAsync(
+            length - 4, sizeof(buffer), buffer,
+            [&](AmSize bytes)
+            {
+                read = bytes;
+                done = true;
+            },
+            eFileReadPriority_Streaming);
+
+        while (!done)
+            Thread::Sleep(1);
+
+        REQUIRE(read == 4);
+        REQUIRE(std::equal(buffer, buffer + 4, expected.end() - 4));
+    }
+}
+
+TEST_CASE("File Read Scheduler Tests", "[filesystem][amplitude]")
+{
+    std::vector<AmUInt8> expected(4096);
+    for (AmSize i = 0; i < expected.size(); ++i)
+        expected[i] = static_cast<AmUInt8>(i * 7);
+
+    MemoryFile file;
+    file.Open(expected.size());
+    file.Write(expected.data(), expected.size());
+
+    SECTION("can be released from a read callback")
+    {
+        auto scheduler = std::make_shared<FileReadScheduler>(2);
+
+        AmUInt8 value = 0;
+        std::atomic<bool> done = false;
+
+        // The callback holds the last reference to the scheduler, so it is destroyed on an I/O thread
+        scheduler->Submit(
+            &file, 3, 1, &value,
+            [&done, scheduler](AmSize) mutable
+            {
+                scheduler.reset();
+                done = true;
+            },
+            eFileReadPriority_Normal);
+
+        scheduler.reset();
+
+        while (!done)
+            Thread::Sleep(1);
+
+        REQUIRE(value == expected[3]);
+    }
+
+    SECTION("completes the pending requests when draining")
+    {
+        FileReadScheduler scheduler(2);
+
+        std::vector<AmUInt8> content(expected.size());
+        std::atomic<AmSize> totalRead = 0;
+
+        for (AmSize offset = 0; offset < content.size(); offset += 256)
+        {
+            scheduler.Submit(
+                &file, offset, 256, content.data() + offset,
+                [&totalRead](AmSize read)
+                {
+                    totalRead += read;
+                },
+                eFileReadPriority_Normal);
+        }
+
+        scheduler.Drain(&file);
+
+        REQUIRE(totalRead == expected.size());
+        REQUIRE(content == expected);
+    }
+
+    SECTION("cancels the queued requests when draining from a read callback")
+    {
+        FileReadScheduler scheduler(1);
+
+        AmUInt8 value = 0;
+        std::array<AmUInt8, 4> others = {};
+        std::atomic<bool> submitted = false;
+        std::atomic<AmSize> completed = 0;
+        std::atomic<AmSize> totalRead = 0;
+
+        // The single I/O thread is busy running this callback, so the requests submitted meanwhile stay queued
+        scheduler.Submit(
+            &file, 3, 1, &value,
+            [&](AmSize)
+            {
+                while (!submitted)
+                    Thread::Sleep(1);
+
+                scheduler.Drain(&file);
+                ++completed;
+            },
+            eFileReadPriority_Normal);
+
+        for (AmSize i = 0; i < others.size(); ++i)
+        {
+            scheduler.Submit(
+                &file, 128 * (i + 1), 1, others.data() + i,
+                [&](AmSize read)
+                {
+                    totalRead += read;
+                    ++completed;
+                },
+                eFileReadPriority_Normal);
+        }
+
+        submitted = true;
+
+        while (completed != others.size() + 1)
+            Thread::Sleep(1);
+
+        REQUIRE(value == expected[3]);
+        REQUIRE(totalRead == 0);
+
+        // Nothing is left pending for the file
+        scheduler.Drain(&file);
+    }
+}
+
+TEST_CASE("CachedFileSystem Tests", "[filesystem][amplitude]")
+{
+    DiskFileSystem diskFileSystem;
+
+    CachedFileSystem fileSystem(&diskFileSystem);
+    fileSystem.SetBasePath(AM_OS_STRING("./samples/assets"));
+    fileSystem.SetBlockSize(4096);
+    fileSystem.SetBlockCacheCapacity(8);
+    fileSystem.SetReadAheadBlockCount(1);
+
+    fileSystem.StartOpenFileSystem();
+    while (!fileSystem.TryFinalizeOpenFileSystem())
+        Thread::Sleep(1);
+
+    const auto diskFile = diskFileSystem.OpenFile(AM_OS_STRING("data/throw_05.ogg"), eFileOpenMode_Read);
+    const AmSize length = diskFile->Length();
+
+    std::vector<AmUInt8> expected(length);
+    REQUIRE(diskFile->Read(expected.data(), length) == length);
+
+    SECTION("forwards the file system operations")
+    {
+        REQUIRE(fileSystem.GetFileSystem() == &diskFileSystem);
+        REQUIRE(fileSystem.GetBasePath() == diskFileSystem.GetBasePath());
+        REQUIRE(fileSystem.ResolvePath(AM_OS_STRING("data")) == diskFileSystem.ResolvePath(AM_OS_STRING("data")));
+        REQUIRE(fileSystem.Exists(AM_OS_STRING("data/throw_05.ogg")));
+        REQUIRE(fileSystem.IsDirectory(AM_OS_STRING("data")));
+    }
+
+    SECTION("can read the entire file")
+    {
+        const auto file = fileSystem.OpenFile(AM_OS_STRING("data/throw_05.ogg"));
+        REQUIRE(file->IsValid());
+        REQUIRE(file->Length() == length);
+
+        std::vector<AmUInt8> content(length);
+        REQUIRE(file->Read(content.data(), length) == length);
+        REQUIRE(content == expected);
+        REQUIRE(file->Eof());
+    }
+
+    SECTION("can seek and read across blocks")
+    {
+        const auto file = fileSystem.OpenFile(AM_OS_STRING("data/throw_05.ogg"));
+
+        const AmSize offset = 4096 - 3;
+        std::vector<AmUInt8> content(10);
+
+        file->Seek(offset, eFileSeekOrigin_Start);
+        REQUIRE(file->Read(content.data(), 10) == 10);
+        REQUIRE(std::equal(content.begin(), content.end(), expected.begin() + offset));
+        REQUIRE(file->Position() == offset + 10);
+
+        file->Seek(-4, eFileSeekOrigin_End);
+        REQUIRE(file->Read(content.data(), 10) == 4);
+        REQUIRE(std::equal(content.begin(), content.begin() + 4, expected.end() - 4));
+    }
+
+    SECTION("reuses cached blocks across opened files")
+    {
+        AmUInt8 buffer[16];
+
+        fileSystem.ResetStatistics();
+
+        const auto file = fileSystem.OpenFile(AM_OS_STRING("data/throw_05.ogg"));
+        REQUIRE(file->ReadAt(0, buffer, sizeof(buffer)) == sizeof(buffer));
+
+        auto statistics = fileSystem.GetStatistics();
+        REQUIRE(statistics.m_Misses == 1);
+        REQUIRE(statistics.m_Hits == 0);
+        REQUIRE(statistics.m_PrefetchedBlocks == 1);
+
+        // The second block has been read ahead
+        const auto other = fileSystem.OpenFile(AM_OS_STRING("data/throw_05.ogg"));
+        REQUIRE(other->ReadAt(4096, buffer, sizeof(buffer)) == sizeof(buffer));
+        REQUIRE(std::equal(buffer, buffer + sizeof(buffer), expected.begin() + 4096));
+
+        statistics = fileSystem.GetStatistics();
+        REQUIRE(statistics.m_Misses == 1);
+        REQUIRE(statistics.m_Hits == 1);
+        REQUIRE(statistics.m_BytesRead == 8192);
+
+        fileSystem.ClearCache();
+        REQUIRE(other->ReadAt(0, buffer, sizeof(buffer)) == sizeof(buffer));
+        REQUIRE(fileSystem.GetStatistics().m_Misses == 2);
+    }
+
+    SECTION("keeps its block settings until it is opened again")
+    {
+        AmUInt8 buffer[16];
+
+        const auto file = fileSystem.OpenFile(AM_OS_STRING("data/throw_05.ogg"));
+        REQUIRE(file->ReadAt(0, buffer, sizeof(buffer)) == sizeof(buffer));
+
+        fileSystem.SetBlockSize(1024);
+        fileSystem.SetReadAheadBlockCount(0);
+        fileSystem.ResetStatistics();
+
+        // The blocks cached with the previous size are still valid for the files opened afterwards
+        const auto other = fileSystem.OpenFile(AM_OS_STRING("data/throw_05.ogg"));
+        REQUIRE(other->ReadAt(4096 + 1024, buffer, sizeof(buffer)) == sizeof(buffer));
+        REQUIRE(std::equal(buffer, buffer + sizeof(buffer), expected.begin() + 4096 + 1024));
+
+        const auto statistics = fileSystem.GetStatistics();
+        REQUIRE(statistics.m_Misses == 0);
+        REQUIRE(statistics.m_Hits == 1);
+    }
+
+    SECTION("can read files asynchronously")
+    {
+        const auto file = fileSystem.OpenFile(AM_OS_STRING("data/throw_05.ogg"));
+
+        std::vector<AmUInt8> content(length);
+        std::atomic<AmSize> totalRead = 0;
+        std::atomic<AmSize> completed = 0;
+        AmSize submitted = 0;
+
+        for (AmSize offset = 0; offset < length; offset += 1000, ++submitted)
+        {
+            file->ReadAsync(
+                offset, AM_MIN(static_cast<AmSize>(1000), length - offset), content.data() + offset,
+                [&totalRead, &completed](AmSize read)
+                {
+                    totalRead += read;
+                    ++completed;
+                });
+        }
+
+        while (completed < submitted)
+            Thread::Sleep(1);
+
+        REQUIRE(totalRead == length);
+        REQUIRE(content == expected);
+    }
+
+    SECTION("can prefetch file ranges")
+    {
+        const auto file = fileSystem.OpenFile(AM_OS_STRING("data/throw_05.ogg"));
+
+        fileSystem.ClearCache();
+        fileSystem.ResetStatistics();
+
+        // The file spans 3 blocks, the last one being partial
+        file->Prefetch(0, length);
+
+        while (fileSystem.GetStatistics().m_PrefetchedBlocks < 3)
+            Thread::Sleep(1);
+
+        std::vector<AmUInt8> content(length);
+        REQUIRE(file->ReadAt(0, content.data(), length) == length);
+        REQUIRE(content == expected);
+
+        const auto statistics = fileSystem.GetStatistics();
+        REQUIRE(statistics.m_Misses == 0);
+        REQUIRE(statistics.m_Hits == 3);
+    }
+
+    SECTION("does not cache files opened for writing")
+    {
+        const auto file = fileSystem.OpenFile(AM_OS_STRING("data/tests/file_read_test.txt"), eFileOpenMode_Append);
+        REQUIRE(std::dynamic_pointer_cast<DiskFile>(file) != nullptr);
+    }
+
+    fileSystem.StartCloseFileSystem();
+    while (!fileSystem.TryFinalizeCloseFileSystem())
+        Thread::Sleep(1);
+}
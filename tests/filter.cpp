@@ -0,0 +1,380 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <random>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+#include <DSP/BiquadCascade.h>
+#include <DSP/Filters/BiquadResonantFilter.h>
+#include <DSP/Filters/DCRemovalFilter.h>
+#include <DSP/Filters/DelayFilter.h>
+#include <DSP/Filters/LofiFilter.h>
+#include <DSP/Filters/MonoPoleFilter.h>
+#include <DSP/Filters/WaveShaperFilter.h>
+
+using namespace SparkyStudios::Audio::Amplitude;
+
+class HalfGainFilterInstance final : public SampleFilterInstance<HalfGainFilterInstance>
+{
+    friend class SampleFilterInstance<HalfGainFilterInstance>;
+
+public:
+    explicit HalfGainFilterInstance(Filter* parent)
+        : SampleFilterInstance(parent)
+    {
+        Initialize(1);
+    }
+
+protected:
+    AmAudioSample ProcessSample(AmAudioSample sample, AmUInt16 channel, AmUInt32 sampleRate) final
+    {
+        return sample * 0.5f;
+    }
+};
+
+static void FillNoise(AudioBuffer& buffer)
+{
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<AmReal32> distribution(-1.0f, 1.0f);
+
+    for (AmSize c = 0; c < buffer.GetChannelCount(); ++c)
+        for (AmSize i = 0; i < buffer.GetFrameCount(); ++i)
+            buffer[c][i] = distribution(generator);
+}
+
+static void ProcessInChunks(FilterInstance* instance, const AudioBuffer& in, AudioBuffer& out, AmUInt64 chunkSize)
+{
+    const AmSize channels = in.GetChannelCount();
+
+    AudioBuffer chunkIn(chunkSize, channels);
+    AudioBuffer chunkOut(chunkSize, channels);
+
+    for (AmUInt64 offset = 0; offset < in.GetFrameCount(); offset += chunkSize)
+    {
+        for (AmSize c = 0; c < channels; ++c)
+            std::copy_n(in[c].begin() + offset, chunkSize, chunkIn[c].begin());
+
+        instance->Process(chunkIn, chunkOut, chunkSize, 48000);
+
+        for (AmSize c = 0; c < channels; ++c)
+            std::copy_n(chunkOut[c].begin(), chunkSize, out[c].begin() + offset);
+    }
+}
+
+template<typename TFilter>
+static void RequireChunkInvariant(TFilter& filter)
+{
+    AudioBuffer in(1024, 2);
+    FillNoise(in);
+
+    AudioBuffer whole(1024, 2);
+    AudioBuffer chunked(1024, 2);
+
+    FilterInstance* a = filter.CreateInstance();
+    FilterInstance* b = filter.CreateInstance();
+
+    a->Process(in, whole, 1024, 48000);
+    ProcessInChunks(b, in, chunked, 128);
+
+    for (AmSize c = 0; c < 2; ++c)
+        for (AmSize i = 0; i < 1024; ++i)
+            REQUIRE(std::abs(whole[c][i] - chunked[c][i]) < 1e-5f);
+
+    filter.DestroyInstance(a);
+    filter.DestroyInstance(b);
+}
+
+static std::vector<AmAudioSample> DirectFormBiquad(const std::vector<AmAudioSample>& input, const BiquadCoefficients& c)
+{
+    std::vector<AmAudioSample> output(input.size());
+    AmReal32 x1 = 0.0f, x2 = 0.0f, y1 = 0.0f, y2 = 0.0f;
+
+    for (AmSize i = 0; i < input.size(); ++i)
+    {
+        const AmReal32 y = c.m_A0 * input[i] + c.m_A1 * x1 + c.m_A2 * x2 - c.m_B1 * y1 - c.m_B2 * y2;
+        x2 = x1;
+        x1 = input[i];
+        y2 = y1;
+        y1 = y;
+        output[i] = y;
+    }
+
+    return output;
+}
+
+TEST_CASE("Biquad Cascade Tests", "[biquad][filter][dsp][amplitude]")
+{
+    constexpr AmSize kLanes = 5;
+    constexpr AmSize kFrames = 1000;
+
+    AudioBuffer noise(kFrames, kLanes);
+    FillNoise(noise);
+
+    std::vector<AmAudioSample> inputs[kLanes];
+    for (AmSize lane = 0; lane < kLanes; ++lane)
+        inputs[lane].assign(noise[lane].begin(), noise[lane].begin() + kFrames);
+
+    SECTION("each lane matches a direct form biquad with its own coefficients")
+    {
+        BiquadCascade cascade(1);
+        BiquadCoefficients coefficients[kLanes];
+
+        for (AmSize lane = 0; lane < kLanes; ++lane)
+        {
+            coefficients[lane] = BiquadResonantFilter::ComputeCoefficients(
+                static_cast<BiquadResonantFilter::TYPE>(lane), 500.0f + 1000.0f * lane, 0.707107f, -6.0f, 48000);
+            cascade.SetCoefficients(0, lane, coefficients[lane], false);
+        }
+
+        REQUIRE_FALSE(cascade.IsInterpolating());
+
+        std::vector<AmAudioSample> outputs[kLanes];
+        for (auto& output : outputs)
+            output.resize(kFrames);
+
+        // Process in two uneven blocks to cover the state saved between calls
+        for (const auto& [offset, length] : { std::pair<AmSize, AmSize>{ 0, 333 }, std::pair<AmSize, AmSize>{ 333, kFrames - 333 } })
+        {
+            const AmAudioSample* in[kLanes];
+            AmAudioSample* out[kLanes];
+
+            for (AmSize lane = 0; lane < kLanes; ++lane)
+            {
+                in[lane] = inputs[lane].data() + offset;
+                out[lane] = outputs[lane].data() + offset;
+            }
+
+            cascade.Process(in, out, kLanes, length);
+        }
+
+        for (AmSize lane = 0; lane < kLanes; ++lane)
+        {
+            const auto expected = DirectFormBiquad(inputs[lane], coefficients[lane]);
+
+            for (AmSize i = 0; i < kFrames; ++i)
+                REQUIRE(std::abs(outputs[lane][i] - expected[i]) < 1e-4f);
+        }
+    }
+
+    SECTION("stages are applied in series")
+    {
+        const auto lowPass = BiquadResonantFilter::ComputeCoefficients(BiquadResonantFilter::TYPE_LOW_PASS, 2000.0f, 0.707107f, 0.0f, 48000);
+        const auto highPass = BiquadResonantFilter::ComputeCoefficients(BiquadResonantFilter::TYPE_HIGH_PASS, 200.0f, 0.707107f, 0.0f, 48000);
+
+        BiquadCascade cascade(2);
+        cascade.SetCoefficients(0, lowPass, false);
+        cascade.SetCoefficients(1, highPass, false);
+
+        std::vector<AmAudioSample> output(kFrames);
+        const AmAudioSample* in = inputs[0].data();
+        AmAudioSample* out = output.data();
+        cascade.Process(&in, &out, 1, kFrames);
+
+        const auto expected = DirectFormBiquad(DirectFormBiquad(inputs[0], lowPass), highPass);
+
+        for (AmSize i = 0; i < kFrames; ++i)
+            REQUIRE(std::abs(output[i] - expected[i]) < 1e-4f);
+    }
+
+    SECTION("coefficient changes are interpolated over one block")
+    {
+        BiquadCascade cascade(1);
+        cascade.SetCoefficients(0, BiquadCoefficients::OnePoleLowPass(0.9f));
+        REQUIRE(cascade.IsInterpolating());
+
+        std::vector<AmAudioSample> ones(kFrames, 1.0f);
+        std::vector<AmAudioSample> output(kFrames);
+        const AmAudioSample* in = ones.data();
+        AmAudioSample* out = output.data();
+
+        // Starts from the identity and ends on the low pass
+        cascade.Process(&in, &out, 1, kFrames);
+        REQUIRE_FALSE(cascade.IsInterpolating());
+        REQUIRE(output[0] == 1.0f);
+        REQUIRE(cascade.GetCoefficients(0, 0) == BiquadCoefficients::OnePoleLowPass(0.9f));
+
+        // Setting the same coefficients again doesn't restart the interpolation
+        cascade.SetCoefficients(0, BiquadCoefficients::OnePoleLowPass(0.9f));
+        REQUIRE_FALSE(cascade.IsInterpolating());
+    }
+}
+
+TEST_CASE("Filter Tests", "[filter][dsp][amplitude]")
+{
+    SECTION("sample filter instances process whole blocks")
+    {
+        AudioBuffer in(256, 2);
+        FillNoise(in);
+
+        AudioBuffer out(256, 2);
+
+        HalfGainFilterInstance instance(nullptr);
+        instance.Process(in, out, 256, 48000);
+
+        for (AmSize c = 0; c < 2; ++c)
+            for (AmSize i = 0; i < 256; ++i)
+                REQUIRE(out[c][i] == in[c][i] * 0.5f);
+    }
+
+    SECTION("biquad resonant filter keeps its state between blocks")
+    {
+        BiquadResonantFilter filter;
+        REQUIRE(filter.InitializeLowPass(1000.0f, 0.707107f) == eErrorCode_Success);
+        RequireChunkInvariant(filter);
+    }
+
+    SECTION("mono pole filter keeps its state between blocks")
+    {
+        MonoPoleFilter filter;
+        REQUIRE(filter.Initialize(0.5f) == eErrorCode_Success);
+        RequireChunkInvariant(filter);
+    }
+
+    SECTION("lofi filter keeps its state between blocks")
+    {
+        LofiFilter filter;
+        REQUIRE(filter.Init(8000.0f, 8.0f) == eErrorCode_Success);
+        RequireChunkInvariant(filter);
+    }
+
+    SECTION("wave shaper filter keeps its state between blocks")
+    {
+        WaveShaperFilter filter;
+        REQUIRE(filter.Init(0.5f) == eErrorCode_Success);
+        RequireChunkInvariant(filter);
+    }
+
+    SECTION("dc removal filter keeps its state between blocks")
+    {
+        DCRemovalFilter filter;
+        REQUIRE(filter.Initialize(0.01f) == eErrorCode_Success);
+        RequireChunkInvariant(filter);
+    }
+
+    SECTION("dc removal filter removes a constant offset")
+    {
+        DCRemovalFilter filter;
+        REQUIRE(filter.Initialize(0.01f) == eErrorCode_Success);
+
+        AudioBuffer in(2048, 1);
+        AudioBuffer out(2048, 1);
+
+        for (AmSize i = 0; i < 2048; ++i)
+            in[0][i] = 0.5f;
+
+        FilterInstance* instance = filter.CreateInstance();
+        ProcessInChunks(instance, in, out, 256);
+        filter.DestroyInstance(instance);
+
+        // The history covers 480 samples at 48kHz
+        for (AmSize i = 480; i < 2048; ++i)
+            REQUIRE(std::abs(out[0][i]) < 1e-5f);
+    }
+
+    SECTION("delay filter keeps its delay line between blocks")
+    {
+        DelayFilter filter;
+        REQUIRE(filter.Initialize(0.01f, 0.5f, 0.0f) == eErrorCode_Success);
+        RequireChunkInvariant(filter);
+
+        // The delay line is longer than a block
+        AudioBuffer in(2048, 1);
+        AudioBuffer out(2048, 1);
+        in[0][0] = 1.0f;
+
+        FilterInstance* instance = filter.CreateInstance();
+        instance->SetParameter(DelayFilter::ATTRIBUTE_DELAY_START, 1.0f);
+        ProcessInChunks(instance, in, out, 128);
+        filter.DestroyInstance(instance);
+
+        // 10ms at 48kHz
+        REQUIRE(out[0][0] == 0.0f);
+        REQUIRE(out[0][480] == 1.0f);
+        REQUIRE(out[0][960] == 0.5f);
+    }
+}
+
+TEST_CASE("Filter Benchmarks", "[.][benchmark][filter][dsp][amplitude]")
+{
+    AudioBuffer in(512, 2);
+    FillNoise(in);
+
+    AudioBuffer out(512, 2);
+
+    const auto benchmark = [&](const char* name, Filter& filter)
+    {
+        FilterInstance* instance = filter.CreateInstance();
+
+        BENCHMARK(name)
+        {
+            instance->Process(in, out, 512, 48000);
+            return out[0][0];
+        };
+
+        filter.DestroyInstance(instance);
+    };
+
+    BiquadResonantFilter biquad;
+    biquad.InitializeLowPass(1000.0f, 0.707107f);
+    benchmark("BiquadResonant", biquad);
+
+    MonoPoleFilter monoPole;
+    monoPole.Initialize(0.5f);
+    benchmark("MonoPole", monoPole);
+
+    LofiFilter lofi;
+    lofi.Init(8000.0f, 8.0f);
+    benchmark("Lofi", lofi);
+
+    WaveShaperFilter waveShaper;
+    waveShaper.Init(0.5f);
+    benchmark("WaveShaper", waveShaper);
+
+    DCRemovalFilter dcRemoval;
+    dcRemoval.Initialize(0.1f);
+    benchmark("DCRemoval", dcRemoval);
+
+    DelayFilter delay;
+    delay.Initialize(0.3f, 0.7f, 0.0f);
+    benchmark("Delay", delay);
+
+    AudioBuffer ambisonicIn(512, kAmMaxSupportedChannelCount);
+    FillNoise(ambisonicIn);
+
+    AudioBuffer ambisonicOut(512, kAmMaxSupportedChannelCount);
+
+    BiquadCascade cascade(3);
+    cascade.SetCoefficients(
+        0, BiquadResonantFilter::ComputeCoefficients(BiquadResonantFilter::TYPE_LOW_SHELF, 800.0f, 0.707107f, -6.0f, 48000), false);
+    cascade.SetCoefficients(
+        1, BiquadResonantFilter::ComputeCoefficients(BiquadResonantFilter::TYPE_PEAK, 2530.0f, 0.35f, -3.0f, 48000), false);
+    cascade.SetCoefficients(
+        2, BiquadResonantFilter::ComputeCoefficients(BiquadResonantFilter::TYPE_HIGH_SHELF, 8000.0f, 0.707107f, -12.0f, 48000), false);
+
+    BENCHMARK("BiquadCascade 3 stages x 2 channels")
+    {
+        cascade.Process(in, out, 512);
+        return out[0][0];
+    };
+
+    BENCHMARK("BiquadCascade 3 stages x 16 channels")
+    {
+        cascade.Process(ambisonicIn, ambisonicOut, 512);
+        return ambisonicOut[0][0];
+    };
+}
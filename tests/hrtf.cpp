@@ -14,12 +14,68 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <filesystem>
+
 #include <SparkyStudios/Audio/Amplitude/Amplitude.h>
 
+#include <DSP/ImpulseResponse.h>
 #include <HRTF/HRIRSphere.h>
 
 using namespace SparkyStudios::Audio::Amplitude;
 
+// Writes an HRIR sphere file the same way the amir tool does
+static void WriteSphere(
+    const std::filesystem::path& path,
+    const HRIRSphereFileHeaderDescription& header,
+    const std::vector<HRIRSphereVertex>& vertices,
+    const std::vector<Face>& faces)
+{
+    DiskFile file(path, eFileOpenMode_Write);
+
+    file.Write(header.m_Header, 4);
+    file.Write16(header.m_Version);
+    file.Write32(header.m_SampleRate);
+    file.Write32(header.m_IRLength);
+    file.Write32(static_cast<AmUInt32>(vertices.size()));
+    file.Write32(static_cast<AmUInt32>(faces.size() * 3));
+
+    if (header.m_Version >= 2)
+        file.Write32(header.m_BlockSize);
+
+    if (header.m_Version >= 3)
+        file.Write8(header.m_MinimumPhase ? 1 : 0);
+
+    for (const auto& face : faces)
+    {
+        file.Write32(face.m_A);
+        file.Write32(face.m_B);
+        file.Write32(face.m_C);
+    }
+
+    const AmSize spectrumSize = header.m_BlockSize > 0 ? MultiConvolver::GetSpectrumSize(header.m_IRLength, header.m_BlockSize) : 0;
+    std::vector<AmReal32> spectrum(spectrumSize);
+
+    for (const auto& vertex : vertices)
+    {
+        file.Write(reinterpret_cast<AmConstUInt8Buffer>(&vertex.m_Position), sizeof(AmVec3));
+        file.Write(reinterpret_cast<AmConstUInt8Buffer>(vertex.m_LeftIR.data()), header.m_IRLength * sizeof(AmReal32));
+        file.Write(reinterpret_cast<AmConstUInt8Buffer>(vertex.m_RightIR.data()), header.m_IRLength * sizeof(AmReal32));
+        file.Write(reinterpret_cast<AmConstUInt8Buffer>(&vertex.m_LeftDelay), sizeof(AmReal32));
+        file.Write(reinterpret_cast<AmConstUInt8Buffer>(&vertex.m_RightDelay), sizeof(AmReal32));
+
+        if (spectrumSize == 0)
+            continue;
+
+        MultiConvolver::TransformIR(vertex.m_LeftIR.data(), header.m_IRLength, header.m_BlockSize, spectrum.data());
+        file.Write(reinterpret_cast<AmConstUInt8Buffer>(spectrum.data()), spectrumSize * sizeof(AmReal32));
+
+        MultiConvolver::TransformIR(vertex.m_RightIR.data(), header.m_IRLength, header.m_BlockSize, spectrum.data());
+        file.Write(reinterpret_cast<AmConstUInt8Buffer>(spectrum.data()), spectrumSize * sizeof(AmReal32));
+    }
+
+    file.Close();
+}
+
 TEST_CASE("HRTF Sphere Tests", "[hrtf_sphere][hrtf][amplitude]")
 {
     HRIRSphereImpl sphere;
@@ -83,4 +139,348 @@ TEST_CASE("HRTF Sphere Tests", "[hrtf_sphere][hrtf][amplitude]")
 
     HRIRSphereVertex transformedVertex = sphere.GetVertex(0);
     REQUIRE(transformedVertex.m_Position == AM_Mul(rotation, AM_V4V(vertex.m_Position, 1.0f)).XYZ);
-}
\ No newline at end of file
+}
+
+TEST_CASE("HRTF Sphere Lookup Grid Tests", "[hrtf_sphere][hrtf][amplitude]")
+{
+    DiskFileSystem fs;
+    fs.SetBasePath(AM_OS_STRING("./samples/assets"));
+
+    HRIRSphereImpl searched;
+    searched.SetResource(AM_OS_STRING("./data/sadie_h12.amir"));
+    searched.Load(&fs);
+
+    HRIRSphereImpl grid;
+    grid.SetResource(AM_OS_STRING("./data/sadie_h12.amir"));
+    grid.SetLookupGridResolution(1.0f);
+    grid.Load(&fs);
+
+    REQUIRE(searched.GetLookupGridResolution() == 0.0f);
+    REQUIRE(grid.GetLookupGridResolution() == 1.0f);
+
+    const AmUInt32 length = grid.GetIRLength();
+    const AmReal32 radius = AM_Len(grid.GetVertex(0).m_Position);
+
+    std::vector<AmReal32> searchedL(length), searchedR(length), gridL(length), gridR(length);
+
+    const auto toDirection = [radius](AmReal32 azimuth, AmReal32 elevation)
+    {
+        azimuth *= AM_DegToRad;
+        elevation *= AM_DegToRad;
+
+        return AM_V3(
+            std::cos(elevation) * std::cos(azimuth) * radius, std::cos(elevation) * std::sin(azimuth) * radius,
+            std::sin(elevation) * radius);
+    };
+
+    const auto maxError = [&]()
+    {
+        AmReal32 error = 0.0f;
+        for (AmUInt32 i = 0; i < length; ++i)
+            error = AM_MAX(error, AM_MAX(std::abs(searchedL[i] - gridL[i]), std::abs(searchedR[i] - gridR[i])));
+
+        return error;
+    };
+
+    SECTION("grid directions match the searched HRIRs")
+    {
+        for (const auto mode : { eHRIRSphereSamplingMode_Bilinear, eHRIRSphereSamplingMode_NearestNeighbor })
+        {
+            searched.SetSamplingMode(mode);
+            grid.SetSamplingMode(mode);
+
+            for (AmReal32 elevation = -83.0f; elevation < 90.0f; elevation += 17.0f)
+            {
+                for (AmReal32 azimuth = 7.0f; azimuth < 360.0f; azimuth += 23.0f)
+                {
+                    const AmVec3 direction = toDirection(azimuth, elevation);
+
+                    searched.Sample(direction, searchedL.data(), searchedR.data());
+                    grid.Sample(direction, gridL.data(), gridR.data());
+
+                    REQUIRE(maxError() < 1e-4f);
+                }
+            }
+        }
+    }
+
+    SECTION("directions are rounded to the nearest grid step")
+    {
+        searched.SetSamplingMode(eHRIRSphereSamplingMode_Bilinear);
+        grid.SetSamplingMode(eHRIRSphereSamplingMode_Bilinear);
+
+        searched.Sample(toDirection(31.0f, 12.0f), searchedL.data(), searchedR.data());
+        grid.Sample(toDirection(30.8f, 12.3f), gridL.data(), gridR.data());
+        REQUIRE(maxError() < 1e-4f);
+
+        // The direction length doesn't matter
+        grid.Sample(AM_Mul(toDirection(31.0f, 12.0f), 3.0f), gridL.data(), gridR.data());
+        REQUIRE(maxError() < 1e-4f);
+    }
+
+    SECTION("the grid can be disabled")
+    {
+        searched.SetSamplingMode(eHRIRSphereSamplingMode_Bilinear);
+        grid.SetSamplingMode(eHRIRSphereSamplingMode_Bilinear);
+        grid.SetLookupGridResolution(0.0f);
+
+        const AmVec3 direction = toDirection(30.8f, 12.3f);
+
+        searched.Sample(direction, searchedL.data(), searchedR.data());
+        grid.Sample(direction, gridL.data(), gridR.data());
+        REQUIRE(maxError() == 0.0f);
+    }
+}
+
+TEST_CASE("HRTF Sphere Spectrum Tests", "[hrtf_sphere][hrtf][amplitude]")
+{
+    constexpr AmUInt32 kBlockSize = 64;
+
+    DiskFileSystem fs;
+    fs.SetBasePath(AM_OS_STRING("./samples/assets"));
+
+    HRIRSphereImpl source;
+    source.SetResource(AM_OS_STRING("./data/sadie_h12.amir"));
+    source.Load(&fs);
+
+    // Version 1 files only store the HRIRs in the time domain
+    REQUIRE(source.GetSpectrumBlockSize() == 0);
+    REQUIRE(source.GetSpectrumSize() == 0);
+
+    const AmUInt32 length = source.GetIRLength();
+    const AmSize spectrumSize = MultiConvolver::GetSpectrumSize(length, kBlockSize);
+    const auto path = std::filesystem::absolute("./sadie_h12_spectra.amir");
+
+    HRIRSphereFileHeaderDescription header;
+    header.m_Version = 2;
+    header.m_SampleRate = source.GetSampleRate();
+    header.m_IRLength = length;
+    header.m_BlockSize = kBlockSize;
+
+    WriteSphere(path, header, source.GetVertices(), source.GetFaces());
+
+    DiskFileSystem tmp;
+    tmp.SetBasePath(AM_OS_STRING("."));
+
+    HRIRSphereImpl sphere;
+    sphere.SetResource(AM_OS_STRING("./sadie_h12_spectra.amir"));
+    sphere.Load(&tmp);
+
+    std::filesystem::remove(path);
+
+    REQUIRE(sphere.IsLoaded());
+    REQUIRE(sphere.GetVertexCount() == source.GetVertexCount());
+    REQUIRE(sphere.GetSpectrumBlockSize() == kBlockSize);
+    REQUIRE(sphere.GetSpectrumSize() == spectrumSize);
+
+    std::vector<AmReal32> hrirL(length), hrirR(length);
+    std::vector<AmReal32> spectrumL(spectrumSize), spectrumR(spectrumSize);
+    std::vector<AmReal32> expectedL(spectrumSize), expectedR(spectrumSize);
+
+    SECTION("sampled spectra match the spectra of the sampled HRIRs")
+    {
+        for (const auto mode : { eHRIRSphereSamplingMode_Bilinear, eHRIRSphereSamplingMode_NearestNeighbor })
+        {
+            sphere.SetSamplingMode(mode);
+
+            for (const auto& direction : { AM_V3(1.0f, 0.0f, 0.0f), AM_V3(0.3f, -0.8f, 0.2f), AM_V3(-0.5f, 0.5f, -0.7f) })
+            {
+                sphere.Sample(direction, hrirL.data(), hrirR.data());
+                sphere.SampleSpectrum(direction, spectrumL.data(), spectrumR.data());
+
+                MultiConvolver::TransformIR(hrirL.data(), length, kBlockSize, expectedL.data());
+                MultiConvolver::TransformIR(hrirR.data(), length, kBlockSize, expectedR.data());
+
+                for (AmSize i = 0; i < spectrumSize; ++i)
+                {
+                    REQUIRE(std::abs(spectrumL[i] - expectedL[i]) < 1e-4f);
+                    REQUIRE(std::abs(spectrumR[i] - expectedR[i]) < 1e-4f);
+                }
+            }
+        }
+    }
+
+    SECTION("spheres without spectra leave the output untouched")
+    {
+        std::fill(spectrumL.begin(), spectrumL.end(), 1.0f);
+        source.SampleSpectrum(AM_V3(1.0f, 0.0f, 0.0f), spectrumL.data(), spectrumR.data());
+
+        for (const AmReal32 value : spectrumL)
+            REQUIRE(value == 1.0f);
+    }
+}
+
+TEST_CASE("HRIR Processing Tests", "[hrtf][dsp][amplitude]")
+{
+    SECTION("minimum phase moves a delayed impulse to the start")
+    {
+        std::vector<AmReal32> impulse(64, 0.0f);
+        impulse[10] = 0.5f;
+
+        std::vector<AmReal32> result(64);
+        ImpulseResponse::MakeMinimumPhase(impulse.data(), impulse.size(), result.data(), result.size());
+
+        REQUIRE(std::abs(result[0] - 0.5f) < 1e-4f);
+        for (AmSize i = 1; i < result.size(); ++i)
+            REQUIRE(std::abs(result[i]) < 1e-4f);
+    }
+
+    SECTION("minimum phase keeps the magnitude and moves the energy to the start")
+    {
+        DiskFileSystem fs;
+        fs.SetBasePath(AM_OS_STRING("./samples/assets"));
+
+        HRIRSphereImpl sphere;
+        sphere.SetResource(AM_OS_STRING("./data/sadie_h12.amir"));
+        sphere.Load(&fs);
+
+        const AmUInt32 length = sphere.GetIRLength();
+        const auto& hrir = sphere.GetVertex(100).m_RightIR;
+
+        std::vector<AmReal32> result(length);
+        ImpulseResponse::MakeMinimumPhase(hrir.data(), length, result.data(), length);
+
+        const AmSize size = length * 2;
+
+        FFT fft;
+        fft.Initialize(size);
+
+        AmAlignedReal32Buffer buffer;
+        buffer.Init(size, true);
+
+        SplitComplex expected, actual;
+
+        std::copy_n(hrir.begin(), length, buffer.GetBuffer());
+        fft.Forward(buffer.GetBuffer(), expected);
+
+        std::copy_n(result.begin(), length, buffer.GetBuffer());
+        fft.Forward(buffer.GetBuffer(), actual);
+
+        AmReal32 peak = 0.0f;
+        for (AmSize i = 0; i < expected.GetSize(); ++i)
+            peak = AM_MAX(peak, std::hypot(expected.re()[i], expected.im()[i]));
+
+        for (AmSize i = 0; i < expected.GetSize(); ++i)
+        {
+            const AmReal32 magnitude = std::hypot(expected.re()[i], expected.im()[i]);
+            REQUIRE(std::abs(std::hypot(actual.re()[i], actual.im()[i]) - magnitude) < peak * 1e-2f);
+        }
+
+        // The minimum-phase response has the most energy in its first samples
+        AmReal32 energy = 0.0f, minimumPhaseEnergy = 0.0f;
+        for (AmSize i = 0; i < length; ++i)
+        {
+            energy += hrir[i] * hrir[i];
+            minimumPhaseEnergy += result[i] * result[i];
+
+            REQUIRE(minimumPhaseEnergy >= energy * 0.999f);
+        }
+    }
+
+    SECTION("fractional delays interpolate between samples")
+    {
+        constexpr AmSize kLength = 32;
+
+        std::vector<AmReal32> ramp(kLength);
+        for (AmSize i = 0; i < kLength; ++i)
+            ramp[i] = static_cast<AmReal32>(i * i) / 64.0f;
+
+        for (const AmReal32 delay : { 0.0f, 3.0f, 2.25f, 7.6f })
+        {
+            const AmSize delayedLength = ImpulseResponse::GetDelayedLength(kLength, delay);
+            std::vector<AmReal32> delayed(delayedLength);
+            ImpulseResponse::ApplyFractionalDelay(ramp.data(), kLength, delay, delayed.data(), delayedLength);
+
+            // Third-order Lagrange interpolation is exact for polynomials, away from the edges
+            for (AmSize i = static_cast<AmSize>(delay) + 2; i < kLength; ++i)
+            {
+                const AmReal32 position = static_cast<AmReal32>(i) - delay;
+                REQUIRE(std::abs(delayed[i] - position * position / 64.0f) < 1e-3f);
+            }
+        }
+
+        // Integer delays shift the input exactly
+        std::vector<AmReal32> delayed(ImpulseResponse::GetDelayedLength(kLength, 5.0f));
+        ImpulseResponse::ApplyFractionalDelay(ramp.data(), kLength, 5.0f, delayed.data(), delayed.size());
+
+        for (AmSize i = 0; i < kLength; ++i)
+            REQUIRE(delayed[i + 5] == ramp[i]);
+    }
+
+    SECTION("minimum-phase spheres sample their delays")
+    {
+        constexpr AmUInt32 kLength = 64;
+
+        DiskFileSystem fs;
+        fs.SetBasePath(AM_OS_STRING("./samples/assets"));
+
+        HRIRSphereImpl source;
+        source.SetResource(AM_OS_STRING("./data/sadie_h12.amir"));
+        source.Load(&fs);
+
+        REQUIRE_FALSE(source.IsMinimumPhase());
+
+        std::vector<HRIRSphereVertex> vertices = source.GetVertices();
+        for (auto& vertex : vertices)
+        {
+            for (auto* ir : { &vertex.m_LeftIR, &vertex.m_RightIR })
+            {
+                ImpulseResponse::MakeMinimumPhase(ir->data(), ir->size(), ir->data(), kLength);
+                ir->resize(kLength);
+            }
+        }
+
+        HRIRSphereFileHeaderDescription header;
+        header.m_Version = 3;
+        header.m_SampleRate = source.GetSampleRate();
+        header.m_IRLength = kLength;
+        header.m_MinimumPhase = true;
+
+        const auto path = std::filesystem::absolute("./sadie_h12_minimum_phase.amir");
+        WriteSphere(path, header, vertices, source.GetFaces());
+
+        DiskFileSystem tmp;
+        tmp.SetBasePath(AM_OS_STRING("."));
+
+        HRIRSphereImpl sphere;
+        sphere.SetResource(AM_OS_STRING("./sadie_h12_minimum_phase.amir"));
+        sphere.Load(&tmp);
+
+        std::filesystem::remove(path);
+
+        REQUIRE(sphere.IsLoaded());
+        REQUIRE(sphere.IsMinimumPhase());
+        REQUIRE(sphere.GetIRLength() == kLength);
+
+        for (const AmUInt32 index : { 0u, 100u, 1000u })
+        {
+            const auto& vertex = sphere.GetVertex(index);
+
+            AmReal32 leftDelay = -1.0f, rightDelay = -1.0f;
+            sphere.SampleDelay(vertex.m_Position, leftDelay, rightDelay);
+
+            REQUIRE(leftDelay == vertex.m_LeftDelay);
+            REQUIRE(rightDelay == vertex.m_RightDelay);
+        }
+
+        // Delays are blended like the HRIRs between the vertices
+        const auto& face = sphere.GetFaces()[10];
+        const AmVec3 center = AM_Div(
+            sphere.GetVertex(face.m_A).m_Position + sphere.GetVertex(face.m_B).m_Position + sphere.GetVertex(face.m_C).m_Position, 3.0f);
+
+        AmReal32 leftDelay = 0.0f, rightDelay = 0.0f;
+        sphere.SampleDelay(center, leftDelay, rightDelay);
+
+        const auto between = [](AmReal32 value, AmReal32 a, AmReal32 b, AmReal32 c)
+        {
+            return value >= std::min({ a, b, c }) - 1e-6f && value <= std::max({ a, b, c }) + 1e-6f;
+        };
+
+        REQUIRE(between(
+            leftDelay, sphere.GetVertex(face.m_A).m_LeftDelay, sphere.GetVertex(face.m_B).m_LeftDelay,
+            sphere.GetVertex(face.m_C).m_LeftDelay));
+        REQUIRE(between(
+            rightDelay, sphere.GetVertex(face.m_A).m_RightDelay, sphere.GetVertex(face.m_B).m_RightDelay,
+            sphere.GetVertex(face.m_C).m_RightDelay));
+    }
+}
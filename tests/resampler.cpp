@@ -0,0 +1,246 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+#include <DSP/Resamplers/PolyphaseResampler.h>
+
+using namespace SparkyStudios::Audio::Amplitude;
+
+constexpr AmSize kBlockSize = 512;
+
+// Resamples the given signal block by block, feeding exactly the number of input frames the resampler asks for.
+template<typename RatioFunction>
+static std::vector<AmAudioSample> Resample(
+    ResamplerInstance* instance, const std::vector<AmAudioSample>& signal, AmSize outputLength, RatioFunction&& ratio)
+{
+    std::vector<AmAudioSample> result;
+
+    AudioBuffer input(kAmMaxSupportedFrameCount, 1);
+    AudioBuffer output(kBlockSize, 1);
+
+    AmSize cursor = 0;
+    while (result.size() < outputLength)
+    {
+        const auto [sampleRateIn, sampleRateOut] = ratio(result.size());
+        instance->SetSampleRate(sampleRateIn, sampleRateOut);
+
+        AmUInt64 inputFrames = instance->GetRequiredInputFrames(kBlockSize);
+        AmUInt64 outputFrames = kBlockSize;
+
+        REQUIRE(cursor + inputFrames <= signal.size());
+        std::copy_n(signal.begin() + cursor, inputFrames, input[0].begin());
+
+        const AmUInt64 required = inputFrames;
+        instance->Process(input, inputFrames, output, outputFrames);
+
+        REQUIRE(inputFrames == required);
+        REQUIRE(outputFrames == kBlockSize);
+
+        result.insert(result.end(), output[0].begin(), output[0].begin() + outputFrames);
+        cursor += inputFrames;
+    }
+
+    return result;
+}
+
+static std::vector<AmAudioSample> Sine(AmSize length, AmReal64 frequency, AmReal64 sampleRate)
+{
+    std::vector<AmAudioSample> signal(length);
+
+    for (AmSize i = 0; i < length; ++i)
+        signal[i] = static_cast<AmAudioSample>(std::sin(2.0 * AM_PI * frequency * static_cast<AmReal64>(i) / sampleRate));
+
+    return signal;
+}
+
+TEST_CASE("Polyphase Resampler Tests", "[resampler][dsp][amplitude]")
+{
+    constexpr ePolyphaseResamplerQuality qualities[4] = {
+        ePolyphaseResamplerQuality_Linear,
+        ePolyphaseResamplerQuality_Cubic,
+        ePolyphaseResamplerQuality_Sinc8,
+        ePolyphaseResamplerQuality_Sinc32,
+    };
+
+    constexpr AmReal32 kMaxErrors[4] = { 5e-3f, 2e-4f, 5e-3f, 5e-4f };
+
+    SECTION("every quality resamples a sine accurately")
+    {
+        constexpr AmUInt32 kSampleRateIn = 44100;
+        constexpr AmUInt32 kSampleRateOut = 48000;
+        constexpr AmReal64 kFrequency = 1000.0;
+        constexpr AmReal64 kStep = static_cast<AmReal64>(kSampleRateIn) / kSampleRateOut;
+
+        const auto signal = Sine(kSampleRateIn, kFrequency, kSampleRateIn);
+
+        for (AmSize q = 0; q < 4; ++q)
+        {
+            PolyphaseResampler resampler("polyphase_test", qualities[q]);
+
+            ResamplerInstance* instance = resampler.CreateInstance();
+            instance->Initialize(1, kSampleRateIn, kSampleRateOut);
+
+            const auto output = Resample(instance, signal, kSampleRateOut / 2,
+                [](AmSize)
+                {
+                    return std::pair{ 44100u, 48000u };
+                });
+
+            const auto latency = static_cast<AmReal64>(resampler.GetLatency());
+
+            AmReal32 maxError = 0.0f;
+            for (AmSize j = 128; j < output.size(); ++j)
+            {
+                const AmReal64 position = static_cast<AmReal64>(j) * kStep - latency;
+                const auto expected = static_cast<AmReal32>(std::sin(2.0 * AM_PI * kFrequency * position / kSampleRateIn));
+                maxError = AM_MAX(maxError, std::abs(output[j] - expected));
+            }
+
+            REQUIRE(maxError < kMaxErrors[q]);
+
+            resampler.DestroyInstance(instance);
+        }
+    }
+
+    SECTION("linear and cubic interpolation reproduce a ramp exactly")
+    {
+        std::vector<AmAudioSample> ramp(kAmMaxSupportedFrameCount);
+        for (AmSize i = 0; i < ramp.size(); ++i)
+            ramp[i] = static_cast<AmAudioSample>(i) / 1024.0f;
+
+        for (AmSize q = 0; q < 2; ++q)
+        {
+            PolyphaseResampler resampler("polyphase_test", qualities[q]);
+
+            ResamplerInstance* instance = resampler.CreateInstance();
+            instance->Initialize(1, 3, 4);
+
+            const auto output = Resample(instance, ramp, kBlockSize * 8,
+                [](AmSize)
+                {
+                    return std::pair{ 3u, 4u };
+                });
+
+            for (AmSize j = 8; j < output.size(); ++j)
+            {
+                const AmReal64 position = static_cast<AmReal64>(j) * 0.75 - static_cast<AmReal64>(resampler.GetLatency());
+                REQUIRE(std::abs(output[j] - position / 1024.0) < 1e-5);
+            }
+
+            resampler.DestroyInstance(instance);
+        }
+    }
+
+    SECTION("the ratio can change continuously without discontinuities")
+    {
+        constexpr AmReal64 kFrequency = 100.0;
+        constexpr AmUInt32 kSampleRate = 48000;
+
+        const auto signal = Sine(kSampleRate * 4, kFrequency, kSampleRate);
+
+        for (AmSize q = 0; q < 4; ++q)
+        {
+            PolyphaseResampler resampler("polyphase_test", qualities[q]);
+
+            ResamplerInstance* instance = resampler.CreateInstance();
+            instance->Initialize(1, kSampleRate, kSampleRate);
+
+            // Sweep the pitch from 0.5 to 3.0, crossing every filter bank
+            const auto pitch = [](AmSize frame)
+            {
+                return 0.5 + 2.5 * static_cast<AmReal64>(frame) / (kBlockSize * 64);
+            };
+
+            const auto output = Resample(instance, signal, kBlockSize * 64,
+                [&pitch](AmSize frame)
+                {
+                    return std::pair{ static_cast<AmUInt32>(pitch(frame) * 1000), 1000u };
+                });
+
+            // The output is a sine sweeping up to 300Hz, so consecutive frames can't be further apart than its slope
+            const AmReal64 maxSlope = 2.0 * AM_PI * kFrequency * 3.0 / kSampleRate;
+            for (AmSize j = 64; j < output.size(); ++j)
+                REQUIRE(std::abs(output[j] - output[j - 1]) < maxSlope * 1.05 + kMaxErrors[q] * 2);
+
+            resampler.DestroyInstance(instance);
+        }
+    }
+
+    SECTION("resetting clears the history")
+    {
+        PolyphaseResampler resampler("polyphase_test", ePolyphaseResamplerQuality_Sinc32);
+
+        ResamplerInstance* instance = resampler.CreateInstance();
+        instance->Initialize(2, 44100, 48000);
+
+        AudioBuffer input(kBlockSize, 2);
+        AudioBuffer output(kBlockSize, 2);
+
+        std::fill(input[0].begin(), input[0].end(), 1.0f);
+        std::fill(input[1].begin(), input[1].end(), -1.0f);
+
+        AmUInt64 inputFrames = kBlockSize;
+        AmUInt64 outputFrames = kBlockSize;
+        instance->Process(input, inputFrames, output, outputFrames);
+
+        REQUIRE(instance->GetOutputLatency() > 0);
+
+        instance->Reset();
+        input.Clear();
+
+        inputFrames = instance->GetRequiredInputFrames(kBlockSize);
+        outputFrames = kBlockSize;
+        instance->Process(input, inputFrames, output, outputFrames);
+
+        for (AmSize i = 0; i < outputFrames; ++i)
+        {
+            REQUIRE(output[0][i] == 0.0f);
+            REQUIRE(output[1][i] == 0.0f);
+        }
+
+        resampler.DestroyInstance(instance);
+    }
+}
+
+TEST_CASE("Polyphase Resampler Benchmarks", "[.][benchmark][resampler][dsp][amplitude]")
+{
+    AudioBuffer input(kAmMaxSupportedFrameCount, 2);
+    AudioBuffer output(kBlockSize, 2);
+
+    for (AmSize i = 0; i < input.GetFrameCount(); ++i)
+    {
+        input[0][i] = static_cast<AmAudioSample>(i % 37) / 37.0f - 0.5f;
+        input[1][i] = static_cast<AmAudioSample>(i % 23) / 23.0f - 0.5f;
+    }
+
+    for (const char* name : { "default", "linear", "cubic", "sinc8", "sinc32" })
+    {
+        ResamplerInstance* instance = Resampler::Construct(name);
+        instance->Initialize(2, 44100, 48000);
+
+        BENCHMARK(std::string(name) + " 44100Hz to 48000Hz 512 frames")
+        {
+            AmUInt64 inputFrames = instance->GetRequiredInputFrames(kBlockSize);
+            AmUInt64 outputFrames = kBlockSize;
+            instance->Process(input, inputFrames, output, outputFrames);
+            return output[0][0];
+        };
+
+        Resampler::Destruct(name, instance);
+    }
+}
@@ -0,0 +1,155 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+#include <DSP/FDNReverb.h>
+
+using namespace SparkyStudios::Audio::Amplitude;
+
+constexpr AmUInt32 kSampleRate = 48000;
+
+static std::vector<AmAudioSample> Impulse(AmSize length)
+{
+    std::vector<AmAudioSample> signal(length, 0.0f);
+    signal[0] = 1.0f;
+
+    return signal;
+}
+
+static AmReal32 Energy(const std::vector<AmAudioSample>& signal, AmSize from, AmSize to)
+{
+    AmReal32 energy = 0.0f;
+
+    for (AmSize i = from; i < to; ++i)
+        energy += signal[i] * signal[i];
+
+    return energy;
+}
+
+TEST_CASE("FDN Reverb Tests", "[reverb][dsp][amplitude]")
+{
+    constexpr AmSize kFrames = kSampleRate * 2;
+
+    const auto input = Impulse(kFrames);
+
+    std::vector<AmAudioSample> left(kFrames), right(kFrames);
+
+    FDNReverb reverb;
+    reverb.Initialize(kSampleRate);
+    REQUIRE(reverb.GetSampleRate() == kSampleRate);
+
+    SECTION("silence stays silent")
+    {
+        const std::vector<AmAudioSample> silence(kFrames, 0.0f);
+        reverb.Process(silence.data(), left.data(), right.data(), kFrames);
+
+        for (AmSize i = 0; i < kFrames; ++i)
+        {
+            REQUIRE(std::abs(left[i]) < 1e-9f);
+            REQUIRE(std::abs(right[i]) < 1e-9f);
+        }
+    }
+
+    SECTION("an impulse produces a decaying stereo tail")
+    {
+        reverb.Process(input.data(), left.data(), right.data(), kFrames);
+
+        // Nothing comes out before the shortest delay line
+        for (AmSize i = 0; i < 1200; ++i)
+            REQUIRE(left[i] == 0.0f);
+
+        const AmReal32 early = Energy(left, 0, kSampleRate / 2);
+        const AmReal32 late = Energy(left, kSampleRate, kSampleRate * 3 / 2);
+
+        REQUIRE(early > 0.0f);
+        REQUIRE(late > 0.0f);
+        REQUIRE(late < early);
+
+        // Both sides are fed by different delay lines
+        bool different = false;
+        for (AmSize i = 0; i < kFrames && !different; ++i)
+            different = left[i] != right[i];
+
+        REQUIRE(different);
+    }
+
+    SECTION("larger rooms have longer tails")
+    {
+        reverb.SetRoomSize(0.2f);
+        reverb.Process(input.data(), left.data(), right.data(), kFrames);
+        const AmReal32 small = Energy(left, kSampleRate, kFrames);
+
+        FDNReverb large;
+        large.Initialize(kSampleRate);
+        large.SetRoomSize(0.9f);
+        large.Process(input.data(), left.data(), right.data(), kFrames);
+
+        REQUIRE(Energy(left, kSampleRate, kFrames) > small);
+    }
+
+    SECTION("processing in chunks and in place matches processing at once")
+    {
+        reverb.Process(input.data(), left.data(), right.data(), kFrames);
+
+        FDNReverb chunked;
+        chunked.Initialize(kSampleRate);
+
+        // The input is processed in place, in the right output
+        std::vector<AmAudioSample> chunkedLeft(kFrames), chunkedRight = input;
+
+        for (AmSize offset = 0; offset < kFrames;)
+        {
+            const AmSize length = AM_MIN(static_cast<AmSize>(300), kFrames - offset);
+            chunked.Process(chunkedRight.data() + offset, chunkedLeft.data() + offset, chunkedRight.data() + offset, length);
+            offset += length;
+        }
+
+        for (AmSize i = 0; i < kFrames; ++i)
+        {
+            REQUIRE(std::abs(left[i] - chunkedLeft[i]) < 1e-6f);
+            REQUIRE(std::abs(right[i] - chunkedRight[i]) < 1e-6f);
+        }
+    }
+
+    SECTION("clearing cuts the tail")
+    {
+        reverb.Process(input.data(), left.data(), right.data(), kSampleRate / 2);
+        reverb.Clear();
+
+        const std::vector<AmAudioSample> silence(kFrames, 0.0f);
+        reverb.Process(silence.data(), left.data(), right.data(), kFrames);
+
+        REQUIRE(Energy(left, 0, kFrames) < 1e-12f);
+    }
+}
+
+TEST_CASE("FDN Reverb Benchmarks", "[.][benchmark][reverb][dsp][amplitude]")
+{
+    std::vector<AmAudioSample> input(512), left(512), right(512);
+    for (AmSize i = 0; i < input.size(); ++i)
+        input[i] = static_cast<AmAudioSample>(i % 37) / 37.0f - 0.5f;
+
+    FDNReverb reverb;
+    reverb.Initialize(kSampleRate);
+
+    BENCHMARK("FDNReverb 512 frames")
+    {
+        reverb.Process(input.data(), left.data(), right.data(), input.size());
+        return left[0];
+    };
+}
@@ -0,0 +1,278 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <random>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+#include <Ambisonics/AmbisonicOrientationProcessor.h>
+#include <Utils/SimdKernels.h>
+
+using namespace SparkyStudios::Audio::Amplitude;
+
+// Long enough to cover a few SIMD registers, with a scalar tail for every width
+constexpr AmSize kSimdTestLength = 67;
+
+static std::vector<AmReal32> Noise(AmSize length, AmUInt32 seed)
+{
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<AmReal32> distribution(-1.0f, 1.0f);
+
+    std::vector<AmReal32> result(length);
+    for (auto& value : result)
+        value = distribution(generator);
+
+    return result;
+}
+
+static void RequireNear(const std::vector<AmReal32>& actual, const std::vector<AmReal32>& expected)
+{
+    REQUIRE(actual.size() == expected.size());
+
+    for (AmSize i = 0; i < actual.size(); ++i)
+        REQUIRE(std::abs(actual[i] - expected[i]) < 1e-5f);
+}
+
+TEST_CASE("SIMD Kernels Tests", "[simd][dsp][amplitude]")
+{
+    const auto available = GetAvailableSimdKernels();
+
+    SECTION("the baseline kernels are always available")
+    {
+        REQUIRE_FALSE(available.empty());
+        REQUIRE(available.front()->m_Width >= 1);
+    }
+
+    SECTION("the widest supported kernels are selected")
+    {
+        REQUIRE(&SelectSimdKernels() == available.back());
+        REQUIRE(&GetSimdKernels() == available.back());
+    }
+
+    for (const SimdKernels* kernels : available)
+    {
+        DYNAMIC_SECTION(kernels->m_Name << " kernels match the scalar results")
+        {
+            // Offset the buffers by one float, the kernels must not rely on the alignment
+            const auto a = Noise(kSimdTestLength + 1, 1);
+            const auto b = Noise(kSimdTestLength + 1, 2);
+            const auto c = Noise(kSimdTestLength + 1, 3);
+            const auto d = Noise(kSimdTestLength + 1, 4);
+
+            for (AmSize length : { AmSize(0), AmSize(1), AmSize(3), AmSize(16), kSimdTestLength })
+            {
+                std::vector<AmReal32> result(length), expected(length);
+
+                kernels->m_Add(result.data(), a.data() + 1, b.data() + 1, length);
+                for (AmSize i = 0; i < length; ++i)
+                    expected[i] = a[i + 1] + b[i + 1];
+                RequireNear(result, expected);
+
+                kernels->m_Subtract(result.data(), a.data() + 1, b.data() + 1, length);
+                for (AmSize i = 0; i < length; ++i)
+                    expected[i] = a[i + 1] - b[i + 1];
+                RequireNear(result, expected);
+
+                kernels->m_Multiply(result.data(), a.data() + 1, b.data() + 1, length);
+                for (AmSize i = 0; i < length; ++i)
+                    expected[i] = a[i + 1] * b[i + 1];
+                RequireNear(result, expected);
+
+                kernels->m_ScalarMultiply(a.data() + 1, result.data(), 0.25f, length);
+                for (AmSize i = 0; i < length; ++i)
+                    expected[i] = a[i + 1] * 0.25f;
+                RequireNear(result, expected);
+
+                std::copy_n(b.begin() + 1, length, result.begin());
+                kernels->m_ScalarMultiplyAccumulate(a.data() + 1, result.data(), 0.25f, length);
+                for (AmSize i = 0; i < length; ++i)
+                    expected[i] = b[i + 1] + a[i + 1] * 0.25f;
+                RequireNear(result, expected);
+
+                std::vector<AmReal32> re(c.begin() + 1, c.begin() + 1 + length), im(d.begin() + 1, d.begin() + 1 + length);
+                std::vector<AmReal32> expectedRe(length), expectedIm(length);
+                kernels->m_ComplexMultiplyAccumulate(re.data(), im.data(), a.data() + 1, b.data() + 1, c.data() + 1, d.data() + 1, length);
+                for (AmSize i = 0; i < length; ++i)
+                {
+                    expectedRe[i] = c[i + 1] + a[i + 1] * c[i + 1] - b[i + 1] * d[i + 1];
+                    expectedIm[i] = d[i + 1] + a[i + 1] * d[i + 1] + b[i + 1] * c[i + 1];
+                }
+                RequireNear(re, expectedRe);
+                RequireNear(im, expectedIm);
+
+                std::vector<AmReal32> interleaved(length * 2), expectedInterleaved(length * 2);
+                kernels->m_InterleaveStereo(a.data() + 1, b.data() + 1, interleaved.data(), length);
+                for (AmSize i = 0; i < length; ++i)
+                {
+                    expectedInterleaved[2 * i] = a[i + 1];
+                    expectedInterleaved[2 * i + 1] = b[i + 1];
+                }
+                RequireNear(interleaved, expectedInterleaved);
+            }
+        }
+
+        DYNAMIC_SECTION(kernels->m_Name << " biquad section matches the scalar results")
+        {
+            constexpr AmSize kLanes = 16;
+            constexpr AmSize kFrames = 37;
+
+            const auto input = Noise(kLanes * kFrames, 5);
+
+            for (bool interpolating : { false, true })
+            {
+                AmReal32 coefficients[5][kLanes], steps[5][kLanes], state[2][kLanes] = {};
+                for (AmSize lane = 0; lane < kLanes; ++lane)
+                {
+                    const AmReal32 t = static_cast<AmReal32>(lane) / kLanes;
+                    coefficients[0][lane] = 0.2f + 0.1f * t;
+                    coefficients[1][lane] = 0.4f;
+                    coefficients[2][lane] = 0.2f - 0.1f * t;
+                    coefficients[3][lane] = -0.5f + 0.2f * t;
+                    coefficients[4][lane] = 0.1f;
+
+                    for (auto& step : steps)
+                        step[lane] = interpolating ? 1e-4f * (t - 0.5f) : 0.0f;
+                }
+
+                std::vector<AmReal32> samples(input);
+                kernels->m_BiquadSection(
+                    samples.data(), kLanes, kFrames, coefficients[0], interpolating ? steps[0] : nullptr, state[0], kLanes);
+
+                std::vector<AmReal32> expected(input);
+                for (AmSize lane = 0; lane < kLanes; ++lane)
+                {
+                    const AmReal32 t = static_cast<AmReal32>(lane) / kLanes;
+                    const AmReal32 step = interpolating ? 1e-4f * (t - 0.5f) : 0.0f;
+
+                    AmReal32 a0 = 0.2f + 0.1f * t, a1 = 0.4f, a2 = 0.2f - 0.1f * t, b1 = -0.5f + 0.2f * t, b2 = 0.1f;
+                    AmReal32 s1 = 0.0f, s2 = 0.0f;
+
+                    for (AmSize i = 0; i < kFrames; ++i)
+                    {
+                        AmReal32& x = expected[i * kLanes + lane];
+                        const AmReal32 y = a0 * x + s1;
+                        s1 = a1 * x - b1 * y + s2;
+                        s2 = a2 * x - b2 * y;
+                        x = y;
+
+                        a0 += step;
+                        a1 += step;
+                        a2 += step;
+                        b1 += step;
+                        b2 += step;
+                    }
+
+                    REQUIRE(std::abs(state[0][lane] - s1) < 1e-5f);
+                    REQUIRE(std::abs(state[1][lane] - s2) < 1e-5f);
+                    REQUIRE(std::abs(coefficients[0][lane] - a0) < 1e-5f);
+                }
+
+                RequireNear(samples, expected);
+            }
+        }
+
+        DYNAMIC_SECTION(kernels->m_Name << " matrix multiplication matches the scalar results")
+        {
+            for (AmSize count : { AmSize(1), AmSize(3), AmSize(5), kAmMaxSimdMatrixSize })
+            {
+                const auto matrix = Noise(count * count, 6);
+
+                std::vector<std::vector<AmReal32>> channels, expected;
+                AmReal32* pointers[kAmMaxSimdMatrixSize];
+
+                for (AmSize c = 0; c < count; ++c)
+                {
+                    channels.push_back(Noise(kSimdTestLength, 7 + static_cast<AmUInt32>(c)));
+                    expected.emplace_back(kSimdTestLength, 0.0f);
+                }
+
+                for (AmSize r = 0; r < count; ++r)
+                    for (AmSize c = 0; c < count; ++c)
+                        for (AmSize i = 0; i < kSimdTestLength; ++i)
+                            expected[r][i] += matrix[r * count + c] * channels[c][i];
+
+                for (AmSize c = 0; c < count; ++c)
+                    pointers[c] = channels[c].data();
+
+                kernels->m_MatrixMultiply(pointers, matrix.data(), count, kSimdTestLength);
+
+                for (AmSize c = 0; c < count; ++c)
+                    RequireNear(channels[c], expected[c]);
+            }
+        }
+    }
+}
+
+TEST_CASE("Ambisonic Orientation Processor Tests", "[simd][ambisonics][amplitude]")
+{
+    constexpr AmUInt32 kOrder = 3;
+    constexpr AmUInt32 kFrames = 67;
+
+    AmbisonicOrientationProcessor processor;
+    processor.Configure(kOrder, true);
+    processor.SetOrientation(Orientation(0.7f, -0.3f, 0.2f));
+
+    BFormat block;
+    block.Configure(kOrder, true, kFrames);
+
+    const AmUInt32 channelCount = block.GetChannelCount();
+    for (AmUInt32 c = 0; c < channelCount; ++c)
+    {
+        const auto noise = Noise(kFrames, 10 + c);
+        std::copy(noise.begin(), noise.end(), block.GetBufferChannel(c).begin());
+    }
+
+    BFormat input;
+    input.Configure(kOrder, true, kFrames);
+    for (AmUInt32 c = 0; c < channelCount; ++c)
+        std::copy_n(block.GetBufferChannel(c).begin(), kFrames, input.GetBufferChannel(c).begin());
+
+    processor.Process(&block, kFrames);
+
+    SECTION("every frame is rotated independently")
+    {
+        BFormat frame;
+        frame.Configure(kOrder, true, 1);
+
+        for (AmUInt32 i = 0; i < kFrames; ++i)
+        {
+            for (AmUInt32 c = 0; c < channelCount; ++c)
+                frame.GetBufferChannel(c)[0] = input.GetBufferChannel(c)[i];
+
+            processor.Process(&frame, 1);
+
+            for (AmUInt32 c = 0; c < channelCount; ++c)
+                REQUIRE(std::abs(frame.GetBufferChannel(c)[0] - block.GetBufferChannel(c)[i]) < 1e-5f);
+        }
+    }
+
+    SECTION("the first order is rotated without changing its energy")
+    {
+        for (AmUInt32 i = 0; i < kFrames; ++i)
+        {
+            REQUIRE(block.GetBufferChannel(eBFormatChannel_W)[i] == input.GetBufferChannel(eBFormatChannel_W)[i]);
+
+            AmReal32 before = 0.0f, after = 0.0f;
+            for (AmUInt32 c : { eBFormatChannel_X, eBFormatChannel_Y, eBFormatChannel_Z })
+            {
+                before += input.GetBufferChannel(c)[i] * input.GetBufferChannel(c)[i];
+                after += block.GetBufferChannel(c)[i] * block.GetBufferChannel(c)[i];
+            }
+
+            REQUIRE(std::abs(before - after) < 1e-4f);
+        }
+    }
+}
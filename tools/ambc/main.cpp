@@ -0,0 +1,355 @@
+// Copyright (c) 2024-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdarg>
+#include <iostream>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+#include "attenuation_definition_generated.h"
+#include "collection_definition_generated.h"
+#include "compiled_sound_bank_definition_generated.h"
+#include "effect_definition_generated.h"
+#include "event_definition_generated.h"
+#include "rtpc_definition_generated.h"
+#include "sound_bank_definition_generated.h"
+#include "sound_definition_generated.h"
+#include "switch_container_definition_generated.h"
+#include "switch_definition_generated.h"
+
+using namespace SparkyStudios::Audio::Amplitude;
+
+struct ProcessingState
+{
+    bool verbose = false;
+};
+
+/**
+ * @brief The alignment of each definition in the compiled sound bank, so they can be used in place.
+ */
+static constexpr AmSize kDefinitionAlignment = 8;
+
+static constexpr char kProjectDirAttenuators[] = "attenuators";
+static constexpr char kProjectDirCollections[] = "collections";
+static constexpr char kProjectDirEffects[] = "effects";
+static constexpr char kProjectDirEvents[] = "events";
+static constexpr char kProjectDirRTPC[] = "rtpc";
+static constexpr char kProjectDirSoundbanks[] = "soundbanks";
+static constexpr char kProjectDirSounds[] = "sounds";
+static constexpr char kProjectDirSwitchContainers[] = "switch_containers";
+static constexpr char kProjectDirSwitches[] = "switches";
+
+typedef flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> FileNameList;
+typedef std::vector<flatbuffers::Offset<CompiledAssetDefinition>> CompiledAssetList;
+
+/**
+ * @brief The log function, used in verbose mode.
+ *
+ * @param output The output stream.
+ * @param fmt The message format.
+ * @param ... The arguments.
+ */
+static void log(FILE* output, const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+#if defined(AM_WCHAR_SUPPORTED)
+    vfwprintf(output, AM_STRING_TO_OS_STRING(fmt), args);
+#else
+    vfprintf(output, fmt, args);
+#endif
+    va_end(args);
+}
+
+/**
+ * @brief Reads the entire content of a file.
+ *
+ * @param path The path to the file.
+ * @param data The read data.
+ *
+ * @return Whether the file has been read successfully.
+ */
+static bool readFile(const std::filesystem::path& path, std::vector<AmUInt8>& data)
+{
+    DiskFile file(path);
+    if (!file.IsValid())
+        return false;
+
+    data.resize(file.Length());
+    return file.Read(data.data(), data.size()) == data.size();
+}
+
+/**
+ * @brief Packs the definitions of the given assets in the compiled sound bank.
+ *
+ * @tparam T The type of the asset definition.
+ *
+ * @param builder The compiled sound bank builder.
+ * @param directory The directory containing the asset definitions.
+ * @param filenames The asset definition files, as listed in the sound bank definition.
+ * @param state The processing state.
+ *
+ * @return The offset of the list of compiled assets, sorted by ID, or a null offset on failure.
+ */
+template<typename T>
+static flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<CompiledAssetDefinition>>> compileAssets(
+    flatbuffers::FlatBufferBuilder& builder, const std::filesystem::path& directory, const FileNameList* filenames, const ProcessingState& state)
+{
+    CompiledAssetList assets;
+
+    if (filenames != nullptr)
+    {
+        std::vector<AmUInt8> data;
+
+        for (const auto* filename : *filenames)
+        {
+            const auto path = directory / filename->str();
+
+            if (!readFile(path, data))
+            {
+                log(stderr, "Unable to read the asset definition: " AM_OS_CHAR_FMT "\n", path.c_str());
+                return 0;
+            }
+
+            flatbuffers::Verifier verifier(data.data(), data.size());
+            if (!verifier.VerifyBuffer<T>(nullptr))
+            {
+                log(stderr, "Invalid asset definition: " AM_OS_CHAR_FMT "\n", path.c_str());
+                return 0;
+            }
+
+            if (state.verbose)
+                log(stdout, "Adding asset: " AM_OS_CHAR_FMT "\n", path.c_str());
+
+            const AmObjectID id = flatbuffers::GetRoot<T>(data.data())->id();
+
+            builder.ForceVectorAlignment(data.size(), sizeof(AmUInt8), kDefinitionAlignment);
+            const auto dataOffset = builder.CreateVector(data);
+            const auto filenameOffset = builder.CreateString(filename);
+
+            assets.push_back(CreateCompiledAssetDefinition(builder, id, filenameOffset, dataOffset));
+        }
+    }
+
+    return builder.CreateVectorOfSortedTables(&assets);
+}
+
+static int compile(const std::filesystem::path& projectPath, const std::filesystem::path& bankPath, const std::filesystem::path& outputPath, const ProcessingState& state)
+{
+    std::vector<AmUInt8> bankData;
+    if (!readFile(bankPath, bankData))
+    {
+        log(stderr, "Unable to read the sound bank: " AM_OS_CHAR_FMT "\n", bankPath.c_str());
+        return EXIT_FAILURE;
+    }
+
+    if (flatbuffers::Verifier verifier(bankData.data(), bankData.size()); !VerifySoundBankDefinitionBuffer(verifier))
+    {
+        log(stderr, "Invalid sound bank: " AM_OS_CHAR_FMT "\n", bankPath.c_str());
+        return EXIT_FAILURE;
+    }
+
+    if (state.verbose)
+        log(stdout, "Compiling sound bank: " AM_OS_CHAR_FMT "\n", bankPath.c_str());
+
+    const SoundBankDefinition* definition = GetSoundBankDefinition(bankData.data());
+
+    flatbuffers::FlatBufferBuilder builder;
+
+    const auto switchContainers =
+        compileAssets<SwitchContainerDefinition>(builder, projectPath / kProjectDirSwitchContainers, definition->switch_containers(), state);
+    const auto collections = compileAssets<CollectionDefinition>(builder, projectPath / kProjectDirCollections, definition->collections(), state);
+    const auto sounds = compileAssets<SoundDefinition>(builder, projectPath / kProjectDirSounds, definition->sounds(), state);
+    const auto events = compileAssets<EventDefinition>(builder, projectPath / kProjectDirEvents, definition->events(), state);
+    const auto attenuators = compileAssets<AttenuationDefinition>(builder, projectPath / kProjectDirAttenuators, definition->attenuators(), state);
+    const auto switches = compileAssets<SwitchDefinition>(builder, projectPath / kProjectDirSwitches, definition->switches(), state);
+    const auto rtpc = compileAssets<RtpcDefinition>(builder, projectPath / kProjectDirRTPC, definition->rtpc(), state);
+    const auto effects = compileAssets<EffectDefinition>(builder, projectPath / kProjectDirEffects, definition->effects(), state);
+
+    if (switchContainers.IsNull() || collections.IsNull() || sounds.IsNull() || events.IsNull() || attenuators.IsNull() ||
+        switches.IsNull() || rtpc.IsNull() || effects.IsNull())
+        return EXIT_FAILURE;
+
+    builder.ForceVectorAlignment(bankData.size(), sizeof(AmUInt8), kDefinitionAlignment);
+    const auto bank = builder.CreateVector(bankData);
+
+    FinishCompiledSoundBankDefinitionBuffer(
+        builder,
+        CreateCompiledSoundBankDefinition(builder, bank, switchContainers, collections, sounds, events, attenuators, switches, rtpc, effects));
+
+    DiskFile outputFile(outputPath, eFileOpenMode_Write);
+    if (!outputFile.IsValid() || outputFile.Write(builder.GetBufferPointer(), builder.GetSize()) != builder.GetSize())
+    {
+        log(stderr, "Unable to write the compiled sound bank: " AM_OS_CHAR_FMT "\n", outputPath.c_str());
+        return EXIT_FAILURE;
+    }
+
+    if (state.verbose)
+        log(stdout, "Compiled sound bank written to: " AM_OS_CHAR_FMT "\n", outputPath.c_str());
+
+    return EXIT_SUCCESS;
+}
+
+static int process(const AmOsString& inDirectory, const AmOsString& outDirectory, const ProcessingState& state)
+{
+    const std::filesystem::path projectPath(inDirectory);
+    const std::filesystem::path soundBanksPath = projectPath / kProjectDirSoundbanks;
+    const std::filesystem::path outputPath = outDirectory.empty() ? soundBanksPath : std::filesystem::path(outDirectory);
+
+    if (!exists(soundBanksPath) || !is_directory(soundBanksPath))
+    {
+        log(stderr, "Invalid project path. The \"%s\" directory is missing.\n", kProjectDirSoundbanks);
+        return EXIT_FAILURE;
+    }
+
+    if (!exists(outputPath))
+        create_directories(outputPath);
+
+    if (state.verbose)
+        log(stdout, "Processing project directory: " AM_OS_CHAR_FMT "\n", projectPath.c_str());
+
+    for (const auto& file : std::filesystem::directory_iterator(soundBanksPath))
+    {
+        if (file.is_directory() || file.path().extension() != AM_OS_STRING(".ambank"))
+            continue;
+
+        auto outputFile = outputPath / file.path().filename();
+        outputFile.replace_extension(AM_OS_STRING(".amcbank"));
+
+        if (const int res = compile(projectPath, file.path(), outputFile, state); res != EXIT_SUCCESS)
+            return res;
+    }
+
+    if (state.verbose)
+        log(stdout, "Sound banks compiled successfully.\n");
+
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char* argv[])
+{
+    MemoryManager::Initialize();
+
+    char *inDirectory = nullptr, *outDirectory = nullptr;
+    bool noLogo = false, needHelp = false;
+    ProcessingState state;
+
+    for (int i = 1; i < argc; i++)
+    {
+#if defined(AM_WINDOWS_VERSION)
+        if (*argv[i] == '-' || *argv[i] == '/')
+#else
+        if (*argv[i] == '-')
+#endif // AM_WINDOWS_VERSION
+        {
+            switch (argv[i][1])
+            {
+            case 'H':
+            case 'h':
+                needHelp = true;
+                state.verbose = true;
+                break;
+
+            case 'O':
+            case 'o':
+                noLogo = true;
+                break;
+
+            case 'Q':
+            case 'q':
+                state.verbose = false;
+                noLogo = true;
+                break;
+
+            case 'V':
+            case 'v':
+                state.verbose = true;
+                break;
+
+            default:
+                log(stderr, "\nInvalid option: %s. Use -h for help.\n", argv[i]);
+                return EXIT_FAILURE;
+            }
+        }
+        else if (!inDirectory)
+        {
+            const auto len = strlen(argv[i]);
+            inDirectory = static_cast<char*>(ampoolmalloc(eMemoryPoolKind_Default, len + 1));
+
+            std::memcpy(inDirectory, argv[i], len);
+            inDirectory[len] = '\0';
+        }
+        else if (!outDirectory)
+        {
+            const auto len = strlen(argv[i]);
+            outDirectory = static_cast<char*>(ampoolmalloc(eMemoryPoolKind_Default, len + 1));
+
+            std::memcpy(outDirectory, argv[i], len);
+            outDirectory[len] = '\0';
+        }
+        else
+        {
+            log(stderr, "\nUnknown extra argument: %s !\n", argv[i]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (!inDirectory)
+    {
+        needHelp = true;
+    }
+
+    if (!noLogo)
+    {
+        // clang-format off
+        log(stdout, "\n");
+        log(stdout, "Amplitude Sound Bank Compiler (ambc)\n");
+        log(stdout, "Copyright (c) 2024-present Sparky Studios - Licensed under Apache 2.0\n");
+        log(stdout, "=====================================================================\n");
+        log(stdout, "\n");
+        // clang-format on
+    }
+
+    if (needHelp)
+    {
+        // clang-format off
+        log(stdout, "Usage: ambc [OPTIONS] PROJECT_DIR [OUTPUT_DIR]\n");
+        log(stdout, "\n");
+        log(stdout, "Compiles each sound bank of a built project into a single .amcbank file, packing the\n");
+        log(stdout, "definitions of all the assets it references. Compiled sound banks are written in the\n");
+        log(stdout, "soundbanks directory of the project, unless an output directory is given.\n");
+        log(stdout, "\n");
+        log(stdout, "Options:\n");
+        log(stdout, "    -[hH]:        \tDisplay this help message.\n");
+        log(stdout, "    -[oO]:        \tHide logo and copyright notice.\n");
+        log(stdout, "    -[qQ]:        \tQuiet mode. Shutdown all messages.\n");
+        log(stdout, "    -[vV]:        \tVerbose mode. Display all messages.\n");
+        log(stdout, "\n");
+        log(stdout, "Example: ambc /path/to/project/\n");
+        log(stdout, "\n");
+        // clang-format on
+
+        return EXIT_SUCCESS;
+    }
+
+    const int res = process(
+        AM_STRING_TO_OS_STRING(inDirectory), outDirectory ? AM_STRING_TO_OS_STRING(outDirectory) : AmOsString(), state);
+
+    ampoolfree(eMemoryPoolKind_Default, inDirectory);
+
+    if (outDirectory)
+        ampoolfree(eMemoryPoolKind_Default, outDirectory);
+
+    return res;
+}
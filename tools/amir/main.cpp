@@ -24,6 +24,7 @@
 
 #include <Core/Codecs/WAV/Codec.h>
 #include <DSP/Filters/BiquadResonantFilter.h>
+#include <DSP/ImpulseResponse.h>
 #include <Utils/Utils.h>
 
 using namespace SparkyStudios::Audio::Amplitude;
@@ -37,10 +38,16 @@ struct ProcessingState
         bool enabled = false;
         AmUInt32 targetSampleRate = 44100;
     } resampling;
+    struct
+    {
+        bool enabled = false;
+        AmUInt32 length = 0;
+    } minimumPhase;
     HRIRSphereDatasetModel datasetModel = eHRIRSphereDatasetModel_SOFA;
+    AmUInt32 spectrumBlockSize = 0;
 };
 
-static constexpr AmUInt32 kCurrentVersion = 1;
+static constexpr AmUInt32 kCurrentVersion = 3;
 
 /**
  * @brief The log function, used in verbose mode.
@@ -142,6 +149,26 @@ void estimateITD(HRIRSphereVertex& vertex, AmSize irLength, AmUInt32 sampleRate)
     vertex.m_RightDelay = itd > 0.0f ? itd : 0.0f;
 }
 
+// Converts the HRIRs of the vertex to minimum phase, and truncates them to the target length.
+// The ITD must be estimated before, since minimum-phase HRIRs lose it.
+void makeMinimumPhase(HRIRSphereVertex& vertex, AmSize irLength, const ProcessingState& state)
+{
+    if (!state.minimumPhase.enabled)
+        return;
+
+    const AmSize length = AM_MIN(irLength, static_cast<AmSize>(state.minimumPhase.length));
+
+    // Fade out the last samples, so the truncation doesn't add clicks
+    const AmSize fadeLength = AM_MAX(length / 8, AmSize(1));
+
+    for (auto* ir : { &vertex.m_LeftIR, &vertex.m_RightIR })
+    {
+        ImpulseResponse::MakeMinimumPhase(ir->data(), irLength, ir->data(), length);
+        ImpulseResponse::FadeOut(ir->data(), length, fadeLength);
+        ir->resize(length);
+    }
+}
+
 void triangulate(const std::vector<HRIRSphereVertex>& vertices, std::vector<AmUInt32>& indices, bool debug = false)
 {
     std::vector<ch_vertex> ch_vertices;
@@ -423,6 +450,7 @@ int process(const AmOsString& inFileName, const AmOsString& outFileName, const P
                 HRIRSphereVertex vertex;
                 processVertex(buffer, position, irLength, sampleRate, i != 0, vertex);
                 estimateITD(vertex, irLength, sampleRate);
+                makeMinimumPhase(vertex, irLength, state);
 
                 vertices.push_back(vertex);
 
@@ -486,6 +514,7 @@ int process(const AmOsString& inFileName, const AmOsString& outFileName, const P
                     HRIRSphereVertex vertex;
                     processVertex(buffer, position, irLength, sampleRate, false, vertex);
                     estimateITD(vertex, irLength, sampleRate);
+                    makeMinimumPhase(vertex, irLength, state);
 
                     vertices.push_back(vertex);
 
@@ -500,6 +529,9 @@ int process(const AmOsString& inFileName, const AmOsString& outFileName, const P
         mysofa_free(hrtf);
     }
 
+    if (state.minimumPhase.enabled)
+        irLength = AM_MIN(irLength, static_cast<AmUInt64>(state.minimumPhase.length));
+
     log(stdout, "Building mesh...\n");
     triangulate(vertices, indices, state.debug);
 
@@ -513,10 +545,16 @@ int process(const AmOsString& inFileName, const AmOsString& outFileName, const P
     packageFile.Write32(irLength);
     packageFile.Write32(static_cast<AmUInt32>(vertices.size()));
     packageFile.Write32(static_cast<AmUInt32>(indices.size()));
+    packageFile.Write32(state.spectrumBlockSize);
+    packageFile.Write8(state.minimumPhase.enabled ? 1 : 0);
 
     // Indices
     packageFile.Write(reinterpret_cast<AmConstUInt8Buffer>(indices.data()), indices.size() * sizeof(AmUInt32));
 
+    const AmSize spectrumSize = state.spectrumBlockSize > 0 ? MultiConvolver::GetSpectrumSize(irLength, state.spectrumBlockSize) : 0;
+
+    std::vector<AmReal32> spectrum(spectrumSize);
+
     // Vertices
     for (const auto& vertex : vertices)
     {
@@ -525,6 +563,15 @@ int process(const AmOsString& inFileName, const AmOsString& outFileName, const P
         packageFile.Write(reinterpret_cast<AmConstUInt8Buffer>(vertex.m_RightIR.data()), irLength * sizeof(AmReal32));
         packageFile.Write(reinterpret_cast<AmConstUInt8Buffer>(&vertex.m_LeftDelay), sizeof(AmReal32));
         packageFile.Write(reinterpret_cast<AmConstUInt8Buffer>(&vertex.m_RightDelay), sizeof(AmReal32));
+
+        if (spectrumSize == 0)
+            continue;
+
+        MultiConvolver::TransformIR(vertex.m_LeftIR.data(), irLength, state.spectrumBlockSize, spectrum.data());
+        packageFile.Write(reinterpret_cast<AmConstUInt8Buffer>(spectrum.data()), spectrumSize * sizeof(AmReal32));
+
+        MultiConvolver::TransformIR(vertex.m_RightIR.data(), irLength, state.spectrumBlockSize, spectrum.data());
+        packageFile.Write(reinterpret_cast<AmConstUInt8Buffer>(spectrum.data()), spectrumSize * sizeof(AmReal32));
     }
 
     packageFile.Close();
@@ -597,6 +644,29 @@ int main(int argc, char* argv[])
                 state.resampling.targetSampleRate = strtol(argv[++i], argv, 10);
                 break;
 
+            case 'P':
+            case 'p':
+                state.minimumPhase.enabled = true;
+                state.minimumPhase.length = strtol(argv[++i], argv, 10);
+
+                if (state.minimumPhase.length == 0)
+                {
+                    log(stderr, "\nInvalid HRIR length!\n");
+                    return EXIT_FAILURE;
+                }
+                break;
+
+            case 'F':
+            case 'f':
+                state.spectrumBlockSize = strtol(argv[++i], argv, 10);
+
+                if (state.spectrumBlockSize == 0 || NextPowerOf2(state.spectrumBlockSize) != state.spectrumBlockSize)
+                {
+                    log(stderr, "\nInvalid block size! It must be a power of two.\n");
+                    return EXIT_FAILURE;
+                }
+                break;
+
             default:
                 log(stderr, "\nInvalid option: -%c. Use -h for help.\n", **argv);
                 return EXIT_FAILURE;
@@ -630,6 +700,12 @@ int main(int argc, char* argv[])
         needHelp = true;
     }
 
+    if (state.minimumPhase.enabled && state.spectrumBlockSize > 0)
+    {
+        log(stderr, "\nMinimum-phase HRIRs can't be stored as spectra, since their delays are applied when the engine loads them.\n");
+        return EXIT_FAILURE;
+    }
+
     if (!noLogo)
     {
         // clang-format off
@@ -653,6 +729,10 @@ int main(int argc, char* argv[])
         log(stdout, "    -[vV]:        \tVerbose mode. Display all messages.\n");
         log(stdout, "    -[dD]:        \tDebug mode. Will create an obj file with a preview of the sphere shape.\n");
         log(stdout, "    -[rR] freq:   \tResample HRIR data to the target frequency.\n");
+        log(stdout, "    -[pP] length: \tConvert HRIR data to minimum phase, and truncate it to the given length.\n");
+        log(stdout, "                  \tThe interaural time difference is stored separately, and applied by the engine.\n");
+        log(stdout, "    -[fF] size:   \tAlso store the HRIR spectra, partitioned for the given block size.\n");
+        log(stdout, "                  \tThe block size must be a power of two. The engine then skips the HRIR transforms.\n");
         log(stdout, "    -[mM]:        \tThe dataset model to use.\n");
         log(stdout, "                  \tThe default value is 0. The available values are:\n");
         log(stdout, "           0:     \tIRCAM (LISTEN) dataset (http://recherche.ircam.fr/equipes/salles/listen/download.html).\n");
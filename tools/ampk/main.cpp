@@ -14,9 +14,12 @@
 
 #include <cstdarg>
 #include <iostream>
+#include <thread>
 
 #include <SparkyStudios/Audio/Amplitude/Amplitude.h>
 
+#include <zlib.h>
+
 using namespace SparkyStudios::Audio::Amplitude;
 
 struct ProcessingState
@@ -24,9 +27,28 @@ struct ProcessingState
     bool verbose = false;
 
     ePackageFileCompressionAlgorithm compression = ePackageFileCompressionAlgorithm_None;
+
+    AmSize alignment = 1;
+
+    AmUInt32 blockSize = 64 * 1024;
+
+    AmUInt32 threadCount = 0;
+};
+
+/**
+ * @brief The data of a package item, produced by a `ProcessItemTask`.
+ */
+struct ItemData
+{
+    std::filesystem::path path;
+    PackageFileItemDescription description;
+    std::vector<AmUInt8> data;
+    AmUInt64 hash = 0;
+    bool valid = false;
+    bool duplicate = false;
 };
 
-static constexpr AmUInt32 kCurrentVersion = 1;
+static constexpr AmUInt32 kCurrentVersion = 2;
 
 static constexpr char kProjectDirAttenuators[] = "attenuators";
 static constexpr char kProjectDirCollections[] = "collections";
@@ -58,6 +80,113 @@ static void log(FILE* output, const char* fmt, ...)
     va_end(args);
 }
 
+/**
+ * @brief Compresses the item data in independent blocks.
+ *
+ * The compressed data starts with the offset of each compressed block, followed by the end offset
+ * of the last block, all relative to the beginning of the compressed data.
+ *
+ * @param data The uncompressed item data.
+ * @param state The processing state.
+ * @param result The compressed item data.
+ *
+ * @return Whether every block has been compressed.
+ */
+static bool compress(const std::vector<AmUInt8>& data, const ProcessingState& state, std::vector<AmUInt8>& result)
+{
+    const AmSize blockCount = (data.size() + state.blockSize - 1) / state.blockSize;
+
+    std::vector<AmUInt64> offsets(blockCount + 1);
+    std::vector<AmUInt8> blocks;
+
+    AmSize offset = offsets.size() * sizeof(AmUInt64);
+
+    for (AmSize i = 0; i < blockCount; i++)
+    {
+        const AmSize start = i * state.blockSize;
+        const AmSize size = std::min(static_cast<AmSize>(state.blockSize), data.size() - start);
+
+        uLongf compressedSize = compressBound(static_cast<uLong>(size));
+        std::vector<AmUInt8> block(compressedSize);
+
+        if (compress2(block.data(), &compressedSize, data.data() + start, static_cast<uLong>(size), Z_BEST_COMPRESSION) != Z_OK)
+            return false;
+
+        offsets[i] = offset;
+        blocks.insert(blocks.end(), block.begin(), block.begin() + static_cast<std::ptrdiff_t>(compressedSize));
+        offset += compressedSize;
+    }
+
+    offsets[blockCount] = offset;
+
+    result.resize(offsets.size() * sizeof(AmUInt64));
+    std::memcpy(result.data(), offsets.data(), result.size());
+    result.insert(result.end(), blocks.begin(), blocks.end());
+
+    return true;
+}
+
+/**
+ * @brief Computes the 64-bit FNV-1a hash of the given data.
+ *
+ * @param data The data to hash.
+ *
+ * @return The hash of the data.
+ */
+static AmUInt64 hash(const std::vector<AmUInt8>& data)
+{
+    AmUInt64 h = 0xCBF29CE484222325ull;
+
+    for (const AmUInt8 byte : data)
+    {
+        h ^= byte;
+        h *= 0x100000001B3ull;
+    }
+
+    return h;
+}
+
+/**
+ * @brief Reads, hashes and compresses a package item.
+ */
+class ProcessItemTask final : public Thread::AwaitablePoolTask
+{
+public:
+    ProcessItemTask(ItemData* item, const ProcessingState* state)
+        : AwaitablePoolTask()
+        , _item(item)
+        , _state(state)
+    {}
+
+    void AwaitableWork() override
+    {
+        DiskFile diskFile(absolute(_item->path));
+
+        if (diskFile.IsValid())
+        {
+            _item->description.m_Size = diskFile.Length();
+            _item->data.resize(_item->description.m_Size);
+            _item->valid = diskFile.Read(_item->data.data(), _item->description.m_Size) == _item->description.m_Size;
+        }
+
+        if (_item->valid)
+        {
+            _item->hash = hash(_item->data);
+
+            if (_state->compression != ePackageFileCompressionAlgorithm_None)
+            {
+                std::vector<AmUInt8> compressed;
+                _item->valid = compress(_item->data, *_state, compressed);
+                _item->data = std::move(compressed);
+            }
+        }
+    }
+
+private:
+    ItemData* _item;
+    const ProcessingState* _state;
+};
+
 static int process(const AmOsString& inFileName, const AmOsString& outFileName, const ProcessingState& state)
 {
     const std::filesystem::path projectPath(inFileName);
@@ -89,31 +218,21 @@ static int process(const AmOsString& inFileName, const AmOsString& outFileName,
 
     packageFile.Write(reinterpret_cast<AmConstUInt8Buffer>("AMPK"), 4);
     packageFile.Write16(kCurrentVersion);
-    packageFile.Write8(ePackageFileCompressionAlgorithm_None); // TODO: state.compression
+    packageFile.Write8(state.compression);
+    packageFile.Write32(state.compression == ePackageFileCompressionAlgorithm_None ? 0 : state.blockSize);
 
-    AmSize lastOffset = 0;
-    std::vector<AmUInt8> buffer;
-    std::vector<PackageFileItemDescription> items;
+    std::vector<ItemData> items;
 
     const auto appendItem = [&](const std::filesystem::path& file)
     {
         if (state.verbose)
             log(stdout, "Adding item: " AM_OS_CHAR_FMT "\n", file.c_str());
 
-        DiskFile diskFile(absolute(file));
-
-        PackageFileItemDescription item;
+        ItemData& item = items.emplace_back();
         std::string relativePath = relative(absolute(file), projectPath).string();
         std::ranges::replace(relativePath, '\\', '/');
-        item.m_Name = relativePath;
-        item.m_Offset = lastOffset;
-        item.m_Size = diskFile.Length();
-
-        buffer.resize(lastOffset + item.m_Size, 0);
-        diskFile.Read(buffer.data() + lastOffset, item.m_Size);
-
-        items.push_back(item);
-        lastOffset += item.m_Size;
+        item.description.m_Name = relativePath;
+        item.path = file;
     };
 
     for (const auto& directory : projectDirectories)
@@ -135,6 +254,88 @@ static int process(const AmOsString& inFileName, const AmOsString& outFileName,
         appendItem(file);
     }
 
+    // Read, hash and compress the items in parallel
+    {
+        Thread::Pool pool;
+        pool.Init(state.threadCount > 0 ? state.threadCount : AM_MAX(std::thread::hardware_concurrency(), 1u));
+
+        std::vector<std::shared_ptr<ProcessItemTask>> tasks;
+        tasks.reserve(items.size());
+
+        for (auto& item : items)
+        {
+            const auto& task = tasks.emplace_back(std::make_shared<ProcessItemTask>(&item, &state));
+            pool.AddTask(task);
+        }
+
+        for (const auto& task : tasks)
+            task->Await();
+    }
+
+    for (const auto& item : items)
+    {
+        if (item.valid)
+            continue;
+
+        log(stderr, "Unable to read or compress the file " AM_OS_CHAR_FMT ".\n", item.path.c_str());
+        return EXIT_FAILURE;
+    }
+
+    // Compute the header size, so items can be aligned relative to the beginning of the package file
+    AmSize headerSize = 4 + 2 + 1 + 4 + 8;
+    for (const auto& item : items)
+        headerSize += 4 + item.description.m_Name.size() + 8 + 8;
+
+    AmSize lastOffset = 0;
+    AmSize duplicateCount = 0;
+    AmSize savedBytes = 0;
+
+    // Items are laid out in a deterministic order, whatever the order they have been processed in
+    std::unordered_multimap<AmUInt64, const ItemData*> storedItems;
+
+    for (auto& item : items)
+    {
+        // Identical items are stored once, and share the same data in the package
+        const ItemData* original = nullptr;
+
+        const auto range = storedItems.equal_range(item.hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second->description.m_Size == item.description.m_Size && it->second->data == item.data)
+            {
+                original = it->second;
+                break;
+            }
+        }
+
+        if (original != nullptr)
+        {
+            if (state.verbose)
+                log(stdout, "Deduplicating item: " AM_OS_CHAR_FMT "\n", item.path.c_str());
+
+            item.description.m_Offset = original->description.m_Offset;
+            item.duplicate = true;
+
+            duplicateCount++;
+            savedBytes += item.data.size();
+
+            item.data.clear();
+            item.data.shrink_to_fit();
+            continue;
+        }
+
+        if (const AmSize misalignment = (headerSize + lastOffset) % state.alignment; misalignment != 0)
+            lastOffset += state.alignment - misalignment;
+
+        item.description.m_Offset = lastOffset;
+        lastOffset += item.data.size();
+
+        storedItems.emplace(item.hash, &item);
+    }
+
+    if (state.verbose && duplicateCount > 0)
+        log(stdout, "Deduplicated %zu items, saving %zu bytes.\n", duplicateCount, savedBytes);
+
     if (state.verbose)
         log(stdout, "Writing package file: " AM_OS_CHAR_FMT "\n", packagePath.c_str());
 
@@ -142,12 +343,28 @@ static int process(const AmOsString& inFileName, const AmOsString& outFileName,
 
     for (const auto& item : items)
     {
-        packageFile.WriteString(item.m_Name);
-        packageFile.Write64(item.m_Offset);
-        packageFile.Write64(item.m_Size);
+        packageFile.WriteString(item.description.m_Name);
+        packageFile.Write64(item.description.m_Offset);
+        packageFile.Write64(item.description.m_Size);
     }
 
-    packageFile.Write(buffer.data(), buffer.size());
+    // Write the items data in place, releasing each item once written
+    const std::vector<AmUInt8> padding(state.alignment, 0);
+    AmSize writtenBytes = 0;
+
+    for (auto& item : items)
+    {
+        if (item.duplicate)
+            continue;
+
+        packageFile.Write(padding.data(), item.description.m_Offset - writtenBytes);
+        packageFile.Write(item.data.data(), item.data.size());
+
+        writtenBytes = item.description.m_Offset + item.data.size();
+
+        item.data.clear();
+        item.data.shrink_to_fit();
+    }
 
     if (state.verbose)
         log(stdout, "Package file created successfully.\n");
@@ -207,6 +424,33 @@ int main(int argc, char* argv[])
                 }
                 break;
 
+            case 'A':
+            case 'a':
+                state.alignment = strtoull(argv[++i], nullptr, 10);
+
+                if (state.alignment == 0 || (state.alignment & (state.alignment - 1)) != 0)
+                {
+                    log(stderr, "\nInvalid alignment! The alignment must be a power of two.\n");
+                    return EXIT_FAILURE;
+                }
+                break;
+
+            case 'J':
+            case 'j':
+                state.threadCount = static_cast<AmUInt32>(strtoul(argv[++i], nullptr, 10));
+                break;
+
+            case 'B':
+            case 'b':
+                state.blockSize = static_cast<AmUInt32>(strtoul(argv[++i], nullptr, 10));
+
+                if (state.blockSize == 0)
+                {
+                    log(stderr, "\nInvalid block size!\n");
+                    return EXIT_FAILURE;
+                }
+                break;
+
             default:
                 log(stderr, "\nInvalid option: -%c. Use -h for help.\n", **argv);
                 return EXIT_FAILURE;
@@ -265,6 +509,11 @@ int main(int argc, char* argv[])
         log(stdout, "                  \tIf not defined, the resulting package will not be compressed. The available values are:\n");
         log(stdout, "           0:     \tNo compression.\n");
         log(stdout, "           1:     \tZLib compression.\n");
+        log(stdout, "    -[bB]:        \tThe size in bytes of the blocks compressed items are split into. Defaults to 65536.\n");
+        log(stdout, "                  \tSmaller blocks make seeking in compressed items cheaper, at the cost of a lower compression ratio.\n");
+        log(stdout, "    -[aA]:        \tThe alignment in bytes of each item in the package file. Must be a power of two.\n");
+        log(stdout, "                  \tUse the memory page size (e.g. 4096) to allow items to be memory-mapped. Defaults to 1.\n");
+        log(stdout, "    -[jJ]:        \tThe number of threads used to read and compress items. Defaults to the number of CPU cores.\n");
         log(stdout, "\n");
         log(stdout, "Example: ampk -c 1 /path/to/project/ output_package.ampk\n");
         log(stdout, "\n");